@@ -0,0 +1,87 @@
+/**
+ * @file joint_names.h
+ * @brief Joint names shared between waypoints
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMAND_LANGUAGE_JOINT_NAMES_H
+#define TESSERACT_COMMAND_LANGUAGE_JOINT_NAMES_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief Get the interned instance of a list of joint names
+ * @details Every call with an identical list returns the same immutable vector while at least one reference is alive,
+ * so a program with thousands of waypoints for the same manipulator only stores the joint names once.
+ * @param names The joint names
+ * @return The shared immutable joint names
+ */
+std::shared_ptr<const std::vector<std::string>> internJointNames(const std::vector<std::string>& names);
+
+/**
+ * @brief The joint names stored by a waypoint
+ * @details The names are interned and shared between all waypoints with the same joint names. Requesting mutable
+ * access detaches a private copy, and a waypoint holding a private copy re-interns it when it is copied, so copies
+ * never observe each others modifications.
+ */
+class JointNames
+{
+public:
+  JointNames() = default;
+  JointNames(const std::vector<std::string>& names);  // NOLINT(google-explicit-constructor)
+  ~JointNames() = default;
+  JointNames(const JointNames& other);
+  JointNames& operator=(const JointNames& other);
+  JointNames(JointNames&&) = default;
+  JointNames& operator=(JointNames&&) = default;
+
+  /** @brief Replace the joint names with the interned instance of names */
+  void set(const std::vector<std::string>& names);
+
+  /** @brief Get the joint names */
+  const std::vector<std::string>& get() const;
+
+  /** @brief Get mutable access to the joint names, which detaches them from the shared instance */
+  std::vector<std::string>& getMutable();
+
+  /** @brief Check if the joint names are the interned shared instance */
+  bool isShared() const;
+
+  bool operator==(const JointNames& rhs) const;
+  bool operator!=(const JointNames& rhs) const;
+
+private:
+  /** @brief The shared interned names, which is null when the names have been detached */
+  std::shared_ptr<const std::vector<std::string>> shared_;
+  /** @brief The privately owned names after mutable access was requested */
+  std::unique_ptr<std::vector<std::string>> owned_;
+};
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_COMMAND_LANGUAGE_JOINT_NAMES_H
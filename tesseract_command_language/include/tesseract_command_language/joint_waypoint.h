@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_command_language/joint_names.h>
 #include <tesseract_command_language/poly/joint_waypoint_poly.h>
 #include <tesseract_common/utils.h>
 
@@ -88,8 +89,8 @@ public:
 protected:
   /** @brief The name of the waypoint */
   std::string name_;
-  /** @brief The names of the joints */
-  std::vector<std::string> names_;
+  /** @brief The names of the joints, shared with other waypoints using the same joints */
+  JointNames names_;
   /** @brief The position of the joints */
   Eigen::VectorXd position_;
   /** @brief Joint distance below position that is allowed. Each element should be <= 0 */
@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <shared_mutex>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -62,6 +63,18 @@ public:
   using Ptr = std::shared_ptr<ProfileDictionary>;
   using ConstPtr = std::shared_ptr<const ProfileDictionary>;
 
+  /**
+   * @brief Get the version of the profiles
+   * @details A new version is assigned whenever a profile is added or removed. Versions are never reused, not even by
+   * other dictionaries, so equal versions mean the same dictionary with the same profiles.
+   * @return The version of the profiles
+   */
+  std::size_t getVersion() const
+  {
+    std::shared_lock lock(mutex_);
+    return version_;
+  }
+
   /**
    * @brief Check if a profile entry exists
    * @param ns The namesspace to search under
@@ -83,6 +96,7 @@ public:
   void removeProfileEntry(const std::string& ns)
   {
     std::unique_lock lock(mutex_);
+    version_ = nextVersion();
 
     auto it = profiles_.find(ns);
     if (it == profiles_.end())
@@ -111,6 +125,29 @@ public:
                              std::string(std::type_index(typeid(ProfileType)).name()) + "' in namespace '" + ns + "'!");
   }
 
+  /**
+   * @brief Get a profile entry if it exists
+   * @details Unlike hasProfileEntry followed by getProfileEntry this takes the lock once, so the entry can not be
+   * removed in between
+   * @param ns The namespace to search under
+   * @return The profile map associated with the profile entry, or std::nullopt if it does not exist
+   */
+  template <typename ProfileType>
+  std::optional<std::unordered_map<std::string, std::shared_ptr<const ProfileType>>>
+  tryGetProfileEntry(const std::string& ns) const
+  {
+    std::shared_lock lock(mutex_);
+    auto it = profiles_.find(ns);
+    if (it == profiles_.end())
+      return std::nullopt;
+
+    auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
+    if (it2 == it->second.end())
+      return std::nullopt;
+
+    return std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second);
+  }
+
   /**
    * @brief Add a profile
    * @details If the profile entry does not exist it will create one
@@ -131,6 +168,7 @@ public:
       throw std::runtime_error("Adding profile that is a nullptr");
 
     std::unique_lock lock(mutex_);
+    version_ = nextVersion();
     auto it = profiles_.find(ns);
     if (it == profiles_.end())
     {
@@ -197,6 +235,35 @@ public:
     return profile_map.at(profile_name);
   }
 
+  /**
+   * @brief Get a profile by name if it exists
+   * @details Unlike hasProfile followed by getProfile this takes the lock once, so the profile can not be removed in
+   * between
+   * @param ns The namespace to search under
+   * @param profile_name The profile name
+   * @return The profile, or nullptr if it does not exist
+   */
+  template <typename ProfileType>
+  std::shared_ptr<const ProfileType> tryGetProfile(const std::string& ns, const std::string& profile_name) const
+  {
+    std::shared_lock lock(mutex_);
+    auto it = profiles_.find(ns);
+    if (it == profiles_.end())
+      return nullptr;
+
+    auto it2 = it->second.find(std::type_index(typeid(ProfileType)));
+    if (it2 == it->second.end())
+      return nullptr;
+
+    const auto& profile_map =
+        std::any_cast<const std::unordered_map<std::string, std::shared_ptr<const ProfileType>>&>(it2->second);
+    auto it3 = profile_map.find(profile_name);
+    if (it3 == profile_map.end())
+      return nullptr;
+
+    return it3->second;
+  }
+
   /**
    * @brief Remove a profile
    * @param profile_name The profile to be removed
@@ -205,6 +272,7 @@ public:
   void removeProfile(const std::string& ns, const std::string& profile_name)
   {
     std::unique_lock lock(mutex_);
+    version_ = nextVersion();
     auto it = profiles_.find(ns);
     if (it == profiles_.end())
       return;
@@ -219,12 +287,17 @@ public:
   void clear()
   {
     std::unique_lock lock(mutex_);
+    version_ = nextVersion();
     profiles_.clear();
   }
 
 protected:
   std::unordered_map<std::string, std::unordered_map<std::type_index, std::any>> profiles_;
+  std::size_t version_{ nextVersion() };
   mutable std::shared_mutex mutex_;
+
+  /** @brief Get a version no dictionary has used yet */
+  static std::size_t nextVersion();
 };
 }  // namespace tesseract_planning
 
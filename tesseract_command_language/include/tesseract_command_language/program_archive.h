@@ -0,0 +1,94 @@
+/**
+ * @file program_archive.h
+ * @brief A compact binary archive of a composite instruction
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_COMMAND_LANGUAGE_PROGRAM_ARCHIVE_H
+#define TESSERACT_COMMAND_LANGUAGE_PROGRAM_ARCHIVE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/composite_instruction.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A compact binary archive of a composite instruction
+ *
+ * The Boost archives of tesseract_common::Serialization write the class information of every type erased instruction
+ * and waypoint and the joint names of every waypoint. This archive stores each distinct string, list of joint names
+ * and manipulator info once and refers to them by index, and stores the values of all waypoints in a single packed
+ * array of doubles. Composite instructions, move instructions and the state, joint and cartesian waypoints are encoded
+ * directly, any other instruction or waypoint type and the user data of composite instructions are embedded as Boost
+ * binary archives so every program round trips.
+ *
+ * Like the Boost archives the profile overrides are not stored. The archive uses the byte order of the machine which
+ * wrote it and reading an archive written with a different byte order throws.
+ */
+struct ProgramArchive
+{
+  /**
+   * @brief Encode a program
+   * @param program The program
+   * @return The archive
+   */
+  static std::vector<std::uint8_t> toArchiveBinaryData(const CompositeInstruction& program);
+
+  /**
+   * @brief Decode a program
+   * @details This throws if the data is not a valid archive
+   * @param data The archive
+   * @param size The size of the archive in bytes
+   * @return The program
+   */
+  static CompositeInstruction fromArchiveBinaryData(const std::uint8_t* data, std::size_t size);
+
+  /** @copydoc fromArchiveBinaryData(const std::uint8_t*, std::size_t) */
+  static CompositeInstruction fromArchiveBinaryData(const std::vector<std::uint8_t>& data);
+
+  /**
+   * @brief Write a program to an archive file
+   * @param program The program
+   * @param file_path The file path
+   * @return True if the file was written, otherwise false
+   */
+  static bool toArchiveFile(const CompositeInstruction& program, const std::string& file_path);
+
+  /**
+   * @brief Read a program from an archive file
+   * @details The file is memory mapped where supported so the values are copied straight from the page cache. This
+   * throws if the file can not be read or is not a valid archive.
+   * @param file_path The file path
+   * @return The program
+   */
+  static CompositeInstruction fromArchiveFile(const std::string& file_path);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_COMMAND_LANGUAGE_PROGRAM_ARCHIVE_H
@@ -30,8 +30,10 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Core>
 #include <vector>
+#include <boost/serialization/version.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_command_language/joint_names.h>
 #include <tesseract_command_language/poly/state_waypoint_poly.h>
 #include <tesseract_common/joint_state.h>
 #include <tesseract_common/utils.h>
@@ -92,6 +94,11 @@ public:
 private:
   /** @brief The name of the waypoint */
   std::string name_;
+  /**
+   * @brief The names of the joints, shared with other waypoints using the same joints
+   * @note The joint names of the base class are only populated while loading an archive before version 1
+   */
+  JointNames names_;
   friend class boost::serialization::access;
   template <class Archive>
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
@@ -99,5 +106,6 @@ private:
 }  // namespace tesseract_planning
 
 TESSERACT_STATE_WAYPOINT_EXPORT_KEY(tesseract_planning, StateWaypoint);
+BOOST_CLASS_VERSION(tesseract_planning::StateWaypoint, 1)
 
 #endif  // TESSERACT_COMMAND_LANGUAGE_JOINT_WAYPOINT_H
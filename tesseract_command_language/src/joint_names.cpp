@@ -0,0 +1,173 @@
+/**
+ * @file joint_names.cpp
+ * @brief Joint names shared between waypoints
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/joint_names.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+struct JointNamesHash
+{
+  std::size_t operator()(const std::vector<std::string>& names) const
+  {
+    std::size_t seed = names.size();
+    for (const auto& name : names)
+      seed ^= std::hash<std::string>{}(name) + 0x9e3779b9 + (seed << 6) + (seed >> 2);
+    return seed;
+  }
+};
+
+struct JointNamesRegistryShard
+{
+  std::mutex mutex;
+  std::unordered_map<std::vector<std::string>, std::weak_ptr<const std::vector<std::string>>, JointNamesHash> names;
+};
+
+/** @brief The registry is split into shards, each with its own mutex, so threads interning names rarely contend */
+struct JointNamesRegistry
+{
+  static constexpr std::size_t SHARD_COUNT{ 16 };
+  std::array<JointNamesRegistryShard, SHARD_COUNT> shards;
+
+  JointNamesRegistryShard& getShard(const std::vector<std::string>& names)
+  {
+    return shards[JointNamesHash{}(names) % SHARD_COUNT];
+  }
+};
+
+JointNamesRegistryShard& getRegistryShard(const std::vector<std::string>& names)
+{
+  // Intentionally leaked so interned names may be released during static destruction
+  static auto* registry = new JointNamesRegistry();
+  return registry->getShard(names);
+}
+
+/** @brief Removes the registry entry when the last waypoint referencing the names is destroyed */
+struct JointNamesDeleter
+{
+  void operator()(const std::vector<std::string>* names) const
+  {
+    {
+      JointNamesRegistryShard& shard = getRegistryShard(*names);
+      std::scoped_lock lock(shard.mutex);
+      auto it = shard.names.find(*names);
+      if (it != shard.names.end() && it->second.expired())
+        shard.names.erase(it);
+    }
+    delete names;  // NOLINT(cppcoreguidelines-owning-memory)
+  }
+};
+
+const std::vector<std::string>& getEmptyJointNames()
+{
+  static const std::vector<std::string> empty;
+  return empty;
+}
+}  // namespace
+
+std::shared_ptr<const std::vector<std::string>> internJointNames(const std::vector<std::string>& names)
+{
+  JointNamesRegistryShard& shard = getRegistryShard(names);
+  std::scoped_lock lock(shard.mutex);
+  auto& entry = shard.names[names];
+  std::shared_ptr<const std::vector<std::string>> interned = entry.lock();
+  if (interned == nullptr)
+  {
+    interned = std::shared_ptr<const std::vector<std::string>>(new std::vector<std::string>(names),
+                                                               JointNamesDeleter());
+    entry = interned;
+  }
+  return interned;
+}
+
+JointNames::JointNames(const std::vector<std::string>& names) : shared_(internJointNames(names)) {}
+
+JointNames::JointNames(const JointNames& other)
+  : shared_((other.owned_ != nullptr) ? internJointNames(*other.owned_) : other.shared_)
+{
+}
+
+JointNames& JointNames::operator=(const JointNames& other)
+{
+  if (this == &other)
+    return *this;
+
+  shared_ = (other.owned_ != nullptr) ? internJointNames(*other.owned_) : other.shared_;
+  owned_.reset();
+  return *this;
+}
+
+void JointNames::set(const std::vector<std::string>& names)
+{
+  if (shared_ != nullptr && *shared_ == names)
+    return;
+
+  shared_ = internJointNames(names);
+  owned_.reset();
+}
+
+const std::vector<std::string>& JointNames::get() const
+{
+  if (owned_ != nullptr)
+    return *owned_;
+
+  if (shared_ != nullptr)
+    return *shared_;
+
+  return getEmptyJointNames();
+}
+
+std::vector<std::string>& JointNames::getMutable()
+{
+  if (owned_ == nullptr)
+  {
+    owned_ = (shared_ != nullptr) ? std::make_unique<std::vector<std::string>>(*shared_) :
+                                    std::make_unique<std::vector<std::string>>();
+    shared_.reset();
+  }
+  return *owned_;
+}
+
+bool JointNames::isShared() const { return (owned_ == nullptr && shared_ != nullptr); }
+
+bool JointNames::operator==(const JointNames& rhs) const
+{
+  const std::vector<std::string>& lhs_names = get();
+  const std::vector<std::string>& rhs_names = rhs.get();
+  return (&lhs_names == &rhs_names || lhs_names == rhs_names);
+}
+// LCOV_EXCL_START
+bool JointNames::operator!=(const JointNames& rhs) const { return !operator==(rhs); }
+// LCOV_EXCL_STOP
+}  // namespace tesseract_planning
@@ -14,9 +14,9 @@ namespace tesseract_planning
 {
 // NOLINTNEXTLINE(modernize-pass-by-value)
 JointWaypoint::JointWaypoint(std::vector<std::string> names, const Eigen::VectorXd& position, bool is_constrained)
-  : names_(std::move(names)), position_(position), is_constrained_(is_constrained)
+  : names_(names), position_(position), is_constrained_(is_constrained)
 {
-  if (static_cast<Eigen::Index>(names_.size()) != position_.size())
+  if (static_cast<Eigen::Index>(names_.get().size()) != position_.size())
     throw std::runtime_error("JointWaypoint: parameters are not the same size!");
 }
 
@@ -24,14 +24,14 @@ JointWaypoint::JointWaypoint(std::vector<std::string> names,
                              const Eigen::VectorXd& position,   // NOLINT(modernize-pass-by-value)
                              const Eigen::VectorXd& lower_tol,  // NOLINT(modernize-pass-by-value)
                              const Eigen::VectorXd& upper_tol)  // NOLINT(modernize-pass-by-value)
-  : names_(std::move(names))
+  : names_(names)
   , position_(position)
   , lower_tolerance_(lower_tol)
   , upper_tolerance_(upper_tol)
   , is_constrained_(true)
 {
-  if (static_cast<Eigen::Index>(names_.size()) != position_.size() || position_.size() != lower_tolerance_.size() ||
-      position_.size() != upper_tolerance_.size())
+  if (static_cast<Eigen::Index>(names_.get().size()) != position_.size() ||
+      position_.size() != lower_tolerance_.size() || position_.size() != upper_tolerance_.size())
     throw std::runtime_error("JointWaypoint: parameters are not the same size!");
 }
 
@@ -55,9 +55,9 @@ JointWaypoint::JointWaypoint(std::initializer_list<std::string> names,
 {
 }
 
-void JointWaypoint::setNames(const std::vector<std::string>& names) { names_ = names; }
-std::vector<std::string>& JointWaypoint::getNames() { return names_; }
-const std::vector<std::string>& JointWaypoint::getNames() const { return names_; }
+void JointWaypoint::setNames(const std::vector<std::string>& names) { names_.set(names); }
+std::vector<std::string>& JointWaypoint::getNames() { return names_.getMutable(); }
+const std::vector<std::string>& JointWaypoint::getNames() const { return names_.get(); }
 
 void JointWaypoint::setPosition(const Eigen::VectorXd& position) { position_ = position; }
 Eigen::VectorXd& JointWaypoint::getPosition() { return position_; }
@@ -88,7 +88,7 @@ bool JointWaypoint::operator==(const JointWaypoint& rhs) const
 
   bool equal = true;
   equal &= (name_ == rhs.name_);
-  equal &= tesseract_common::isIdentical(names_, rhs.names_);
+  equal &= (names_ == rhs.names_);
   equal &= tesseract_common::almostEqualRelativeAndAbs(position_, rhs.position_, max_diff);
   equal &= tesseract_common::almostEqualRelativeAndAbs(lower_tolerance_, rhs.lower_tolerance_, max_diff);
   equal &= tesseract_common::almostEqualRelativeAndAbs(upper_tolerance_, rhs.upper_tolerance_, max_diff);
@@ -103,7 +103,18 @@ template <class Archive>
 void JointWaypoint::serialize(Archive& ar, const unsigned int /*version*/)
 {
   ar& BOOST_SERIALIZATION_NVP(name_);
-  ar& BOOST_SERIALIZATION_NVP(names_);
+  // The names are archived as a plain vector so the archive format does not depend on how they are shared
+  if constexpr (Archive::is_saving::value)
+  {
+    const std::vector<std::string>& names = names_.get();
+    ar& boost::serialization::make_nvp("names_", names);
+  }
+  else
+  {
+    std::vector<std::string> names;
+    ar& boost::serialization::make_nvp("names_", names);
+    names_.set(names);
+  }
   ar& BOOST_SERIALIZATION_NVP(position_);
   ar& BOOST_SERIALIZATION_NVP(upper_tolerance_);
   ar& BOOST_SERIALIZATION_NVP(lower_tolerance_);
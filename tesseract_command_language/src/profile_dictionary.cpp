@@ -0,0 +1,40 @@
+/**
+ * @file profile_dictionary.cpp
+ * @brief This is a profile dictionary for storing all profiles
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_command_language/profile_dictionary.h>
+
+namespace tesseract_planning
+{
+std::size_t ProfileDictionary::nextVersion()
+{
+  static std::atomic<std::size_t> next_version{ 1 };
+  return next_version++;
+}
+}  // namespace tesseract_planning
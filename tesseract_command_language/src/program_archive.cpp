@@ -0,0 +1,778 @@
+/**
+ * @file program_archive.cpp
+ * @brief A compact binary archive of a composite instruction
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <fstream>
+#include <map>
+#include <sstream>
+#include <stdexcept>
+#include <type_traits>
+#include <unordered_map>
+#include <console_bridge/console.h>
+#include <boost/archive/binary_iarchive.hpp>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <boost/serialization/unordered_map.hpp>
+#include <tesseract_common/std_variant_serialization.h>
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/any_poly.h>
+#include <tesseract_common/manipulator_info.h>
+#include <tesseract_command_language/program_archive.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/poly/cartesian_waypoint_poly.h>
+#include <tesseract_command_language/poly/joint_waypoint_poly.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+#include <tesseract_command_language/poly/state_waypoint_poly.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/*
+ * Layout of an archive
+ *
+ * Header: magic, version, byte order mark, reserved and the offset and size of the five sections
+ * Strings: count followed by the length and characters of each distinct string
+ * Joint names: count followed by the number of names and the string index of each name of each distinct list
+ * Manipulators: count followed by each distinct manipulator info as a Boost binary archive
+ * Records: the instruction tree in depth first order, strings, joint names and manipulators are stored by index
+ * Values: the values of all waypoints as a packed array of doubles in the order they are referenced by the records
+ */
+constexpr std::array<char, 4> MAGIC{ 'T', 'P', 'R', 'G' };
+constexpr std::uint32_t VERSION{ 1 };
+constexpr std::uint32_t BYTE_ORDER_MARK{ 0x01020304 };
+constexpr std::size_t NUM_SECTIONS{ 5 };
+constexpr std::size_t HEADER_SIZE{ MAGIC.size() + (3 * sizeof(std::uint32_t)) +
+                                   (NUM_SECTIONS * 2 * sizeof(std::uint64_t)) };
+
+enum class RecordType : std::uint8_t
+{
+  COMPOSITE = 0,
+  MOVE = 1,
+  INSTRUCTION = 2
+};
+
+enum class WaypointType : std::uint8_t
+{
+  NONE = 0,
+  STATE = 1,
+  JOINT = 2,
+  CARTESIAN = 3,
+  WAYPOINT = 4
+};
+
+/** @brief Appends trivially copyable values to a buffer */
+struct Writer
+{
+  std::vector<std::uint8_t> data;
+
+  void writeBytes(const void* bytes, std::size_t size)
+  {
+    const auto* begin = static_cast<const std::uint8_t*>(bytes);
+    data.insert(data.end(), begin, begin + size);
+  }
+
+  template <typename T>
+  void write(const T& value)
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written");
+    writeBytes(&value, sizeof(T));
+  }
+
+  void writeUUID(const boost::uuids::uuid& uuid) { writeBytes(&(*uuid.begin()), uuid.size()); }
+};
+
+/** @brief Reads trivially copyable values from a buffer, throwing if the buffer is too short */
+struct Reader
+{
+  Reader(const std::uint8_t* bytes, std::size_t num_bytes) : data(bytes), size(num_bytes) {}
+
+  const std::uint8_t* data;
+  std::size_t size;
+  std::size_t pos{ 0 };
+
+  const std::uint8_t* readBytes(std::size_t count)
+  {
+    if (count > size - pos)
+      throw std::runtime_error("ProgramArchive: The archive is truncated!");
+
+    const std::uint8_t* bytes = data + pos;
+    pos += count;
+    return bytes;
+  }
+
+  /**
+   * @brief Read the number of elements of a list
+   * @details This throws if the remaining data can not hold that many elements, so a corrupt count does not cause a
+   * large allocation before the data is found to be truncated
+   * @param element_size The minimum size of an element in bytes
+   */
+  std::size_t readCount(std::size_t element_size)
+  {
+    const auto count = static_cast<std::size_t>(read<std::uint32_t>());
+    if (count > (size - pos) / element_size)
+      throw std::runtime_error("ProgramArchive: The archive is truncated!");
+
+    return count;
+  }
+
+  template <typename T>
+  T read()
+  {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be read");
+    T value;
+    std::memcpy(&value, readBytes(sizeof(T)), sizeof(T));
+    return value;
+  }
+
+  boost::uuids::uuid readUUID()
+  {
+    boost::uuids::uuid uuid{};
+    std::memcpy(&(*uuid.begin()), readBytes(uuid.size()), uuid.size());
+    return uuid;
+  }
+};
+
+/** @brief Write a value as a Boost binary archive prefixed by its size */
+template <typename T>
+void writeBoost(Writer& writer, const T& value)
+{
+  std::ostringstream os;
+  {
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << boost::serialization::make_nvp("value", value);
+  }
+  const std::string bytes = os.str();
+  writer.write(static_cast<std::uint64_t>(bytes.size()));
+  writer.writeBytes(bytes.data(), bytes.size());
+}
+
+/** @brief Read a value written by writeBoost */
+template <typename T>
+void readBoost(Reader& reader, T& value)
+{
+  const auto size = static_cast<std::size_t>(reader.read<std::uint64_t>());
+  const auto* bytes = reinterpret_cast<const char*>(reader.readBytes(size));  // NOLINT
+  std::istringstream is(std::string(bytes, size));
+  boost::archive::binary_iarchive ia(is, boost::archive::no_header);
+  ia >> boost::serialization::make_nvp("value", value);
+}
+
+class Encoder
+{
+public:
+  std::vector<std::uint8_t> encode(const CompositeInstruction& program)
+  {
+    writeComposite(program);
+
+    Writer archive;
+    archive.data.reserve(HEADER_SIZE + strings_.data.size() + joint_names_.data.size() + records_.data.size() +
+                         ((values_.size() + 1) * sizeof(double)));
+    archive.writeBytes(MAGIC.data(), MAGIC.size());
+    archive.write(VERSION);
+    archive.write(BYTE_ORDER_MARK);
+    archive.write(std::uint32_t{ 0 });
+
+    Writer strings;
+    strings.write(num_strings_);
+    strings.writeBytes(strings_.data.data(), strings_.data.size());
+
+    Writer joint_names;
+    joint_names.write(num_joint_names_);
+    joint_names.writeBytes(joint_names_.data.data(), joint_names_.data.size());
+
+    Writer manipulators;
+    manipulators.write(static_cast<std::uint32_t>(manipulators_.size()));
+    for (const auto& manipulator : manipulators_)
+      writeBoost(manipulators, manipulator);
+
+    const std::array<const std::vector<std::uint8_t>*, NUM_SECTIONS - 1> sections{
+      &strings.data, &joint_names.data, &manipulators.data, &records_.data
+    };
+    std::uint64_t offset{ HEADER_SIZE };
+    for (const auto* section : sections)
+    {
+      archive.write(offset);
+      archive.write(static_cast<std::uint64_t>(section->size()));
+      offset += section->size();
+    }
+    // The values are aligned so a memory mapped archive can be read without unaligned accesses
+    const std::uint64_t padding = (sizeof(double) - (offset % sizeof(double))) % sizeof(double);
+    offset += padding;
+    archive.write(offset);
+    archive.write(static_cast<std::uint64_t>(values_.size() * sizeof(double)));
+
+    for (const auto* section : sections)
+      archive.writeBytes(section->data(), section->size());
+    archive.data.resize(archive.data.size() + padding, 0);
+    archive.writeBytes(values_.data(), values_.size() * sizeof(double));
+    return std::move(archive.data);
+  }
+
+private:
+  Writer strings_;
+  std::uint32_t num_strings_{ 0 };
+  std::unordered_map<std::string, std::uint32_t> string_indices_;
+
+  Writer joint_names_;
+  std::uint32_t num_joint_names_{ 0 };
+  std::map<std::vector<std::string>, std::uint32_t> joint_names_indices_;
+  /** @brief Interned joint names are shared between waypoints, so most lookups are resolved by address */
+  std::unordered_map<const std::vector<std::string>*, std::uint32_t> joint_names_addresses_;
+
+  std::vector<tesseract_common::ManipulatorInfo> manipulators_;
+  std::uint32_t last_manipulator_{ 0 };
+
+  Writer records_;
+  std::vector<double> values_;
+
+  std::uint32_t addString(const std::string& value)
+  {
+    auto it = string_indices_.find(value);
+    if (it == string_indices_.end())
+    {
+      it = string_indices_.emplace(value, num_strings_++).first;
+      strings_.write(static_cast<std::uint32_t>(value.size()));
+      strings_.writeBytes(value.data(), value.size());
+    }
+    return it->second;
+  }
+
+  std::uint32_t addJointNames(const std::vector<std::string>& names)
+  {
+    auto address_it = joint_names_addresses_.find(&names);
+    if (address_it != joint_names_addresses_.end())
+      return address_it->second;
+
+    auto it = joint_names_indices_.find(names);
+    if (it == joint_names_indices_.end())
+    {
+      it = joint_names_indices_.emplace(names, num_joint_names_++).first;
+      joint_names_.write(static_cast<std::uint32_t>(names.size()));
+      for (const auto& name : names)
+        joint_names_.write(addString(name));
+    }
+    joint_names_addresses_.emplace(&names, it->second);
+    return it->second;
+  }
+
+  std::uint32_t addManipulatorInfo(const tesseract_common::ManipulatorInfo& info)
+  {
+    // Consecutive instructions almost always share the same manipulator info
+    if (!manipulators_.empty() && manipulators_[last_manipulator_] == info)
+      return last_manipulator_;
+
+    auto it = std::find(manipulators_.begin(), manipulators_.end(), info);
+    if (it == manipulators_.end())
+      it = manipulators_.insert(manipulators_.end(), info);
+
+    last_manipulator_ = static_cast<std::uint32_t>(std::distance(manipulators_.begin(), it));
+    return last_manipulator_;
+  }
+
+  void writeString(const std::string& value) { records_.write(addString(value)); }
+
+  void writeJointNames(const std::vector<std::string>& names) { records_.write(addJointNames(names)); }
+
+  void writeManipulatorInfo(const tesseract_common::ManipulatorInfo& info) { records_.write(addManipulatorInfo(info)); }
+
+  void writeValues(const Eigen::Ref<const Eigen::VectorXd>& values)
+  {
+    records_.write(static_cast<std::uint32_t>(values.size()));
+    values_.insert(values_.end(), values.data(), values.data() + values.size());
+  }
+
+  void writeJointState(const tesseract_common::JointState& state)
+  {
+    writeJointNames(state.joint_names);
+    writeValues(state.position);
+    writeValues(state.velocity);
+    writeValues(state.acceleration);
+    writeValues(state.effort);
+    records_.write(state.time);
+  }
+
+  void writeWaypoint(const WaypointPoly& waypoint)
+  {
+    if (waypoint.isNull())
+    {
+      records_.write(WaypointType::NONE);
+      return;
+    }
+
+    if (waypoint.isStateWaypoint() &&
+        waypoint.as<StateWaypointPoly>().getType() == std::type_index(typeid(StateWaypoint)))
+    {
+      const auto& swp = waypoint.as<StateWaypointPoly>().as<StateWaypoint>();
+      records_.write(WaypointType::STATE);
+      writeString(swp.getName());
+      writeJointNames(swp.getNames());
+      writeValues(swp.getPosition());
+      writeValues(swp.getVelocity());
+      writeValues(swp.getAcceleration());
+      writeValues(swp.getEffort());
+      records_.write(swp.getTime());
+      return;
+    }
+
+    if (waypoint.isJointWaypoint() &&
+        waypoint.as<JointWaypointPoly>().getType() == std::type_index(typeid(JointWaypoint)))
+    {
+      const auto& jwp = waypoint.as<JointWaypointPoly>().as<JointWaypoint>();
+      records_.write(WaypointType::JOINT);
+      writeString(jwp.getName());
+      writeJointNames(jwp.getNames());
+      writeValues(jwp.getPosition());
+      writeValues(jwp.getLowerTolerance());
+      writeValues(jwp.getUpperTolerance());
+      records_.write(static_cast<std::uint8_t>(jwp.isConstrained()));
+      return;
+    }
+
+    if (waypoint.isCartesianWaypoint() &&
+        waypoint.as<CartesianWaypointPoly>().getType() == std::type_index(typeid(CartesianWaypoint)))
+    {
+      const auto& cwp = waypoint.as<CartesianWaypointPoly>().as<CartesianWaypoint>();
+      records_.write(WaypointType::CARTESIAN);
+      writeString(cwp.getName());
+      const Eigen::Matrix4d& transform = cwp.getTransform().matrix();
+      values_.insert(values_.end(), transform.data(), transform.data() + transform.size());
+      writeValues(cwp.getLowerTolerance());
+      writeValues(cwp.getUpperTolerance());
+      writeJointState(cwp.getSeed());
+      return;
+    }
+
+    records_.write(WaypointType::WAYPOINT);
+    writeBoost(records_, waypoint);
+  }
+
+  void writeMove(const MoveInstruction& move)
+  {
+    records_.write(RecordType::MOVE);
+    records_.writeUUID(move.getUUID());
+    records_.writeUUID(move.getParentUUID());
+    records_.write(static_cast<std::int32_t>(move.getMoveType()));
+    writeString(move.getDescription());
+    writeString(move.getProfile());
+    writeString(move.getPathProfile());
+    writeManipulatorInfo(move.getManipulatorInfo());
+    writeWaypoint(move.getWaypoint());
+  }
+
+  void writeComposite(const CompositeInstruction& composite)
+  {
+    records_.write(RecordType::COMPOSITE);
+    records_.writeUUID(composite.getUUID());
+    records_.writeUUID(composite.getParentUUID());
+    records_.write(static_cast<std::uint8_t>(composite.getOrder()));
+    writeString(composite.getDescription());
+    writeString(composite.getProfile());
+    writeManipulatorInfo(composite.getManipulatorInfo());
+
+    records_.write(static_cast<std::uint8_t>(!composite.getUserData().empty()));
+    if (!composite.getUserData().empty())
+      writeBoost(records_, composite.getUserData());
+
+    const auto& instructions = composite.getInstructions();
+    records_.write(static_cast<std::uint64_t>(instructions.size()));
+    for (const auto& instruction : instructions)
+    {
+      if (instruction.isCompositeInstruction())
+      {
+        writeComposite(instruction.as<CompositeInstruction>());
+      }
+      else if (instruction.isMoveInstruction() &&
+               instruction.as<MoveInstructionPoly>().getType() == std::type_index(typeid(MoveInstruction)))
+      {
+        writeMove(instruction.as<MoveInstructionPoly>().as<MoveInstruction>());
+      }
+      else
+      {
+        records_.write(RecordType::INSTRUCTION);
+        writeBoost(records_, instruction);
+      }
+    }
+  }
+};
+
+class Decoder
+{
+public:
+  Decoder(const std::uint8_t* data, std::size_t size) : records_(nullptr, 0), values_(nullptr, 0)
+  {
+    Reader header(data, size);
+    if (data == nullptr || size < HEADER_SIZE ||
+        std::memcmp(header.readBytes(MAGIC.size()), MAGIC.data(), MAGIC.size()) != 0)
+      throw std::runtime_error("ProgramArchive: The data is not a program archive!");
+
+    if (header.read<std::uint32_t>() != VERSION)
+      throw std::runtime_error("ProgramArchive: The archive version is not supported!");
+
+    if (header.read<std::uint32_t>() != BYTE_ORDER_MARK)
+      throw std::runtime_error("ProgramArchive: The archive was written with a different byte order!");
+
+    header.read<std::uint32_t>();
+
+    std::array<Reader, NUM_SECTIONS> sections{ Reader(nullptr, 0), Reader(nullptr, 0), Reader(nullptr, 0),
+                                               Reader(nullptr, 0), Reader(nullptr, 0) };
+    for (auto& section : sections)
+    {
+      const auto offset = header.read<std::uint64_t>();
+      const auto section_size = header.read<std::uint64_t>();
+      if (offset > size || section_size > size - offset)
+        throw std::runtime_error("ProgramArchive: The archive is truncated!");
+
+      section = Reader(data + offset, static_cast<std::size_t>(section_size));
+    }
+
+    Reader& strings = sections[0];
+    strings_.resize(strings.readCount(sizeof(std::uint32_t)));
+    for (auto& value : strings_)
+    {
+      const auto length = strings.read<std::uint32_t>();
+      value.assign(reinterpret_cast<const char*>(strings.readBytes(length)), length);  // NOLINT
+    }
+
+    Reader& joint_names = sections[1];
+    joint_names_.resize(joint_names.readCount(sizeof(std::uint32_t)));
+    for (auto& names : joint_names_)
+    {
+      names.resize(joint_names.readCount(sizeof(std::uint32_t)));
+      for (auto& name : names)
+        name = getString(joint_names.read<std::uint32_t>());
+    }
+
+    Reader& manipulators = sections[2];
+    manipulators_.resize(manipulators.readCount(sizeof(std::uint64_t)));
+    for (auto& manipulator : manipulators_)
+      readBoost(manipulators, manipulator);
+
+    records_ = sections[3];
+    values_ = sections[4];
+  }
+
+  CompositeInstruction decode()
+  {
+    if (records_.read<RecordType>() != RecordType::COMPOSITE)
+      throw std::runtime_error("ProgramArchive: The archive does not contain a composite instruction!");
+
+    return readComposite();
+  }
+
+private:
+  std::vector<std::string> strings_;
+  std::vector<std::vector<std::string>> joint_names_;
+  std::vector<tesseract_common::ManipulatorInfo> manipulators_;
+  Reader records_;
+  Reader values_;
+
+  const std::string& getString(std::uint32_t index) const
+  {
+    if (index >= strings_.size())
+      throw std::runtime_error("ProgramArchive: Invalid string index!");
+
+    return strings_[index];
+  }
+
+  const std::string& readString() { return getString(records_.read<std::uint32_t>()); }
+
+  const std::vector<std::string>& readJointNames()
+  {
+    const auto index = records_.read<std::uint32_t>();
+    if (index >= joint_names_.size())
+      throw std::runtime_error("ProgramArchive: Invalid joint names index!");
+
+    return joint_names_[index];
+  }
+
+  const tesseract_common::ManipulatorInfo& readManipulatorInfo()
+  {
+    const auto index = records_.read<std::uint32_t>();
+    if (index >= manipulators_.size())
+      throw std::runtime_error("ProgramArchive: Invalid manipulator info index!");
+
+    return manipulators_[index];
+  }
+
+  void readValues(Eigen::VectorXd& values)
+  {
+    const auto size = static_cast<std::size_t>(records_.read<std::uint32_t>());
+    const std::uint8_t* bytes = values_.readBytes(size * sizeof(double));
+    values.resize(static_cast<Eigen::Index>(size));
+    if (size > 0)
+      std::memcpy(values.data(), bytes, size * sizeof(double));
+  }
+
+  void readJointState(tesseract_common::JointState& state)
+  {
+    state.joint_names = readJointNames();
+    readValues(state.position);
+    readValues(state.velocity);
+    readValues(state.acceleration);
+    readValues(state.effort);
+    state.time = records_.read<double>();
+  }
+
+  void readWaypoint(MoveInstruction& move)
+  {
+    switch (records_.read<WaypointType>())
+    {
+      case WaypointType::NONE:
+        return;
+      case WaypointType::STATE:
+      {
+        StateWaypoint swp;
+        swp.setName(readString());
+        swp.setNames(readJointNames());
+        readValues(swp.getPosition());
+        readValues(swp.getVelocity());
+        readValues(swp.getAcceleration());
+        readValues(swp.getEffort());
+        swp.setTime(records_.read<double>());
+        move.assignStateWaypoint(StateWaypointPoly{ std::move(swp) });
+        return;
+      }
+      case WaypointType::JOINT:
+      {
+        JointWaypoint jwp;
+        jwp.setName(readString());
+        jwp.setNames(readJointNames());
+        readValues(jwp.getPosition());
+        readValues(jwp.getLowerTolerance());
+        readValues(jwp.getUpperTolerance());
+        jwp.setIsConstrained(records_.read<std::uint8_t>() != 0);
+        move.assignJointWaypoint(JointWaypointPoly{ std::move(jwp) });
+        return;
+      }
+      case WaypointType::CARTESIAN:
+      {
+        CartesianWaypoint cwp;
+        cwp.setName(readString());
+        Eigen::Matrix4d& transform = cwp.getTransform().matrix();
+        std::memcpy(transform.data(), values_.readBytes(sizeof(Eigen::Matrix4d)), sizeof(Eigen::Matrix4d));
+        readValues(cwp.getLowerTolerance());
+        readValues(cwp.getUpperTolerance());
+        readJointState(cwp.getSeed());
+        move.assignCartesianWaypoint(CartesianWaypointPoly{ std::move(cwp) });
+        return;
+      }
+      case WaypointType::WAYPOINT:
+      {
+        readBoost(records_, move.getWaypoint());
+        return;
+      }
+    }
+
+    throw std::runtime_error("ProgramArchive: Invalid waypoint type!");
+  }
+
+  MoveInstruction readMove()
+  {
+    // The default constructor does not generate a UUID, which would be overwritten below
+    MoveInstruction move;
+    const boost::uuids::uuid uuid = records_.readUUID();
+    if (!uuid.is_nil())
+      move.setUUID(uuid);
+    move.setParentUUID(records_.readUUID());
+    move.setMoveType(static_cast<MoveInstructionType>(records_.read<std::int32_t>()));
+    move.setDescription(readString());
+    move.setProfile(readString());
+    move.setPathProfile(readString());
+    move.setManipulatorInfo(readManipulatorInfo());
+    readWaypoint(move);
+    return move;
+  }
+
+  CompositeInstruction readComposite()
+  {
+    const boost::uuids::uuid uuid = records_.readUUID();
+    const boost::uuids::uuid parent_uuid = records_.readUUID();
+    const auto order = static_cast<CompositeInstructionOrder>(records_.read<std::uint8_t>());
+    const std::string& description = readString();
+    const std::string& profile = readString();
+
+    CompositeInstruction composite(profile, order, readManipulatorInfo());
+    if (!uuid.is_nil())
+      composite.setUUID(uuid);
+    composite.setParentUUID(parent_uuid);
+    composite.setDescription(description);
+
+    if (records_.read<std::uint8_t>() != 0)
+      readBoost(records_, composite.getUserData());
+
+    const auto size = static_cast<std::size_t>(records_.read<std::uint64_t>());
+    composite.reserve(std::min(size, records_.size - records_.pos));
+    for (std::size_t i = 0; i < size; ++i)
+    {
+      switch (records_.read<RecordType>())
+      {
+        case RecordType::COMPOSITE:
+          composite.emplace_back(readComposite());
+          break;
+        case RecordType::MOVE:
+          composite.emplace_back(MoveInstructionPoly{ readMove() });
+          break;
+        case RecordType::INSTRUCTION:
+        {
+          InstructionPoly instruction;
+          readBoost(records_, instruction);
+          composite.push_back(std::move(instruction));
+          break;
+        }
+        default:
+          throw std::runtime_error("ProgramArchive: Invalid record type!");
+      }
+    }
+
+    return composite;
+  }
+};
+
+/** @brief A read only view of a file, memory mapped where supported */
+class MappedFile
+{
+public:
+  MappedFile(const std::string& file_path)
+  {
+#ifndef _WIN32
+    const int fd = ::open(file_path.c_str(), O_RDONLY);  // NOLINT
+    if (fd < 0)
+      throw std::runtime_error("ProgramArchive: Failed to open file '" + file_path + "'!");
+
+    struct stat st;  // NOLINT(cppcoreguidelines-pro-type-member-init)
+    if (::fstat(fd, &st) != 0)
+    {
+      ::close(fd);
+      throw std::runtime_error("ProgramArchive: Failed to read file '" + file_path + "'!");
+    }
+
+    size_ = static_cast<std::size_t>(st.st_size);
+    if (size_ > 0)
+    {
+      void* mapped = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+      if (mapped == MAP_FAILED)  // NOLINT
+      {
+        ::close(fd);
+        throw std::runtime_error("ProgramArchive: Failed to map file '" + file_path + "'!");
+      }
+      mapped_ = mapped;
+      data_ = static_cast<const std::uint8_t*>(mapped);
+    }
+    ::close(fd);
+#else
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file)
+      throw std::runtime_error("ProgramArchive: Failed to open file '" + file_path + "'!");
+
+    buffer_.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    data_ = buffer_.data();
+    size_ = buffer_.size();
+#endif
+  }
+
+  ~MappedFile()
+  {
+#ifndef _WIN32
+    if (mapped_ != nullptr)
+      ::munmap(mapped_, size_);
+#endif
+  }
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+  MappedFile(MappedFile&&) = delete;
+  MappedFile& operator=(MappedFile&&) = delete;
+
+  const std::uint8_t* data() const { return data_; }
+  std::size_t size() const { return size_; }
+
+private:
+  const std::uint8_t* data_{ nullptr };
+  std::size_t size_{ 0 };
+#ifndef _WIN32
+  void* mapped_{ nullptr };
+#else
+  std::vector<std::uint8_t> buffer_;
+#endif
+};
+}  // namespace
+
+std::vector<std::uint8_t> ProgramArchive::toArchiveBinaryData(const CompositeInstruction& program)
+{
+  return Encoder().encode(program);
+}
+
+CompositeInstruction ProgramArchive::fromArchiveBinaryData(const std::uint8_t* data, std::size_t size)
+{
+  return Decoder(data, size).decode();
+}
+
+CompositeInstruction ProgramArchive::fromArchiveBinaryData(const std::vector<std::uint8_t>& data)
+{
+  return fromArchiveBinaryData(data.data(), data.size());
+}
+
+bool ProgramArchive::toArchiveFile(const CompositeInstruction& program, const std::string& file_path)
+{
+  try
+  {
+    const std::vector<std::uint8_t> data = toArchiveBinaryData(program);
+    std::ofstream file(file_path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));  // NOLINT
+    if (!file)
+    {
+      CONSOLE_BRIDGE_logError("ProgramArchive: Failed to write file '%s'", file_path.c_str());
+      return false;
+    }
+    return true;
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logError("ProgramArchive: Failed to archive program: %s", e.what());
+    return false;
+  }
+}
+
+CompositeInstruction ProgramArchive::fromArchiveFile(const std::string& file_path)
+{
+  MappedFile file(file_path);
+  return fromArchiveBinaryData(file.data(), file.size());
+}
+
+}  // namespace tesseract_planning
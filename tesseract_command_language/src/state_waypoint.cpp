@@ -32,10 +32,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+// NOLINTNEXTLINE(performance-unnecessary-value-param)
 StateWaypoint::StateWaypoint(std::vector<std::string> joint_names, const Eigen::Ref<const Eigen::VectorXd>& position)
-  : tesseract_common::JointState(std::move(joint_names), position)
+  : names_(joint_names)
 {
-  if (static_cast<Eigen::Index>(this->joint_names.size()) != this->position.size())
+  this->position = position;
+  if (static_cast<Eigen::Index>(names_.get().size()) != this->position.size())
     throw std::runtime_error("StateWaypoint: parameters are not the same size!");
 }
 StateWaypoint::StateWaypoint(const std::vector<std::string>& names,
@@ -43,14 +45,14 @@ StateWaypoint::StateWaypoint(const std::vector<std::string>& names,
                              const Eigen::VectorXd& velocity,
                              const Eigen::VectorXd& acceleration,
                              double time)
+  : names_(names)
 {
-  this->joint_names = names;
   this->position = position;
   this->velocity = velocity;
   this->acceleration = acceleration;
   this->time = time;
 
-  if (static_cast<Eigen::Index>(joint_names.size()) != this->position.size() ||
+  if (static_cast<Eigen::Index>(names_.get().size()) != this->position.size() ||
       this->position.size() != this->velocity.size() || this->position.size() != this->acceleration.size())
     throw std::runtime_error("StateWaypoint: parameters are not the same size!");
 }
@@ -75,9 +77,9 @@ StateWaypoint::StateWaypoint(std::initializer_list<std::string> names,
 {
 }
 
-void StateWaypoint::setNames(const std::vector<std::string>& names) { joint_names = names; }
-std::vector<std::string>& StateWaypoint::getNames() { return joint_names; }
-const std::vector<std::string>& StateWaypoint::getNames() const { return joint_names; }
+void StateWaypoint::setNames(const std::vector<std::string>& names) { names_.set(names); }
+std::vector<std::string>& StateWaypoint::getNames() { return names_.getMutable(); }
+const std::vector<std::string>& StateWaypoint::getNames() const { return names_.get(); }
 
 void StateWaypoint::setPosition(const Eigen::VectorXd& position) { this->position = position; }
 Eigen::VectorXd& StateWaypoint::getPosition() { return position; }
@@ -113,7 +115,7 @@ bool StateWaypoint::operator==(const StateWaypoint& rhs) const
   bool equal = true;
   equal &= (name_ == rhs.name_);
   equal &= tesseract_common::almostEqualRelativeAndAbs(position, rhs.position, max_diff);
-  equal &= tesseract_common::isIdentical(joint_names, rhs.joint_names);
+  equal &= (names_ == rhs.names_);
   return equal;
 }
 // LCOV_EXCL_START
@@ -121,10 +123,32 @@ bool StateWaypoint::operator!=(const StateWaypoint& rhs) const { return !operato
 // LCOV_EXCL_STOP
 
 template <class Archive>
-void StateWaypoint::serialize(Archive& ar, const unsigned int /*version*/)
+void StateWaypoint::serialize(Archive& ar, const unsigned int version)
 {
+  // The names are archived as a plain vector so the archive format does not depend on how they are shared. Saving
+  // only reads the waypoint, so concurrent saves of the same waypoint are safe.
   ar& BOOST_SERIALIZATION_NVP(name_);
   ar& boost::serialization::make_nvp("base", boost::serialization::base_object<tesseract_common::JointState>(*this));
+  if constexpr (Archive::is_saving::value)
+  {
+    const std::vector<std::string>& names = names_.get();
+    ar& boost::serialization::make_nvp("names_", names);
+  }
+  else
+  {
+    // Archives before version 1 stored the names in the base class
+    if (version == 0)
+    {
+      names_.set(joint_names);
+      std::vector<std::string>().swap(joint_names);
+    }
+    else
+    {
+      std::vector<std::string> names;
+      ar& boost::serialization::make_nvp("names_", names);
+      names_.set(names);
+    }
+  }
 }
 
 }  // namespace tesseract_planning
@@ -26,6 +26,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <algorithm>
+#include <utility>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -219,19 +220,23 @@ Eigen::VectorXd getJointPosition(const std::vector<std::string>& joint_names, co
 
 bool formatJointPosition(const std::vector<std::string>& joint_names, WaypointPoly& waypoint)
 {
+  // The names are only read through const access so shared waypoint joint names are not detached
   Eigen::VectorXd* jv{ nullptr };
-  std::vector<std::string>* jn{ nullptr };
+  const std::vector<std::string>* jn{ nullptr };
+  JointWaypointPoly* jwp{ nullptr };
+  StateWaypointPoly* swp{ nullptr };
+  tesseract_common::JointState* seed{ nullptr };
   if (waypoint.isJointWaypoint())
   {
-    auto& jwp = waypoint.as<JointWaypointPoly>();
-    jv = &(jwp.getPosition());
-    jn = &(jwp.getNames());
+    jwp = &waypoint.as<JointWaypointPoly>();
+    jv = &(jwp->getPosition());
+    jn = &(std::as_const(*jwp).getNames());
   }
   else if (waypoint.isStateWaypoint())
   {
-    auto& swp = waypoint.as<StateWaypointPoly>();
-    jv = &(swp.getPosition());
-    jn = &(swp.getNames());
+    swp = &waypoint.as<StateWaypointPoly>();
+    jv = &(swp->getPosition());
+    jn = &(std::as_const(*swp).getNames());
   }
   else if (waypoint.isCartesianWaypoint())
   {
@@ -239,8 +244,9 @@ bool formatJointPosition(const std::vector<std::string>& joint_names, WaypointPo
     if (!cwp.hasSeed())
       throw std::runtime_error("Cartesian waypoint does not have a seed.");
 
-    jv = &(cwp.getSeed().position);
-    jn = &(cwp.getSeed().joint_names);
+    seed = &(cwp.getSeed());
+    jv = &(seed->position);
+    jn = &(seed->joint_names);
   }
   else
   {
@@ -250,7 +256,7 @@ bool formatJointPosition(const std::vector<std::string>& joint_names, WaypointPo
   if (jn->size() != joint_names.size())
     throw std::runtime_error("Joint name sizes do not match!");
 
-  if (joint_names == *jn)
+  if (jn == &joint_names || joint_names == *jn)
     return false;
 
   Eigen::VectorXd output = *jv;
@@ -267,7 +273,13 @@ bool formatJointPosition(const std::vector<std::string>& joint_names, WaypointPo
     output(static_cast<long>(i)) = (*jv)(static_cast<long>(idx));
   }
 
-  *jn = joint_names;
+  if (jwp != nullptr)
+    jwp->setNames(joint_names);
+  else if (swp != nullptr)
+    swp->setNames(joint_names);
+  else
+    seed->joint_names = joint_names;
+
   *jv = output;
 
   return true;
@@ -276,10 +288,16 @@ bool formatJointPosition(const std::vector<std::string>& joint_names, WaypointPo
 bool checkJointPositionFormat(const std::vector<std::string>& joint_names, const WaypointPoly& waypoint)
 {
   if (waypoint.isJointWaypoint())
-    return (joint_names == waypoint.as<JointWaypointPoly>().getNames());
+  {
+    const std::vector<std::string>& names = waypoint.as<JointWaypointPoly>().getNames();
+    return (&joint_names == &names || joint_names == names);
+  }
 
   if (waypoint.isStateWaypoint())
-    return (joint_names == waypoint.as<StateWaypointPoly>().getNames());
+  {
+    const std::vector<std::string>& names = waypoint.as<StateWaypointPoly>().getNames();
+    return (&joint_names == &names || joint_names == names);
+  }
 
   if (waypoint.isCartesianWaypoint())
   {
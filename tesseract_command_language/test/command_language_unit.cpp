@@ -25,6 +25,16 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstring>
+#include <limits>
+#include <thread>
+#include <utility>
+#include <sstream>
+#include <boost/archive/binary_oarchive.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_command_language/test_suite/cartesian_waypoint_poly_unit.hpp>
 #include <tesseract_command_language/test_suite/joint_waypoint_poly_unit.hpp>
 #include <tesseract_command_language/test_suite/state_waypoint_poly_unit.hpp>
@@ -36,9 +46,11 @@
 #include <tesseract_command_language/instruction_type.h>
 #include <tesseract_command_language/cartesian_waypoint.h>
 #include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_names.h>
 #include <tesseract_command_language/joint_waypoint.h>
 #include <tesseract_command_language/state_waypoint.h>
 #include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/program_archive.h>
 #include <tesseract_command_language/set_analog_instruction.h>
 #include <tesseract_command_language/set_tool_instruction.h>
 #include <tesseract_command_language/timer_instruction.h>
@@ -158,6 +170,80 @@ TEST(TesseractCommandLanguageUnit, StateWaypointTests)  // NOLINT
   test_suite::runStateWaypointTest<StateWaypoint>();
 }
 
+TEST(TesseractCommandLanguageUnit, JointNamesTests)  // NOLINT
+{
+  std::vector<std::string> names{ "j1", "j2", "j3" };
+  std::vector<std::string> other_names{ "j3", "j2", "j1" };
+
+  {  // Waypoints with the same joint names share storage
+    StateWaypoint swp1(names, Eigen::VectorXd::Zero(3));
+    StateWaypoint swp2(names, Eigen::VectorXd::Ones(3));
+    JointWaypoint jwp(names, Eigen::VectorXd::Zero(3));
+    EXPECT_EQ(&std::as_const(swp1).getNames(), &std::as_const(swp2).getNames());
+    EXPECT_EQ(&std::as_const(swp1).getNames(), &std::as_const(jwp).getNames());
+    EXPECT_EQ(internJointNames(names).get(), &std::as_const(jwp).getNames());
+    EXPECT_NE(internJointNames(other_names).get(), &std::as_const(jwp).getNames());
+  }
+
+  {  // Mutable access detaches the names from the other waypoints
+    StateWaypoint swp1(names, Eigen::VectorXd::Zero(3));
+    StateWaypoint swp2(swp1);
+    swp2.getNames()[0] = "j4";
+    EXPECT_EQ(std::as_const(swp1).getNames(), names);
+    EXPECT_EQ(std::as_const(swp2).getNames()[0], "j4");
+    EXPECT_FALSE(swp1 == swp2);
+
+    // Copies of a detached waypoint do not observe further modification
+    StateWaypoint swp3(swp2);
+    swp2.getNames()[0] = "j5";
+    EXPECT_EQ(std::as_const(swp3).getNames()[0], "j4");
+    EXPECT_EQ(std::as_const(swp2).getNames()[0], "j5");
+
+    swp2.setNames(names);
+    EXPECT_EQ(&std::as_const(swp1).getNames(), &std::as_const(swp2).getNames());
+    EXPECT_TRUE(swp1 == swp2);
+  }
+
+  {  // Moved from names are empty
+    JointNames jn1(names);
+    JointNames jn2(std::move(jn1));
+    EXPECT_TRUE(jn2.isShared());
+    EXPECT_EQ(jn2.get(), names);
+    EXPECT_TRUE(jn1.get().empty());  // NOLINT(bugprone-use-after-move,clang-analyzer-cplusplus.Move)
+    jn1 = jn2;
+    EXPECT_TRUE(jn1 == jn2);
+  }
+
+  {  // Interning from many threads returns one shared instance per unique list of names
+    const std::shared_ptr<const std::vector<std::string>> expected = internJointNames(names);
+    std::vector<std::shared_ptr<const std::vector<std::string>>> interned(8);
+    std::vector<std::thread> threads;
+    threads.reserve(interned.size());
+    for (auto& result : interned)
+    {
+      threads.emplace_back([&names, &other_names, &result]() {
+        for (int i = 0; i < 1000; ++i)
+        {
+          result = internJointNames(other_names);
+          result = internJointNames(names);
+        }
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+
+    for (const auto& result : interned)
+      EXPECT_EQ(result.get(), expected.get());
+  }
+
+  {  // Serializing a waypoint does not detach its shared names
+    const WaypointPoly wp{ StateWaypointPoly(StateWaypoint(names, Eigen::VectorXd::Zero(3))) };
+    test_suite::runWaypointSerializationTest(wp);
+    EXPECT_EQ(&wp.as<StateWaypointPoly>().getNames(), internJointNames(names).get());
+  }
+}
+
 TEST(TesseractCommandLanguageUnit, MoveInstructionTests)  // NOLINT
 {
   test_suite::runMoveInstructionTest<MoveInstruction>();
@@ -673,6 +759,94 @@ TEST(TesseractCommandLanguageUnit, CompositeInstructionTests)  // NOLINT
   }
 }
 
+TEST(TesseractCommandLanguageUnit, ProgramArchiveTests)  // NOLINT
+{
+  ManipulatorInfo manip_info("manipulator", "world", "tool0");
+  CompositeInstruction program = getTestProgram("raster_program", CompositeInstructionOrder::ORDERED, manip_info);
+  program.setDescription("raster program");
+
+  // Add a state waypoint with a trajectory
+  StateWaypoint swp({ "j1", "j2", "j3" }, Eigen::VectorXd::Constant(3, 0.5));
+  swp.setVelocity(Eigen::VectorXd::Constant(3, 0.1));
+  swp.setAcceleration(Eigen::VectorXd::Constant(3, 0.2));
+  swp.setTime(1.5);
+  MoveInstruction state_instruction(StateWaypointPoly{ swp }, MoveInstructionType::LINEAR, "STATE");
+  program.appendMoveInstruction(state_instruction);
+
+  // Add instructions and waypoints which are embedded as Boost archives
+  program.push_back(InstructionPoly{ SetToolInstruction(5) });
+  program.push_back(InstructionPoly{ WaitInstruction(2.5) });
+  program.push_back(InstructionPoly{ TimerInstruction(TimerInstructionType::DIGITAL_OUTPUT_HIGH, 1.0, 3) });
+
+  MoveInstruction null_instruction(state_instruction);
+  null_instruction.getWaypoint() = WaypointPoly();
+  program.appendMoveInstruction(null_instruction);
+
+  // A state waypoint poly which does not hold a StateWaypoint
+  MoveInstruction custom_instruction(state_instruction);
+  custom_instruction.getWaypoint() = WaypointPoly{ StateWaypointPoly() };
+  program.appendMoveInstruction(custom_instruction);
+
+  program.getUserData()["count"] = 3;
+  program.getUserData()["scale"] = 1.5;
+  CompositeInstruction user_data_composite("USER_DATA", CompositeInstructionOrder::UNORDERED, manip_info);
+  user_data_composite.getUserData()["name"] = std::string("user data");
+  user_data_composite.appendMoveInstruction(state_instruction);
+  program.push_back(user_data_composite);
+
+  auto check = [&program](const CompositeInstruction& decoded) {
+    EXPECT_TRUE(decoded == program);
+    EXPECT_EQ(decoded.getUUID(), program.getUUID());
+    EXPECT_EQ(decoded.getDescription(), program.getDescription());
+    auto mis = program.flatten(moveFilter);
+    auto dmis = decoded.flatten(moveFilter);
+    ASSERT_EQ(dmis.size(), mis.size());
+    for (std::size_t i = 0; i < mis.size(); ++i)
+    {
+      EXPECT_EQ(dmis[i].get().getUUID(), mis[i].get().getUUID());
+      EXPECT_EQ(dmis[i].get().getParentUUID(), mis[i].get().getParentUUID());
+      EXPECT_EQ(dmis[i].get().getDescription(), mis[i].get().getDescription());
+    }
+  };
+
+  {  // Data
+    std::vector<std::uint8_t> data = ProgramArchive::toArchiveBinaryData(program);
+    check(ProgramArchive::fromArchiveBinaryData(data));
+
+    // The archive is smaller than the boost binary archive
+    std::stringstream ss;
+    {
+      boost::archive::binary_oarchive oa(ss);
+      oa << boost::serialization::make_nvp("program", program);
+    }
+    EXPECT_LT(data.size(), ss.str().size());
+  }
+
+  {  // File
+    const std::string filepath = tesseract_common::getTempPath() + "program_archive.tprg";
+    EXPECT_TRUE(ProgramArchive::toArchiveFile(program, filepath));
+    check(ProgramArchive::fromArchiveFile(filepath));
+    EXPECT_ANY_THROW(ProgramArchive::fromArchiveFile(filepath + ".missing"));  // NOLINT
+  }
+
+  {  // Invalid data
+    std::vector<std::uint8_t> data = ProgramArchive::toArchiveBinaryData(program);
+    EXPECT_ANY_THROW(ProgramArchive::fromArchiveBinaryData(data.data(), 0));                // NOLINT
+    EXPECT_ANY_THROW(ProgramArchive::fromArchiveBinaryData(data.data(), data.size() / 2));  // NOLINT
+    std::vector<std::uint8_t> bad_magic = data;
+    bad_magic[0] = 'X';
+    EXPECT_ANY_THROW(ProgramArchive::fromArchiveBinaryData(bad_magic));  // NOLINT
+
+    // A corrupt count throws instead of allocating memory for the elements
+    std::vector<std::uint8_t> bad_count = data;
+    std::uint64_t strings_offset{ 0 };
+    std::memcpy(&strings_offset, bad_count.data() + 16, sizeof(strings_offset));
+    const std::uint32_t count{ std::numeric_limits<std::uint32_t>::max() };
+    std::memcpy(bad_count.data() + strings_offset, &count, sizeof(count));
+    EXPECT_ANY_THROW(ProgramArchive::fromArchiveBinaryData(bad_count));  // NOLINT
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -0,0 +1,186 @@
+/**
+ * @file program_archive_benchmark.cpp
+ * @brief Benchmarks of the program archive and the Boost archives
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <sstream>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/archive/binary_iarchive.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/serialization.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/program_archive.h>
+#include <tesseract_command_language/state_waypoint.h>
+
+using namespace tesseract_planning;
+using tesseract_common::ManipulatorInfo;
+
+/** @brief Create a time parameterized program of state waypoints */
+CompositeInstruction createTrajectoryProgram(std::size_t size)
+{
+  const std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  CompositeInstruction program(
+      "program", CompositeInstructionOrder::ORDERED, ManipulatorInfo("manipulator", "world", "tool0"));
+  program.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    const auto t = static_cast<double>(i);
+    StateWaypoint swp(joint_names, Eigen::VectorXd::Constant(6, t));
+    swp.setVelocity(Eigen::VectorXd::Constant(6, 0.1 * t));
+    swp.setAcceleration(Eigen::VectorXd::Constant(6, 0.01 * t));
+    swp.setTime(0.1 * t);
+    program.appendMoveInstruction(
+        MoveInstruction(StateWaypointPoly{ swp }, MoveInstructionType::FREESPACE, "freespace_profile"));
+  }
+  return program;
+}
+
+std::string toBoostBinary(const CompositeInstruction& program)
+{
+  std::stringstream ss;
+  {
+    boost::archive::binary_oarchive oa(ss);
+    oa << boost::serialization::make_nvp("program", program);
+  }
+  return ss.str();
+}
+
+CompositeInstruction fromBoostBinary(const std::string& data)
+{
+  CompositeInstruction program;
+  std::stringstream ss(data);
+  boost::archive::binary_iarchive ia(ss);
+  ia >> boost::serialization::make_nvp("program", program);
+  return program;
+}
+
+/** @brief Report the number of waypoints and archive bytes processed */
+void setArchiveCounters(benchmark::State& state, std::size_t bytes)
+{
+  state.SetItemsProcessed(static_cast<std::int64_t>(state.iterations()) * state.range(0));
+  state.SetBytesProcessed(static_cast<std::int64_t>(state.iterations()) * static_cast<std::int64_t>(bytes));
+  state.counters["archive_bytes"] = static_cast<double>(bytes);
+}
+
+static void BM_ProgramArchiveEncode(benchmark::State& state)
+{
+  CompositeInstruction program = createTrajectoryProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(ProgramArchive::toArchiveBinaryData(program));
+
+  setArchiveCounters(state, ProgramArchive::toArchiveBinaryData(program).size());
+}
+
+BENCHMARK(BM_ProgramArchiveEncode)->Arg(100)->Arg(5000);
+
+static void BM_ProgramArchiveDecode(benchmark::State& state)
+{
+  std::vector<std::uint8_t> data =
+      ProgramArchive::toArchiveBinaryData(createTrajectoryProgram(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(ProgramArchive::fromArchiveBinaryData(data));
+
+  setArchiveCounters(state, data.size());
+}
+
+BENCHMARK(BM_ProgramArchiveDecode)->Arg(100)->Arg(5000);
+
+static void BM_ProgramArchiveFileRead(benchmark::State& state)
+{
+  const std::string filepath = tesseract_common::getTempPath() + "program_archive_benchmark.tprg";
+  CompositeInstruction program = createTrajectoryProgram(static_cast<std::size_t>(state.range(0)));
+  ProgramArchive::toArchiveFile(program, filepath);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(ProgramArchive::fromArchiveFile(filepath));
+
+  setArchiveCounters(state, ProgramArchive::toArchiveBinaryData(program).size());
+}
+
+BENCHMARK(BM_ProgramArchiveFileRead)->Arg(100)->Arg(5000);
+
+static void BM_BoostBinaryEncode(benchmark::State& state)
+{
+  CompositeInstruction program = createTrajectoryProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(toBoostBinary(program));
+
+  setArchiveCounters(state, toBoostBinary(program).size());
+}
+
+BENCHMARK(BM_BoostBinaryEncode)->Arg(100)->Arg(5000);
+
+static void BM_BoostBinaryDecode(benchmark::State& state)
+{
+  std::string data = toBoostBinary(createTrajectoryProgram(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(fromBoostBinary(data));
+
+  setArchiveCounters(state, data.size());
+}
+
+BENCHMARK(BM_BoostBinaryDecode)->Arg(100)->Arg(5000);
+
+static void BM_BoostBinaryFileRead(benchmark::State& state)
+{
+  const std::string filepath = tesseract_common::getTempPath() + "program_archive_benchmark.bin";
+  CompositeInstruction program = createTrajectoryProgram(static_cast<std::size_t>(state.range(0)));
+  tesseract_common::Serialization::toArchiveFileBinary<CompositeInstruction>(program, filepath);
+  for (auto _ : state)
+    benchmark::DoNotOptimize(tesseract_common::Serialization::fromArchiveFileBinary<CompositeInstruction>(filepath));
+
+  setArchiveCounters(state, toBoostBinary(program).size());
+}
+
+BENCHMARK(BM_BoostBinaryFileRead)->Arg(100)->Arg(5000);
+
+static void BM_BoostXMLEncode(benchmark::State& state)
+{
+  CompositeInstruction program = createTrajectoryProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(tesseract_common::Serialization::toArchiveStringXML<CompositeInstruction>(program));
+
+  setArchiveCounters(state, tesseract_common::Serialization::toArchiveStringXML<CompositeInstruction>(program).size());
+}
+
+BENCHMARK(BM_BoostXMLEncode)->Arg(100)->Arg(5000);
+
+static void BM_BoostXMLDecode(benchmark::State& state)
+{
+  std::string data = tesseract_common::Serialization::toArchiveStringXML<CompositeInstruction>(
+      createTrajectoryProgram(static_cast<std::size_t>(state.range(0))));
+  for (auto _ : state)
+    benchmark::DoNotOptimize(tesseract_common::Serialization::fromArchiveStringXML<CompositeInstruction>(data));
+
+  setArchiveCounters(state, data.size());
+}
+
+BENCHMARK(BM_BoostXMLDecode)->Arg(100)->Arg(5000);
+
+BENCHMARK_MAIN();
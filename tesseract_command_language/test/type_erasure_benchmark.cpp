@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/archive/xml_oarchive.hpp>
 #include <boost/archive/xml_iarchive.hpp>
 #include <fstream>
+#include <unordered_set>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <benchmark/benchmark.h>
@@ -416,4 +417,61 @@ static void BM_VectorStateWaypointUPtrCopy(benchmark::State& state)
 
 BENCHMARK(BM_VectorStateWaypointUPtrCopy);
 
+CompositeInstruction createStateWaypointProgram(std::size_t size)
+{
+  const std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  CompositeInstruction program(
+      "program", CompositeInstructionOrder::ORDERED, ManipulatorInfo("manipulator", "world", "tool0"));
+  program.reserve(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    StateWaypointPoly wp{ StateWaypoint(joint_names, Eigen::VectorXd::Constant(6, static_cast<double>(i))) };
+    program.appendMoveInstruction(MoveInstruction(wp, MoveInstructionType::FREESPACE, "freespace_profile"));
+  }
+  return program;
+}
+
+/** @brief Report the number of joint name vectors and the bytes they occupy in the program */
+void setJointNamesCounters(benchmark::State& state, const CompositeInstruction& program)
+{
+  std::unordered_set<const std::vector<std::string>*> unique_names;
+  std::size_t bytes{ 0 };
+  for (const auto& instruction : program.getInstructions())
+  {
+    const auto& names = instruction.as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getNames();
+    if (!unique_names.insert(&names).second)
+      continue;
+
+    bytes += names.capacity() * sizeof(std::string);
+    for (const auto& name : names)
+      bytes += name.capacity();
+  }
+  state.counters["joint_names"] = static_cast<double>(unique_names.size());
+  state.counters["joint_names_bytes"] = static_cast<double>(bytes);
+}
+
+static void BM_StateWaypointProgramCreation(benchmark::State& state)
+{
+  for (auto _ : state)
+    benchmark::DoNotOptimize(createStateWaypointProgram(static_cast<std::size_t>(state.range(0))));
+
+  setJointNamesCounters(state, createStateWaypointProgram(static_cast<std::size_t>(state.range(0))));
+}
+
+BENCHMARK(BM_StateWaypointProgramCreation)->Arg(100)->Arg(5000);
+
+static void BM_StateWaypointProgramCopy(benchmark::State& state)
+{
+  CompositeInstruction program = createStateWaypointProgram(static_cast<std::size_t>(state.range(0)));
+  for (auto _ : state)
+  {
+    CompositeInstruction copy(program);
+    benchmark::DoNotOptimize(copy);
+  }
+
+  setJointNamesCounters(state, program);
+}
+
+BENCHMARK(BM_StateWaypointProgramCopy)->Arg(100)->Arg(5000);
+
 BENCHMARK_MAIN();
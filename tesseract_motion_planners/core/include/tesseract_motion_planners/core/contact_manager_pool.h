@@ -0,0 +1,151 @@
+/**
+ * @file contact_manager_pool.h
+ * @brief A pool of reusable contact managers
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_CONTACT_MANAGER_POOL_H
+#define TESSERACT_MOTION_PLANNERS_CONTACT_MANAGER_POOL_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_collision/core/discrete_contact_manager.h>
+#include <tesseract_collision/core/continuous_contact_manager.h>
+#include <tesseract_collision/core/types.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A thread safe pool of contact managers which avoids cloning the environment's collision world on every use
+ * @details Managers are keyed by environment, environment revision, active link set and contact manager config. A
+ * manager is handed out as a shared pointer and returned to the pool once the last copy is released, so each manager
+ * is only ever used by a single thread at a time. Managers belonging to an environment that has been destroyed or has
+ * a different revision are never handed out again and are dropped from the pool.
+ *
+ * The returned manager has its active collision objects and contact manager config applied. The caller is still
+ * responsible for setting the collision object transforms before each contact test.
+ */
+class ContactManagerPool
+{
+public:
+  using Ptr = std::shared_ptr<ContactManagerPool>;
+  using ConstPtr = std::shared_ptr<const ContactManagerPool>;
+  using UPtr = std::unique_ptr<ContactManagerPool>;
+  using ConstUPtr = std::unique_ptr<const ContactManagerPool>;
+
+  /**
+   * @brief Construct a contact manager pool
+   * @param max_idle The max number of idle managers kept for each manager type
+   */
+  ContactManagerPool(std::size_t max_idle = 16);
+  ~ContactManagerPool() = default;
+  ContactManagerPool(const ContactManagerPool&) = delete;
+  ContactManagerPool& operator=(const ContactManagerPool&) = delete;
+  ContactManagerPool(ContactManagerPool&&) = delete;
+  ContactManagerPool& operator=(ContactManagerPool&&) = delete;
+
+  /**
+   * @brief Get a discrete contact manager from the pool, cloning one from the environment if none are available
+   * @param env The environment
+   * @param active_links The active link names
+   * @param config The contact manager config to apply
+   * @return A discrete contact manager which is returned to the pool when released
+   */
+  tesseract_collision::DiscreteContactManager::Ptr
+  getDiscreteContactManager(const tesseract_environment::Environment::ConstPtr& env,
+                            const std::vector<std::string>& active_links,
+                            const tesseract_collision::ContactManagerConfig& config);
+
+  /**
+   * @brief Get a continuous contact manager from the pool, cloning one from the environment if none are available
+   * @param env The environment
+   * @param active_links The active link names
+   * @param config The contact manager config to apply
+   * @return A continuous contact manager which is returned to the pool when released
+   */
+  tesseract_collision::ContinuousContactManager::Ptr
+  getContinuousContactManager(const tesseract_environment::Environment::ConstPtr& env,
+                              const std::vector<std::string>& active_links,
+                              const tesseract_collision::ContactManagerConfig& config);
+
+  /** @brief Get the number of idle managers currently held by the pool */
+  std::size_t getIdleCount() const;
+
+  /** @brief Remove all idle managers from the pool */
+  void clear();
+
+  /**
+   * @brief Get the default pool shared by the planning tasks
+   * @return The default pool
+   */
+  static ContactManagerPool& getDefault();
+
+private:
+  struct Key
+  {
+    std::weak_ptr<const tesseract_environment::Environment> env;
+    const tesseract_environment::Environment* env_ptr{ nullptr };
+    int revision{ 0 };
+    std::vector<std::string> active_links;
+    tesseract_collision::ContactManagerConfig config;
+
+    bool matches(const Key& other) const;
+  };
+
+  template <typename ManagerType>
+  struct Entry
+  {
+    Key key;
+    std::shared_ptr<ManagerType> manager;
+  };
+
+  struct Storage
+  {
+    std::size_t max_idle{ 16 };
+    mutable std::mutex mutex;
+    std::vector<Entry<tesseract_collision::DiscreteContactManager>> discrete;
+    std::vector<Entry<tesseract_collision::ContinuousContactManager>> continuous;
+  };
+
+  /** @brief Outstanding managers hold a weak reference so releasing them after the pool is destroyed is safe */
+  std::shared_ptr<Storage> storage_;
+
+  template <typename ManagerType, typename CloneFn>
+  std::shared_ptr<ManagerType> acquire(std::vector<Entry<ManagerType>> Storage::*entries,
+                                       Key key,
+                                       const CloneFn& clone_fn);
+
+  static Key createKey(const tesseract_environment::Environment::ConstPtr& env,
+                       const std::vector<std::string>& active_links,
+                       const tesseract_collision::ContactManagerConfig& config);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_CONTACT_MANAGER_POOL_H
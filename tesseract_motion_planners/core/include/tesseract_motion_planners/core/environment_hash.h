@@ -0,0 +1,66 @@
+/**
+ * @file environment_hash.h
+ * @brief Hashing of the content of an environment, used as part of cache keys
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_ENVIRONMENT_HASH_H
+#define TESSERACT_MOTION_PLANNERS_ENVIRONMENT_HASH_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <streambuf>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_planning
+{
+/** @brief A stream buffer which computes the 64 bit FNV-1a hash of the characters written to it */
+class FNV1aHashBuf : public std::streambuf
+{
+public:
+  /** @brief Get the hash of the characters written so far */
+  std::uint64_t getHash() const;
+
+protected:
+  std::streamsize xsputn(const char* s, std::streamsize n) override;
+  int_type overflow(int_type ch) override;
+
+private:
+  std::uint64_t hash_{ 14695981039346656037ULL };
+};
+
+/**
+ * @brief Get the hash of the command history of an environment, which identifies its content
+ * @details The name and revision of an environment are not unique across environments, so caches shared between
+ * environments use this hash to identify the scene. Serializing the command history is expensive, so the hash of the
+ * last few environments is remembered and only computed again once the revision of the environment changed.
+ * @param env The environment
+ * @return The 64 bit FNV-1a hash of the binary serialization of the command history
+ */
+std::uint64_t getEnvironmentHash(const tesseract_environment::Environment::ConstPtr& env);
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_ENVIRONMENT_HASH_H
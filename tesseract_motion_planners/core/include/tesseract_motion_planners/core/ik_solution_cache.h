@@ -0,0 +1,173 @@
+/**
+ * @file ik_solution_cache.h
+ * @brief A thread safe cache of inverse kinematics solutions
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_IK_SOLUTION_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_IK_SOLUTION_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_kinematics/core/types.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A thread safe, bounded cache of inverse kinematics solutions
+ * @details Multi stage pipelines and re-plans of the same program solve inverse kinematics for the same cartesian
+ * targets many times. Solutions are keyed by the manipulator, inverse kinematics solver, working frame, tip link,
+ * environment revision and the target pose quantized to the cache resolution. The kinematic group keeps the
+ * environment state it was created with, so the working frame and tip link poses relative to the base link are part
+ * of the key as well, which separates groups created before and after the environment state changed. These poses are
+ * taken from the frame signature of the kinematic group, see getFrameSignature(). By default the
+ * seed is part of the key too, because numerical solvers return seed dependent solutions. For analytical solvers the
+ * seed can be excluded so that callers using different seeds share entries.
+ *
+ * Only the solutions returned by the solver are cached. Redundant solutions are cheap to generate and depend on the
+ * caller's joint limits, so they are still generated by the caller.
+ *
+ * When the cache is full the least recently used entry is evicted.
+ */
+class IKSolutionCache
+{
+public:
+  using Ptr = std::shared_ptr<IKSolutionCache>;
+  using ConstPtr = std::shared_ptr<const IKSolutionCache>;
+
+  /**
+   * @brief Construct an inverse kinematics solution cache
+   * @param max_size The max number of cached targets
+   * @param resolution The resolution used to quantize the target pose and seed
+   * @param use_seed Indicate if the seed is part of the key
+   */
+  IKSolutionCache(std::size_t max_size = 4096, double resolution = 1e-6, bool use_seed = true);
+  ~IKSolutionCache() = default;
+  IKSolutionCache(const IKSolutionCache&) = delete;
+  IKSolutionCache& operator=(const IKSolutionCache&) = delete;
+  IKSolutionCache(IKSolutionCache&&) = delete;
+  IKSolutionCache& operator=(IKSolutionCache&&) = delete;
+
+  /**
+   * @brief Get the inverse kinematics solutions for a target, solving and caching them if they are not cached
+   * @param manip The kinematic group used to solve inverse kinematics
+   * @param frame_signature The frame signature of the kinematic group, see getFrameSignature()
+   * @param ik_input The inverse kinematics target
+   * @param seed The seed
+   * @param env_revision The revision of the environment the kinematic group was created from
+   * @param ik_solver The name of the inverse kinematics solver of the kinematic group, empty for the default solver
+   * @return The inverse kinematics solutions
+   */
+  tesseract_kinematics::IKSolutions calcInvKin(const tesseract_kinematics::KinematicGroup& manip,
+                                               const tesseract_common::TransformMap& frame_signature,
+                                               const tesseract_kinematics::KinGroupIKInput& ik_input,
+                                               const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                               int env_revision,
+                                               const std::string& ik_solver = "");
+
+  /**
+   * @brief Get the frame signature of a kinematic group
+   * @details The poses of the links of the kinematic group at zero joint values relative to its base link, which
+   * identify the kinematics a target is solved with. This requires forward kinematics, so it should be computed once
+   * per kinematic group and passed to every lookup.
+   * @param manip The kinematic group
+   * @return The frame signature
+   */
+  static tesseract_common::TransformMap getFrameSignature(const tesseract_kinematics::KinematicGroup& manip);
+
+  /** @brief Get the number of cached targets */
+  std::size_t size() const;
+
+  /** @brief Get the max number of cached targets */
+  std::size_t getMaxSize() const;
+
+  /** @brief Get the number of lookups which returned cached solutions */
+  std::size_t getHits() const;
+
+  /** @brief Get the number of lookups which had to solve inverse kinematics */
+  std::size_t getMisses() const;
+
+  /** @brief Get the ratio of hits to lookups, zero if there were no lookups */
+  double getHitRate() const;
+
+  /** @brief Reset the hit and miss counters */
+  void resetStatistics();
+
+  /** @brief Remove all cached solutions */
+  void clear();
+
+private:
+  struct Key
+  {
+    std::string manipulator;
+    std::string ik_solver;
+    std::string working_frame;
+    std::string tip_link_name;
+    int env_revision{ 0 };
+    std::vector<std::int64_t> values;
+    std::size_t hash{ 0 };
+
+    bool operator==(const Key& other) const;
+  };
+
+  struct KeyHash
+  {
+    std::size_t operator()(const Key& key) const { return key.hash; }
+  };
+
+  using Entry = std::pair<Key, tesseract_kinematics::IKSolutions>;
+
+  std::size_t max_size_;
+  double resolution_;
+  bool use_seed_;
+
+  mutable std::mutex mutex_;
+  std::list<Entry> entries_;
+  std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> index_;
+
+  std::atomic<std::size_t> hits_{ 0 };
+  std::atomic<std::size_t> misses_{ 0 };
+
+  Key createKey(const tesseract_kinematics::KinematicGroup& manip,
+                const tesseract_common::TransformMap& frame_signature,
+                const tesseract_kinematics::KinGroupIKInput& ik_input,
+                const Eigen::Ref<const Eigen::VectorXd>& seed,
+                int env_revision,
+                const std::string& ik_solver) const;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_IK_SOLUTION_CACHE_H
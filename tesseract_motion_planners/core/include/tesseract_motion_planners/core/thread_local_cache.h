@@ -0,0 +1,153 @@
+/**
+ * @file thread_local_cache.h
+ * @brief A lock free cache of per thread objects
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief Get a process wide unique id for a thread local cache
+ * @details Ids are never reused and zero is never returned.
+ */
+std::size_t getThreadLocalCacheId();
+
+/**
+ * @brief A cache holding one object per thread which does not lock once a thread has its object
+ * @details Objects are created on the first call to get() from each thread and are owned by the cache, so they are
+ * destroyed with the cache. Each thread remembers the objects of the last few caches it used in thread local storage,
+ * keyed by the cache id. Since ids are never reused a thread never finds an object belonging to a destroyed cache.
+ * A thread which uses more caches than it remembers looks its object up by thread id under the lock of the cache, so
+ * each thread gets at most one object per cache.
+ *
+ * This is intended for objects like cloned contact managers which are expensive to create and not thread safe. When
+ * the number of worker threads is known, reserve() creates their objects up front so a worker's first call to get()
+ * only claims one of them.
+ */
+template <typename T>
+class ThreadLocalCache
+{
+public:
+  using CreateFn = std::function<std::unique_ptr<T>()>;
+
+  /**
+   * @brief Construct a thread local cache
+   * @param create_fn The function used to create the object for a thread
+   */
+  explicit ThreadLocalCache(CreateFn create_fn) : id_(getThreadLocalCacheId()), create_fn_(std::move(create_fn)) {}
+  ~ThreadLocalCache() = default;
+  ThreadLocalCache(const ThreadLocalCache&) = delete;
+  ThreadLocalCache& operator=(const ThreadLocalCache&) = delete;
+  ThreadLocalCache(ThreadLocalCache&&) = delete;
+  ThreadLocalCache& operator=(ThreadLocalCache&&) = delete;
+
+  /**
+   * @brief Create objects up front for the provided number of threads
+   * @details This must be called before the cache is shared between threads.
+   * @param count The number of objects to create
+   */
+  void reserve(std::size_t count)
+  {
+    while (reserved_values_.size() < count)
+      reserved_values_.push_back(create_fn_());
+  }
+
+  /** @brief Get the object for the calling thread, creating it on first use */
+  T& get() const
+  {
+    thread_local std::array<Entry, THREAD_SLOTS> slots;
+    thread_local std::size_t next_slot{ 0 };
+
+    for (const Entry& slot : slots)
+    {
+      if (slot.id == id_)
+        return *slot.value;
+    }
+
+    T* value{ nullptr };
+    {
+      std::scoped_lock lock(mutex_);
+      T*& thread_value = thread_values_[std::this_thread::get_id()];
+      if (thread_value == nullptr)
+      {
+        if (next_reserved_ < reserved_values_.size())
+        {
+          thread_value = reserved_values_[next_reserved_++].get();
+        }
+        else
+        {
+          values_.push_back(create_fn_());
+          thread_value = values_.back().get();
+        }
+      }
+      value = thread_value;
+    }
+
+    slots[next_slot] = Entry{ id_, value };
+    next_slot = (next_slot + 1) % THREAD_SLOTS;
+    return *value;
+  }
+
+  /** @brief Get the number of objects created by the cache */
+  std::size_t size() const
+  {
+    std::scoped_lock lock(mutex_);
+    return reserved_values_.size() + values_.size();
+  }
+
+private:
+  /** @brief The number of caches each thread remembers before falling back to creating a new object */
+  static constexpr std::size_t THREAD_SLOTS{ 8 };
+
+  struct Entry
+  {
+    std::size_t id{ 0 };
+    T* value{ nullptr };
+  };
+
+  std::size_t id_;
+  CreateFn create_fn_;
+  mutable std::mutex mutex_;
+  mutable std::vector<std::unique_ptr<T>> values_;
+  std::vector<std::unique_ptr<T>> reserved_values_;
+  mutable std::size_t next_reserved_{ 0 };
+  /** @brief The object of each thread, used when a thread no longer remembers this cache */
+  mutable std::unordered_map<std::thread::id, T*> thread_values_;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_THREAD_LOCAL_CACHE_H
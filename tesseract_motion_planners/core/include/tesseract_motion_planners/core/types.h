@@ -26,6 +26,11 @@
 #ifndef TESSERACT_MOTION_PLANNERS_PLANNER_TYPES_H
 #define TESSERACT_MOTION_PLANNERS_PLANNER_TYPES_H
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_environment/environment.h>
 #include <tesseract_common/types.h>
 #include <tesseract_command_language/poly/instruction_poly.h>
@@ -42,6 +47,13 @@ namespace tesseract_planning
  */
 using PlannerProfileRemapping = std::unordered_map<std::string, std::unordered_map<std::string, std::string>>;
 
+/**
+ * @brief Runs independent jobs of a planner, for example the segments of an OMPL request or the rungs of Descartes
+ * @details It is called with the number of jobs and the job, and must call the job once for every index in [0, count)
+ * and return after all of them have finished. The jobs may run in any order and at the same time. Jobs do not throw.
+ */
+using PlannerParallelFor = std::function<void(std::size_t count, const std::function<void(std::size_t)>& job)>;
+
 struct PlannerRequest
 {
   // LCOV_EXCL_START
@@ -78,6 +90,13 @@ struct PlannerRequest
    */
   PlannerProfileRemapping composite_profile_remapping{};
 
+  /**
+   * @brief Runs the independent jobs of the planner
+   * @details If not set the jobs run in sequence on the calling thread. The motion planner task sets this to run the
+   * jobs on the task composer executor, so planners do not create threads of their own.
+   */
+  PlannerParallelFor parallel_for;
+
   /** @brief Indicate if output should be verbose */
   bool verbose{ false };
 
@@ -40,6 +40,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/utils.h>
 #include <tesseract_common/types.h>
+#include <tesseract_motion_planners/core/types.h>
 
 namespace tesseract_planning
 {
@@ -99,6 +100,27 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
                          const CompositeInstruction& program,
                          const tesseract_collision::CollisionCheckConfig& config);
 
+/**
+ * @brief Should perform a continuous collision check over the trajectory in parallel
+ * @details The trajectory is split into chunks which are checked as the jobs of the parallel for, each using a clone of
+ * the contact manager and state solver. When the contact test type is FIRST, the remaining chunks are skipped once a
+ * collision is found. The results are identical to the serial implementation. The serial implementation is used when
+ * parallel_for is not set or debug logging is enabled.
+ * @param contacts A vector of vector of ContactMap where each index corresponds to a timestep
+ * @param manager A continuous contact manager which is cloned for each job
+ * @param state_solver The environment state solver which is cloned for each job
+ * @param program The program to check for contacts
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param parallel_for Runs the chunks, for example PlannerRequest::parallel_for
+ * @return True if collision was found, otherwise false.
+ */
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         const PlannerParallelFor& parallel_for);
+
 /**
  * @brief Should perform a discrete collision check over the trajectory
  * @param contacts A vector of vector of ContactMap where each index corresponds to a timestep
@@ -114,6 +136,38 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
                          const CompositeInstruction& program,
                          const tesseract_collision::CollisionCheckConfig& config);
 
+/**
+ * @brief Should perform a discrete collision check over the trajectory in parallel
+ * @details The trajectory is split into chunks which are checked as the jobs of the parallel for, each using a clone of
+ * the contact manager and state solver. When the contact test type is FIRST, the remaining chunks are skipped once a
+ * collision is found. The results are identical to the serial implementation. The serial implementation is used when
+ * parallel_for is not set or debug logging is enabled.
+ * @param contacts A vector of vector of ContactMap where each index corresponds to a timestep
+ * @param manager A discrete contact manager which is cloned for each job
+ * @param state_solver The environment state solver which is cloned for each job
+ * @param program The program to check for contacts
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param parallel_for Runs the chunks, for example PlannerRequest::parallel_for
+ * @return True if collision was found, otherwise false.
+ */
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         const PlannerParallelFor& parallel_for);
+
+/**
+ * @brief Run independent jobs using the parallel for of a planner request
+ * @details If parallel_for is not set the jobs run in sequence on the calling thread
+ * @param parallel_for The parallel for of the planner request
+ * @param count The number of jobs
+ * @param job The job, which is called with the index of each job and must not throw
+ */
+void parallelFor(const PlannerParallelFor& parallel_for,
+                 std::size_t count,
+                 const std::function<void(std::size_t)>& job);
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_PLANNING_UTILS_H
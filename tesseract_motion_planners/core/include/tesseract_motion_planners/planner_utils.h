@@ -30,6 +30,8 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 #include <console_bridge/console.h>
+#include <string>
+#include <unordered_map>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/constants.h>
@@ -134,8 +136,8 @@ std::shared_ptr<const ProfileType> getProfile(const std::string& ns,
                                               const ProfileDictionary& profile_dictionary,
                                               std::shared_ptr<const ProfileType> default_profile = nullptr)
 {
-  if (profile_dictionary.hasProfile<ProfileType>(ns, profile))
-    return profile_dictionary.getProfile<ProfileType>(ns, profile);
+  if (auto found = profile_dictionary.tryGetProfile<ProfileType>(ns, profile))
+    return found;
 
   CONSOLE_BRIDGE_logDebug("Profile '%s' was not found in namespace '%s' for type '%s'. Using default if available. "
                           "Available "
@@ -144,9 +146,9 @@ std::shared_ptr<const ProfileType> getProfile(const std::string& ns,
                           ns.c_str(),
                           typeid(ProfileType).name());
 
-  if (profile_dictionary.hasProfileEntry<ProfileType>(ns))
+  if (auto entry = profile_dictionary.tryGetProfileEntry<ProfileType>(ns))
   {
-    for (const auto& pair : profile_dictionary.getProfileEntry<ProfileType>(ns))
+    for (const auto& pair : *entry)
     {
       CONSOLE_BRIDGE_logDebug("%s", pair.first.c_str());
     }
@@ -173,12 +175,94 @@ std::shared_ptr<const ProfileType> applyProfileOverrides(const std::string& ns,
   if (!overrides)
     return nominal_profile;
 
-  if (overrides->hasProfile<ProfileType>(ns, profile))
-    return overrides->getProfile<ProfileType>(ns, profile);
+  if (auto override_profile = overrides->tryGetProfile<ProfileType>(ns, profile))
+    return override_profile;
 
   return nominal_profile;
 }
 
+/**
+ * @brief An immutable snapshot of the profiles of a single type for a planner, with the profile remapping applied
+ * @details This is built once per request, copying the profile entry from the dictionary under a single lock. Each
+ * lookup is then a hash lookup without locking or any_cast, and the default profile is shared rather than created for
+ * every instruction. This is equivalent to calling getProfileString, getProfile and applyProfileOverrides for each
+ * instruction. Changes made to the profile dictionary after the snapshot is created are not seen by the snapshot.
+ */
+template <typename ProfileType>
+class ProfileSnapshot
+{
+public:
+  /**
+   * @brief Create a snapshot of the profiles
+   * @param ns The namespace to search for requested profiles
+   * @param profile_dictionary The dictionary that contains the profiles
+   * @param profile_remapping Remapping used to remap a profile name based on the planner name
+   * @param default_profile Profile that is returned if the requested profile is not found. Default = nullptr
+   */
+  ProfileSnapshot(std::string ns,
+                  const ProfileDictionary& profile_dictionary,
+                  const PlannerProfileRemapping& profile_remapping,
+                  std::shared_ptr<const ProfileType> default_profile = nullptr)
+    : ns_(std::move(ns)), default_profile_(std::move(default_profile))
+  {
+    if (auto entry = profile_dictionary.tryGetProfileEntry<ProfileType>(ns_))
+      profiles_ = std::move(*entry);
+
+    auto remap = profile_remapping.find(ns_);
+    if (remap != profile_remapping.end())
+      remapping_ = remap->second;
+  }
+
+  /**
+   * @brief Get the profile string taking into account defaults and profile remapping
+   * @param profile The requested profile name in the instructions
+   * @return The profile string taking into account defaults and profile remapping
+   */
+  const std::string& getProfileString(const std::string& profile) const
+  {
+    auto p = remapping_.find(profile);
+    if (p != remapping_.end())
+      return p->second;
+
+    return (profile.empty()) ? default_profile_key_ : profile;
+  }
+
+  /**
+   * @brief Get the profile for the requested profile name
+   * @param profile The requested profile name in the instructions
+   * @param overrides Dictionary of profile overrides that will override the profile if present. Default = nullptr
+   * @return The override if present, otherwise the profile if found, otherwise the default profile
+   */
+  std::shared_ptr<const ProfileType> getProfile(const std::string& profile,
+                                                const ProfileDictionary::ConstPtr& overrides = nullptr) const
+  {
+    const std::string& name = getProfileString(profile);
+    if (overrides)
+    {
+      if (auto override_profile = overrides->tryGetProfile<ProfileType>(ns_, name))
+        return override_profile;
+    }
+
+    auto it = profiles_.find(name);
+    if (it != profiles_.end())
+      return it->second;
+
+    CONSOLE_BRIDGE_logDebug("Profile '%s' was not found in namespace '%s' for type '%s'. Using default if available.",
+                            name.c_str(),
+                            ns_.c_str(),
+                            typeid(ProfileType).name());
+
+    return default_profile_;
+  }
+
+private:
+  std::string ns_;
+  std::string default_profile_key_{ DEFAULT_PROFILE_KEY };
+  std::shared_ptr<const ProfileType> default_profile_;
+  std::unordered_map<std::string, std::shared_ptr<const ProfileType>> profiles_;
+  std::unordered_map<std::string, std::string> remapping_;
+};
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_PLANNER_UTILS_H
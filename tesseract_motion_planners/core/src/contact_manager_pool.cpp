@@ -0,0 +1,153 @@
+/**
+ * @file contact_manager_pool.cpp
+ * @brief A pool of reusable contact managers
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/contact_manager_pool.h>
+
+namespace tesseract_planning
+{
+bool ContactManagerPool::Key::matches(const Key& other) const
+{
+  return (env_ptr == other.env_ptr && revision == other.revision && active_links == other.active_links &&
+          config == other.config);
+}
+
+ContactManagerPool::ContactManagerPool(std::size_t max_idle) : storage_(std::make_shared<Storage>())
+{
+  storage_->max_idle = max_idle;
+}
+
+ContactManagerPool::Key ContactManagerPool::createKey(const tesseract_environment::Environment::ConstPtr& env,
+                                                      const std::vector<std::string>& active_links,
+                                                      const tesseract_collision::ContactManagerConfig& config)
+{
+  Key key;
+  key.env = env;
+  key.env_ptr = env.get();
+  key.revision = env->getRevision();
+  key.active_links = active_links;
+  std::sort(key.active_links.begin(), key.active_links.end());
+  key.config = config;
+  return key;
+}
+
+template <typename ManagerType, typename CloneFn>
+std::shared_ptr<ManagerType> ContactManagerPool::acquire(std::vector<Entry<ManagerType>> Storage::*entries,
+                                                         Key key,
+                                                         const CloneFn& clone_fn)
+{
+  std::shared_ptr<ManagerType> manager;
+  {
+    std::unique_lock<std::mutex> lock(storage_->mutex);
+    auto& idle = (*storage_).*entries;
+
+    // Drop managers which can never be handed out again
+    idle.erase(std::remove_if(idle.begin(),
+                              idle.end(),
+                              [&key](const Entry<ManagerType>& e) {
+                                return (e.key.env.expired() ||
+                                        (e.key.env_ptr == key.env_ptr && e.key.revision != key.revision));
+                              }),
+               idle.end());
+
+    auto it = std::find_if(
+        idle.begin(), idle.end(), [&key](const Entry<ManagerType>& e) { return e.key.matches(key); });
+    if (it != idle.end())
+    {
+      manager = std::move(it->manager);
+      idle.erase(it);
+    }
+  }
+
+  // Clone outside of the lock since this is the expensive operation the pool exists to avoid
+  if (manager == nullptr)
+  {
+    manager = clone_fn();
+    manager->setActiveCollisionObjects(key.active_links);
+    manager->applyContactManagerConfig(key.config);
+  }
+
+  // The deleter returns the manager to the pool instead of destroying it
+  std::weak_ptr<Storage> weak_storage = storage_;
+  ManagerType* raw = manager.get();
+  return std::shared_ptr<ManagerType>(
+      raw, [weak_storage, entries, key = std::move(key), manager = std::move(manager)](ManagerType* /*p*/) mutable {
+        std::shared_ptr<Storage> storage = weak_storage.lock();
+        if (storage == nullptr)
+          return;
+
+        std::unique_lock<std::mutex> lock(storage->mutex);
+        auto& idle = (*storage).*entries;
+        if (idle.size() < storage->max_idle && !key.env.expired())
+          idle.push_back(Entry<ManagerType>{ std::move(key), std::move(manager) });
+      });
+}
+
+tesseract_collision::DiscreteContactManager::Ptr
+ContactManagerPool::getDiscreteContactManager(const tesseract_environment::Environment::ConstPtr& env,
+                                              const std::vector<std::string>& active_links,
+                                              const tesseract_collision::ContactManagerConfig& config)
+{
+  return acquire<tesseract_collision::DiscreteContactManager>(
+      &Storage::discrete, createKey(env, active_links, config), [&env]() {
+        return tesseract_collision::DiscreteContactManager::Ptr(env->getDiscreteContactManager());
+      });
+}
+
+tesseract_collision::ContinuousContactManager::Ptr
+ContactManagerPool::getContinuousContactManager(const tesseract_environment::Environment::ConstPtr& env,
+                                                const std::vector<std::string>& active_links,
+                                                const tesseract_collision::ContactManagerConfig& config)
+{
+  return acquire<tesseract_collision::ContinuousContactManager>(
+      &Storage::continuous, createKey(env, active_links, config), [&env]() {
+        return tesseract_collision::ContinuousContactManager::Ptr(env->getContinuousContactManager());
+      });
+}
+
+std::size_t ContactManagerPool::getIdleCount() const
+{
+  std::unique_lock<std::mutex> lock(storage_->mutex);
+  return storage_->discrete.size() + storage_->continuous.size();
+}
+
+void ContactManagerPool::clear()
+{
+  std::unique_lock<std::mutex> lock(storage_->mutex);
+  storage_->discrete.clear();
+  storage_->continuous.clear();
+}
+
+ContactManagerPool& ContactManagerPool::getDefault()
+{
+  static ContactManagerPool pool;
+  return pool;
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,121 @@
+/**
+ * @file environment_hash.cpp
+ * @brief Hashing of the content of an environment, used as part of cache keys
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/shared_ptr.hpp>
+#if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
+#include <boost/serialization/library_version_type.hpp>
+#endif
+#include <boost/serialization/vector.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/environment_hash.h>
+#include <tesseract_environment/commands.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+struct EnvironmentHashEntry
+{
+  std::weak_ptr<const tesseract_environment::Environment> env;
+  int revision{ 0 };
+  std::uint64_t hash{ 0 };
+};
+}  // namespace
+
+std::uint64_t FNV1aHashBuf::getHash() const { return hash_; }
+
+std::streamsize FNV1aHashBuf::xsputn(const char* s, std::streamsize n)
+{
+  for (std::streamsize i = 0; i < n; ++i)
+  {
+    hash_ ^= static_cast<unsigned char>(s[i]);
+    hash_ *= 1099511628211ULL;
+  }
+  return n;
+}
+
+FNV1aHashBuf::int_type FNV1aHashBuf::overflow(int_type ch)
+{
+  if (!traits_type::eq_int_type(ch, traits_type::eof()))
+  {
+    const char c = traits_type::to_char_type(ch);
+    xsputn(&c, 1);
+  }
+
+  return traits_type::not_eof(ch);
+}
+
+std::uint64_t getEnvironmentHash(const tesseract_environment::Environment::ConstPtr& env)
+{
+  // The most recently used entries are at the front. The entry of a destroyed environment can not be locked, so an
+  // environment created at the same address never gets its hash.
+  static constexpr std::size_t MAX_ENTRIES{ 16 };
+  static std::mutex mutex;
+  static std::list<EnvironmentHashEntry> entries;
+
+  const int revision = env->getRevision();
+  {
+    std::scoped_lock lock(mutex);
+    for (auto it = entries.begin(); it != entries.end(); ++it)
+    {
+      if (it->revision == revision && it->env.lock() == env)
+      {
+        entries.splice(entries.begin(), entries, it);
+        return it->hash;
+      }
+    }
+  }
+
+  FNV1aHashBuf buffer;
+  {
+    const tesseract_environment::Commands commands = env->getCommandHistory();
+    boost::archive::binary_oarchive oa(buffer, boost::archive::no_header);
+    oa << boost::serialization::make_nvp("commands", commands);
+  }
+
+  // The environment may have been changed while the hash was computed, in which case it is not remembered
+  if (env->getRevision() != revision)
+    return buffer.getHash();
+
+  std::scoped_lock lock(mutex);
+  entries.remove_if([&env](const EnvironmentHashEntry& entry) {
+    const auto locked = entry.env.lock();
+    return (locked == nullptr || locked == env);
+  });
+  entries.push_front(EnvironmentHashEntry{ env, revision, buffer.getHash() });
+  if (entries.size() > MAX_ENTRIES)
+    entries.pop_back();
+
+  return buffer.getHash();
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,187 @@
+/**
+ * @file ik_solution_cache.cpp
+ * @brief A thread safe cache of inverse kinematics solutions
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <boost/functional/hash.hpp>
+#include <cmath>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
+
+namespace tesseract_planning
+{
+bool IKSolutionCache::Key::operator==(const Key& other) const
+{
+  return (hash == other.hash && env_revision == other.env_revision && values == other.values &&
+          manipulator == other.manipulator && ik_solver == other.ik_solver && working_frame == other.working_frame &&
+          tip_link_name == other.tip_link_name);
+}
+
+IKSolutionCache::IKSolutionCache(std::size_t max_size, double resolution, bool use_seed)
+  : max_size_(max_size), resolution_(resolution), use_seed_(use_seed)
+{
+  if (max_size_ == 0)
+    throw std::runtime_error("IKSolutionCache, max size must be greater than zero!");
+
+  if (!(resolution_ > 0))
+    throw std::runtime_error("IKSolutionCache, resolution must be greater than zero!");
+}
+
+tesseract_common::TransformMap IKSolutionCache::getFrameSignature(const tesseract_kinematics::KinematicGroup& manip)
+{
+  // The kinematic group keeps the environment state it was created with, which changes without a new revision when
+  // the state is set and is not tied to a revision across environments, so it is identified by its link poses
+  tesseract_common::TransformMap poses = manip.calcFwdKin(Eigen::VectorXd::Zero(manip.numJoints()));
+  const Eigen::Isometry3d base_pose_inv = poses.at(manip.getBaseLinkName()).inverse();
+  for (auto& pose : poses)
+    pose.second = base_pose_inv * pose.second;
+
+  return poses;
+}
+
+IKSolutionCache::Key IKSolutionCache::createKey(const tesseract_kinematics::KinematicGroup& manip,
+                                                const tesseract_common::TransformMap& frame_signature,
+                                                const tesseract_kinematics::KinGroupIKInput& ik_input,
+                                                const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                                int env_revision,
+                                                const std::string& ik_solver) const
+{
+  Key key;
+  key.manipulator = manip.getName();
+  key.ik_solver = ik_solver;
+  key.working_frame = ik_input.working_frame;
+  key.tip_link_name = ik_input.tip_link_name;
+  key.env_revision = env_revision;
+
+  const auto quantize = [this](double value) { return static_cast<std::int64_t>(std::llround(value / resolution_)); };
+  const auto appendPose = [&key, &quantize](const Eigen::Isometry3d& pose) {
+    for (Eigen::Index i = 0; i < 3; ++i)
+      key.values.push_back(quantize(pose.translation()(i)));
+
+    for (Eigen::Index c = 0; c < 3; ++c)
+      for (Eigen::Index r = 0; r < 3; ++r)
+        key.values.push_back(quantize(pose.linear()(r, c)));
+  };
+
+  key.values.reserve(36 + (use_seed_ ? static_cast<std::size_t>(seed.size()) : 0));
+  appendPose(ik_input.pose);
+
+  // The working frame and the tip link identify the kinematics the target is solved with
+  appendPose(frame_signature.at(ik_input.working_frame));
+  appendPose(frame_signature.at(ik_input.tip_link_name));
+
+  if (use_seed_)
+  {
+    for (Eigen::Index i = 0; i < seed.size(); ++i)
+      key.values.push_back(quantize(seed(i)));
+  }
+
+  std::size_t hash{ 0 };
+  boost::hash_combine(hash, key.manipulator);
+  boost::hash_combine(hash, key.ik_solver);
+  boost::hash_combine(hash, key.working_frame);
+  boost::hash_combine(hash, key.tip_link_name);
+  boost::hash_combine(hash, key.env_revision);
+  boost::hash_range(hash, key.values.begin(), key.values.end());
+  key.hash = hash;
+  return key;
+}
+
+tesseract_kinematics::IKSolutions IKSolutionCache::calcInvKin(const tesseract_kinematics::KinematicGroup& manip,
+                                                              const tesseract_common::TransformMap& frame_signature,
+                                                              const tesseract_kinematics::KinGroupIKInput& ik_input,
+                                                              const Eigen::Ref<const Eigen::VectorXd>& seed,
+                                                              int env_revision,
+                                                              const std::string& ik_solver)
+{
+  Key key = createKey(manip, frame_signature, ik_input, seed, env_revision, ik_solver);
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+      entries_.splice(entries_.begin(), entries_, it->second);
+      ++hits_;
+      return it->second->second;
+    }
+  }
+
+  // Solve without holding the lock, two threads may solve the same target but the results are identical
+  ++misses_;
+  tesseract_kinematics::IKSolutions solutions = manip.calcInvKin({ ik_input }, seed);
+
+  std::unique_lock<std::mutex> lock(mutex_);
+  if (index_.find(key) != index_.end())
+    return solutions;
+
+  entries_.emplace_front(key, solutions);
+  index_.emplace(std::move(key), entries_.begin());
+  if (entries_.size() > max_size_)
+  {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+
+  return solutions;
+}
+
+std::size_t IKSolutionCache::size() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t IKSolutionCache::getMaxSize() const { return max_size_; }
+
+std::size_t IKSolutionCache::getHits() const { return hits_.load(); }
+
+std::size_t IKSolutionCache::getMisses() const { return misses_.load(); }
+
+double IKSolutionCache::getHitRate() const
+{
+  const std::size_t hits = hits_.load();
+  const std::size_t lookups = hits + misses_.load();
+  if (lookups == 0)
+    return 0;
+
+  return static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+void IKSolutionCache::resetStatistics()
+{
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void IKSolutionCache::clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  entries_.clear();
+  index_.clear();
+}
+
+}  // namespace tesseract_planning
@@ -27,7 +27,10 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Geometry>
 #include <iostream>
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <thread>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -290,304 +293,719 @@ void printDiscreteDebugInfo(const std::vector<std::string>& joint_names,
   CONSOLE_BRIDGE_logDebug(ss.str().c_str());
 }
 
-bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+namespace
+{
+/**
+ * @brief Check a single step of a flattened program using a continuous contact manager
+ * @details A step is the segment between states iStep and iStep + 1. This is shared by the serial and parallel
+ * implementations of contactCheckProgram so both produce identical results.
+ * @param state_results The contacts found for the step
+ * @param sub_state_results Scratch contact map used while checking the step
+ * @param record Set to false if the step should not be stored in the output contacts
+ * @param manager A continuous contact manager
+ * @param state_solver The environment state solver
+ * @param mi The flattened move instructions
+ * @param iStep The step index
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param traj_contacts The debug trajectory results, nullptr if debug logging is disabled
+ * @return True if collision was found for the step, otherwise false.
+ */
+bool checkContinuousStep(tesseract_collision::ContactResultMap& state_results,
+                         tesseract_collision::ContactResultMap& sub_state_results,
+                         bool& record,
                          tesseract_collision::ContinuousContactManager& manager,
                          const tesseract_scene_graph::StateSolver& state_solver,
-                         const CompositeInstruction& program,
-                         const tesseract_collision::CollisionCheckConfig& config)
+                         const std::vector<std::reference_wrapper<const InstructionPoly>>& mi,
+                         std::size_t iStep,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         tesseract_collision::ContactTrajectoryResults* traj_contacts)
 {
-  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
-      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
-    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
-                             "ContactManager type (Continuous)");
+  const bool debug_logging = (traj_contacts != nullptr);
+  bool found = false;
+  record = true;
+  state_results.clear();
 
-  // Flatten results
-  std::vector<std::reference_wrapper<const InstructionPoly>> mi = program.flatten(moveFilter);
+  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+  {
+    assert(config.longest_valid_segment_length > 0);
 
-  if (mi.size() < 2)
-    throw std::runtime_error("contactCheckProgram was given continuous contact manager with a trajectory that only has "
-                             "one state.");
+    const auto& joint_names = getJointNames(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
+    const auto& joint_positions0 = getJointPosition(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
+    const auto& joint_positions1 = getJointPosition(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
 
-  manager.applyContactManagerConfig(config.contact_manager_config);
+    // TODO: Should check joint names and make sure they are in the same order
+    double dist = (joint_positions1 - joint_positions0).norm();
+    if (dist > config.longest_valid_segment_length)
+    {
+      auto cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+      tesseract_common::TrajArray subtraj(cnt, joint_positions0.size());
+      for (long iVar = 0; iVar < joint_positions0.size(); ++iVar)
+        subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, joint_positions0(iVar), joint_positions1(iVar));
 
-  bool debug_logging = console_bridge::getLogLevel() < console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO;
+      tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
 
-  tesseract_collision::ContactTrajectoryResults::UPtr traj_contacts;
-  if (debug_logging)
+      if (debug_logging)
+      {
+        step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
+            static_cast<int>(iStep + 1), joint_positions0, joint_positions1, static_cast<int>(subtraj.rows()));
+      }
+
+      auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
+
+      // Update start and end index based on collision check program mode
+      long start_idx{ 0 };
+      long end_idx(subtraj.rows() - 1);
+      if (iStep == 0)
+      {
+        if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
+            config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+          ++start_idx;
+      }
+      if (iStep == (mi.size() - 2))
+      {
+        if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
+            config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+          --end_idx;
+      }
+
+      for (long iSubStep = start_idx; iSubStep < end_idx; ++iSubStep)
+      {
+        tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+        if (debug_logging)
+        {
+          substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
+              static_cast<int>(iSubStep) + 1, subtraj.row(iSubStep), subtraj.row(iSubStep + 1));
+        }
+
+        tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, subtraj.row(iSubStep));
+        tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, subtraj.row(iSubStep + 1));
+        sub_state_results.clear();
+        tesseract_environment::checkTrajectorySegment(
+            sub_state_results, manager, state0.link_transforms, state1.link_transforms, config.contact_request);
+        if (!sub_state_results.empty())
+        {
+          found = true;
+
+          if (debug_logging)
+          {
+            substep_contacts->contacts = sub_state_results;
+            step_contacts->substeps[static_cast<size_t>(iSubStep)] = *substep_contacts;
+          }
+          double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
+          state_results.addInterpolatedCollisionResults(sub_state_results,
+                                                        iSubStep,
+                                                        sub_segment_last_index,
+                                                        manager.getActiveCollisionObjects(),
+                                                        segment_dt,
+                                                        false);
+        }
+
+        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+          break;
+      }
+
+      if (debug_logging)
+      {
+        traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+      }
+
+      return found;
+    }
+  }
+
+  // Update start and end index based on collision check program mode
+  if (iStep == 0)
   {
-    // Grab the first waypoint to get the joint names
-    const auto& joint_names = getJointNames(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
-    traj_contacts =
-        std::make_unique<tesseract_collision::ContactTrajectoryResults>(joint_names, static_cast<int>(program.size()));
+    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
+        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+      return found;
+  }
+  if (iStep == (mi.size() - 2))
+  {
+    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
+        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+    {
+      record = false;
+      return found;
+    }
   }
 
-  contacts.clear();
-  contacts.reserve(mi.size());
+  const auto& joint_names0 = getJointNames(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
+  const auto& joint_positions0 = getJointPosition(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
 
-  /** @brief Making this thread_local does not help because it is not called enough during planning */
-  tesseract_collision::ContactResultMap state_results;
-  tesseract_collision::ContactResultMap sub_state_results;
+  const auto& joint_names1 = getJointNames(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
+  const auto& joint_positions1 = getJointPosition(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
 
-  bool found = false;
-  if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY)
+  tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names0, joint_positions0);
+  tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names1, joint_positions1);
+
+  tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
+  tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+
+  if (debug_logging)
   {
-    const auto& joint_names = getJointNames(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
-    const auto& joint_positions = getJointPosition(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
-    tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, joint_positions);
-    sub_state_results.clear();
-    tesseract_environment::checkTrajectoryState(
-        sub_state_results, manager, state.link_transforms, config.contact_request);
+    step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
+        static_cast<int>(iStep + 1), joint_positions0, joint_positions1, 1);
+    substep_contacts =
+        std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(1, joint_positions0, joint_positions1);
+  }
 
-    if (!sub_state_results.empty())
+  tesseract_environment::checkTrajectorySegment(
+      state_results, manager, state0.link_transforms, state1.link_transforms, config);
+  if (!state_results.empty())
+  {
+    found = true;
+
+    if (debug_logging)
     {
-      found = true;
-      // Always use addInterpolatedCollisionResults so cc_type is defined correctly
-      state_results.addInterpolatedCollisionResults(
-          sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, false);
-      if (debug_logging)
-        printContinuousDebugInfo(joint_names, joint_positions, joint_positions, 0, mi.size() - 1);
+      substep_contacts->contacts = state_results;
+      step_contacts->substeps[0] = *substep_contacts;
+      traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
     }
-    contacts.push_back(state_results);
-    return found;
   }
 
-  if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
+  if (debug_logging)
   {
-    const auto& joint_names = getJointNames(mi.back().get().as<MoveInstructionPoly>().getWaypoint());
-    const auto& joint_positions = getJointPosition(mi.back().get().as<MoveInstructionPoly>().getWaypoint());
-    tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, joint_positions);
+    traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+  }
+
+  return found;
+}
+
+/**
+ * @brief Check a single step of a flattened program using a discrete contact manager
+ * @details For LVS_DISCRETE a step is the segment between states iStep and iStep + 1, otherwise it is the state iStep.
+ * This is shared by the serial and parallel implementations of contactCheckProgram so both produce identical results.
+ * @param state_results The contacts found for the step
+ * @param sub_state_results Scratch contact map used while checking the step
+ * @param record Set to false if the step should not be stored in the output contacts
+ * @param manager A discrete contact manager
+ * @param state_solver The environment state solver
+ * @param mi The flattened move instructions
+ * @param iStep The step index
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param traj_contacts The debug trajectory results, nullptr if debug logging is disabled
+ * @return True if collision was found for the step, otherwise false.
+ */
+bool checkDiscreteStep(tesseract_collision::ContactResultMap& state_results,
+                       tesseract_collision::ContactResultMap& sub_state_results,
+                       bool& record,
+                       tesseract_collision::DiscreteContactManager& manager,
+                       const tesseract_scene_graph::StateSolver& state_solver,
+                       const std::vector<std::reference_wrapper<const InstructionPoly>>& mi,
+                       std::size_t iStep,
+                       const tesseract_collision::CollisionCheckConfig& config,
+                       tesseract_collision::ContactTrajectoryResults* traj_contacts)
+{
+  const bool debug_logging = (traj_contacts != nullptr);
+  bool found = false;
+  record = true;
+  state_results.clear();
+
+  if (config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  {
+    if (iStep == 0)
+    {
+      if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
+          config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+        return found;
+    }
+
+    if (iStep == (mi.size() - 1))
+    {
+      if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
+          config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+      {
+        record = false;
+        return found;
+      }
+    }
+
+    const auto& wp0 = mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint();
+    const std::vector<std::string>& jn = getJointNames(wp0);
+    const Eigen::VectorXd& p0 = getJointPosition(wp0);
+
+    tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
+    tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+    if (debug_logging)
+    {
+      step_contacts =
+          std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(static_cast<int>(iStep + 1), p0);
+      substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(1, p0);
+    }
+
+    tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
     sub_state_results.clear();
     tesseract_environment::checkTrajectoryState(
         sub_state_results, manager, state.link_transforms, config.contact_request);
-
     if (!sub_state_results.empty())
     {
       found = true;
-      // Always use addInterpolatedCollisionResults so cc_type is defined correctly
-      state_results.addInterpolatedCollisionResults(
-          sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, false);
       if (debug_logging)
-        printContinuousDebugInfo(joint_names, joint_positions, joint_positions, 0, mi.size() - 1);
+      {
+        substep_contacts->contacts = sub_state_results;
+        step_contacts->substeps[0] = *substep_contacts;
+        traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+      }
+      state_results.addInterpolatedCollisionResults(
+          sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
     }
-    contacts.push_back(state_results);
+
     return found;
   }
 
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+  assert(config.longest_valid_segment_length > 0);
+
+  const auto& wp0 = mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint();
+  const std::vector<std::string>& jn = getJointNames(wp0);
+  const Eigen::VectorXd& p0 = getJointPosition(wp0);
+
+  const auto& wp1 = mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint();
+  const Eigen::VectorXd& p1 = getJointPosition(wp1);
+  const double dist = (p1 - p0).norm();
+
+  if (dist > config.longest_valid_segment_length)
   {
-    assert(config.longest_valid_segment_length > 0);
+    auto cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
+    tesseract_common::TrajArray subtraj(cnt, p0.size());
+    for (long iVar = 0; iVar < p0.size(); ++iVar)
+      subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, p0(iVar), p1(iVar));
 
-    for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
+    tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
+
+    if (debug_logging)
     {
-      state_results.clear();
+      step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
+          iStep + 1, p0, p1, static_cast<int>(subtraj.rows()));
+    }
 
-      const auto& joint_names = getJointNames(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
-      const auto& joint_positions0 = getJointPosition(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
-      const auto& joint_positions1 = getJointPosition(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
+    auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
 
-      // TODO: Should check joint names and make sure they are in the same order
-      double dist = (joint_positions1 - joint_positions0).norm();
-      if (dist > config.longest_valid_segment_length)
+    // Update start and end index based on collision check program mode
+    long start_idx{ 0 };
+    long end_idx(subtraj.rows() - 1);
+    if (iStep == 0)
+    {
+      if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
+          config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+        ++start_idx;
+    }
+    if (iStep == (mi.size() - 2))
+    {
+      // This is the last segment so check the last state
+      end_idx = subtraj.rows();
+      if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
+          config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+        --end_idx;
+    }
+
+    for (long iSubStep = start_idx; iSubStep < end_idx; ++iSubStep)
+    {
+      tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+      if (debug_logging)
       {
-        auto cnt = static_cast<long>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, joint_positions0.size());
-        for (long iVar = 0; iVar < joint_positions0.size(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, joint_positions0(iVar), joint_positions1(iVar));
+        substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
+            static_cast<int>(iSubStep) + 1, subtraj.row(iSubStep));
+      }
 
-        tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
+      tesseract_scene_graph::SceneState state = state_solver.getState(jn, subtraj.row(iSubStep));
+      sub_state_results.clear();
+      tesseract_environment::checkTrajectoryState(sub_state_results, manager, state.link_transforms, config);
+      if (!sub_state_results.empty())
+      {
+        found = true;
 
         if (debug_logging)
         {
-          step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
-              static_cast<int>(iStep + 1), joint_positions0, joint_positions1, static_cast<int>(subtraj.rows()));
+          substep_contacts->contacts = sub_state_results;
+          step_contacts->substeps[static_cast<size_t>(iSubStep)] = *substep_contacts;
         }
+        double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
+        state_results.addInterpolatedCollisionResults(sub_state_results,
+                                                      iSubStep,
+                                                      sub_segment_last_index,
+                                                      manager.getActiveCollisionObjects(),
+                                                      segment_dt,
+                                                      true);
+      }
 
-        auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
+      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+        break;
+    }
 
-        // Update start and end index based on collision check program mode
-        long start_idx{ 0 };
-        long end_idx(subtraj.rows() - 1);
-        if (iStep == 0)
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            ++start_idx;
-        }
-        if (iStep == (mi.size() - 2))
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            --end_idx;
-        }
+    if (debug_logging)
+    {
+      traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+    }
 
-        for (long iSubStep = start_idx; iSubStep < end_idx; ++iSubStep)
-        {
-          tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
-          if (debug_logging)
-          {
-            substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
-                static_cast<int>(iSubStep) + 1, subtraj.row(iSubStep), subtraj.row(iSubStep + 1));
-          }
+    return found;
+  }
 
-          tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names, subtraj.row(iSubStep));
-          tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names, subtraj.row(iSubStep + 1));
-          sub_state_results.clear();
-          tesseract_environment::checkTrajectorySegment(
-              sub_state_results, manager, state0.link_transforms, state1.link_transforms, config.contact_request);
-          if (!sub_state_results.empty())
-          {
-            found = true;
-
-            if (debug_logging)
-            {
-              substep_contacts->contacts = sub_state_results;
-              step_contacts->substeps[static_cast<size_t>(iSubStep)] = *substep_contacts;
-            }
-            double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
-            state_results.addInterpolatedCollisionResults(sub_state_results,
-                                                          iSubStep,
-                                                          sub_segment_last_index,
-                                                          manager.getActiveCollisionObjects(),
-                                                          segment_dt,
-                                                          false);
-          }
+  tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
+  tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+  tesseract_collision::ContactTrajectorySubstepResults::UPtr end_substep_contacts;
+  if (debug_logging)
+  {
+    step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(iStep + 1, p0);
+    substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(1, p0);
+    end_substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(2, p1);
+  }
+
+  if (iStep == 0 && mi.size() == 2)
+  {
+    if (config.check_program_mode != tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START &&
+        config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+    {
+      tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
+      sub_state_results.clear();
+      tesseract_environment::checkTrajectoryState(
+          sub_state_results, manager, state.link_transforms, config.contact_request);
+      if (!sub_state_results.empty())
+      {
+        found = true;
+        state_results.addInterpolatedCollisionResults(
+            sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
 
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
+        if (debug_logging)
+        {
+          substep_contacts->contacts = state_results;
+          step_contacts->substeps[0] = *substep_contacts;
+          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
         }
-        contacts.push_back(state_results);
+      }
+
+      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+        return found;
+    }
 
+    if (config.check_program_mode != tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END &&
+        config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+    {
+      tesseract_scene_graph::SceneState state = state_solver.getState(jn, p1);
+      sub_state_results.clear();
+      tesseract_environment::checkTrajectoryState(
+          sub_state_results, manager, state.link_transforms, config.contact_request);
+      if (!sub_state_results.empty())
+      {
+        found = true;
         if (debug_logging)
         {
+          end_substep_contacts->contacts = sub_state_results;
+          step_contacts->substeps[1] = *end_substep_contacts;
           traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
         }
+        state_results.addInterpolatedCollisionResults(
+            sub_state_results, 1, 1, manager.getActiveCollisionObjects(), 1, true);
+      }
+    }
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
+    return found;
+  }
+
+  if (iStep == 0)
+  {
+    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
+        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+      return found;
+  }
+
+  tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
+  sub_state_results.clear();
+  tesseract_environment::checkTrajectoryState(
+      sub_state_results, manager, state.link_transforms, config.contact_request);
+  if (!sub_state_results.empty())
+  {
+    found = true;
+    if (debug_logging)
+    {
+      substep_contacts->contacts = sub_state_results;
+      step_contacts->substeps[0] = *substep_contacts;
+      traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+    }
+    state_results.addInterpolatedCollisionResults(
+        sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
+  }
+
+  if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+    return found;
+
+  // If last segment check the end state
+  if (iStep == (mi.size() - 2))
+  {
+    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
+        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+      return found;
+
+    tesseract_scene_graph::SceneState state = state_solver.getState(jn, p1);
+    sub_state_results.clear();
+    tesseract_environment::checkTrajectoryState(
+        sub_state_results, manager, state.link_transforms, config.contact_request);
+    if (!sub_state_results.empty())
+    {
+      found = true;
+      if (debug_logging)
+      {
+        end_substep_contacts->contacts = sub_state_results;
+        step_contacts->substeps[1] = *end_substep_contacts;
+        traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
       }
-      else
+      state_results.addInterpolatedCollisionResults(
+          sub_state_results, 1, 1, manager.getActiveCollisionObjects(), 1, true);
+    }
+
+    if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+      return found;
+  }
+
+  if (debug_logging)
+  {
+    traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
+  }
+
+  return found;
+}
+
+/**
+ * @brief Check the steps of a flattened program in parallel
+ * @details The steps are split into chunks which run as the jobs of the parallel for. Each job uses a clone of the
+ * contact manager and state solver, and the clones are reused by later jobs so only one is created per job running at
+ * the same time. When the contact test type is FIRST, the index of the first step found in collision is shared between
+ * jobs so steps after it are skipped. The results are merged in step order and the merge stops at the same step as the
+ * serial implementation, so the output is identical.
+ * @param contacts The output contacts
+ * @param manager The contact manager to clone for each job
+ * @param state_solver The environment state solver to clone for each job
+ * @param mi The flattened move instructions
+ * @param num_steps The number of steps
+ * @param config CollisionCheckConfig used to specify collision check settings
+ * @param parallel_for The parallel for used to run the chunks
+ * @param check_step The function used to check a single step
+ * @return True if collision was found, otherwise false.
+ */
+template <typename ManagerType, typename CheckStepFn>
+bool checkStepsParallel(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                        const ManagerType& manager,
+                        const tesseract_scene_graph::StateSolver& state_solver,
+                        const std::vector<std::reference_wrapper<const InstructionPoly>>& mi,
+                        std::size_t num_steps,
+                        const tesseract_collision::CollisionCheckConfig& config,
+                        const PlannerParallelFor& parallel_for,
+                        const CheckStepFn& check_step)
+{
+  struct StepResult
+  {
+    tesseract_collision::ContactResultMap contacts;
+    bool record{ true };
+    bool found{ false };
+  };
+
+  struct Worker
+  {
+    typename ManagerType::UPtr manager;
+    tesseract_scene_graph::StateSolver::UPtr state_solver;
+  };
+
+  const bool first_only = (config.contact_request.type == tesseract_collision::ContactTestType::FIRST);
+  const std::size_t max_chunks = std::max<std::size_t>(1, std::thread::hardware_concurrency()) * 4;
+  const std::size_t chunk_size = (num_steps + max_chunks - 1) / max_chunks;
+  const std::size_t num_chunks = (num_steps + chunk_size - 1) / chunk_size;
+
+  std::vector<StepResult> results(num_steps);
+  std::atomic<std::size_t> first_found{ num_steps };
+  std::vector<Worker> workers;
+  std::exception_ptr error;
+  std::mutex mutex;
+
+  auto job = [&](std::size_t chunk) {
+    const std::size_t start = chunk * chunk_size;
+    const std::size_t end = std::min(start + chunk_size, num_steps);
+
+    // Nothing after the first collision is needed
+    if (first_only && start > first_found.load())
+      return;
+
+    Worker worker;
+    {
+      std::scoped_lock lock(mutex);
+      if (error)
+        return;
+
+      if (!workers.empty())
       {
-        // Update start and end index based on collision check program mode
-        if (iStep == 0)
+        worker = std::move(workers.back());
+        workers.pop_back();
+      }
+    }
+
+    try
+    {
+      if (worker.manager == nullptr)
+      {
+        worker.manager = manager.clone();
+        worker.manager->applyContactManagerConfig(config.contact_manager_config);
+        worker.state_solver = state_solver.clone();
+      }
+
+      tesseract_collision::ContactResultMap sub_state_results;
+      for (std::size_t iStep = start; iStep < end; ++iStep)
+      {
+        if (first_only && iStep > first_found.load())
+          break;
+
+        StepResult& result = results[iStep];
+        result.found = check_step(result.contacts,
+                                  sub_state_results,
+                                  result.record,
+                                  *worker.manager,
+                                  *worker.state_solver,
+                                  mi,
+                                  iStep,
+                                  config,
+                                  nullptr);
+
+        if (first_only && result.found)
         {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+          std::size_t current = first_found.load();
+          while (iStep < current && !first_found.compare_exchange_weak(current, iStep))
           {
-            contacts.emplace_back(tesseract_collision::ContactResultMap{});
-            continue;
           }
         }
-        if (iStep == (mi.size() - 2))
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            continue;
-        }
+      }
+    }
+    catch (...)
+    {
+      std::scoped_lock lock(mutex);
+      if (!error)
+        error = std::current_exception();
 
-        const auto& joint_names0 = getJointNames(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
-        const auto& joint_positions0 = getJointPosition(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
+      // Skip the remaining chunks
+      first_found = 0;
+      return;
+    }
 
-        const auto& joint_names1 = getJointNames(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
-        const auto& joint_positions1 = getJointPosition(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
+    std::scoped_lock lock(mutex);
+    workers.push_back(std::move(worker));
+  };
 
-        tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names0, joint_positions0);
-        tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names1, joint_positions1);
+  parallelFor(parallel_for, num_chunks, job);
 
-        tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
-        tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+  if (error)
+    std::rethrow_exception(error);
 
-        if (debug_logging)
-        {
-          step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
-              static_cast<int>(iStep + 1), joint_positions0, joint_positions1, 1);
-          substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
-              1, joint_positions0, joint_positions1);
-        }
+  bool found = false;
+  for (auto& result : results)
+  {
+    if (result.record)
+      contacts.push_back(std::move(result.contacts));
 
-        tesseract_environment::checkTrajectorySegment(
-            state_results, manager, state0.link_transforms, state1.link_transforms, config);
-        if (!state_results.empty())
-        {
-          found = true;
+    if (result.found)
+    {
+      found = true;
+      if (first_only)
+        break;
+    }
+  }
+
+  return found;
+}
+}  // namespace
+
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type (Continuous)");
+
+  // Flatten results
+  std::vector<std::reference_wrapper<const InstructionPoly>> mi = program.flatten(moveFilter);
+
+  if (mi.size() < 2)
+    throw std::runtime_error("contactCheckProgram was given continuous contact manager with a trajectory that only has "
+                             "one state.");
+
+  manager.applyContactManagerConfig(config.contact_manager_config);
+
+  bool debug_logging = console_bridge::getLogLevel() < console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO;
+
+  tesseract_collision::ContactTrajectoryResults::UPtr traj_contacts;
+  if (debug_logging)
+  {
+    // Grab the first waypoint to get the joint names
+    const auto& joint_names = getJointNames(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
+    traj_contacts =
+        std::make_unique<tesseract_collision::ContactTrajectoryResults>(joint_names, static_cast<int>(program.size()));
+  }
 
-          if (debug_logging)
-          {
-            substep_contacts->contacts = state_results;
-            step_contacts->substeps[0] = *substep_contacts;
-            traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-          }
-        }
-        contacts.push_back(state_results);
+  contacts.clear();
+  contacts.reserve(mi.size());
 
-        if (debug_logging)
-        {
-          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-        }
+  /** @brief Making this thread_local does not help because it is not called enough during planning */
+  tesseract_collision::ContactResultMap state_results;
+  tesseract_collision::ContactResultMap sub_state_results;
 
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-    }
-  }
-  else
+  bool found = false;
+  if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY)
   {
-    std::size_t start_idx{ 0 };
-    std::size_t end_idx(mi.size() - 1);
-    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
+    const auto& joint_names = getJointNames(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
+    const auto& joint_positions = getJointPosition(mi.front().get().as<MoveInstructionPoly>().getWaypoint());
+    tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, joint_positions);
+    sub_state_results.clear();
+    tesseract_environment::checkTrajectoryState(
+        sub_state_results, manager, state.link_transforms, config.contact_request);
+
+    if (!sub_state_results.empty())
     {
-      contacts.emplace_back(tesseract_collision::ContactResultMap{});
-      ++start_idx;
+      found = true;
+      // Always use addInterpolatedCollisionResults so cc_type is defined correctly
+      state_results.addInterpolatedCollisionResults(
+          sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, false);
+      if (debug_logging)
+        printContinuousDebugInfo(joint_names, joint_positions, joint_positions, 0, mi.size() - 1);
     }
+    contacts.push_back(state_results);
+    return found;
+  }
 
-    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-      --end_idx;
+  if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
+  {
+    const auto& joint_names = getJointNames(mi.back().get().as<MoveInstructionPoly>().getWaypoint());
+    const auto& joint_positions = getJointPosition(mi.back().get().as<MoveInstructionPoly>().getWaypoint());
+    tesseract_scene_graph::SceneState state = state_solver.getState(joint_names, joint_positions);
+    sub_state_results.clear();
+    tesseract_environment::checkTrajectoryState(
+        sub_state_results, manager, state.link_transforms, config.contact_request);
 
-    for (std::size_t iStep = start_idx; iStep < end_idx; ++iStep)
+    if (!sub_state_results.empty())
     {
-      state_results.clear();
-
-      const auto& joint_names0 = getJointNames(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
-      const auto& joint_positions0 = getJointPosition(mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint());
-
-      const auto& joint_names1 = getJointNames(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
-      const auto& joint_positions1 = getJointPosition(mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint());
-
-      tesseract_scene_graph::SceneState state0 = state_solver.getState(joint_names0, joint_positions0);
-      tesseract_scene_graph::SceneState state1 = state_solver.getState(joint_names1, joint_positions1);
-
-      tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
-      tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
+      found = true;
+      // Always use addInterpolatedCollisionResults so cc_type is defined correctly
+      state_results.addInterpolatedCollisionResults(
+          sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, false);
       if (debug_logging)
-      {
-        step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
-            static_cast<int>(iStep + 1), joint_positions0, joint_positions1, 1);
-        substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
-            1, joint_positions0, joint_positions1);
-      }
+        printContinuousDebugInfo(joint_names, joint_positions, joint_positions, 0, mi.size() - 1);
+    }
+    contacts.push_back(state_results);
+    return found;
+  }
 
-      tesseract_environment::checkTrajectorySegment(
-          state_results, manager, state0.link_transforms, state1.link_transforms, config);
-      if (!state_results.empty())
-      {
-        found = true;
+  for (std::size_t iStep = 0; iStep < mi.size() - 1; ++iStep)
+  {
+    bool record{ true };
+    bool step_found = checkContinuousStep(
+        state_results, sub_state_results, record, manager, state_solver, mi, iStep, config, traj_contacts.get());
 
-        if (debug_logging)
-        {
-          substep_contacts->contacts = state_results;
-          step_contacts->substeps[0] = *substep_contacts;
-          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-        }
-      }
+    if (record)
       contacts.push_back(state_results);
 
-      if (debug_logging)
-      {
-        traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-      }
-
-      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
+    if (step_found)
+    {
+      found = true;
+      if (config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
         break;
     }
   }
@@ -598,6 +1016,33 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
   return found;
 }
 
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::ContinuousContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         const PlannerParallelFor& parallel_for)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::CONTINUOUS &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type (Continuous)");
+
+  std::vector<std::reference_wrapper<const InstructionPoly>> mi = program.flatten(moveFilter);
+  bool debug_logging = console_bridge::getLogLevel() < console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO;
+
+  // The debug trajectory table and single state modes are only supported by the serial implementation
+  if (!parallel_for || debug_logging || mi.size() < 3 ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
+    return contactCheckProgram(contacts, manager, state_solver, program, config);
+
+  contacts.clear();
+  contacts.reserve(mi.size());
+  return checkStepsParallel(
+      contacts, manager, state_solver, mi, mi.size() - 1, config, parallel_for, checkContinuousStep);
+}
+
 bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
                          tesseract_collision::DiscreteContactManager& manager,
                          const tesseract_scene_graph::StateSolver& state_solver,
@@ -721,309 +1166,72 @@ bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& con
     return (!state_results.empty());
   }
 
-  if (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+  const std::size_t num_steps =
+      (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE) ? mi.size() - 1 : mi.size();
+  for (std::size_t iStep = 0; iStep < num_steps; ++iStep)
   {
-    assert(config.longest_valid_segment_length > 0);
-
-    for (std::size_t iStep = 0; iStep < (mi.size() - 1); ++iStep)
-    {
-      state_results.clear();
-
-      const auto& wp0 = mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint();
-      const std::vector<std::string>& jn = getJointNames(wp0);
-      const Eigen::VectorXd& p0 = getJointPosition(wp0);
-
-      const auto& wp1 = mi.at(iStep + 1).get().as<MoveInstructionPoly>().getWaypoint();
-      const Eigen::VectorXd& p1 = getJointPosition(wp1);
-      const double dist = (p1 - p0).norm();
-
-      if (dist > config.longest_valid_segment_length)
-      {
-        auto cnt = static_cast<int>(std::ceil(dist / config.longest_valid_segment_length)) + 1;
-        tesseract_common::TrajArray subtraj(cnt, p0.size());
-        for (long iVar = 0; iVar < p0.size(); ++iVar)
-          subtraj.col(iVar) = Eigen::VectorXd::LinSpaced(cnt, p0(iVar), p1(iVar));
-
-        tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
-
-        if (debug_logging)
-        {
-          step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(
-              iStep + 1, p0, p1, static_cast<int>(subtraj.rows()));
-        }
-
-        auto sub_segment_last_index = static_cast<int>(subtraj.rows() - 1);
-
-        // Update start and end index based on collision check program mode
-        long start_idx{ 0 };
-        long end_idx(subtraj.rows() - 1);
-        if (iStep == 0)
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            ++start_idx;
-        }
-        if (iStep == (mi.size() - 2))
-        {
-          // This is the last segment so check the last state
-          end_idx = subtraj.rows();
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-            --end_idx;
-        }
-
-        for (long iSubStep = start_idx; iSubStep < end_idx; ++iSubStep)
-        {
-          tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
-          if (debug_logging)
-          {
-            substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(
-                static_cast<int>(iSubStep) + 1, subtraj.row(iSubStep));
-          }
+    bool record{ true };
+    bool step_found = checkDiscreteStep(
+        state_results, sub_state_results, record, manager, state_solver, mi, iStep, config, traj_contacts.get());
 
-          tesseract_scene_graph::SceneState state = state_solver.getState(jn, subtraj.row(iSubStep));
-          sub_state_results.clear();
-          tesseract_environment::checkTrajectoryState(sub_state_results, manager, state.link_transforms, config);
-          if (!sub_state_results.empty())
-          {
-            found = true;
-
-            if (debug_logging)
-            {
-              substep_contacts->contacts = sub_state_results;
-              step_contacts->substeps[static_cast<size_t>(iSubStep)] = *substep_contacts;
-            }
-            double segment_dt = (sub_segment_last_index > 0) ? 1.0 / static_cast<double>(sub_segment_last_index) : 0.0;
-            state_results.addInterpolatedCollisionResults(sub_state_results,
-                                                          iSubStep,
-                                                          sub_segment_last_index,
-                                                          manager.getActiveCollisionObjects(),
-                                                          segment_dt,
-                                                          true);
-          }
-
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            break;
-        }
-        contacts.push_back(state_results);
-
-        if (debug_logging)
-        {
-          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-        }
-
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          break;
-      }
-      else
-      {
-        tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
-        tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
-        tesseract_collision::ContactTrajectorySubstepResults::UPtr end_substep_contacts;
-        if (debug_logging)
-        {
-          step_contacts = std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(iStep + 1, p0);
-          substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(1, p0);
-          end_substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(2, p1);
-        }
-
-        if (iStep == 0 && mi.size() == 2)
-        {
-          if (config.check_program_mode != tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START &&
-              config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
-            sub_state_results.clear();
-            tesseract_environment::checkTrajectoryState(
-                sub_state_results, manager, state.link_transforms, config.contact_request);
-            if (!sub_state_results.empty())
-            {
-              found = true;
-              state_results.addInterpolatedCollisionResults(
-                  sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-
-              if (debug_logging)
-              {
-                substep_contacts->contacts = state_results;
-                step_contacts->substeps[0] = *substep_contacts;
-                traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-              }
-            }
-
-            if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            {
-              contacts.push_back(state_results);
-              break;
-            }
-          }
-
-          if (config.check_program_mode != tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END &&
-              config.check_program_mode != tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            tesseract_scene_graph::SceneState state = state_solver.getState(jn, p1);
-            sub_state_results.clear();
-            tesseract_environment::checkTrajectoryState(
-                sub_state_results, manager, state.link_transforms, config.contact_request);
-            if (!sub_state_results.empty())
-            {
-              found = true;
-              if (debug_logging)
-              {
-                end_substep_contacts->contacts = sub_state_results;
-                step_contacts->substeps[1] = *end_substep_contacts;
-                traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-              }
-              state_results.addInterpolatedCollisionResults(
-                  sub_state_results, 1, 1, manager.getActiveCollisionObjects(), 1, true);
-            }
-
-            if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-            {
-              contacts.push_back(state_results);
-              break;
-            }
-          }
-
-          contacts.push_back(state_results);
-          break;
-        }
-
-        if (iStep == 0)
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            contacts.emplace_back(tesseract_collision::ContactResultMap{});
-            continue;
-          }
-        }
-
-        tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
-        sub_state_results.clear();
-        tesseract_environment::checkTrajectoryState(
-            sub_state_results, manager, state.link_transforms, config.contact_request);
-        if (!sub_state_results.empty())
-        {
-          found = true;
-          if (debug_logging)
-          {
-            substep_contacts->contacts = sub_state_results;
-            step_contacts->substeps[0] = *substep_contacts;
-            traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-          }
-          state_results.addInterpolatedCollisionResults(
-              sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-        }
-
-        if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-        {
-          contacts.push_back(state_results);
-          break;
-        }
-
-        // If last segment check the end state
-        if (iStep == (mi.size() - 2))
-        {
-          if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-              config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-          {
-            contacts.push_back(state_results);
-            continue;
-          }
-
-          tesseract_scene_graph::SceneState state = state_solver.getState(jn, p1);
-          sub_state_results.clear();
-          tesseract_environment::checkTrajectoryState(
-              sub_state_results, manager, state.link_transforms, config.contact_request);
-          if (!sub_state_results.empty())
-          {
-            found = true;
-            if (debug_logging)
-            {
-              end_substep_contacts->contacts = sub_state_results;
-              step_contacts->substeps[1] = *end_substep_contacts;
-              traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-            }
-            state_results.addInterpolatedCollisionResults(
-                sub_state_results, 1, 1, manager.getActiveCollisionObjects(), 1, true);
-          }
-
-          if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-          {
-            contacts.push_back(state_results);
-            break;
-          }
-        }
-
-        contacts.push_back(state_results);
+    if (record)
+      contacts.push_back(state_results);
 
-        if (debug_logging)
-        {
-          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-        }
-      }
+    if (step_found)
+    {
+      found = true;
+      if (config.contact_request.type == tesseract_collision::ContactTestType::FIRST)
+        break;
     }
   }
-  else
-  {
-    std::size_t start_idx{ 0 };
-    std::size_t end_idx(mi.size());
 
-    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START ||
-        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-    {
-      contacts.emplace_back(tesseract_collision::ContactResultMap{});
-      ++start_idx;
-    }
+  if (debug_logging)
+    std::cout << traj_contacts->trajectoryCollisionResultsTable().str();
 
-    if (config.check_program_mode == tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END ||
-        config.check_program_mode == tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY)
-      --end_idx;
+  return found;
+}
 
-    for (std::size_t iStep = start_idx; iStep < end_idx; ++iStep)
-    {
-      state_results.clear();
+bool contactCheckProgram(std::vector<tesseract_collision::ContactResultMap>& contacts,
+                         tesseract_collision::DiscreteContactManager& manager,
+                         const tesseract_scene_graph::StateSolver& state_solver,
+                         const CompositeInstruction& program,
+                         const tesseract_collision::CollisionCheckConfig& config,
+                         const PlannerParallelFor& parallel_for)
+{
+  if (config.type != tesseract_collision::CollisionEvaluatorType::DISCRETE &&
+      config.type != tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE)
+    throw std::runtime_error("contactCheckProgram was given an CollisionEvaluatorType that is inconsistent with the "
+                             "ContactManager type (Discrete)");
 
-      const auto& wp0 = mi.at(iStep).get().as<MoveInstructionPoly>().getWaypoint();
-      const std::vector<std::string>& jn = getJointNames(wp0);
-      const Eigen::VectorXd& p0 = getJointPosition(wp0);
+  std::vector<std::reference_wrapper<const InstructionPoly>> mi = program.flatten(moveFilter);
+  bool debug_logging = console_bridge::getLogLevel() < console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_INFO;
 
-      tesseract_collision::ContactTrajectoryStepResults::UPtr step_contacts;
-      tesseract_collision::ContactTrajectorySubstepResults::UPtr substep_contacts;
-      if (debug_logging)
-      {
-        step_contacts =
-            std::make_unique<tesseract_collision::ContactTrajectoryStepResults>(static_cast<int>(iStep + 1), p0);
-        substep_contacts = std::make_unique<tesseract_collision::ContactTrajectorySubstepResults>(1, p0);
-      }
+  // The debug trajectory table and single state modes are only supported by the serial implementation
+  if (!parallel_for || debug_logging || mi.size() < 3 ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::START_ONLY ||
+      config.check_program_mode == tesseract_collision::CollisionCheckProgramType::END_ONLY)
+    return contactCheckProgram(contacts, manager, state_solver, program, config);
 
-      tesseract_scene_graph::SceneState state = state_solver.getState(jn, p0);
-      sub_state_results.clear();
-      tesseract_environment::checkTrajectoryState(
-          sub_state_results, manager, state.link_transforms, config.contact_request);
-      if (!sub_state_results.empty())
-      {
-        found = true;
-        if (debug_logging)
-        {
-          substep_contacts->contacts = sub_state_results;
-          step_contacts->substeps[0] = *substep_contacts;
-          traj_contacts->steps[static_cast<size_t>(iStep)] = *step_contacts;
-        }
-        state_results.addInterpolatedCollisionResults(
-            sub_state_results, 0, 0, manager.getActiveCollisionObjects(), 0, true);
-      }
-      contacts.push_back(state_results);
+  const std::size_t num_steps =
+      (config.type == tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE) ? mi.size() - 1 : mi.size();
 
-      if (found && (config.contact_request.type == tesseract_collision::ContactTestType::FIRST))
-        break;
-    }
-  }
+  contacts.clear();
+  contacts.reserve(mi.size());
+  return checkStepsParallel(contacts, manager, state_solver, mi, num_steps, config, parallel_for, checkDiscreteStep);
+}
 
-  if (debug_logging)
-    std::cout << traj_contacts->trajectoryCollisionResultsTable().str();
+void parallelFor(const PlannerParallelFor& parallel_for,
+                 std::size_t count,
+                 const std::function<void(std::size_t)>& job)
+{
+  if (count > 1 && parallel_for)
+  {
+    parallel_for(count, job);
+    return;
+  }
 
-  return found;
+  for (std::size_t i = 0; i < count; ++i)
+    job(i);
 }
 
 }  // namespace tesseract_planning
@@ -0,0 +1,87 @@
+/**
+ * @file contact_manager_pool_benchmark.cpp
+ * @brief Benchmark cloning contact managers against reusing them from a pool
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/utils.h>
+#include <tesseract_motion_planners/core/contact_manager_pool.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+/** @brief The previous behavior of the fix state collision task, cloning a manager for every state checked */
+static void BM_ContactManagerClone(benchmark::State& state)
+{
+  Environment::Ptr env = getEnvironment();
+  auto joint_group = env->getJointGroup("manipulator");
+  tesseract_collision::CollisionCheckConfig config(0.025);
+  Eigen::VectorXd position = Eigen::VectorXd::Zero(joint_group->numJoints());
+  for (auto _ : state)
+  {
+    tesseract_collision::DiscreteContactManager::Ptr manager = env->getDiscreteContactManager();
+    manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
+    manager->applyContactManagerConfig(config.contact_manager_config);
+
+    tesseract_collision::ContactResultMap contacts;
+    tesseract_environment::checkTrajectoryState(contacts, *manager, joint_group->calcFwdKin(position), config);
+    benchmark::DoNotOptimize(contacts);
+  }
+}
+
+/** @brief The same check reusing managers from a pool */
+static void BM_ContactManagerPool(benchmark::State& state)
+{
+  Environment::Ptr env = getEnvironment();
+  auto joint_group = env->getJointGroup("manipulator");
+  tesseract_collision::CollisionCheckConfig config(0.025);
+  Eigen::VectorXd position = Eigen::VectorXd::Zero(joint_group->numJoints());
+  ContactManagerPool pool;
+  for (auto _ : state)
+  {
+    tesseract_collision::DiscreteContactManager::Ptr manager =
+        pool.getDiscreteContactManager(env, joint_group->getActiveLinkNames(), config.contact_manager_config);
+
+    tesseract_collision::ContactResultMap contacts;
+    tesseract_environment::checkTrajectoryState(contacts, *manager, joint_group->calcFwdKin(position), config);
+    benchmark::DoNotOptimize(contacts);
+  }
+}
+
+BENCHMARK(BM_ContactManagerClone)->Threads(1)->Threads(4)->UseRealTime();
+BENCHMARK(BM_ContactManagerPool)->Threads(1)->Threads(4)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,116 @@
+/**
+ * @file profile_dictionary_benchmark.cpp
+ * @brief Benchmark resolving profiles through the profile dictionary against a profile snapshot
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_motion_planners/planner_utils.h>
+
+using namespace tesseract_planning;
+
+static const std::string NAMESPACE = "TrajOptMotionPlannerTask";
+
+struct BenchmarkProfile
+{
+  BenchmarkProfile() = default;
+  BenchmarkProfile(int value) : value(value) {}
+  virtual ~BenchmarkProfile() = default;
+  BenchmarkProfile(const BenchmarkProfile&) = default;
+  BenchmarkProfile& operator=(const BenchmarkProfile&) = default;
+  BenchmarkProfile(BenchmarkProfile&&) = default;
+  BenchmarkProfile& operator=(BenchmarkProfile&&) = default;
+
+  int value{ 0 };
+  std::vector<double> data = std::vector<double>(16, 0);
+};
+
+/** @brief Create a dictionary with profiles for several planners and the profile names used by each waypoint */
+static void createProfiles(ProfileDictionary& profiles, std::vector<std::string>& waypoint_profiles, long num_waypoints)
+{
+  for (const std::string& ns : std::vector<std::string>{ "DescartesMotionPlannerTask", NAMESPACE, "OMPLTask" })
+  {
+    for (int i = 0; i < 10; ++i)
+      profiles.addProfile<BenchmarkProfile>(ns, "PROFILE_" + std::to_string(i), std::make_shared<BenchmarkProfile>(i));
+  }
+
+  // Every fourth waypoint uses a profile which is not in the dictionary so the default profile is used
+  waypoint_profiles.clear();
+  for (long i = 0; i < num_waypoints; ++i)
+    waypoint_profiles.push_back("PROFILE_" + std::to_string((i % 4 == 3) ? 10 : (i % 10)));
+}
+
+/** @brief Resolve the profile of every waypoint the way the planners did, through the profile dictionary */
+static void BM_ProfileDictionaryResolve(benchmark::State& state)
+{
+  ProfileDictionary profiles;
+  std::vector<std::string> waypoint_profiles;
+  createProfiles(profiles, waypoint_profiles, state.range(0));
+  PlannerProfileRemapping remapping;
+  ProfileDictionary::ConstPtr overrides;
+
+  for (auto _ : state)
+  {
+    for (const auto& name : waypoint_profiles)
+    {
+      std::string profile = getProfileString(NAMESPACE, name, remapping);
+      auto cur_profile =
+          getProfile<BenchmarkProfile>(NAMESPACE, profile, profiles, std::make_shared<BenchmarkProfile>());
+      cur_profile = applyProfileOverrides(NAMESPACE, profile, cur_profile, overrides);
+      benchmark::DoNotOptimize(cur_profile);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief Resolve the profile of every waypoint using a snapshot built once per request */
+static void BM_ProfileSnapshotResolve(benchmark::State& state)
+{
+  ProfileDictionary profiles;
+  std::vector<std::string> waypoint_profiles;
+  createProfiles(profiles, waypoint_profiles, state.range(0));
+  PlannerProfileRemapping remapping;
+  ProfileDictionary::ConstPtr overrides;
+
+  for (auto _ : state)
+  {
+    ProfileSnapshot<BenchmarkProfile> snapshot(NAMESPACE, profiles, remapping, std::make_shared<BenchmarkProfile>());
+    for (const auto& name : waypoint_profiles)
+    {
+      auto cur_profile = snapshot.getProfile(name, overrides);
+      benchmark::DoNotOptimize(cur_profile);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_ProfileDictionaryResolve)->RangeMultiplier(10)->Range(10, 10000);
+BENCHMARK(BM_ProfileSnapshotResolve)->RangeMultiplier(10)->Range(10, 10000);
+
+BENCHMARK_MAIN();
@@ -26,9 +26,12 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_motion_planners/planner_utils.h>
 
 struct ProfileBase
 {
@@ -123,6 +126,101 @@ TEST(TesseractPlanningProfileDictionaryUnit, ProfileDictionaryTest)  // NOLINT
   auto profile_check4 = profiles.getProfile<ProfileBase>("ns", "key");
   EXPECT_TRUE(profile_check4 != nullptr);
   EXPECT_EQ(profile_check4->a, 20);
+
+  // Try get a profile entry and profile
+  auto entry = profiles.tryGetProfileEntry<ProfileBase>("ns");
+  ASSERT_TRUE(entry.has_value());
+  EXPECT_EQ(entry->at("key")->a, 20);
+  EXPECT_FALSE(profiles.tryGetProfileEntry<ProfileBase>("DoesNotExist").has_value());
+  EXPECT_FALSE(profiles.tryGetProfileEntry<int>("ns").has_value());
+  EXPECT_EQ(profiles.tryGetProfile<ProfileBase>("ns", "key")->a, 20);
+  EXPECT_TRUE(profiles.tryGetProfile<ProfileBase>("ns", "DoesNotExist") == nullptr);
+  EXPECT_TRUE(profiles.tryGetProfile<ProfileBase>("DoesNotExist", "key") == nullptr);
+  EXPECT_TRUE(profiles.tryGetProfile<int>("ns", "key") == nullptr);
+
+  // Every change gets a new version and no other dictionary uses it
+  std::size_t version = profiles.getVersion();
+  EXPECT_EQ(profiles.getVersion(), version);
+  EXPECT_NE(ProfileDictionary().getVersion(), version);
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(30));
+  EXPECT_NE(profiles.getVersion(), version);
+  version = profiles.getVersion();
+  profiles.removeProfile<ProfileBase>("ns", "key");
+  EXPECT_NE(profiles.getVersion(), version);
+  version = profiles.getVersion();
+  profiles.removeProfileEntry<ProfileBase2>("ns");
+  EXPECT_NE(profiles.getVersion(), version);
+  version = profiles.getVersion();
+  profiles.clear();
+  EXPECT_NE(profiles.getVersion(), version);
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileSnapshotConcurrentRemoveTest)  // NOLINT
+{
+  // Creating snapshots while profiles are removed must never throw
+  ProfileDictionary profiles;
+  PlannerProfileRemapping remapping;
+  std::atomic<bool> done{ false };
+  std::thread writer([&profiles, &done]() {
+    for (int i = 0; i < 1000; ++i)
+    {
+      profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(i));
+      profiles.removeProfileEntry<ProfileBase>("ns");
+      profiles.clear();
+    }
+    done = true;
+  });
+
+  while (!done)
+  {
+    EXPECT_NO_THROW(ProfileSnapshot<ProfileBase>("ns", profiles, remapping).getProfile("key", nullptr));  // NOLINT
+    EXPECT_NO_THROW(getProfile<ProfileBase>("ns", "missing", profiles));                                 // NOLINT
+  }
+  writer.join();
+}
+
+TEST(TesseractPlanningProfileDictionaryUnit, ProfileSnapshotTest)  // NOLINT
+{
+  ProfileDictionary profiles;
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(1));
+  profiles.addProfile<ProfileBase>("ns", DEFAULT_PROFILE_KEY, std::make_shared<ProfileTest>(2));
+
+  PlannerProfileRemapping remapping;
+  remapping["ns"]["remapped"] = "key";
+  remapping["other_ns"]["key"] = "missing";
+
+  ProfileSnapshot<ProfileBase> snapshot("ns", profiles, remapping, std::make_shared<ProfileTest>(3));
+  EXPECT_EQ(snapshot.getProfile("key")->a, 1);
+  EXPECT_EQ(snapshot.getProfile("")->a, 2);
+  EXPECT_EQ(snapshot.getProfile(DEFAULT_PROFILE_KEY)->a, 2);
+  EXPECT_EQ(snapshot.getProfile("remapped")->a, 1);
+  EXPECT_EQ(snapshot.getProfile("missing")->a, 3);
+  EXPECT_EQ(snapshot.getProfileString("remapped"), "key");
+  EXPECT_EQ(snapshot.getProfileString(""), DEFAULT_PROFILE_KEY);
+
+  // The snapshot must match resolving each profile through the dictionary
+  for (const std::string& name : { "key", "", "remapped", "missing" })
+  {
+    std::string profile = getProfileString("ns", name, remapping);
+    EXPECT_EQ(snapshot.getProfileString(name), profile);
+    auto expected = getProfile<ProfileBase>("ns", profile, profiles, std::make_shared<ProfileTest>(3));
+    EXPECT_EQ(snapshot.getProfile(name)->a, expected->a);
+  }
+
+  // Overrides take precedence
+  auto overrides = std::make_shared<ProfileDictionary>();
+  overrides->addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(4));
+  EXPECT_EQ(snapshot.getProfile("key", overrides)->a, 4);
+  EXPECT_EQ(snapshot.getProfile("remapped", overrides)->a, 4);
+  EXPECT_EQ(snapshot.getProfile("missing", overrides)->a, 3);
+
+  // Changes to the dictionary are not seen by an existing snapshot
+  profiles.addProfile<ProfileBase>("ns", "key", std::make_shared<ProfileTest>(5));
+  EXPECT_EQ(snapshot.getProfile("key")->a, 1);
+
+  // A missing profile entry uses the default profile
+  ProfileSnapshot<ProfileBase2> empty_snapshot("ns", profiles, remapping);
+  EXPECT_TRUE(empty_snapshot.getProfile("key") == nullptr);
 }
 
 int main(int argc, char** argv)
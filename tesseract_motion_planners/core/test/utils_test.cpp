@@ -26,12 +26,18 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/commands/add_link_command.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/contact_manager_pool.h>
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
+#include <tesseract_motion_planners/core/environment_hash.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/move_instruction.h>
@@ -1699,6 +1705,403 @@ TEST_F(TesseractPlanningUtilsUnit, checkProgramUnit)  // NOLINT
         contacts, *continuous_manager, *state_solver, tesseract_planning::CompositeInstruction(), config));
   }
 }
+
+TEST_F(TesseractPlanningUtilsUnit, checkProgramParallelUnit)  // NOLINT
+{
+  // Add sphere to environment
+  tesseract_scene_graph::Link link_sphere("sphere_attached");
+
+  tesseract_scene_graph::Visual::Ptr visual = std::make_shared<tesseract_scene_graph::Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.visual.push_back(visual);
+
+  tesseract_scene_graph::Collision::Ptr collision = std::make_shared<tesseract_scene_graph::Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link_sphere.collision.push_back(collision);
+
+  tesseract_scene_graph::Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = tesseract_scene_graph::JointType::FIXED;
+
+  auto cmd = std::make_shared<tesseract_environment::AddLinkCommand>(link_sphere, joint_sphere);
+
+  EXPECT_TRUE(env_->applyCommand(cmd));
+
+  std::vector<std::string> joint_names{ "joint_a1", "joint_a2", "joint_a3", "joint_a4",
+                                        "joint_a5", "joint_a6", "joint_a7" };
+
+  Eigen::VectorXd joint_start_pos(7);
+  joint_start_pos << -0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  Eigen::VectorXd joint_end_pos(7);
+  joint_end_pos << 0.4, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+
+  // Sweep back and forth through the sphere so there are multiple regions in collision
+  const long num_states = 61;
+  tesseract_common::TrajArray traj(num_states, joint_start_pos.size());
+  for (long r = 0; r < num_states; ++r)
+  {
+    double t = std::abs(std::sin(static_cast<double>(r) * M_PI / 20.0));
+    traj.row(r) = joint_start_pos + t * (joint_end_pos - joint_start_pos);
+  }
+
+  CompositeInstruction traj_ci;
+  for (long r = 0; r < traj.rows(); ++r)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, traj.row(r)) };
+    traj_ci.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  auto state_solver = env_->getStateSolver();
+
+  auto expect_equal = [](const std::vector<tesseract_collision::ContactResultMap>& serial,
+                         const std::vector<tesseract_collision::ContactResultMap>& parallel) {
+    ASSERT_EQ(serial.size(), parallel.size());
+    for (std::size_t i = 0; i < serial.size(); ++i)
+    {
+      EXPECT_EQ(serial[i].size(), parallel[i].size());
+      EXPECT_EQ(serial[i].count(), parallel[i].count());
+      for (const auto& pair : serial[i])
+      {
+        auto it = parallel[i].find(pair.first);
+        ASSERT_TRUE(it != parallel[i].end());
+        ASSERT_EQ(pair.second.size(), it->second.size());
+
+        // The order of the results of a pair depends on the broadphase, so compare them sorted by distance
+        auto sorted = [](tesseract_collision::ContactResultVector results) {
+          std::sort(
+              results.begin(), results.end(), [](const auto& a, const auto& b) { return a.distance < b.distance; });
+          return results;
+        };
+        const tesseract_collision::ContactResultVector expected = sorted(pair.second);
+        const tesseract_collision::ContactResultVector actual = sorted(it->second);
+        for (std::size_t j = 0; j < expected.size(); ++j)
+        {
+          EXPECT_EQ(expected[j].link_names, actual[j].link_names);
+          EXPECT_NEAR(expected[j].distance, actual[j].distance, 1e-6);
+          EXPECT_TRUE(expected[j].nearest_points[0].isApprox(actual[j].nearest_points[0], 1e-6));
+          EXPECT_TRUE(expected[j].nearest_points[1].isApprox(actual[j].nearest_points[1], 1e-6));
+          EXPECT_EQ(expected[j].cc_type, actual[j].cc_type);
+          EXPECT_NEAR(expected[j].cc_time[0], actual[j].cc_time[0], 1e-6);
+          EXPECT_NEAR(expected[j].cc_time[1], actual[j].cc_time[1], 1e-6);
+        }
+      }
+    }
+  };
+
+  // Run the chunks on threads owned by the test, like an executor would
+  auto make_parallel_for = [](std::size_t num_threads) -> PlannerParallelFor {
+    return [num_threads](std::size_t count, const std::function<void(std::size_t)>& job) {
+      std::vector<std::thread> threads;
+      for (std::size_t t = 0; t < num_threads; ++t)
+      {
+        threads.emplace_back([t, num_threads, count, &job]() {
+          for (std::size_t i = t; i < count; i += num_threads)
+            job(i);
+        });
+      }
+      for (auto& thread : threads)
+        thread.join();
+    };
+  };
+
+  const std::vector<tesseract_collision::CollisionCheckProgramType> modes{
+    tesseract_collision::CollisionCheckProgramType::ALL,
+    tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_START,
+    tesseract_collision::CollisionCheckProgramType::ALL_EXCEPT_END,
+    tesseract_collision::CollisionCheckProgramType::INTERMEDIATE_ONLY
+  };
+
+  const std::vector<tesseract_collision::ContactTestType> test_types{ tesseract_collision::ContactTestType::FIRST,
+                                                                       tesseract_collision::ContactTestType::ALL };
+
+  for (auto mode : modes)
+  {
+    for (auto test_type : test_types)
+    {
+      for (auto type : { tesseract_collision::CollisionEvaluatorType::DISCRETE,
+                         tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE })
+      {
+        tesseract_collision::CollisionCheckConfig config;
+        config.type = type;
+        config.check_program_mode = mode;
+        config.contact_request.type = test_type;
+        config.longest_valid_segment_length = 0.01;
+
+        auto discrete_manager = env_->getDiscreteContactManager();
+        std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+        bool serial_found = contactCheckProgram(serial_contacts, *discrete_manager, *state_solver, traj_ci, config);
+        EXPECT_TRUE(serial_found);
+
+        for (std::size_t num_threads : { 2, 4, 7 })
+        {
+          std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+          bool parallel_found = contactCheckProgram(
+              parallel_contacts, *discrete_manager, *state_solver, traj_ci, config, make_parallel_for(num_threads));
+          EXPECT_EQ(serial_found, parallel_found);
+          expect_equal(serial_contacts, parallel_contacts);
+        }
+      }
+
+      for (auto type : { tesseract_collision::CollisionEvaluatorType::CONTINUOUS,
+                         tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS })
+      {
+        tesseract_collision::CollisionCheckConfig config;
+        config.type = type;
+        config.check_program_mode = mode;
+        config.contact_request.type = test_type;
+        config.longest_valid_segment_length = 0.01;
+
+        auto continuous_manager = env_->getContinuousContactManager();
+        std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+        bool serial_found = contactCheckProgram(serial_contacts, *continuous_manager, *state_solver, traj_ci, config);
+        EXPECT_TRUE(serial_found);
+
+        for (std::size_t num_threads : { 2, 4, 7 })
+        {
+          std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+          bool parallel_found = contactCheckProgram(
+              parallel_contacts, *continuous_manager, *state_solver, traj_ci, config, make_parallel_for(num_threads));
+          EXPECT_EQ(serial_found, parallel_found);
+          expect_equal(serial_contacts, parallel_contacts);
+        }
+      }
+    }
+  }
+
+  // A collision free program
+  CompositeInstruction free_ci;
+  for (long r = 0; r < 20; ++r)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, joint_start_pos) };
+    free_ci.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  {
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = tesseract_collision::CollisionEvaluatorType::LVS_DISCRETE;
+    auto discrete_manager = env_->getDiscreteContactManager();
+    std::vector<tesseract_collision::ContactResultMap> serial_contacts;
+    std::vector<tesseract_collision::ContactResultMap> parallel_contacts;
+    EXPECT_FALSE(contactCheckProgram(serial_contacts, *discrete_manager, *state_solver, free_ci, config));
+    EXPECT_FALSE(contactCheckProgram(
+        parallel_contacts, *discrete_manager, *state_solver, free_ci, config, make_parallel_for(4)));
+    expect_equal(serial_contacts, parallel_contacts);
+  }
+
+  {  // Inconsistent evaluator type
+    tesseract_collision::CollisionCheckConfig config;
+    config.type = tesseract_collision::CollisionEvaluatorType::CONTINUOUS;
+    auto discrete_manager = env_->getDiscreteContactManager();
+    std::vector<tesseract_collision::ContactResultMap> contacts;
+    // NOLINTNEXTLINE
+    EXPECT_ANY_THROW(
+        contactCheckProgram(contacts, *discrete_manager, *state_solver, traj_ci, config, make_parallel_for(4)));
+  }
+}
+
+TEST_F(TesseractPlanningUtilsUnit, ContactManagerPoolUnit)  // NOLINT
+{
+  auto joint_group = env_->getJointGroup("manipulator");
+  std::vector<std::string> active_links = joint_group->getActiveLinkNames();
+  tesseract_collision::ContactManagerConfig config(0.025);
+
+  ContactManagerPool pool(2);
+  EXPECT_EQ(pool.getIdleCount(), 0);
+
+  const tesseract_collision::DiscreteContactManager* raw{ nullptr };
+  {
+    auto manager = pool.getDiscreteContactManager(env_, active_links, config);
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager->getActiveCollisionObjects().size(), active_links.size());
+    raw = manager.get();
+    EXPECT_EQ(pool.getIdleCount(), 0);
+  }
+  EXPECT_EQ(pool.getIdleCount(), 1);
+
+  {  // The released manager is reused independent of the active link order
+    std::vector<std::string> reversed_links(active_links.rbegin(), active_links.rend());
+    auto manager = pool.getDiscreteContactManager(env_, reversed_links, config);
+    EXPECT_EQ(manager.get(), raw);
+    EXPECT_EQ(pool.getIdleCount(), 0);
+
+    // A manager is never shared so a second request creates a new one
+    auto manager2 = pool.getDiscreteContactManager(env_, active_links, config);
+    EXPECT_NE(manager2.get(), raw);
+  }
+  EXPECT_EQ(pool.getIdleCount(), 2);
+
+  {  // A different config does not reuse the existing managers
+    auto manager = pool.getDiscreteContactManager(env_, active_links, tesseract_collision::ContactManagerConfig(0.1));
+    EXPECT_NE(manager.get(), raw);
+  }
+  EXPECT_EQ(pool.getIdleCount(), 2);
+
+  {  // Continuous managers
+    auto manager = pool.getContinuousContactManager(env_, active_links, config);
+    ASSERT_TRUE(manager != nullptr);
+    EXPECT_EQ(manager->getActiveCollisionObjects().size(), active_links.size());
+  }
+  EXPECT_EQ(pool.getIdleCount(), 3);
+
+  // Changing the environment revision invalidates the idle managers
+  auto link = tesseract_scene_graph::Link("pool_test_link");
+  auto joint = tesseract_scene_graph::Joint("pool_test_joint");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = link.getName();
+  joint.type = tesseract_scene_graph::JointType::FIXED;
+  EXPECT_TRUE(env_->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+  {
+    auto manager = pool.getDiscreteContactManager(env_, active_links, config);
+    EXPECT_EQ(pool.getIdleCount(), 1);  // Only the stale continuous manager remains
+  }
+  EXPECT_EQ(pool.getIdleCount(), 2);
+
+  // Releasing a manager after the pool is destroyed must be safe
+  auto pool2 = std::make_unique<ContactManagerPool>();
+  auto manager = pool2->getDiscreteContactManager(env_, active_links, config);
+  pool2 = nullptr;
+  manager = nullptr;
+
+  pool.clear();
+  EXPECT_EQ(pool.getIdleCount(), 0);
+}
+
+TEST_F(TesseractPlanningUtilsUnit, ThreadLocalCacheUnit)  // NOLINT
+{
+  // Use more caches than a thread remembers so the slots of each thread are evicted
+  std::vector<std::unique_ptr<ThreadLocalCache<int>>> caches;
+  for (std::size_t i = 0; i < 20; ++i)
+    caches.push_back(std::make_unique<ThreadLocalCache<int>>([]() { return std::make_unique<int>(0); }));
+
+  caches.front()->reserve(2);
+  EXPECT_EQ(caches.front()->size(), 2);
+
+  auto increment = [&caches]() {
+    for (int i = 0; i < 5; ++i)
+    {
+      for (auto& cache : caches)
+        ++cache->get();
+    }
+  };
+
+  increment();
+  std::thread thread(increment);
+  thread.join();
+
+  // Each thread has a single object per cache which keeps its value
+  for (auto& cache : caches)
+  {
+    EXPECT_EQ(cache->size(), 2);
+    EXPECT_EQ(cache->get(), 5);
+  }
+}
+
+TEST_F(TesseractPlanningUtilsUnit, IKSolutionCacheUnit)  // NOLINT
+{
+  auto manip = env_->getKinematicGroup("manipulator");
+  Eigen::VectorXd seed = Eigen::VectorXd::Zero(7);
+  Eigen::VectorXd joint_values(7);
+  joint_values << 0, 0.5, 0, -1.0, 0, 0.5, 0;
+  Eigen::Isometry3d pose = manip->calcFwdKin(joint_values).at("tool0");
+  tesseract_kinematics::KinGroupIKInput ik_input(pose, "base_link", "tool0");
+
+  // The frame signature is relative to the base link
+  const tesseract_common::TransformMap frame_signature = IKSolutionCache::getFrameSignature(*manip);
+  EXPECT_TRUE(frame_signature.at(manip->getBaseLinkName()).isApprox(Eigen::Isometry3d::Identity()));
+
+  EXPECT_ANY_THROW(IKSolutionCache(0));         // NOLINT
+  EXPECT_ANY_THROW(IKSolutionCache(16, -1.0));  // NOLINT
+
+  IKSolutionCache cache(2);
+  EXPECT_EQ(cache.getMaxSize(), 2);
+  EXPECT_NEAR(cache.getHitRate(), 0, 1e-8);
+
+  tesseract_kinematics::IKSolutions expected = manip->calcInvKin({ ik_input }, seed);
+  tesseract_kinematics::IKSolutions solutions =
+      cache.calcInvKin(*manip, frame_signature, ik_input, seed, env_->getRevision());
+  ASSERT_EQ(solutions.size(), expected.size());
+  EXPECT_EQ(cache.getMisses(), 1);
+  EXPECT_EQ(cache.getHits(), 0);
+  EXPECT_EQ(cache.size(), 1);
+
+  // A pose within the resolution is a hit and returns the same solutions
+  Eigen::Isometry3d close_pose = pose * Eigen::Translation3d(1e-9, 0, 0);
+  tesseract_kinematics::KinGroupIKInput close_ik_input(close_pose, "base_link", "tool0");
+  tesseract_kinematics::IKSolutions cached =
+      cache.calcInvKin(*manip, frame_signature, close_ik_input, seed, env_->getRevision());
+  ASSERT_EQ(cached.size(), solutions.size());
+  for (std::size_t i = 0; i < cached.size(); ++i)
+    EXPECT_TRUE(cached[i].isApprox(solutions[i]));
+  EXPECT_EQ(cache.getHits(), 1);
+  EXPECT_NEAR(cache.getHitRate(), 0.5, 1e-8);
+
+  // The seed, environment revision and inverse kinematics solver are part of the key
+  cache.calcInvKin(*manip, frame_signature, ik_input, joint_values, env_->getRevision());
+  EXPECT_EQ(cache.getMisses(), 2);
+  cache.calcInvKin(*manip, frame_signature, ik_input, seed, env_->getRevision() + 1);
+  EXPECT_EQ(cache.getMisses(), 3);
+  cache.calcInvKin(*manip, frame_signature, ik_input, seed, env_->getRevision(), "OtherSolver");
+  EXPECT_EQ(cache.getMisses(), 4);
+  EXPECT_EQ(cache.size(), 2);
+
+  // The least recently used entries were evicted
+  cache.calcInvKin(*manip, frame_signature, ik_input, seed, env_->getRevision());
+  EXPECT_EQ(cache.getMisses(), 5);
+  EXPECT_EQ(cache.getHits(), 1);
+
+  // Without the seed in the key different seeds share an entry
+  IKSolutionCache seedless_cache(16, 1e-6, false);
+  seedless_cache.calcInvKin(*manip, frame_signature, ik_input, seed, env_->getRevision());
+  seedless_cache.calcInvKin(*manip, frame_signature, ik_input, joint_values, env_->getRevision());
+  EXPECT_EQ(seedless_cache.getHits(), 1);
+  EXPECT_EQ(seedless_cache.getMisses(), 1);
+
+  // A different frame signature, for example of a kinematic group created from another state, is a miss
+  tesseract_common::TransformMap moved_signature = frame_signature;
+  moved_signature.at("tool0").translation().x() += 0.1;
+  seedless_cache.calcInvKin(*manip, moved_signature, ik_input, seed, env_->getRevision());
+  EXPECT_EQ(seedless_cache.getMisses(), 2);
+
+  cache.resetStatistics();
+  EXPECT_EQ(cache.getHits(), 0);
+  EXPECT_EQ(cache.getMisses(), 0);
+
+  cache.clear();
+  EXPECT_EQ(cache.size(), 0);
+}
+
+TEST_F(TesseractPlanningUtilsUnit, EnvironmentHashUnit)  // NOLINT
+{
+  FNV1aHashBuf empty_buffer;
+  EXPECT_EQ(empty_buffer.getHash(), 14695981039346656037ULL);
+  FNV1aHashBuf buffer;
+  buffer.sputc('a');
+  EXPECT_EQ(buffer.getHash(), 0xaf63dc4c8601ec8cULL);
+
+  Environment::ConstPtr env = env_;
+  const std::uint64_t hash = getEnvironmentHash(env);
+  EXPECT_EQ(hash, getEnvironmentHash(env));
+
+  // An environment built with the same commands has the same hash
+  Environment::ConstPtr clone = env_->clone();
+  EXPECT_EQ(hash, getEnvironmentHash(clone));
+
+  // Changing the environment changes its hash
+  tesseract_scene_graph::Link link("hash_link");
+  tesseract_scene_graph::Joint joint("hash_joint");
+  joint.type = tesseract_scene_graph::JointType::FIXED;
+  joint.parent_link_name = env_->getRootLinkName();
+  joint.child_link_name = link.getName();
+  EXPECT_TRUE(env_->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+  EXPECT_NE(hash, getEnvironmentHash(env));
+  EXPECT_EQ(hash, getEnvironmentHash(clone));
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
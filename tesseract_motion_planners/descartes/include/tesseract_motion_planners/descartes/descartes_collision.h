@@ -34,6 +34,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tesseract_collision/core/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+
 namespace tesseract_planning
 {
 class DescartesCollision
@@ -103,6 +105,20 @@ private:
   bool debug_; /**< @brief Enable debug information to be printed to the terminal */
 };
 
+/**
+ * @brief Per thread clones of a collision interface
+ * @details This allows a single collision interface to be shared by samplers which are sampled in parallel, without
+ * cloning a contact manager for every sampler.
+ */
+using DescartesThreadLocalCollision = ThreadLocalCache<DescartesCollision>;
+
+/**
+ * @brief Create per thread clones of the provided collision interface
+ * @param collision The collision interface which is cloned for each thread
+ * @return The per thread collision interfaces
+ */
+std::shared_ptr<DescartesThreadLocalCollision> createThreadLocalCollision(DescartesCollision::ConstPtr collision);
+
 }  // namespace tesseract_planning
 
 #endif  // TESSERACT_MOTION_PLANNERS_DESCARTES_COLLISION_H
@@ -36,17 +36,30 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <tesseract_collision/core/types.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+
 namespace tesseract_planning
 {
 template <typename FloatType>
 class DescartesCollisionEdgeEvaluator : public descartes_light::EdgeEvaluator<FloatType>
 {
 public:
+  /**
+   * @brief Construct a collision edge evaluator
+   * @param collision_env The environment
+   * @param manip The joint group
+   * @param config The collision check config
+   * @param allow_collision If true and no valid edges are found it will return the one with the lowest cost
+   * @param debug Enable debug information to be printed to the terminal
+   * @param num_threads The number of contact managers to clone up front. This should be the problem's number of
+   * threads when a single evaluator is shared by every rung, otherwise managers are cloned on first use by each thread.
+   */
   DescartesCollisionEdgeEvaluator(const tesseract_environment::Environment& collision_env,
                                   tesseract_kinematics::JointGroup::ConstPtr manip,
                                   tesseract_collision::CollisionCheckConfig config,
                                   bool allow_collision = false,
-                                  bool debug = false);
+                                  bool debug = false,
+                                  int num_threads = 0);
 
   std::pair<bool, FloatType> evaluate(const descartes_light::State<FloatType>& start,
                                       const descartes_light::State<FloatType>& end) const override;
@@ -67,39 +80,38 @@ protected:
   /** @brief Enable debug information to be printed to the terminal */
   bool debug_;
 
-  // The member variables below are to cache the contact manager based on thread ID. Currently descartes is multi
-  // threaded but the methods used to implement collision checking are not thread safe. To prevent
-  // reconstructing the collision environment for every check this will cache a contact manager
-  // based on its thread ID.
+  /** @brief The collision check config used for every edge, the contact test type is set based on allow_collision */
+  tesseract_collision::CollisionCheckConfig edge_check_config_;
 
-  /** @brief Contact manager caching mutex */
-  mutable std::mutex mutex_;
+  /** @brief The collision checking data owned by each thread, only the contact manager of the evaluator type is set */
+  struct ThreadData
+  {
+    tesseract_collision::DiscreteContactManager::UPtr discrete_contact_manager;
+    tesseract_collision::ContinuousContactManager::UPtr continuous_contact_manager;
+    tesseract_common::TrajArray segment;
+    std::vector<tesseract_collision::ContactResultMap> contact_results;
+  };
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::ContinuousContactManager::Ptr> continuous_contact_managers_;
+  // Currently descartes is multi threaded but the methods used to implement collision checking are not thread safe.
+  // To prevent reconstructing the collision environment for every check each thread is given its own contact manager
+  // and result buffers, which are looked up without locking.
 
-  /** @brief The discrete contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::DiscreteContactManager::Ptr> discrete_contact_managers_;
+  /** @brief The per thread contact managers and buffers */
+  ThreadLocalCache<ThreadData> thread_data_;
 
   /**
-   * @brief Perform a continuous collision check between two states
-   * @param segment Trajectory containing two states
-   * @param results Store results from collision check.
+   * @brief Perform a continuous collision check between the two states in the thread's segment
+   * @param data The thread data, results are stored in its contact results
    * @return True if in collision otherwise false
    */
-  bool continuousCollisionCheck(std::vector<tesseract_collision::ContactResultMap>& results,
-                                const tesseract_common::TrajArray& segment,
-                                bool find_best) const;
+  bool continuousCollisionCheck(ThreadData& data) const;
 
   /**
-   * @brief Perform a continuous discrete check between two states
-   * @param segment Trajectory containing two states
-   * @param results Store results from collision check.
+   * @brief Perform a discrete collision check between the two states in the thread's segment
+   * @param data The thread data, results are stored in its contact results
    * @return True if in collision otherwise false
    */
-  bool discreteCollisionCheck(std::vector<tesseract_collision::ContactResultMap>& results,
-                              const tesseract_common::TrajArray& segment,
-                              bool find_best) const;
+  bool discreteCollisionCheck(ThreadData& data) const;
 };
 
 using DescartesCollisionEdgeEvaluatorF = DescartesCollisionEdgeEvaluator<float>;
@@ -35,6 +35,31 @@ public:
   MotionPlanner::Ptr clone() const override;
 
   virtual std::shared_ptr<DescartesProblem<FloatType>> createProblem(const PlannerRequest& request) const;
+
+  /**
+   * @brief Set the inverse kinematics solution cache used by the robot samplers
+   * @details The cache may be shared with other planners, for example the simple planner, and with clones of the
+   * planner. If nullptr, which is the default, inverse kinematics is solved for every sampled pose.
+   * @param ik_cache The inverse kinematics solution cache
+   */
+  void setIKSolutionCache(IKSolutionCache::Ptr ik_cache);
+
+  /** @brief Get the inverse kinematics solution cache, which may be nullptr */
+  IKSolutionCache::Ptr getIKSolutionCache() const;
+
+  /**
+   * @brief Sample all rungs of the ladder graph, in parallel if a parallel for is provided
+   * @details Samplers sharing a collision interface use a clone of it for each thread.
+   * @param samplers The samplers of the problem
+   * @param parallel_for The parallel for of the planner request, if not set the rungs are sampled in sequence
+   * @return Samplers returning the computed samples, in the same order as the provided samplers
+   */
+  static std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr>
+  sampleRungs(const std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr>& samplers,
+              const PlannerParallelFor& parallel_for);
+
+protected:
+  IKSolutionCache::Ptr ik_cache_;
 };
 
 using DescartesMotionPlannerD = DescartesMotionPlanner<double>;
@@ -0,0 +1,58 @@
+/**
+ * @file descartes_presampled_sampler.h
+ * @brief Tesseract Descartes sampler returning precomputed samples
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_DESCARTES_PRESAMPLED_SAMPLER_H
+#define TESSERACT_MOTION_PLANNERS_DESCARTES_PRESAMPLED_SAMPLER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <descartes_light/core/waypoint_sampler.h>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief A descartes sampler which returns samples computed ahead of time
+ * @details The Descartes planner samples all rungs in parallel before building the ladder graph and hands the
+ * results to the solver through this sampler.
+ */
+template <typename FloatType>
+class DescartesPresampledSampler : public descartes_light::WaypointSampler<FloatType>
+{
+public:
+  explicit DescartesPresampledSampler(std::vector<descartes_light::StateSample<FloatType>> samples)
+    : samples_(std::move(samples))
+  {
+  }
+
+  std::vector<descartes_light::StateSample<FloatType>> sample() const override { return samples_; }
+
+private:
+  std::vector<descartes_light::StateSample<FloatType>> samples_;
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_DESCARTES_PRESAMPLED_SAMPLER_H
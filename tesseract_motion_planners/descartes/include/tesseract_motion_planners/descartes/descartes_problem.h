@@ -31,14 +31,35 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <descartes_light/core/edge_evaluator.h>
 #include <descartes_light/core/state_evaluator.h>
 #include <descartes_light/core/waypoint_sampler.h>
+#include <string>
 #include <thread>
+#include <unordered_map>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/environment.h>
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
+#include <tesseract_motion_planners/descartes/descartes_collision.h>
 
 namespace tesseract_planning
 {
+/** @brief The time in seconds spent in each phase of solving a Descartes problem */
+struct DescartesPhaseTimes
+{
+  /**
+   * @brief Sampling the rungs, which includes inverse kinematics and vertex collision checking
+   * @details Without a parallel for in the request the rungs are sampled while building the ladder graph, so this is
+   * zero and the sampling is included in edges.
+   */
+  double sampling{ 0 };
+
+  /** @brief Building the ladder graph, which is dominated by evaluating the edges */
+  double edges{ 0 };
+
+  /** @brief Searching the ladder graph */
+  double search{ 0 };
+};
+
 template <typename FloatType>
 struct DescartesProblem
 {
@@ -53,11 +74,26 @@ struct DescartesProblem
   // Kinematic Objects
   tesseract_kinematics::KinematicGroup::ConstPtr manip;
 
+  /** @brief The inverse kinematics solver name of the kinematic group, empty for the default solver */
+  std::string ik_solver;
+
+  /** @brief The inverse kinematics solution cache used by the samplers, may be nullptr */
+  IKSolutionCache::Ptr ik_cache;
+
+  /** @brief The inverse kinematics frame signature of the kinematic group, only set if there is a solution cache */
+  std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature;
+
   // These are required for descartes
   std::vector<typename descartes_light::EdgeEvaluator<FloatType>::ConstPtr> edge_evaluators{};
   std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr> samplers{};
   std::vector<typename descartes_light::StateEvaluator<FloatType>::ConstPtr> state_evaluators{};
   int num_threads = static_cast<int>(std::thread::hardware_concurrency());
+
+  /** @brief Vertex collision interfaces shared by the samplers created from the same plan profile, by profile name */
+  std::unordered_map<std::string, std::shared_ptr<DescartesThreadLocalCollision>> vertex_collisions{};
+
+  /** @brief The time spent in each phase by the last solve of this problem */
+  DescartesPhaseTimes phase_times{};
 };
 using DescartesProblemF = DescartesProblem<float>;
 using DescartesProblemD = DescartesProblem<double>;
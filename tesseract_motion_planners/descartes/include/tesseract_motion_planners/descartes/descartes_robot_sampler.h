@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
 #include <tesseract_motion_planners/descartes/descartes_utils.h>
 #include <tesseract_motion_planners/descartes/descartes_collision.h>
 #include <tesseract_motion_planners/descartes/types.h>
@@ -52,6 +53,11 @@ public:
    * @param robot_tcp The robot tcp to be used.
    * @param allow_collision If true and no valid solution was found it will return the best of the worst
    * @param is_valid This is a user defined function to filter out solution
+   * @param use_redundant_joint_solutions Should redundant solutions be used
+   * @param ik_cache The inverse kinematics solution cache, if nullptr inverse kinematics is always solved
+   * @param env_revision The revision of the environment the manipulator was created from, used by the cache
+   * @param ik_solver The inverse kinematics solver name of the manipulator, used by the cache
+   * @param ik_frame_signature The frame signature of the manipulator used by the cache, computed if nullptr
    */
   DescartesRobotSampler(std::string target_working_frame,
                         const Eigen::Isometry3d& target_pose,
@@ -62,7 +68,32 @@ public:
                         const Eigen::Isometry3d& tcp_offset,
                         bool allow_collision,
                         DescartesVertexEvaluator::Ptr is_valid,
-                        bool use_redundant_joint_solutions);
+                        bool use_redundant_joint_solutions,
+                        IKSolutionCache::Ptr ik_cache = nullptr,
+                        int env_revision = 0,
+                        std::string ik_solver = "",
+                        std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature = nullptr);
+
+  /**
+   * @brief This is a descartes sampler for a robot which shares its collision interface with other samplers
+   * @details Each thread calling sample() uses its own clone of the collision interface, so samplers of a problem can
+   * share one collision interface and be sampled in parallel.
+   * @param collision The per thread collision interfaces, may be nullptr if collisions are allowed
+   */
+  DescartesRobotSampler(std::string target_working_frame,
+                        const Eigen::Isometry3d& target_pose,
+                        PoseSamplerFn target_pose_sampler,
+                        tesseract_kinematics::KinematicGroup::ConstPtr manip,
+                        std::shared_ptr<const DescartesThreadLocalCollision> collision,
+                        std::string tcp_frame,
+                        const Eigen::Isometry3d& tcp_offset,
+                        bool allow_collision,
+                        DescartesVertexEvaluator::Ptr is_valid,
+                        bool use_redundant_joint_solutions,
+                        IKSolutionCache::Ptr ik_cache = nullptr,
+                        int env_revision = 0,
+                        std::string ik_solver = "",
+                        std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature = nullptr);
 
   std::vector<descartes_light::StateSample<FloatType>> sample() const override;
 
@@ -82,6 +113,9 @@ private:
   /** @brief The collision interface */
   DescartesCollision::Ptr collision_;
 
+  /** @brief The per thread collision interfaces, used instead of collision_ when set */
+  std::shared_ptr<const DescartesThreadLocalCollision> thread_local_collision_;
+
   /** @brief The robot tool center point frame */
   std::string tcp_frame_;
 
@@ -102,6 +136,18 @@ private:
 
   /** @brief Should redundant solutions be used */
   bool use_redundant_joint_solutions_{ false };
+
+  /** @brief The inverse kinematics solution cache */
+  IKSolutionCache::Ptr ik_cache_;
+
+  /** @brief The revision of the environment the manipulator was created from */
+  int env_revision_{ 0 };
+
+  /** @brief The inverse kinematics solver name of the manipulator */
+  std::string ik_solver_;
+
+  /** @brief The inverse kinematics frame signature of the manipulator, only set if there is a solution cache */
+  std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature_;
 };
 
 using DescartesRobotSamplerF = DescartesRobotSampler<float>;
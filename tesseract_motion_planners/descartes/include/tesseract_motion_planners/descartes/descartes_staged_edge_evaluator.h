@@ -0,0 +1,83 @@
+/**
+ * @file descartes_staged_edge_evaluator.h
+ * @brief Tesseract Descartes Staged Edge Evaluator Implementation
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_DESCARTES_STAGED_EDGE_EVALUATOR_H
+#define TESSERACT_MOTION_PLANNERS_DESCARTES_STAGED_EDGE_EVALUATOR_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <limits>
+#include <memory>
+#include <vector>
+#include <descartes_light/core/edge_evaluator.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+/**
+ * @brief An edge evaluator which applies cheap checks before expensive ones
+ * @details Edges are first rejected if any joint moves further than the max joint step, then the joint distance cost
+ * is computed and edges whose cost exceeds the max cost are rejected. Only the edges which remain are passed to the
+ * evaluators, in order, stopping at the first evaluator which rejects the edge. Expensive evaluators like the
+ * DescartesCollisionEdgeEvaluator should be added last.
+ *
+ * The cost of a valid edge is the joint distance plus the cost returned by each evaluator.
+ */
+template <typename FloatType>
+class DescartesStagedEdgeEvaluator : public descartes_light::EdgeEvaluator<FloatType>
+{
+public:
+  using Ptr = std::shared_ptr<DescartesStagedEdgeEvaluator<FloatType>>;
+  using ConstPtr = std::shared_ptr<const DescartesStagedEdgeEvaluator<FloatType>>;
+
+  DescartesStagedEdgeEvaluator() = default;
+
+  /**
+   * @brief Construct a staged edge evaluator
+   * @param max_joint_step The max change allowed for each joint. If empty no joint bound is applied.
+   * @param max_cost The max joint distance cost allowed for an edge
+   */
+  DescartesStagedEdgeEvaluator(Eigen::Matrix<FloatType, Eigen::Dynamic, 1> max_joint_step,
+                               FloatType max_cost = std::numeric_limits<FloatType>::max());
+
+  std::pair<bool, FloatType> evaluate(const descartes_light::State<FloatType>& start,
+                                      const descartes_light::State<FloatType>& end) const override;
+
+  /** @brief The evaluators applied to edges which pass the joint step and cost checks, cheapest first */
+  std::vector<typename descartes_light::EdgeEvaluator<FloatType>::ConstPtr> evaluators;
+
+protected:
+  /** @brief The max change allowed for each joint, if empty no joint bound is applied */
+  Eigen::Matrix<FloatType, Eigen::Dynamic, 1> max_joint_step_;
+
+  /** @brief The max joint distance cost allowed for an edge */
+  FloatType max_cost_{ std::numeric_limits<FloatType>::max() };
+};
+
+using DescartesStagedEdgeEvaluatorF = DescartesStagedEdgeEvaluator<float>;
+using DescartesStagedEdgeEvaluatorD = DescartesStagedEdgeEvaluator<double>;
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_DESCARTES_STAGED_EDGE_EVALUATOR_H
@@ -27,10 +27,6 @@
 #define TESSERACT_MOTION_PLANNERS_IMPL_DESCARTES_COLLISION_EDGE_EVALUATOR_HPP
 
 #include <tesseract_common/macros.h>
-TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
-#include <thread>
-TESSERACT_COMMON_IGNORE_WARNINGS_POP
-
 #include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
 #include <tesseract_environment/utils.h>
 
@@ -42,7 +38,8 @@ DescartesCollisionEdgeEvaluator<FloatType>::DescartesCollisionEdgeEvaluator(
     tesseract_kinematics::JointGroup::ConstPtr manip,
     tesseract_collision::CollisionCheckConfig config,
     bool allow_collision,
-    bool debug)
+    bool debug,
+    int num_threads)
   : manip_(std::move(manip))
   , active_link_names_(manip_->getActiveLinkNames())
   , discrete_contact_manager_(collision_env.getDiscreteContactManager())
@@ -50,7 +47,23 @@ DescartesCollisionEdgeEvaluator<FloatType>::DescartesCollisionEdgeEvaluator(
   , collision_check_config_(std::move(config))
   , allow_collision_(allow_collision)
   , debug_(debug)
+  , edge_check_config_(collision_check_config_)
+  , thread_data_([this]() {
+    // Only the contact manager used by the evaluator type is cloned
+    auto data = std::make_unique<ThreadData>();
+    if (collision_check_config_.type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
+        collision_check_config_.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
+      data->continuous_contact_manager = continuous_contact_manager_->clone();
+    else
+      data->discrete_contact_manager = discrete_contact_manager_->clone();
+
+    data->segment.resize(2, manip_->numJoints());
+    return data;
+  })
 {
+  edge_check_config_.contact_request.type =
+      (allow_collision_) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
+
   if (discrete_contact_manager_ != nullptr)
   {
     discrete_contact_manager_->setActiveCollisionObjects(active_link_names_);
@@ -74,6 +87,9 @@ DescartesCollisionEdgeEvaluator<FloatType>::DescartesCollisionEdgeEvaluator(
     throw std::runtime_error("Evaluator type is CONTINUOUS or LVS_CONTINUOUS, but continuous contact manager is not "
                              "available");
   }
+
+  if (num_threads > 0)
+    thread_data_.reserve(static_cast<std::size_t>(num_threads));
 }
 
 template <typename FloatType>
@@ -83,25 +99,22 @@ DescartesCollisionEdgeEvaluator<FloatType>::evaluate(const descartes_light::Stat
 {
   assert(start.values.rows() == end.values.rows());
 
+  ThreadData& data = thread_data_.get();
+
   // Happens in two phases:
   // 1. Compute the transform of all objects
-  tesseract_common::TrajArray segment(2, start.values.rows());
-  for (Eigen::Index i = 0; i < start.values.rows(); ++i)
-  {
-    segment(0, i) = start[i];
-    segment(1, i) = end[i];
-  }
+  data.segment.row(0) = start.values.template cast<double>().transpose();
+  data.segment.row(1) = end.values.template cast<double>().transpose();
 
-  std::vector<tesseract_collision::ContactResultMap> contact_results;
   bool in_contact{ true };
   if (collision_check_config_.type == tesseract_collision::CollisionEvaluatorType::CONTINUOUS ||
       collision_check_config_.type == tesseract_collision::CollisionEvaluatorType::LVS_CONTINUOUS)
   {
-    in_contact = continuousCollisionCheck(contact_results, segment, allow_collision_);
+    in_contact = continuousCollisionCheck(data);
   }
   else
   {
-    in_contact = discreteCollisionCheck(contact_results, segment, allow_collision_);
+    in_contact = discreteCollisionCheck(data);
   }
 
   if (!in_contact)
@@ -112,66 +125,25 @@ DescartesCollisionEdgeEvaluator<FloatType>::evaluate(const descartes_light::Stat
       static_cast<FloatType>(collision_check_config_.contact_manager_config.margin_data.getMaxCollisionMargin());
 
   if (in_contact && allow_collision_)
-    return std::make_pair(true, collision_safety_margin_ - contact_results.begin()->begin()->second[0].distance);
+    return std::make_pair(true, collision_safety_margin_ - data.contact_results.begin()->begin()->second[0].distance);
 
   return std::make_pair(false, 0);
 }
 
 template <typename FloatType>
-bool DescartesCollisionEdgeEvaluator<FloatType>::continuousCollisionCheck(
-    std::vector<tesseract_collision::ContactResultMap>& results,
-    const tesseract_common::TrajArray& segment,
-    bool find_best) const
+bool DescartesCollisionEdgeEvaluator<FloatType>::continuousCollisionCheck(ThreadData& data) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::ContinuousContactManager::Ptr cm;
-  mutex_.lock();
-  auto it = continuous_contact_managers_.find(hash);
-  if (it == continuous_contact_managers_.end())
-  {
-    cm = continuous_contact_manager_->clone();
-    continuous_contact_managers_[hash] = cm;
-  }
-  else
-  {
-    cm = it->second;
-  }
-  mutex_.unlock();
-  tesseract_collision::CollisionCheckConfig config = collision_check_config_;
-  config.contact_request.type =
-      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
-
-  return tesseract_environment::checkTrajectory(results, *cm, *manip_, segment, config);
+  data.contact_results.clear();
+  return tesseract_environment::checkTrajectory(
+      data.contact_results, *data.continuous_contact_manager, *manip_, data.segment, edge_check_config_);
 }
 
 template <typename FloatType>
-bool DescartesCollisionEdgeEvaluator<FloatType>::discreteCollisionCheck(
-    std::vector<tesseract_collision::ContactResultMap>& results,
-    const tesseract_common::TrajArray& segment,
-    bool find_best) const
+bool DescartesCollisionEdgeEvaluator<FloatType>::discreteCollisionCheck(ThreadData& data) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::DiscreteContactManager::Ptr cm;
-  mutex_.lock();
-  auto it = discrete_contact_managers_.find(hash);
-  if (it == discrete_contact_managers_.end())
-  {
-    cm = discrete_contact_manager_->clone();
-    discrete_contact_managers_[hash] = cm;
-  }
-  else
-  {
-    cm = it->second;
-  }
-  mutex_.unlock();
-
-  tesseract_collision::CollisionCheckConfig config = collision_check_config_;
-  config.contact_request.type =
-      (find_best) ? tesseract_collision::ContactTestType::CLOSEST : tesseract_collision::ContactTestType::FIRST;
-
-  return tesseract_environment::checkTrajectory(results, *cm, *manip_, segment, config);
+  data.contact_results.clear();
+  return tesseract_environment::checkTrajectory(
+      data.contact_results, *data.discrete_contact_manager, *manip_, data.segment, edge_check_config_);
 }
 
 }  // namespace tesseract_planning
@@ -30,16 +30,21 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <descartes_light/solvers/ladder_graph/ladder_graph_solver.h>
 #include <descartes_light/samplers/fixed_joint_waypoint_sampler.h>
+#include <algorithm>
+#include <exception>
+#include <mutex>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_collision/core/discrete_contact_manager.h>
 #include <tesseract_collision/core/continuous_contact_manager.h>
 
+#include <tesseract_common/timer.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_environment/utils.h>
 
 #include <tesseract_motion_planners/descartes/descartes_motion_planner.h>
+#include <tesseract_motion_planners/descartes/descartes_presampled_sampler.h>
 #include <tesseract_motion_planners/descartes/profile/descartes_default_plan_profile.h>
 #include <tesseract_motion_planners/core/utils.h>
 #include <tesseract_motion_planners/simple/interpolation.h>
@@ -88,9 +93,36 @@ PlannerResponse DescartesMotionPlanner<FloatType>::solve(const PlannerRequest& r
   descartes_light::SearchResult<FloatType> descartes_result;
   try
   {
+    tesseract_common::Timer timer;
+
+    // Without a parallel for the ladder graph solver samples the rungs with its own threads
+    std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr> presampled;
+    problem->phase_times.sampling = 0;
+    if (request.parallel_for)
+    {
+      timer.start();
+      presampled = sampleRungs(problem->samplers, request.parallel_for);
+      timer.stop();
+      problem->phase_times.sampling = timer.elapsedSeconds();
+    }
+
+    timer.start();
     descartes_light::LadderGraphSolver<FloatType> solver(problem->num_threads);
-    solver.build(problem->samplers, problem->edge_evaluators, problem->state_evaluators);
+    solver.build(request.parallel_for ? presampled : problem->samplers,
+                 problem->edge_evaluators,
+                 problem->state_evaluators);
+    timer.stop();
+    problem->phase_times.edges = timer.elapsedSeconds();
+
+    timer.start();
     descartes_result = solver.search();
+    timer.stop();
+    problem->phase_times.search = timer.elapsedSeconds();
+
+    CONSOLE_BRIDGE_logDebug("DescartesMotionPlanner, sampling: %f s, edges: %f s, search: %f s",
+                            problem->phase_times.sampling,
+                            problem->phase_times.edges,
+                            problem->phase_times.search);
     if (descartes_result.trajectory.empty())
     {
       CONSOLE_BRIDGE_logError("Search for graph completion failed");
@@ -213,7 +245,56 @@ void DescartesMotionPlanner<FloatType>::clear()
 template <typename FloatType>
 MotionPlanner::Ptr DescartesMotionPlanner<FloatType>::clone() const
 {
-  return std::make_shared<DescartesMotionPlanner<FloatType>>(name_);
+  auto planner = std::make_shared<DescartesMotionPlanner<FloatType>>(name_);
+  planner->setIKSolutionCache(ik_cache_);
+  return planner;
+}
+
+template <typename FloatType>
+void DescartesMotionPlanner<FloatType>::setIKSolutionCache(IKSolutionCache::Ptr ik_cache)
+{
+  ik_cache_ = std::move(ik_cache);
+}
+
+template <typename FloatType>
+IKSolutionCache::Ptr DescartesMotionPlanner<FloatType>::getIKSolutionCache() const
+{
+  return ik_cache_;
+}
+
+template <typename FloatType>
+std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr>
+DescartesMotionPlanner<FloatType>::sampleRungs(
+    const std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr>& samplers,
+    const PlannerParallelFor& parallel_for)
+{
+  std::vector<std::vector<descartes_light::StateSample<FloatType>>> samples(samplers.size());
+  std::exception_ptr error;
+  std::mutex error_mutex;
+
+  // The jobs of a parallel for must not throw, so the first error is rethrown after all rungs were sampled
+  parallelFor(parallel_for, samplers.size(), [&samplers, &samples, &error, &error_mutex](std::size_t i) {
+    try
+    {
+      samples[i] = samplers[i]->sample();
+    }
+    catch (...)
+    {
+      std::scoped_lock lock(error_mutex);
+      if (!error)
+        error = std::current_exception();
+    }
+  });
+
+  if (error)
+    std::rethrow_exception(error);
+
+  std::vector<typename descartes_light::WaypointSampler<FloatType>::ConstPtr> presampled;
+  presampled.reserve(samples.size());
+  for (auto& rung_samples : samples)
+    presampled.push_back(std::make_shared<const DescartesPresampledSampler<FloatType>>(std::move(rung_samples)));
+
+  return presampled;
 }
 
 template <typename FloatType>
@@ -255,12 +336,24 @@ DescartesMotionPlanner<FloatType>::createProblem(const PlannerRequest& request)
 
   prob->env_state = request.env_state;
   prob->env = request.env;
+  prob->ik_solver = composite_mi.manipulator_ik_solver;
+  prob->ik_cache = ik_cache_;
+  if (ik_cache_ != nullptr)
+    prob->ik_frame_signature =
+        std::make_shared<const tesseract_common::TransformMap>(IKSolutionCache::getFrameSignature(*prob->manip));
 
   std::vector<std::string> joint_names = prob->manip->getJointNames();
 
   // Flatten the input for planning
   auto move_instructions = request.instructions.flatten(&moveFilter);
 
+  // Resolve the plan profiles once for all instructions
+  ProfileSnapshot<DescartesPlanProfile<FloatType>> plan_profiles(
+      name_,
+      *request.profiles,
+      request.plan_profile_remapping,
+      std::make_shared<DescartesDefaultPlanProfile<FloatType>>());
+
   // Transform plan instructions into descartes samplers
   int index = 0;
   for (const auto& move_instruction : move_instructions)
@@ -283,10 +376,7 @@ DescartesMotionPlanner<FloatType>::createProblem(const PlannerRequest& request)
       throw std::runtime_error("Descartes, working_frame is empty!");
 
     // Get Plan Profile
-    std::string profile = plan_instruction.getProfile();
-    profile = getProfileString(name_, profile, request.plan_profile_remapping);
-    auto cur_plan_profile = getProfile<DescartesPlanProfile<FloatType>>(
-        name_, profile, *request.profiles, std::make_shared<DescartesDefaultPlanProfile<FloatType>>());
+    auto cur_plan_profile = plan_profiles.getProfile(plan_instruction.getProfile());
     //      cur_plan_profile = applyProfileOverrides(name_, profile, cur_plan_profile,
     //      plan_instruction.profile_overrides);
     if (!cur_plan_profile)
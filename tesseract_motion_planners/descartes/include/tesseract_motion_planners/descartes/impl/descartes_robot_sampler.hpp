@@ -39,16 +39,21 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 namespace tesseract_planning
 {
 template <typename FloatType>
-DescartesRobotSampler<FloatType>::DescartesRobotSampler(std::string target_working_frame,
-                                                        const Eigen::Isometry3d& target_pose,
-                                                        PoseSamplerFn target_pose_sampler,
-                                                        tesseract_kinematics::KinematicGroup::ConstPtr manip,
-                                                        DescartesCollision::Ptr collision,
-                                                        std::string tcp_frame,
-                                                        const Eigen::Isometry3d& tcp_offset,
-                                                        bool allow_collision,
-                                                        DescartesVertexEvaluator::Ptr is_valid,
-                                                        bool use_redundant_joint_solutions)
+DescartesRobotSampler<FloatType>::DescartesRobotSampler(
+    std::string target_working_frame,
+    const Eigen::Isometry3d& target_pose,
+    PoseSamplerFn target_pose_sampler,
+    tesseract_kinematics::KinematicGroup::ConstPtr manip,
+    DescartesCollision::Ptr collision,
+    std::string tcp_frame,
+    const Eigen::Isometry3d& tcp_offset,
+    bool allow_collision,
+    DescartesVertexEvaluator::Ptr is_valid,
+    bool use_redundant_joint_solutions,
+    IKSolutionCache::Ptr ik_cache,
+    int env_revision,
+    std::string ik_solver,
+    std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature)
   : target_working_frame_(std::move(target_working_frame))
   , target_pose_(target_pose)
   , target_pose_sampler_(std::move(target_pose_sampler))
@@ -61,14 +66,67 @@ DescartesRobotSampler<FloatType>::DescartesRobotSampler(std::string target_worki
   , ik_seed_(Eigen::VectorXd::Zero(dof_))
   , is_valid_(std::move(is_valid))
   , use_redundant_joint_solutions_(use_redundant_joint_solutions)
+  , ik_cache_(std::move(ik_cache))
+  , env_revision_(env_revision)
+  , ik_solver_(std::move(ik_solver))
+  , ik_frame_signature_(std::move(ik_frame_signature))
 {
   if (!allow_collision_ && !collision_)
     throw std::runtime_error("Collision checker must not be a nullptr if collisions are not allowed during planning");
+
+  if (ik_cache_ != nullptr && ik_frame_signature_ == nullptr)
+    ik_frame_signature_ =
+        std::make_shared<const tesseract_common::TransformMap>(IKSolutionCache::getFrameSignature(*manip_));
+}
+
+template <typename FloatType>
+DescartesRobotSampler<FloatType>::DescartesRobotSampler(
+    std::string target_working_frame,
+    const Eigen::Isometry3d& target_pose,
+    PoseSamplerFn target_pose_sampler,
+    tesseract_kinematics::KinematicGroup::ConstPtr manip,
+    std::shared_ptr<const DescartesThreadLocalCollision> collision,
+    std::string tcp_frame,
+    const Eigen::Isometry3d& tcp_offset,
+    bool allow_collision,
+    DescartesVertexEvaluator::Ptr is_valid,
+    bool use_redundant_joint_solutions,
+    IKSolutionCache::Ptr ik_cache,
+    int env_revision,
+    std::string ik_solver,
+    std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature)
+  : target_working_frame_(std::move(target_working_frame))
+  , target_pose_(target_pose)
+  , target_pose_sampler_(std::move(target_pose_sampler))
+  , manip_(std::move(manip))
+  , thread_local_collision_(std::move(collision))
+  , tcp_frame_(std::move(tcp_frame))
+  , tcp_offset_(tcp_offset)
+  , allow_collision_(allow_collision)
+  , dof_(static_cast<int>(manip_->numJoints()))
+  , ik_seed_(Eigen::VectorXd::Zero(dof_))
+  , is_valid_(std::move(is_valid))
+  , use_redundant_joint_solutions_(use_redundant_joint_solutions)
+  , ik_cache_(std::move(ik_cache))
+  , env_revision_(env_revision)
+  , ik_solver_(std::move(ik_solver))
+  , ik_frame_signature_(std::move(ik_frame_signature))
+{
+  if (!allow_collision_ && !thread_local_collision_)
+    throw std::runtime_error("Collision checker must not be a nullptr if collisions are not allowed during planning");
+
+  if (ik_cache_ != nullptr && ik_frame_signature_ == nullptr)
+    ik_frame_signature_ =
+        std::make_shared<const tesseract_common::TransformMap>(IKSolutionCache::getFrameSignature(*manip_));
 }
 
 template <typename FloatType>
 std::vector<descartes_light::StateSample<FloatType>> DescartesRobotSampler<FloatType>::sample() const
 {
+  DescartesCollision* collision = collision_.get();
+  if (thread_local_collision_ != nullptr)
+    collision = &thread_local_collision_->get();
+
   // Generate all possible Cartesian poses
   tesseract_common::VectorIsometry3d target_poses = target_pose_sampler_(target_pose_);
 
@@ -81,7 +139,12 @@ std::vector<descartes_light::StateSample<FloatType>> DescartesRobotSampler<Float
 
     // Solve IK (TODO Should tcp_offset be stored in KinGroupIKInput?)
     tesseract_kinematics::KinGroupIKInput ik_input(target_pose, target_working_frame_, tcp_frame_);
-    tesseract_kinematics::IKSolutions ik_solutions = manip_->calcInvKin({ ik_input }, ik_seed_);
+    tesseract_kinematics::IKSolutions ik_solutions;
+    if (ik_cache_ != nullptr)
+      ik_solutions =
+          ik_cache_->calcInvKin(*manip_, *ik_frame_signature_, ik_input, ik_seed_, env_revision_, ik_solver_);
+    else
+      ik_solutions = manip_->calcInvKin({ ik_input }, ik_seed_);
 
     if (ik_solutions.empty())
       continue;
@@ -93,18 +156,18 @@ std::vector<descartes_light::StateSample<FloatType>> DescartesRobotSampler<Float
         continue;
 
       auto state = std::make_shared<descartes_light::State<FloatType>>(sol.cast<FloatType>());
-      if (allow_collision_ && collision_ == nullptr)
+      if (allow_collision_ && collision == nullptr)
       {
         samples.push_back(descartes_light::StateSample<FloatType>{ state, static_cast<FloatType>(0.0) });
       }
       else if (!allow_collision_)
       {
-        if (collision_->validate(sol))
+        if (collision->validate(sol))
           samples.push_back(descartes_light::StateSample<FloatType>{ state, 0.0 });
       }
       else
       {
-        const FloatType cost = static_cast<FloatType>(collision_->distance(sol));
+        const FloatType cost = static_cast<FloatType>(collision->distance(sol));
         samples.push_back(descartes_light::StateSample<FloatType>{ state, cost });
       }
     }
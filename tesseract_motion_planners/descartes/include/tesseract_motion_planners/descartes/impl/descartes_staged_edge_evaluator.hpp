@@ -0,0 +1,73 @@
+/**
+ * @file descartes_staged_edge_evaluator.hpp
+ * @brief Tesseract Descartes Staged Edge Evaluator Implementation
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_IMPL_DESCARTES_STAGED_EDGE_EVALUATOR_HPP
+#define TESSERACT_MOTION_PLANNERS_IMPL_DESCARTES_STAGED_EDGE_EVALUATOR_HPP
+
+#include <tesseract_motion_planners/descartes/descartes_staged_edge_evaluator.h>
+
+namespace tesseract_planning
+{
+template <typename FloatType>
+DescartesStagedEdgeEvaluator<FloatType>::DescartesStagedEdgeEvaluator(
+    Eigen::Matrix<FloatType, Eigen::Dynamic, 1> max_joint_step,
+    FloatType max_cost)
+  : max_joint_step_(std::move(max_joint_step)), max_cost_(max_cost)
+{
+}
+
+template <typename FloatType>
+std::pair<bool, FloatType>
+DescartesStagedEdgeEvaluator<FloatType>::evaluate(const descartes_light::State<FloatType>& start,
+                                                  const descartes_light::State<FloatType>& end) const
+{
+  assert(start.values.rows() == end.values.rows());
+  assert(max_joint_step_.rows() == 0 || max_joint_step_.rows() == start.values.rows());
+
+  // Stage 1: Joint step bound
+  if (max_joint_step_.rows() > 0 && ((end.values - start.values).cwiseAbs().array() > max_joint_step_.array()).any())
+    return std::make_pair(false, 0);
+
+  // Stage 2: Joint distance cost
+  FloatType cost = (end.values - start.values).norm();
+  if (cost > max_cost_)
+    return std::make_pair(false, 0);
+
+  // Stage 3: The remaining evaluators, which are only run on edges that passed the cheap checks
+  for (const auto& evaluator : evaluators)
+  {
+    std::pair<bool, FloatType> result = evaluator->evaluate(start, end);
+    if (!result.first)
+      return std::make_pair(false, 0);
+
+    cost += result.second;
+  }
+
+  return std::make_pair(true, cost);
+}
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_IMPL_DESCARTES_STAGED_EDGE_EVALUATOR_HPP
@@ -32,8 +32,8 @@
 #include <tesseract_motion_planners/descartes/descartes_robot_sampler.h>
 #include <tesseract_motion_planners/descartes/descartes_collision.h>
 #include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
+#include <tesseract_motion_planners/descartes/descartes_staged_edge_evaluator.h>
 
-#include <descartes_light/edge_evaluators/euclidean_distance_edge_evaluator.h>
 #include <descartes_light/edge_evaluators/compound_edge_evaluator.h>
 #include <descartes_light/state_evaluators/euclidean_distance_state_evaluator.h>
 #include <descartes_light/samplers/fixed_joint_waypoint_sampler.h>
@@ -47,6 +47,7 @@ DescartesDefaultPlanProfile<FloatType>::DescartesDefaultPlanProfile(const tinyxm
 {
   const tinyxml2::XMLElement* vertex_collisions_element = xml_element.FirstChildElement("VertexCollisions");
   const tinyxml2::XMLElement* edge_collisions_element = xml_element.FirstChildElement("EdgeCollisions");
+  const tinyxml2::XMLElement* edge_max_joint_step_element = xml_element.FirstChildElement("EdgeMaxJointStep");
   const tinyxml2::XMLElement* num_threads_element = xml_element.FirstChildElement("NumberThreads");
   const tinyxml2::XMLElement* allow_collisions_element = xml_element.FirstChildElement("AllowCollisions");
   const tinyxml2::XMLElement* debug_element = xml_element.FirstChildElement("Debug");
@@ -132,6 +133,19 @@ DescartesDefaultPlanProfile<FloatType>::DescartesDefaultPlanProfile(const tinyxm
     }
   }
 
+  if (edge_max_joint_step_element != nullptr)
+  {
+    std::string edge_max_joint_step_string;
+    status = tesseract_common::QueryStringText(edge_max_joint_step_element, edge_max_joint_step_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("DescartesPlanProfile: Error parsing EdgeMaxJointStep string");
+
+    if (!tesseract_common::isNumeric(edge_max_joint_step_string))
+      throw std::runtime_error("DescartesPlanProfile: EdgeMaxJointStep is not a numeric values.");
+
+    tesseract_common::toNumeric<double>(edge_max_joint_step_string, edge_max_joint_step);
+  }
+
   if (num_threads_element != nullptr)
   {
     std::string num_threads_string;
@@ -192,39 +206,39 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
   //    is "
   //                             "not set to the base link of manipulator!");
 
-  DescartesCollision::Ptr ci = nullptr;
+  // The samplers of this profile share one collision interface which is cloned for each sampling thread
+  std::shared_ptr<DescartesThreadLocalCollision> ci;
   if (enable_collision)
-    ci = std::make_shared<DescartesCollision>(*prob.env, prob.manip, vertex_collision_check_config, debug);
+  {
+    std::shared_ptr<DescartesThreadLocalCollision>& shared_ci = prob.vertex_collisions[base_instruction.getProfile()];
+    if (shared_ci == nullptr)
+      shared_ci = createThreadLocalCollision(
+          std::make_shared<DescartesCollision>(*prob.env, prob.manip, vertex_collision_check_config, debug));
+
+    ci = shared_ci;
+  }
 
   // Add vertex evaluator
-  std::shared_ptr<descartes_light::WaypointSampler<FloatType>> sampler;
+  DescartesVertexEvaluator::Ptr ve;
   if (vertex_evaluator == nullptr)
-  {
-    auto ve = std::make_shared<DescartesJointLimitsVertexEvaluator>(prob.manip->getLimits().joint_limits);
-    sampler = std::make_shared<DescartesRobotSampler<FloatType>>(mi.working_frame,
-                                                                 cartesian_waypoint,
-                                                                 target_pose_sampler,
-                                                                 prob.manip,
-                                                                 ci,
-                                                                 mi.tcp_frame,
-                                                                 tcp_offset,
-                                                                 allow_collision,
-                                                                 ve,
-                                                                 use_redundant_joint_solutions);
-  }
+    ve = std::make_shared<DescartesJointLimitsVertexEvaluator>(prob.manip->getLimits().joint_limits);
   else
-  {
-    sampler = std::make_shared<DescartesRobotSampler<FloatType>>(mi.working_frame,
-                                                                 cartesian_waypoint,
-                                                                 target_pose_sampler,
-                                                                 prob.manip,
-                                                                 ci,
-                                                                 mi.tcp_frame,
-                                                                 tcp_offset,
-                                                                 allow_collision,
-                                                                 vertex_evaluator(prob),
-                                                                 use_redundant_joint_solutions);
-  }
+    ve = vertex_evaluator(prob);
+
+  auto sampler = std::make_shared<DescartesRobotSampler<FloatType>>(mi.working_frame,
+                                                                    cartesian_waypoint,
+                                                                    target_pose_sampler,
+                                                                    prob.manip,
+                                                                    ci,
+                                                                    mi.tcp_frame,
+                                                                    tcp_offset,
+                                                                    allow_collision,
+                                                                    ve,
+                                                                    use_redundant_joint_solutions,
+                                                                    prob.ik_cache,
+                                                                    prob.env->getRevision(),
+                                                                    prob.ik_solver,
+                                                                    prob.ik_frame_signature);
   prob.samplers.push_back(std::move(sampler));
 
   if (index != 0)
@@ -232,19 +246,17 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
     // Add edge Evaluator
     if (edge_evaluator == nullptr)
     {
+      // The joint step and joint distance cost are checked before the collision check
+      Eigen::Matrix<FloatType, Eigen::Dynamic, 1> max_joint_step;
+      if (edge_max_joint_step > 0)
+        max_joint_step.setConstant(prob.manip->numJoints(), static_cast<FloatType>(edge_max_joint_step));
+
+      auto staged_evaluator = std::make_shared<DescartesStagedEdgeEvaluator<FloatType>>(max_joint_step);
       if (enable_edge_collision)
-      {
-        auto compound_evaluator = std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>();
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>());
-        compound_evaluator->evaluators.push_back(std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(
+        staged_evaluator->evaluators.push_back(std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(
             *prob.env, prob.manip, edge_collision_check_config, allow_collision, debug));
-        prob.edge_evaluators.push_back(compound_evaluator);
-      }
-      else
-      {
-        prob.edge_evaluators.push_back(std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>());
-      }
+
+      prob.edge_evaluators.push_back(staged_evaluator);
     }
     else
     {
@@ -290,19 +302,17 @@ void DescartesDefaultPlanProfile<FloatType>::apply(DescartesProblem<FloatType>&
     // Add edge Evaluator
     if (edge_evaluator == nullptr)
     {
+      // The joint step and joint distance cost are checked before the collision check
+      Eigen::Matrix<FloatType, Eigen::Dynamic, 1> max_joint_step;
+      if (edge_max_joint_step > 0)
+        max_joint_step.setConstant(prob.manip->numJoints(), static_cast<FloatType>(edge_max_joint_step));
+
+      auto staged_evaluator = std::make_shared<DescartesStagedEdgeEvaluator<FloatType>>(max_joint_step);
       if (enable_edge_collision)
-      {
-        auto compound_evaluator = std::make_shared<descartes_light::CompoundEdgeEvaluator<FloatType>>();
-        compound_evaluator->evaluators.push_back(
-            std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>());
-        compound_evaluator->evaluators.push_back(std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(
+        staged_evaluator->evaluators.push_back(std::make_shared<DescartesCollisionEdgeEvaluator<FloatType>>(
             *prob.env, prob.manip, edge_collision_check_config, allow_collision, debug));
-        prob.edge_evaluators.push_back(compound_evaluator);
-      }
-      else
-      {
-        prob.edge_evaluators.push_back(std::make_shared<descartes_light::EuclideanDistanceEdgeEvaluator<FloatType>>());
-      }
+
+      prob.edge_evaluators.push_back(staged_evaluator);
     }
     else
     {
@@ -353,6 +363,10 @@ tinyxml2::XMLElement* DescartesDefaultPlanProfile<FloatType>::toXML(tinyxml2::XM
 
   xml_descartes->InsertEndChild(edge_collisions);
 
+  tinyxml2::XMLElement* edge_max_joint_step_element = doc.NewElement("EdgeMaxJointStep");
+  edge_max_joint_step_element->SetText(edge_max_joint_step);
+  xml_descartes->InsertEndChild(edge_max_joint_step_element);
+
   tinyxml2::XMLElement* number_threads = doc.NewElement("NumberThreads");
   number_threads->SetText(num_threads);
   xml_descartes->InsertEndChild(number_threads);
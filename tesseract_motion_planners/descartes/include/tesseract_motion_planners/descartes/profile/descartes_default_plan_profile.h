@@ -78,6 +78,13 @@ public:
   bool enable_edge_collision{ false };
   tesseract_collision::CollisionCheckConfig edge_collision_check_config{ 0 };
 
+  /**
+   * @brief The max change of any joint allowed along an edge, used by the default edge evaluator
+   * @details Edges exceeding it are rejected before their cost is computed or collision checked. If zero or less no
+   * bound is applied.
+   */
+  double edge_max_joint_step{ 0 };
+
   /**
    * @brief Flag for generating redundant solutions as additional vertices for the planning graph search
    */
@@ -86,4 +86,10 @@ double DescartesCollision::distance(const Eigen::Ref<const Eigen::VectorXd>& pos
 
 DescartesCollision::Ptr DescartesCollision::clone() const { return std::make_shared<DescartesCollision>(*this); }
 
+std::shared_ptr<DescartesThreadLocalCollision> createThreadLocalCollision(DescartesCollision::ConstPtr collision)
+{
+  return std::make_shared<DescartesThreadLocalCollision>(
+      [collision = std::move(collision)]() { return std::make_unique<DescartesCollision>(*collision); });
+}
+
 }  // namespace tesseract_planning
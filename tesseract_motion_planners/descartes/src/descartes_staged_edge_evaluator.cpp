@@ -0,0 +1,34 @@
+/**
+ * @file descartes_staged_edge_evaluator.cpp
+ * @brief Tesseract Descartes Staged Edge Evaluator Implementation
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_motion_planners/descartes/impl/descartes_staged_edge_evaluator.hpp>
+
+namespace tesseract_planning
+{
+// Explicit template instantiation
+template class DescartesStagedEdgeEvaluator<float>;
+template class DescartesStagedEdgeEvaluator<double>;
+
+}  // namespace tesseract_planning
@@ -0,0 +1,117 @@
+/**
+ * @file descartes_edge_evaluator_benchmark.cpp
+ * @brief Benchmark Descartes collision edge evaluation throughput against the number of threads
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <random>
+#include <thread>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_motion_planners/descartes/descartes_collision_edge_evaluator.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+/** @brief The number of edges evaluated by each thread per benchmark iteration */
+static const std::size_t EDGES_PER_THREAD = 1000;
+
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/abb_irb2400.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+/** @brief Create random states within the joint limits, as found in consecutive rungs of a ladder graph */
+static std::vector<descartes_light::State<double>> createStates(const tesseract_kinematics::JointGroup& joint_group,
+                                                                std::size_t num_states)
+{
+  std::mt19937 gen(42);
+  Eigen::MatrixX2d limits = joint_group.getLimits().joint_limits;
+  std::vector<descartes_light::State<double>> states;
+  states.reserve(num_states);
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    Eigen::VectorXd values(limits.rows());
+    for (Eigen::Index j = 0; j < limits.rows(); ++j)
+      values(j) = std::uniform_real_distribution<double>(limits(j, 0), limits(j, 1))(gen);
+
+    states.emplace_back(values);
+  }
+  return states;
+}
+
+/** @brief Evaluate edges from the given number of threads sharing a single evaluator */
+static void evaluateEdges(benchmark::State& state, tesseract_collision::CollisionEvaluatorType type)
+{
+  Environment::Ptr env = getEnvironment();
+  auto joint_group = env->getJointGroup("manipulator");
+  const auto num_threads = static_cast<std::size_t>(state.range(0));
+
+  tesseract_collision::CollisionCheckConfig config(0);
+  config.type = type;
+  DescartesCollisionEdgeEvaluator<double> evaluator(
+      *env, joint_group, config, false, false, static_cast<int>(num_threads));
+
+  std::vector<descartes_light::State<double>> states = createStates(*joint_group, EDGES_PER_THREAD + 1);
+  for (auto _ : state)
+  {
+    std::vector<std::thread> threads;
+    threads.reserve(num_threads);
+    for (std::size_t t = 0; t < num_threads; ++t)
+    {
+      threads.emplace_back([&evaluator, &states]() {
+        for (std::size_t i = 0; i < EDGES_PER_THREAD; ++i)
+          benchmark::DoNotOptimize(evaluator.evaluate(states[i], states[i + 1]));
+      });
+    }
+
+    for (auto& thread : threads)
+      thread.join();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations() * num_threads * EDGES_PER_THREAD));
+}
+
+static void BM_DescartesDiscreteEdgeEvaluator(benchmark::State& state)
+{
+  evaluateEdges(state, tesseract_collision::CollisionEvaluatorType::DISCRETE);
+}
+
+static void BM_DescartesContinuousEdgeEvaluator(benchmark::State& state)
+{
+  evaluateEdges(state, tesseract_collision::CollisionEvaluatorType::CONTINUOUS);
+}
+
+BENCHMARK(BM_DescartesDiscreteEdgeEvaluator)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+BENCHMARK(BM_DescartesContinuousEdgeEvaluator)->RangeMultiplier(2)->Range(1, 8)->UseRealTime();
+
+BENCHMARK_MAIN();
@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <atomic>
+#include <thread>
 #include <tesseract_motion_planners/descartes/descartes_collision.h>
 #include <descartes_light/edge_evaluators/euclidean_distance_edge_evaluator.h>
 #include <tesseract_kinematics/core/utils.h>
@@ -43,6 +45,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/descartes/descartes_motion_planner.h>
 #include <tesseract_motion_planners/descartes/descartes_utils.h>
+#include <tesseract_motion_planners/descartes/descartes_staged_edge_evaluator.h>
 #include <tesseract_motion_planners/descartes/profile/descartes_default_plan_profile.h>
 #include <tesseract_motion_planners/descartes/serialize.h>
 #include <tesseract_motion_planners/descartes/deserialize.h>
@@ -165,6 +168,7 @@ TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerFixedPoses)  // NOLINT
       auto problem = single_descartes_planner.createProblem(request);
       EXPECT_EQ(problem->samplers.size(), 11);
       EXPECT_EQ(problem->edge_evaluators.size(), 10);
+      EXPECT_EQ(problem->vertex_collisions.size(), 1);
     }
 
     DescartesMotionPlannerD descartes_planner(DESCARTES_DEFAULT_NAMESPACE);
@@ -421,6 +425,160 @@ TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerCollisionEdgeEvaluator)
   }
 }
 
+/** @brief Edge evaluator which counts the number of edges it evaluates */
+class CountingEdgeEvaluator : public descartes_light::EdgeEvaluator<double>
+{
+public:
+  CountingEdgeEvaluator(bool valid, double cost) : valid_(valid), cost_(cost) {}
+
+  std::pair<bool, double> evaluate(const descartes_light::State<double>& /*start*/,
+                                   const descartes_light::State<double>& /*end*/) const override
+  {
+    ++count;
+    return std::make_pair(valid_, cost_);
+  }
+
+  mutable int count{ 0 };
+
+private:
+  bool valid_;
+  double cost_;
+};
+
+TEST_F(TesseractPlanningDescartesUnit, DescartesPlannerParallelSampling)  // NOLINT
+{
+  // Create a program
+  CartesianWaypointPoly wp1{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, -.20, 0.8) *
+                                               Eigen::Quaterniond(0, 0, -1.0, 0)) };
+  CartesianWaypointPoly wp2{ CartesianWaypoint(Eigen::Isometry3d::Identity() * Eigen::Translation3d(0.8, .20, 0.8) *
+                                               Eigen::Quaterniond(0, 0, -1.0, 0)) };
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::LINEAR, "TEST_PROFILE", manip));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::LINEAR, "TEST_PROFILE", manip));
+
+  auto cur_state = env_->getState();
+  CompositeInstruction interpolated_program =
+      generateInterpolatedProgram(program, cur_state, env_, 3.14, 1.0, 3.14, 10);
+
+  // Sample the tool z axis so each rung has many samples
+  auto plan_profile = std::make_shared<DescartesDefaultPlanProfileD>();
+  plan_profile->target_pose_sampler = [](const Eigen::Isometry3d& tool_pose) {
+    return tesseract_planning::sampleToolZAxis(tool_pose, M_PI_4);
+  };
+  plan_profile->num_threads = 1;
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<DescartesPlanProfile<double>>(DESCARTES_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = interpolated_program;
+  request.env = env_;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  // Run the jobs on threads owned by the test, like an executor would
+  std::atomic<int> parallel_for_calls{ 0 };
+  PlannerParallelFor parallel_for = [&parallel_for_calls](std::size_t count,
+                                                          const std::function<void(std::size_t)>& job) {
+    ++parallel_for_calls;
+    std::vector<std::thread> threads;
+    for (std::size_t t = 0; t < 4; ++t)
+    {
+      threads.emplace_back([t, count, &job]() {
+        for (std::size_t i = t; i < count; i += 4)
+          job(i);
+      });
+    }
+    for (auto& thread : threads)
+      thread.join();
+  };
+
+  DescartesMotionPlannerD planner(DESCARTES_DEFAULT_NAMESPACE);
+  auto problem = planner.createProblem(request);
+  auto serial = DescartesMotionPlannerD::sampleRungs(problem->samplers, PlannerParallelFor());
+  auto parallel = DescartesMotionPlannerD::sampleRungs(problem->samplers, parallel_for);
+  EXPECT_EQ(parallel_for_calls, 1);
+
+  // Parallel and serial sampling return identical samples in the same order
+  ASSERT_EQ(serial.size(), problem->samplers.size());
+  ASSERT_EQ(parallel.size(), problem->samplers.size());
+  for (std::size_t i = 0; i < serial.size(); ++i)
+  {
+    std::vector<StateSample<double>> serial_samples = serial[i]->sample();
+    std::vector<StateSample<double>> parallel_samples = parallel[i]->sample();
+    EXPECT_FALSE(serial_samples.empty());
+    ASSERT_EQ(serial_samples.size(), parallel_samples.size());
+    for (std::size_t j = 0; j < serial_samples.size(); ++j)
+    {
+      EXPECT_TRUE(serial_samples[j].state->values.isApprox(parallel_samples[j].state->values));
+      EXPECT_DOUBLE_EQ(serial_samples[j].cost, parallel_samples[j].cost);
+    }
+  }
+
+  // Without a parallel for the ladder graph solver samples the rungs while building
+  PlannerResponse serial_response = planner.solve(request);
+  EXPECT_TRUE(serial_response.successful);
+  EXPECT_EQ(parallel_for_calls, 1);
+  auto serial_problem = std::static_pointer_cast<DescartesProblem<double>>(serial_response.data);
+  ASSERT_TRUE(serial_problem != nullptr);
+  EXPECT_DOUBLE_EQ(serial_problem->phase_times.sampling, 0);
+  EXPECT_GT(serial_problem->phase_times.edges, 0);
+
+  // The planner samples with the parallel for of the request and records the time of each phase
+  request.parallel_for = parallel_for;
+  PlannerResponse response = planner.solve(request);
+  EXPECT_TRUE(response.successful);
+  EXPECT_EQ(parallel_for_calls, 2);
+
+  auto solved_problem = std::static_pointer_cast<DescartesProblem<double>>(response.data);
+  ASSERT_TRUE(solved_problem != nullptr);
+  EXPECT_GT(solved_problem->phase_times.sampling, 0);
+  EXPECT_GT(solved_problem->phase_times.edges, 0);
+  EXPECT_GT(solved_problem->phase_times.search, 0);
+
+  // The same plan profile is resolved for every waypoint, so they share one vertex collision interface
+  EXPECT_EQ(solved_problem->vertex_collisions.size(), 1);
+  EXPECT_TRUE(solved_problem->vertex_collisions.find("TEST_PROFILE") != solved_problem->vertex_collisions.end());
+}
+
+TEST(TesseractPlanningDescartesStagedEdgeEvaluatorUnit, StagedEdgeEvaluator)  // NOLINT
+{
+  descartes_light::State<double> start(Eigen::VectorXd::Zero(3));
+  descartes_light::State<double> near(Eigen::Vector3d(0.1, -0.2, 0.2));
+  descartes_light::State<double> far(Eigen::Vector3d(0.1, 1.0, 0.0));
+
+  auto first = std::make_shared<CountingEdgeEvaluator>(true, 1.0);
+  auto second = std::make_shared<CountingEdgeEvaluator>(false, 0.0);
+  auto third = std::make_shared<CountingEdgeEvaluator>(true, 1.0);
+
+  // Without any bounds the cost is the joint distance plus the cost of each evaluator
+  DescartesStagedEdgeEvaluatorD unbounded;
+  unbounded.evaluators.push_back(first);
+  std::pair<bool, double> result = unbounded.evaluate(start, near);
+  EXPECT_TRUE(result.first);
+  EXPECT_NEAR(result.second, 0.3 + 1.0, 1e-6);
+  EXPECT_EQ(first->count, 1);
+
+  // Edges exceeding the joint step are rejected before the evaluators are called
+  DescartesStagedEdgeEvaluatorD bounded(Eigen::VectorXd::Constant(3, 0.5));
+  bounded.evaluators = { first, second, third };
+  EXPECT_FALSE(bounded.evaluate(start, far).first);
+  EXPECT_EQ(first->count, 1);
+
+  // Edges exceeding the max cost are rejected before the evaluators are called
+  DescartesStagedEdgeEvaluatorD cost_bounded(Eigen::VectorXd(), 0.5);
+  cost_bounded.evaluators.push_back(first);
+  EXPECT_FALSE(cost_bounded.evaluate(start, far).first);
+  EXPECT_EQ(first->count, 1);
+
+  // Evaluation stops at the first evaluator which rejects the edge
+  EXPECT_FALSE(bounded.evaluate(start, near).first);
+  EXPECT_EQ(first->count, 2);
+  EXPECT_EQ(second->count, 1);
+  EXPECT_EQ(third->count, 0);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -30,6 +30,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/StateValidityChecker.h>
 #include <ompl/base/SpaceInformation.h>
+#include <functional>
 #include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -45,12 +46,25 @@ public:
 
   bool isValid(const ompl::base::State* state) const override;
 
+  /**
+   * @brief Check a batch of states, stopping at the first invalid state
+   * @details Each validator checks the batch in the order added, only up to the first invalid state found by the
+   * previous validators, so the cheap validators added first limit the work done by the collision validators.
+   * @param states The states to check
+   * @param count The number of states from the front of states to check
+   * @return The index of the first invalid state, or count if all states are valid
+   */
+  std::size_t findFirstInvalid(const std::vector<const ompl::base::State*>& states, std::size_t count) const;
+
   void addStateValidator(ompl::base::StateValidityCheckerPtr validator);
   void addStateValidator(ompl::base::StateValidityCheckerFn validator);
 
 private:
+  using BatchValidatorFn = std::function<std::size_t(const std::vector<const ompl::base::State*>&, std::size_t)>;
+
   std::vector<ompl::base::StateValidityCheckerPtr> cache_;
   std::vector<ompl::base::StateValidityCheckerFn> validators_;
+  std::vector<BatchValidatorFn> batch_validators_;
 };
 }  // namespace tesseract_planning
 #endif  // TESSERACT_MOTION_PLANNERS_COMPOUND_STATE_VALIDATOR_H
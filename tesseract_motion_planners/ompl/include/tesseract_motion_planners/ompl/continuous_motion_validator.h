@@ -30,10 +30,11 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/MotionValidator.h>
 #include <ompl/base/StateValidityChecker.h>
-#include <mutex>
+#include <ompl/base/StateSpace.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/core/thread_local_cache.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
 
@@ -48,7 +49,8 @@ public:
                             const tesseract_environment::Environment& env,
                             tesseract_kinematics::JointGroup::ConstPtr manip,
                             const tesseract_collision::CollisionCheckConfig& collision_check_config,
-                            OMPLStateExtractor extractor);
+                            OMPLStateExtractor extractor,
+                            OMPLMotionCheckOrder check_order = OMPLMotionCheckOrder::LINEAR);
 
   bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const override;
 
@@ -57,13 +59,77 @@ public:
                    std::pair<ompl::base::State*, double>& lastValid) const override;
 
 private:
+  /** @brief The collision checking data owned by each thread */
+  struct ThreadData
+  {
+    ThreadData(ompl::base::StateSpacePtr state_space);
+    ~ThreadData();
+    ThreadData(const ThreadData&) = delete;
+    ThreadData& operator=(const ThreadData&) = delete;
+    ThreadData(ThreadData&&) = delete;
+    ThreadData& operator=(ThreadData&&) = delete;
+
+    ompl::base::StateSpacePtr state_space;
+    ompl::base::State* start_interp{ nullptr };
+    ompl::base::State* end_interp{ nullptr };
+    tesseract_collision::ContinuousContactManager::UPtr contact_manager;
+    tesseract_collision::ContactResultMap contact_map;
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> unchecked;
+  };
+
+  /**
+   * @brief Check the motion between two states
+   * @param s1 The start state, which is assumed to be valid
+   * @param s2 The end state
+   * @param last_valid The last valid state and fraction of the motion, if nullptr it is not calculated
+   * @return True if the motion is valid, otherwise false
+   */
+  bool checkMotion(const ompl::base::State* s1,
+                   const ompl::base::State* s2,
+                   std::pair<ompl::base::State*, double>* last_valid) const;
+
+  /**
+   * @brief Check the segments of a motion in order, reusing the link transforms of the end of each segment
+   * @return The index of the first invalid segment, or n_steps if all segments are valid
+   */
+  std::size_t checkSegmentsLinear(ThreadData& data,
+                                  const ompl::base::State* s1,
+                                  const ompl::base::State* s2,
+                                  unsigned n_steps) const;
+
+  /**
+   * @brief Check the segments of a motion in bisection order
+   * @param find_first Indicate if the first invalid segment must be found, otherwise the search stops at any invalid
+   * segment
+   * @return The index of the first invalid segment, or n_steps if all segments are valid
+   */
+  std::size_t checkSegmentsBisection(ThreadData& data,
+                                     const ompl::base::State* s1,
+                                     const ompl::base::State* s2,
+                                     unsigned n_steps,
+                                     bool find_first) const;
+
+  /**
+   * @brief Check a single segment of the motion, which ends at the interpolated state (segment + 1) / n_steps
+   * @return True if the segment is valid, otherwise false
+   */
+  bool checkSegment(ThreadData& data,
+                    const ompl::base::State* s1,
+                    const ompl::base::State* s2,
+                    std::size_t segment,
+                    unsigned n_steps) const;
+
   /**
-   * @brief Perform a continuous collision check between two ompl states
-   * @param s1 First OMPL State
-   * @param s2 Second OMPL State
+   * @brief Perform a continuous collision check between the link transforms of two states
+   * @param data The thread data
+   * @param state0 The link transforms of the first state
+   * @param state1 The link transforms of the second state
    * @return True if not in collision, otherwise false.
    */
-  bool continuousCollisionCheck(const ompl::base::State* s1, const ompl::base::State* s2) const;
+  bool continuousCollisionCheck(ThreadData& data,
+                                const tesseract_common::TransformMap& state0,
+                                const tesseract_common::TransformMap& state1) const;
 
   /**
    * @brief The state validator without collision checking
@@ -84,16 +150,15 @@ private:
   /** @brief This will extract an Eigen::VectorXd from the OMPL State */
   OMPLStateExtractor extractor_;
 
-  // The items below are to cache the contact manager based on thread ID. Currently ompl is multi
-  // threaded but the methods used to implement collision checking are not thread safe. To prevent
-  // reconstructing the collision environment for every check this will cache a contact manager
-  // based on its thread ID.
+  /** @brief The order in which the segments of a motion are checked */
+  OMPLMotionCheckOrder check_order_;
 
-  /** @brief Contact manager caching mutex */
-  mutable std::mutex mutex_;
+  // Currently ompl is multi threaded but the methods used to implement collision checking are not thread safe. To
+  // prevent reconstructing the collision environment for every check each thread is given its own contact manager
+  // which, after its first check, is looked up without locking.
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::ContinuousContactManager::Ptr> continuous_contact_managers_;
+  /** @brief The per thread contact managers, contact results and interpolation state */
+  ThreadLocalCache<ThreadData> thread_data_;
 };
 }  // namespace tesseract_planning
 
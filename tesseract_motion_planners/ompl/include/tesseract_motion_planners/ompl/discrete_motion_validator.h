@@ -29,21 +29,65 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/MotionValidator.h>
+#include <ompl/base/StateSpace.h>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_motion_planners/core/thread_local_cache.h>
+#include <tesseract_motion_planners/ompl/types.h>
+
 namespace tesseract_planning
 {
 /** @brief Continuous collision check between two states */
 class DiscreteMotionValidator : public ompl::base::MotionValidator
 {
 public:
-  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info);
+  /**
+   * @brief Construct a discrete motion validator
+   * @param space_info The space information, whose state validity checker is used to check the interpolated states
+   * @param check_order The order in which the interpolated states are checked
+   */
+  DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                          OMPLMotionCheckOrder check_order = OMPLMotionCheckOrder::LINEAR);
 
   bool checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const override;
 
   bool checkMotion(const ompl::base::State* s1,
                    const ompl::base::State* s2,
                    std::pair<ompl::base::State*, double>& lastValid) const override;
+
+private:
+  /** @brief The interpolated states reused by each thread so checking a motion does not allocate states */
+  struct ThreadData
+  {
+    ThreadData(ompl::base::StateSpacePtr state_space);
+    ~ThreadData();
+    ThreadData(const ThreadData&) = delete;
+    ThreadData& operator=(const ThreadData&) = delete;
+    ThreadData(ThreadData&&) = delete;
+    ThreadData& operator=(ThreadData&&) = delete;
+
+    ompl::base::StateSpacePtr state_space;
+    std::vector<ompl::base::State*> interp_states;
+    std::vector<const ompl::base::State*> states;
+    std::vector<const ompl::base::State*> batch;
+    std::vector<std::size_t> order;
+    std::vector<std::size_t> unchecked;
+  };
+
+  OMPLMotionCheckOrder check_order_;
+  ThreadLocalCache<ThreadData> thread_data_;
+
+  /**
+   * @brief Check the motion between two states
+   * @param s1 The start state, which is assumed to be valid
+   * @param s2 The end state
+   * @param last_valid The last valid state and fraction of the motion, if nullptr it is not calculated
+   * @return True if the motion is valid, otherwise false
+   */
+  bool checkMotion(const ompl::base::State* s1,
+                   const ompl::base::State* s2,
+                   std::pair<ompl::base::State*, double>* last_valid) const;
 };
 }  // namespace tesseract_planning
 
@@ -36,6 +36,7 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
 #include <ompl/base/Planner.h>
+#include <ompl/base/PlannerData.h>
 #include <tinyxml2.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -73,6 +74,13 @@ struct OMPLPlannerConfigurator
 
   virtual ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const = 0;
 
+  /**
+   * @brief Create the planner starting from an existing roadmap
+   * @details Only roadmap planners support this, all other planners return nullptr
+   * @param roadmap The roadmap, the planner is created on its space information
+   */
+  virtual ompl::base::PlannerPtr createFromRoadmap(const ompl::base::PlannerData& roadmap) const;
+
   virtual OMPLPlannerType getType() const = 0;
 
   virtual tinyxml2::XMLElement* toXML(tinyxml2::XMLDocument& doc) const = 0;
@@ -387,6 +395,9 @@ struct PRMConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner starting from an existing roadmap */
+  ompl::base::PlannerPtr createFromRoadmap(const ompl::base::PlannerData& roadmap) const override;
+
   OMPLPlannerType getType() const override;
 
   /** @brief Serialize planner to xml */
@@ -406,6 +417,9 @@ struct PRMstarConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner starting from an existing roadmap */
+  ompl::base::PlannerPtr createFromRoadmap(const ompl::base::PlannerData& roadmap) const override;
+
   OMPLPlannerType getType() const override;
 
   /** @brief Serialize planner to xml */
@@ -425,6 +439,9 @@ struct LazyPRMstarConfigurator : public OMPLPlannerConfigurator
   /** @brief Create the planner */
   ompl::base::PlannerPtr create(ompl::base::SpaceInformationPtr si) const override;
 
+  /** @brief Create the planner starting from an existing roadmap */
+  ompl::base::PlannerPtr createFromRoadmap(const ompl::base::PlannerData& roadmap) const override;
+
   OMPLPlannerType getType() const override;
 
   /** @brief Serialize planner to xml */
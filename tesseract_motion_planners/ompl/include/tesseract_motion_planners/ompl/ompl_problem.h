@@ -35,7 +35,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_cache.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_collision/core/types.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_motion_planners/ompl/types.h>
 
@@ -94,6 +96,19 @@ struct OMPLProblem
   /** @brief The max number of solutions. If max solutions are hit it will exit even if other threads are running. */
   int max_solutions = 10;
 
+  /**
+   * @brief Solve this problem at the same time as the other problems of the request
+   * @details The problems of a request are solved concurrently, using the parallel for of the request, when all of them
+   * set this
+   */
+  bool solve_concurrently = false;
+
+  /**
+   * @brief The planning time budget in seconds shared by all problems of the request
+   * @details Ignored if not greater than zero. If the problems have different budgets the smallest one is used.
+   */
+  double total_planning_time = 0;
+
   /**
    * @brief Simplify trajectory.
    *
@@ -131,6 +146,16 @@ struct OMPLProblem
    */
   std::vector<OMPLPlannerConfigurator::ConstPtr> planners{};
 
+  /**
+   * @brief The cache roadmap planners start from and store their roadmap in after the solve
+   *
+   * If nullptr every solve builds a new roadmap.
+   */
+  OMPLRoadmapCache::Ptr roadmap_cache;
+
+  /** @brief The collision check configuration of the validators, roadmaps are only reused with equal configurations */
+  tesseract_collision::CollisionCheckConfig collision_check_config;
+
   /**
    * @brief This will extract an Eigen::VectorXd from the OMPL State ***REQUIRED***
    */
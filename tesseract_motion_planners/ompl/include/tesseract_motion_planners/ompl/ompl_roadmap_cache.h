@@ -0,0 +1,153 @@
+/**
+ * @file ompl_roadmap_cache.h
+ * @brief A cache of OMPL roadmaps reused across solves
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <memory>
+#include <shared_mutex>
+#include <string>
+#include <unordered_map>
+#include <ompl/base/Planner.h>
+#include <ompl/base/PlannerData.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+namespace tesseract_planning
+{
+struct OMPLProblem;
+struct OMPLPlannerConfigurator;
+
+/**
+ * @brief A thread safe cache of the roadmaps built by OMPL roadmap planners (PRM, PRMstar and LazyPRMstar)
+ *
+ * By default a new planner is created for every solve, so the roadmap is thrown away afterwards. When a cache is
+ * provided the roadmap of each roadmap planner is stored after the solve and the next solve for the same scene,
+ * collision checking configuration, manipulator and planner starts from it. Roadmaps are kept in memory and, if a
+ * directory is provided, can be saved to and loaded from files so a restarted process starts warm.
+ *
+ * The stored roadmaps were validated against the state validity checker of the solve that built them. Custom state
+ * validity checkers or motion validators are not part of the key, so a cache should only be shared by profiles which
+ * use the same ones.
+ */
+class OMPLRoadmapCache
+{
+public:
+  using Ptr = std::shared_ptr<OMPLRoadmapCache>;
+  using ConstPtr = std::shared_ptr<const OMPLRoadmapCache>;
+
+  /**
+   * @brief Constructor
+   * @param directory The directory roadmaps are saved to and loaded from. If empty roadmaps are only kept in memory.
+   */
+  explicit OMPLRoadmapCache(std::string directory = "");
+  ~OMPLRoadmapCache() = default;
+  OMPLRoadmapCache(const OMPLRoadmapCache&) = delete;
+  OMPLRoadmapCache& operator=(const OMPLRoadmapCache&) = delete;
+  OMPLRoadmapCache(OMPLRoadmapCache&&) = delete;
+  OMPLRoadmapCache& operator=(OMPLRoadmapCache&&) = delete;
+
+  /**
+   * @brief Create the key of the roadmaps of a problem
+   * @details The key contains a hash of the command history of the environment and the values of the joints which are
+   * not part of the manipulator, which identify the scene since the name and revision of an environment are not unique.
+   * It also contains the collision check configuration and the collision margins of the contact checker, the
+   * manipulator and its joints and the state space. The hash of the command history is only computed once per
+   * environment revision, see getEnvironmentHash().
+   * @param prob The problem, the simple setup must already be created
+   * @return The key
+   */
+  static std::string createKey(const OMPLProblem& prob);
+
+  /**
+   * @brief Create the key of a planner of a problem
+   * @param problem_key The key of the problem, see createKey(const OMPLProblem&)
+   * @param prob The problem
+   * @param planner_index The index of the planner in the problem's planners
+   * @return The key
+   */
+  static std::string createKey(const std::string& problem_key, const OMPLProblem& prob, std::size_t planner_index);
+
+  /**
+   * @brief Create a planner initialized with the stored roadmap
+   * @details If the roadmap is not in memory it is loaded from the directory. If there is no stored roadmap the
+   * planner starts with an empty roadmap.
+   * @param key The key of the roadmap
+   * @param configurator The planner configurator
+   * @param si The space information of the problem being solved
+   * @return The planner, or nullptr if the planner does not support roadmaps
+   */
+  ompl::base::PlannerPtr create(const std::string& key,
+                                const OMPLPlannerConfigurator& configurator,
+                                const ompl::base::SpaceInformationPtr& si);
+
+  /**
+   * @brief Store the roadmap of a planner after a solve
+   * @details Concurrent solves may grow separate roadmaps for the same key so the stored roadmap is only replaced by
+   * one with at least as many vertices
+   * @param key The key of the roadmap
+   * @param planner The planner created by create()
+   */
+  void put(const std::string& key, const ompl::base::Planner& planner);
+
+  /**
+   * @brief Save the roadmaps in memory to the directory
+   * @return True if all roadmaps were saved, otherwise false
+   */
+  bool save() const;
+
+  /** @brief Get the directory roadmaps are saved to and loaded from */
+  const std::string& getDirectory() const;
+
+  /**
+   * @brief Get the file a roadmap is saved to
+   * @details The file name is the 64 bit FNV-1a hash of the key, which is the same on every platform. The file starts
+   * with the key so a roadmap is never loaded for another key with the same hash.
+   */
+  std::string getFilePath(const std::string& key) const;
+
+  /** @brief The number of roadmaps in memory */
+  std::size_t size() const;
+
+  /** @brief The total number of vertices of the roadmaps in memory */
+  std::size_t getNumVertices() const;
+
+  /** @brief Remove all roadmaps from memory, this does not remove saved files */
+  void clear();
+
+private:
+  std::string directory_;
+  mutable std::shared_mutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<const ompl::base::PlannerData>> roadmaps_;
+
+  /** @brief Load a roadmap from the directory, returns nullptr if there is none */
+  std::shared_ptr<const ompl::base::PlannerData> load(const std::string& key,
+                                                      const ompl::base::SpaceInformationPtr& si) const;
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_OMPL_OMPL_ROADMAP_CACHE_H
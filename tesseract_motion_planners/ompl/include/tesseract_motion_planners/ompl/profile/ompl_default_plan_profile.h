@@ -35,6 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_cache.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_profile.h>
 
 namespace tesseract_planning
@@ -67,6 +68,20 @@ public:
   /** @brief The max number of solutions. If max solutions are hit it will exit even if other threads are running. */
   int max_solutions = 10;
 
+  /**
+   * @brief Solve the segment at the same time as the other segments of the request
+   * @details The segments of a request are solved concurrently when all of their profiles set this. The segments run
+   * on the executor of the motion planner task, or in sequence if the request does not provide one.
+   */
+  bool solve_concurrently = false;
+
+  /**
+   * @brief The planning time budget in seconds shared by all segments of the request
+   * @details Ignored if not greater than zero. If the segments use profiles with different budgets the smallest one
+   * is used.
+   */
+  double total_planning_time = 0;
+
   /**
    * @brief Simplify trajectory.
    *
@@ -96,6 +111,14 @@ public:
   std::vector<OMPLPlannerConfigurator::ConstPtr> planners = { std::make_shared<const RRTConnectConfigurator>(),
                                                               std::make_shared<const RRTConnectConfigurator>() };
 
+  /**
+   * @brief The cache used to keep the roadmaps of roadmap planners (PRM, PRMstar and LazyPRMstar) across solves
+   *
+   * If nullptr every solve builds a new roadmap. The collision check configuration is part of the key of a roadmap, so
+   * the same cache may be shared by profiles which do not use custom validators.
+   */
+  OMPLRoadmapCache::Ptr roadmap_cache;
+
   /** @brief The collision check configuration */
   tesseract_collision::CollisionCheckConfig collision_check_config;
 
@@ -113,6 +136,9 @@ public:
    * ContinuousMotionValidator */
   MotionValidatorAllocator mv_allocator;
 
+  /** @brief The order in which the default motion validators check the states of a motion */
+  OMPLMotionCheckOrder motion_check_order{ OMPLMotionCheckOrder::LINEAR };
+
   void setup(OMPLProblem& prob) const override;
 
   void applyGoalStates(OMPLProblem& prob,
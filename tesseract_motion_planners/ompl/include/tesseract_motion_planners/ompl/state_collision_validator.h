@@ -29,10 +29,11 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/StateValidityChecker.h>
-#include <mutex>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/core/thread_local_cache.h>
 #include <tesseract_environment/environment.h>
 #include <tesseract_kinematics/core/forward_kinematics.h>
 
@@ -50,7 +51,23 @@ public:
 
   bool isValid(const ompl::base::State* state) const override;
 
+  /**
+   * @brief Check a batch of states, stopping at the first state in collision
+   * @details The contact manager for the calling thread is looked up once for the whole batch.
+   * @param states The states to check
+   * @param count The number of states from the front of states to check
+   * @return The index of the first invalid state, or count if all states are valid
+   */
+  std::size_t findFirstInvalid(const std::vector<const ompl::base::State*>& states, std::size_t count) const;
+
 private:
+  /** @brief The collision checking data owned by each thread */
+  struct ThreadData
+  {
+    tesseract_collision::DiscreteContactManager::UPtr contact_manager;
+    tesseract_collision::ContactResultMap contact_map;
+  };
+
   /** @brief The Tesseract Joint Group */
   tesseract_kinematics::JointGroup::ConstPtr manip_;
 
@@ -63,16 +80,15 @@ private:
   /** @brief This will extract an Eigen::VectorXd from the OMPL State */
   OMPLStateExtractor extractor_;
 
-  // The items below are to cache the contact manager based on thread ID. Currently ompl is multi
-  // threaded but the methods used to implement collision checking are not thread safe. To prevent
-  // reconstructing the collision environment for every check this will cache a contact manager
-  // based on its thread ID.
+  // Currently ompl is multi threaded but the methods used to implement collision checking are not thread safe. To
+  // prevent reconstructing the collision environment for every check each thread is given its own contact manager
+  // which, after its first check, is looked up without locking.
 
-  /** @brief Contact manager caching mutex */
-  mutable std::mutex mutex_;
+  /** @brief The per thread contact managers and contact results */
+  ThreadLocalCache<ThreadData> thread_data_;
 
-  /** @brief The continuous contact manager cache */
-  mutable std::map<unsigned long int, tesseract_collision::DiscreteContactManager::Ptr> contact_managers_;
+  /** @brief Check a single state using the provided thread data */
+  bool checkState(ThreadData& data, const ompl::base::State* state) const;
 };
 
 }  // namespace tesseract_planning
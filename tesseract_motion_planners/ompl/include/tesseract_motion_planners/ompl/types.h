@@ -39,5 +39,19 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 namespace tesseract_planning
 {
 using OMPLStateExtractor = std::function<Eigen::Map<Eigen::VectorXd>(const ompl::base::State*)>;
-}
+
+/** @brief The order in which the motion validators check the interpolated states of a motion */
+enum class OMPLMotionCheckOrder
+{
+  /** @brief Check the states from the start toward the end of the motion */
+  LINEAR,
+  /**
+   * @brief Check the end of the motion first, followed by the midpoints of ever smaller intervals (van der Corput)
+   * @details Collisions usually sit in the middle of a motion so an invalid motion is rejected with fewer checks. When
+   * the last valid state is requested the remaining states before the first invalid state found are checked in
+   * order, so it is the same as when checking linearly.
+   */
+  BISECTION
+};
+}  // namespace tesseract_planning
 #endif  // TESSERACT_MOTION_PLANNERS_OMPL_TYPES_H
@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/State.h>
+#include <ompl/base/StateValidityChecker.h>
 #include <ompl/geometric/PathGeometric.h>
 #include <Eigen/Geometry>
 #include <functional>
@@ -83,6 +84,27 @@ bool checkStateInCollision(OMPLProblem& prob,
                            const Eigen::VectorXd& state,
                            tesseract_collision::ContactResultMap& contact_map);
 
+/**
+ * @brief Check a batch of states, stopping at the first invalid state
+ * @details The batch API of the StateCollisionValidator and CompoundStateValidator is used when available, otherwise
+ * each state is checked using isValid.
+ * @param validator The state validity checker
+ * @param states The states to check
+ * @param count The number of states from the front of states to check
+ * @return The index of the first invalid state, or count if all states are valid
+ */
+std::size_t findFirstInvalidState(const ompl::base::StateValidityChecker& validator,
+                                  const std::vector<const ompl::base::State*>& states,
+                                  std::size_t count);
+
+/**
+ * @brief Get the order in which OMPLMotionCheckOrder::BISECTION checks the states or segments of a motion
+ * @details The last index is first, followed by the midpoints of ever smaller intervals of the remaining indices.
+ * @param count The number of states or segments
+ * @param order The indices in the order they are checked, the memory of the vector is reused
+ */
+void getBisectionOrder(std::size_t count, std::vector<std::size_t>& order);
+
 /**
  * @brief Default State sampler which uses the weights information to scale the sampled state. This is use full
  * when you state space has mixed units like meters and radian.
@@ -30,6 +30,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/compound_state_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 
 namespace tesseract_planning
 {
@@ -56,17 +57,41 @@ bool CompoundStateValidator::isValid(const ompl::base::State* state) const
   return true;
 }
 
+std::size_t CompoundStateValidator::findFirstInvalid(const std::vector<const ompl::base::State*>& states,
+                                                     std::size_t count) const
+{
+  for (const auto& fn : batch_validators_)
+    count = fn(states, count);
+
+  return count;
+}
+
 void CompoundStateValidator::addStateValidator(ompl::base::StateValidityCheckerPtr validator)
 {
   auto fn = [validator](const ompl::base::State* state) { return validator->isValid(state); };
 
+  auto batch_fn = [validator](const std::vector<const ompl::base::State*>& states, std::size_t count) {
+    return findFirstInvalidState(*validator, states, count);
+  };
+
   cache_.push_back(std::move(validator));
   validators_.emplace_back(fn);
+  batch_validators_.emplace_back(batch_fn);
 }
 
 void CompoundStateValidator::addStateValidator(ompl::base::StateValidityCheckerFn validator)
 {
+  auto batch_fn = [validator](const std::vector<const ompl::base::State*>& states, std::size_t count) {
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      if (!validator(states[i]))
+        return i;
+    }
+    return count;
+  };
+
   validators_.push_back(std::move(validator));
+  batch_validators_.emplace_back(batch_fn);
 }
 
 }  // namespace tesseract_planning
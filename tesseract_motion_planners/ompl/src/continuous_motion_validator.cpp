@@ -25,8 +25,8 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <ompl/base/SpaceInformation.h>
-#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
@@ -39,12 +39,19 @@ ContinuousMotionValidator::ContinuousMotionValidator(
     const tesseract_environment::Environment& env,
     tesseract_kinematics::JointGroup::ConstPtr manip,
     const tesseract_collision::CollisionCheckConfig& collision_check_config,
-    OMPLStateExtractor extractor)
+    OMPLStateExtractor extractor,
+    OMPLMotionCheckOrder check_order)
   : MotionValidator(space_info)
   , state_validator_(std::move(state_validator))
   , manip_(std::move(manip))
   , continuous_contact_manager_(env.getContinuousContactManager())
   , extractor_(std::move(extractor))
+  , check_order_(check_order)
+  , thread_data_([this]() {
+    auto data = std::make_unique<ThreadData>(si_->getStateSpace());
+    data->contact_manager = continuous_contact_manager_->clone();
+    return data;
+  })
 {
   links_ = manip_->getActiveLinkNames();
 
@@ -52,100 +59,174 @@ ContinuousMotionValidator::ContinuousMotionValidator(
   continuous_contact_manager_->applyContactManagerConfig(collision_check_config.contact_manager_config);
 }
 
+ContinuousMotionValidator::ThreadData::ThreadData(ompl::base::StateSpacePtr state_space)
+  : state_space(std::move(state_space))
+  , start_interp(this->state_space->allocState())
+  , end_interp(this->state_space->allocState())
+{
+}
+
+ContinuousMotionValidator::ThreadData::~ThreadData()
+{
+  state_space->freeState(start_interp);
+  state_space->freeState(end_interp);
+}
+
 bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
-  std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
-  return checkMotion(s1, s2, dummy);
+  return checkMotion(s1, s2, nullptr);
 }
 
 bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1,
                                             const ompl::base::State* s2,
                                             std::pair<ompl::base::State*, double>& lastValid) const
+{
+  return checkMotion(s1, s2, &lastValid);
+}
+
+bool ContinuousMotionValidator::checkMotion(const ompl::base::State* s1,
+                                            const ompl::base::State* s2,
+                                            std::pair<ompl::base::State*, double>* last_valid) const
 {
   const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+  ThreadData& data = thread_data_.get();
 
   unsigned n_steps = state_space.validSegmentCount(s1, s2);
-  bool is_valid = true;
 
-  ompl::base::State* start_interp = si_->allocState();
-  if (n_steps > 1)
+  std::size_t first_invalid{ n_steps };
+  if (check_order_ == OMPLMotionCheckOrder::LINEAR)
+    first_invalid = checkSegmentsLinear(data, s1, s2, n_steps);
+  else
+    first_invalid = checkSegmentsBisection(data, s1, s2, n_steps, last_valid != nullptr);
+
+  if (first_invalid == n_steps)
+    return true;
+
+  if (last_valid != nullptr)
   {
-    ompl::base::State* end_interp = si_->allocState();
+    last_valid->second = static_cast<double>(first_invalid) / static_cast<double>(n_steps);
+    if (last_valid->first != nullptr)
+      state_space.interpolate(s1, s2, last_valid->second, last_valid->first);
+  }
+
+  return false;
+}
 
-    for (unsigned i = 1; i < n_steps; ++i)
+std::size_t ContinuousMotionValidator::checkSegmentsLinear(ThreadData& data,
+                                                           const ompl::base::State* s1,
+                                                           const ompl::base::State* s2,
+                                                           unsigned n_steps) const
+{
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+
+  // The end of each segment is the start of the next, so its link transforms are only calculated once
+  tesseract_common::TransformMap start_transforms = manip_->calcFwdKin(extractor_(s1));
+  for (unsigned i = 1; i <= n_steps; ++i)
+  {
+    const ompl::base::State* end_state = s2;
+    if (i < n_steps)
     {
-      state_space.interpolate(s1, s2, (i - 1) / static_cast<double>(n_steps), start_interp);
-      state_space.interpolate(s1, s2, (i) / static_cast<double>(n_steps), end_interp);
-      if (state_validator_ && !state_validator_->isValid(end_interp))
-      {
-        lastValid.second = static_cast<double>(i - 1) / static_cast<double>(n_steps);
-        if (lastValid.first != nullptr)
-          state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
-
-        is_valid = false;
-      }
-      else if (!continuousCollisionCheck(start_interp, end_interp))
-      {
-        lastValid.second = (i - 1) / static_cast<double>(n_steps);
-        if (lastValid.first != nullptr)
-          state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
-
-        is_valid = false;
-      }
+      state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), data.end_interp);
+      end_state = data.end_interp;
     }
 
-    si_->freeState(end_interp);
+    bool is_valid = (state_validator_ == nullptr || state_validator_->isValid(end_state));
+    tesseract_common::TransformMap end_transforms;
+    if (is_valid)
+    {
+      end_transforms = manip_->calcFwdKin(extractor_(end_state));
+      is_valid = continuousCollisionCheck(data, start_transforms, end_transforms);
+    }
+
+    if (!is_valid)
+      return i - 1;
+
+    start_transforms = std::move(end_transforms);
   }
 
-  if (is_valid)
+  return n_steps;
+}
+
+std::size_t ContinuousMotionValidator::checkSegmentsBisection(ThreadData& data,
+                                                              const ompl::base::State* s1,
+                                                              const ompl::base::State* s2,
+                                                              unsigned n_steps,
+                                                              bool find_first) const
+{
+  if (data.order.size() != n_steps)
+    getBisectionOrder(n_steps, data.order);
+
+  for (std::size_t pos = 0; pos < data.order.size(); ++pos)
   {
-    state_space.interpolate(s1, s2, (n_steps - 1) / static_cast<double>(n_steps), start_interp);
-    if ((state_validator_ != nullptr && !state_validator_->isValid(s2)) || !continuousCollisionCheck(start_interp, s2))
+    if (checkSegment(data, s1, s2, data.order[pos], n_steps))
+      continue;
+
+    std::size_t first_invalid = data.order[pos];
+    if (!find_first)
+      return first_invalid;
+
+    // The segments before the invalid segment which were not checked yet are checked in order
+    data.unchecked.clear();
+    for (std::size_t i = pos + 1; i < data.order.size(); ++i)
     {
-      lastValid.second = static_cast<double>(n_steps - 1) / static_cast<double>(n_steps);
-      if (lastValid.first != nullptr)
-        state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
+      if (data.order[i] < first_invalid)
+        data.unchecked.push_back(data.order[i]);
+    }
+    std::sort(data.unchecked.begin(), data.unchecked.end());
 
-      is_valid = false;
+    for (std::size_t segment : data.unchecked)
+    {
+      if (!checkSegment(data, s1, s2, segment, n_steps))
+        return segment;
     }
-  }
 
-  si_->freeState(start_interp);
+    return first_invalid;
+  }
 
-  return is_valid;
+  return n_steps;
 }
 
-bool ContinuousMotionValidator::continuousCollisionCheck(const ompl::base::State* s1, const ompl::base::State* s2) const
+bool ContinuousMotionValidator::checkSegment(ThreadData& data,
+                                             const ompl::base::State* s1,
+                                             const ompl::base::State* s2,
+                                             std::size_t segment,
+                                             unsigned n_steps) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::ContinuousContactManager::Ptr cm;
-  mutex_.lock();
-  auto it = continuous_contact_managers_.find(hash);
-  if (it == continuous_contact_managers_.end())
+  const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+
+  const ompl::base::State* start_state = s1;
+  if (segment > 0)
   {
-    cm = continuous_contact_manager_->clone();
-    continuous_contact_managers_[hash] = cm;
+    state_space.interpolate(s1, s2, static_cast<double>(segment) / static_cast<double>(n_steps), data.start_interp);
+    start_state = data.start_interp;
   }
-  else
+
+  const ompl::base::State* end_state = s2;
+  if (segment + 1 < n_steps)
   {
-    cm = it->second;
+    state_space.interpolate(s1, s2, static_cast<double>(segment + 1) / static_cast<double>(n_steps), data.end_interp);
+    end_state = data.end_interp;
   }
-  mutex_.unlock();
 
-  Eigen::Map<Eigen::VectorXd> start_joints = extractor_(s1);
-  Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(s2);
+  if (state_validator_ != nullptr && !state_validator_->isValid(end_state))
+    return false;
 
-  tesseract_common::TransformMap state0 = manip_->calcFwdKin(start_joints);
-  tesseract_common::TransformMap state1 = manip_->calcFwdKin(finish_joints);
+  return continuousCollisionCheck(
+      data, manip_->calcFwdKin(extractor_(start_state)), manip_->calcFwdKin(extractor_(end_state)));
+}
 
+bool ContinuousMotionValidator::continuousCollisionCheck(ThreadData& data,
+                                                         const tesseract_common::TransformMap& state0,
+                                                         const tesseract_common::TransformMap& state1) const
+{
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state0[link_name], state1[link_name]);
+    data.contact_manager->setCollisionObjectsTransform(link_name, state0.at(link_name), state1.at(link_name));
 
-  tesseract_collision::ContactResultMap contact_map;
-  cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
+  // Clearing keeps the memory allocated by previous checks
+  data.contact_map.clear();
+  data.contact_manager->contactTest(data.contact_map, tesseract_collision::ContactTestType::FIRST);
 
-  return contact_map.empty();
+  return data.contact_map.empty();
 }
 
 }  // namespace tesseract_planning
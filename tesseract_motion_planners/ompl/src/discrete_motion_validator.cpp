@@ -25,65 +25,120 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <ompl/base/SpaceInformation.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 
 namespace tesseract_planning
 {
-DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info)
+DiscreteMotionValidator::DiscreteMotionValidator(const ompl::base::SpaceInformationPtr& space_info,
+                                                 OMPLMotionCheckOrder check_order)
   : MotionValidator(space_info)
+  , check_order_(check_order)
+  , thread_data_([this]() { return std::make_unique<ThreadData>(si_->getStateSpace()); })
 {
 }
 
+DiscreteMotionValidator::ThreadData::ThreadData(ompl::base::StateSpacePtr state_space)
+  : state_space(std::move(state_space))
+{
+}
+
+DiscreteMotionValidator::ThreadData::~ThreadData()
+{
+  for (ompl::base::State* state : interp_states)
+    state_space->freeState(state);
+}
+
 bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1, const ompl::base::State* s2) const
 {
-  std::pair<ompl::base::State*, double> dummy = { nullptr, 0.0 };
-  return checkMotion(s1, s2, dummy);
+  return checkMotion(s1, s2, nullptr);
 }
 
 bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
                                           const ompl::base::State* s2,
                                           std::pair<ompl::base::State*, double>& lastValid) const
+{
+  return checkMotion(s1, s2, &lastValid);
+}
+
+bool DiscreteMotionValidator::checkMotion(const ompl::base::State* s1,
+                                          const ompl::base::State* s2,
+                                          std::pair<ompl::base::State*, double>* last_valid) const
 {
   const ompl::base::StateSpace& state_space = *si_->getStateSpace();
+  const ompl::base::StateValidityChecker& validator = *si_->getStateValidityChecker();
 
   unsigned n_steps = state_space.validSegmentCount(s1, s2);
-  bool is_valid = true;
 
-  if (n_steps > 1)
+  // Interpolate the whole motion up front so the states are checked as a single batch
+  ThreadData& data = thread_data_.get();
+  while (data.interp_states.size() + 1 < n_steps)
+    data.interp_states.push_back(state_space.allocState());
+
+  data.states.clear();
+  for (unsigned i = 1; i < n_steps; ++i)
   {
-    ompl::base::State* end_interp = si_->allocState();
-    for (unsigned i = 1; i < n_steps; ++i)
-    {
-      state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), end_interp);
+    ompl::base::State* interp = data.interp_states[i - 1];
+    state_space.interpolate(s1, s2, static_cast<double>(i) / static_cast<double>(n_steps), interp);
+    data.states.push_back(interp);
+  }
+  data.states.push_back(s2);
 
-      if (!si_->isValid(end_interp))
-      {
-        lastValid.second = static_cast<double>(i - 1) / static_cast<double>(n_steps);
-        if (lastValid.first != nullptr)
-          state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
+  std::size_t first_invalid = data.states.size();
+  if (check_order_ == OMPLMotionCheckOrder::LINEAR)
+  {
+    first_invalid = findFirstInvalidState(validator, data.states, data.states.size());
+  }
+  else
+  {
+    if (data.order.size() != data.states.size())
+      getBisectionOrder(data.states.size(), data.order);
+
+    data.batch.clear();
+    for (std::size_t idx : data.order)
+      data.batch.push_back(data.states[idx]);
 
-        is_valid = false;
-        break;
-      }
+    std::size_t pos = findFirstInvalidState(validator, data.batch, data.batch.size());
+    if (pos == data.batch.size())
+      return true;
+
+    if (last_valid == nullptr)
+      return false;
+
+    // The first invalid state found may not be the first invalid state of the motion, so the states before it which
+    // were not checked yet are checked in order
+    first_invalid = data.order[pos];
+    data.unchecked.clear();
+    for (std::size_t i = pos + 1; i < data.order.size(); ++i)
+    {
+      if (data.order[i] < first_invalid)
+        data.unchecked.push_back(data.order[i]);
     }
-    si_->freeState(end_interp);
+    std::sort(data.unchecked.begin(), data.unchecked.end());
+
+    data.batch.clear();
+    for (std::size_t idx : data.unchecked)
+      data.batch.push_back(data.states[idx]);
+
+    pos = findFirstInvalidState(validator, data.batch, data.batch.size());
+    if (pos < data.batch.size())
+      first_invalid = data.unchecked[pos];
   }
 
-  if (is_valid)
-  {
-    if (!si_->isValid(s2))
-    {
-      lastValid.second = static_cast<double>(n_steps - 1) / static_cast<double>(n_steps);
-      if (lastValid.first != nullptr)
-        state_space.interpolate(s1, s2, lastValid.second, lastValid.first);
+  if (first_invalid == data.states.size())
+    return true;
 
-      is_valid = false;
-    }
+  if (last_valid != nullptr)
+  {
+    last_valid->second = static_cast<double>(first_invalid) / static_cast<double>(n_steps);
+    if (last_valid->first != nullptr)
+      state_space.interpolate(s1, s2, last_valid->second, last_valid->first);
   }
 
-  return is_valid;
+  return false;
 }
 }  // namespace tesseract_planning
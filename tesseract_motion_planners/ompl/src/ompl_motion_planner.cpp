@@ -30,6 +30,10 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/goals/GoalState.h>
 #include <ompl/base/goals/GoalStates.h>
 #include <ompl/tools/multiplan/ParallelPlan.h>
+#include <algorithm>
+#include <atomic>
+#include <limits>
+#include <optional>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_environment/utils.h>
@@ -88,6 +92,127 @@ bool checkGoalState(const ompl::base::ProblemDefinitionPtr& prob_def,
   return false;
 }
 
+namespace
+{
+/**
+ * @brief Solve a single segment problem and post process the solution path
+ * @param p The problem to solve
+ * @param deadline If provided, the planning time is limited so the solve does not run past this point in time
+ * @return True if an exact solution was found, otherwise false
+ */
+bool solveProblem(OMPLProblem& p, const std::optional<ompl::time::point>& deadline)
+{
+  double planning_time = p.planning_time;
+  if (deadline.has_value())
+    planning_time = std::min(planning_time, std::max(ompl::time::seconds(deadline.value() - ompl::time::now()), 0.0));
+
+  p.simple_setup->setup();
+  auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(p.simple_setup->getProblemDefinition());
+
+  // Roadmap planners start from the roadmap in the cache, which is updated after the solve
+  std::vector<std::pair<std::string, ompl::base::PlannerPtr>> roadmap_planners;
+  const std::string problem_key = (p.roadmap_cache != nullptr) ? OMPLRoadmapCache::createKey(p) : "";
+  for (std::size_t i = 0; i < p.planners.size(); ++i)
+  {
+    ompl::base::PlannerPtr planner;
+    if (p.roadmap_cache != nullptr)
+    {
+      std::string key = OMPLRoadmapCache::createKey(problem_key, p, i);
+      planner = p.roadmap_cache->create(key, *p.planners[i], p.simple_setup->getSpaceInformation());
+      if (planner != nullptr)
+        roadmap_planners.emplace_back(std::move(key), planner);
+    }
+
+    if (planner == nullptr)
+      planner = p.planners[i]->create(p.simple_setup->getSpaceInformation());
+
+    parallel_plan->addPlanner(planner);
+  }
+
+  ompl::base::PlannerStatus status;
+  if (!p.optimize)
+  {
+    // Solve problem. Results are stored in the response
+    // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
+    // and finishes at the end state.
+    status = parallel_plan->solve(planning_time, 1, static_cast<unsigned>(p.max_solutions), false);
+  }
+  else
+  {
+    ompl::time::point end = ompl::time::now() + ompl::time::seconds(planning_time);
+    const ompl::base::ProblemDefinitionPtr& pdef = p.simple_setup->getProblemDefinition();
+    while (ompl::time::now() < end)
+    {
+      // Solve problem. Results are stored in the response
+      // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
+      // and finishes at the end state.
+      ompl::base::PlannerStatus localResult =
+          parallel_plan->solve(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0),
+                               1,
+                               static_cast<unsigned>(p.max_solutions),
+                               false);
+      if (localResult)
+      {
+        if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+          status = localResult;
+
+        if (!pdef->hasOptimizationObjective())
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
+          break;
+        }
+
+        ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
+        CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
+
+        if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
+          break;
+        }
+
+        if (pdef->getSolutionCount() >= static_cast<std::size_t>(p.max_solutions))
+        {
+          CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p.max_solutions);
+          break;
+        }
+      }
+    }
+  }
+
+  // The roadmap is kept even if no solution was found, the next solve continues growing it
+  for (const auto& roadmap_planner : roadmap_planners)
+    p.roadmap_cache->put(roadmap_planner.first, *roadmap_planner.second);
+
+  if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
+    return false;
+
+  if (p.simplify)
+  {
+    p.simple_setup->simplifySolution();
+  }
+  else
+  {
+    // Interpolate the path if it shouldn't be simplified and there are currently fewer states than requested
+    auto num_output_states = static_cast<unsigned>(p.n_output_states);
+    if (p.simple_setup->getSolutionPath().getStateCount() < num_output_states)
+    {
+      p.simple_setup->getSolutionPath().interpolate(num_output_states);
+    }
+    else
+    {
+      // Now try to simplify the trajectory to get it under the requested number of output states
+      // The interpolate function only executes if the current number of states is less than the requested
+      p.simple_setup->simplifySolution();
+      if (p.simple_setup->getSolutionPath().getStateCount() < num_output_states)
+        p.simple_setup->getSolutionPath().interpolate(num_output_states);
+    }
+  }
+
+  return true;
+}
+}  // namespace
+
 /** @brief Construct a basic planner */
 OMPLMotionPlanner::OMPLMotionPlanner(std::string name) : MotionPlanner(std::move(name)) {}
 
@@ -132,95 +257,45 @@ PlannerResponse OMPLMotionPlanner::solve(const PlannerRequest& request) const
   if (request.verbose)
     console_bridge::setLogLevel(console_bridge::LogLevel::CONSOLE_BRIDGE_LOG_DEBUG);
 
-  /// @todo: Need to expand this to support multiple motion plans leveraging taskflow
-  for (auto& pc : problems)
+  // The segments share the smallest planning time budget of their profiles
+  std::optional<ompl::time::point> deadline;
+  double total_planning_time{ std::numeric_limits<double>::max() };
+  for (const auto& pc : problems)
   {
-    auto& p = pc.problem;
-    p->simple_setup->setup();
-    auto parallel_plan = std::make_shared<ompl::tools::ParallelPlan>(p->simple_setup->getProblemDefinition());
+    if (pc.problem->total_planning_time > 0)
+      total_planning_time = std::min(total_planning_time, pc.problem->total_planning_time);
+  }
+  if (total_planning_time < std::numeric_limits<double>::max())
+    deadline = ompl::time::now() + ompl::time::seconds(total_planning_time);
 
-    for (const auto& planner : p->planners)
-      parallel_plan->addPlanner(planner->create(p->simple_setup->getSpaceInformation()));
+  // The segments are independent of each other, each has its own contact checkers and space information, so they may
+  // be solved concurrently. The results are still stitched together in order below.
+  std::atomic<bool> failed{ false };
+  auto solve_segment = [&problems, &deadline, &failed](std::size_t i) {
+    if (failed)
+      return;
 
-    ompl::base::PlannerStatus status;
-    if (!p->optimize)
+    try
     {
-      // Solve problem. Results are stored in the response
-      // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-      // and finishes at the end state.
-      status = parallel_plan->solve(p->planning_time, 1, static_cast<unsigned>(p->max_solutions), false);
+      if (!solveProblem(*problems[i].problem, deadline))
+        failed = true;
     }
-    else
+    catch (const std::exception& e)
     {
-      ompl::time::point end = ompl::time::now() + ompl::time::seconds(p->planning_time);
-      const ompl::base::ProblemDefinitionPtr& pdef = p->simple_setup->getProblemDefinition();
-      while (ompl::time::now() < end)
-      {
-        // Solve problem. Results are stored in the response
-        // Disabling hybridization because there is a bug which will return a trajectory that starts at the end state
-        // and finishes at the end state.
-        ompl::base::PlannerStatus localResult =
-            parallel_plan->solve(std::max(ompl::time::seconds(end - ompl::time::now()), 0.0),
-                                 1,
-                                 static_cast<unsigned>(p->max_solutions),
-                                 false);
-        if (localResult)
-        {
-          if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
-            status = localResult;
-
-          if (!pdef->hasOptimizationObjective())
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since there is no optimization objective specified");
-            break;
-          }
-
-          ompl::base::Cost obj_cost = pdef->getSolutionPath()->cost(pdef->getOptimizationObjective());
-          CONSOLE_BRIDGE_logDebug("Motion Objective Cost: %f", obj_cost.value());
-
-          if (pdef->getOptimizationObjective()->isSatisfied(obj_cost))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since solution path satisfies the optimization objective");
-            break;
-          }
-
-          if (pdef->getSolutionCount() >= static_cast<std::size_t>(p->max_solutions))
-          {
-            CONSOLE_BRIDGE_logDebug("Terminating early since %u solutions were generated", p->max_solutions);
-            break;
-          }
-        }
-      }
+      CONSOLE_BRIDGE_logError("OMPLPlanner failed to solve segment %zu: %s", i, e.what());
+      failed = true;
     }
+  };
 
-    if (status != ompl::base::PlannerStatus::EXACT_SOLUTION)
-    {
-      response.successful = false;
-      response.message = ERROR_FAILED_TO_FIND_VALID_SOLUTION;
-      return response;
-    }
+  const bool concurrent =
+      std::all_of(problems.begin(), problems.end(), [](const auto& pc) { return pc.problem->solve_concurrently; });
+  parallelFor(concurrent ? request.parallel_for : PlannerParallelFor{}, problems.size(), solve_segment);
 
-    if (p->simplify)
-    {
-      p->simple_setup->simplifySolution();
-    }
-    else
-    {
-      // Interpolate the path if it shouldn't be simplified and there are currently fewer states than requested
-      auto num_output_states = static_cast<unsigned>(p->n_output_states);
-      if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
-      {
-        p->simple_setup->getSolutionPath().interpolate(num_output_states);
-      }
-      else
-      {
-        // Now try to simplify the trajectory to get it under the requested number of output states
-        // The interpolate function only executes if the current number of states is less than the requested
-        p->simple_setup->simplifySolution();
-        if (p->simple_setup->getSolutionPath().getStateCount() < num_output_states)
-          p->simple_setup->getSolutionPath().interpolate(num_output_states);
-      }
-    }
+  if (failed)
+  {
+    response.successful = false;
+    response.message = ERROR_FAILED_TO_FIND_VALID_SOLUTION;
+    return response;
   }
 
   // Flatten the results to make them easier to process
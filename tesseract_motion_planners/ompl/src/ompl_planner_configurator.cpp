@@ -38,6 +38,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/geometric/planners/rrt/TRRT.h>
 #include <ompl/geometric/planners/prm/PRM.h>
 #include <ompl/geometric/planners/prm/PRMstar.h>
+#include <ompl/geometric/planners/prm/LazyPRM.h>
 #include <ompl/geometric/planners/prm/LazyPRMstar.h>
 #include <ompl/geometric/planners/prm/SPARS.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -47,6 +48,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+ompl::base::PlannerPtr OMPLPlannerConfigurator::createFromRoadmap(const ompl::base::PlannerData& /*roadmap*/) const
+{
+  return nullptr;
+}
+
 SBLConfigurator::SBLConfigurator(const tinyxml2::XMLElement& xml_element)
 {
   const tinyxml2::XMLElement* sbl_element = xml_element.FirstChildElement("SBL");
@@ -928,6 +934,13 @@ ompl::base::PlannerPtr PRMConfigurator::create(ompl::base::SpaceInformationPtr s
   return planner;
 }
 
+ompl::base::PlannerPtr PRMConfigurator::createFromRoadmap(const ompl::base::PlannerData& roadmap) const
+{
+  auto planner = std::make_shared<ompl::geometric::PRM>(roadmap);
+  planner->setMaxNearestNeighbors(static_cast<unsigned>(max_nearest_neighbors));
+  return planner;
+}
+
 OMPLPlannerType PRMConfigurator::getType() const { return OMPLPlannerType::PRM; }
 
 tinyxml2::XMLElement* PRMConfigurator::toXML(tinyxml2::XMLDocument& doc) const
@@ -948,6 +961,14 @@ ompl::base::PlannerPtr PRMstarConfigurator::create(ompl::base::SpaceInformationP
   return std::make_shared<ompl::geometric::PRMstar>(si);
 }
 
+ompl::base::PlannerPtr PRMstarConfigurator::createFromRoadmap(const ompl::base::PlannerData& roadmap) const
+{
+  // PRMstar is PRM using the star strategy, it does not provide a constructor from a roadmap
+  auto planner = std::make_shared<ompl::geometric::PRM>(roadmap, true);
+  planner->setName("PRMstar");
+  return planner;
+}
+
 OMPLPlannerType PRMstarConfigurator::getType() const { return OMPLPlannerType::PRMstar; }
 
 tinyxml2::XMLElement* PRMstarConfigurator::toXML(tinyxml2::XMLDocument& doc) const
@@ -964,6 +985,14 @@ ompl::base::PlannerPtr LazyPRMstarConfigurator::create(ompl::base::SpaceInformat
   return std::make_shared<ompl::geometric::LazyPRMstar>(si);
 }
 
+ompl::base::PlannerPtr LazyPRMstarConfigurator::createFromRoadmap(const ompl::base::PlannerData& roadmap) const
+{
+  // LazyPRMstar is LazyPRM using the star strategy, it does not provide a constructor from a roadmap
+  auto planner = std::make_shared<ompl::geometric::LazyPRM>(roadmap, true);
+  planner->setName("LazyPRMstar");
+  return planner;
+}
+
 OMPLPlannerType LazyPRMstarConfigurator::getType() const { return OMPLPlannerType::LazyPRMstar; }
 
 tinyxml2::XMLElement* LazyPRMstarConfigurator::toXML(tinyxml2::XMLDocument& doc) const
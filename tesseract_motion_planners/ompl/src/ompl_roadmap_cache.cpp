@@ -0,0 +1,293 @@
+/**
+ * @file ompl_roadmap_cache.cpp
+ * @brief A cache of OMPL roadmaps reused across solves
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <cstdint>
+#include <fstream>
+#include <iomanip>
+#include <limits>
+#include <map>
+#include <mutex>
+#include <sstream>
+#include <ompl/base/PlannerDataStorage.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_motion_planners/core/environment_hash.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_cache.h>
+#include <tesseract_motion_planners/ompl/ompl_problem.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief Sort the entries of an unordered map so equal maps are written in the same order */
+template <typename Map>
+std::map<typename Map::key_type, typename Map::mapped_type> sorted(const Map& map)
+{
+  return { map.begin(), map.end() };
+}
+}  // namespace
+
+OMPLRoadmapCache::OMPLRoadmapCache(std::string directory) : directory_(std::move(directory)) {}
+
+std::string OMPLRoadmapCache::createKey(const OMPLProblem& prob)
+{
+  const ompl::base::StateSpacePtr& state_space = prob.simple_setup->getStateSpace();
+  const std::vector<std::string> joint_names = prob.manip->getJointNames();
+
+  // The commands which built the environment identify the content of the scene, the hash is computed once per revision
+  std::stringstream key;
+  key << std::setprecision(std::numeric_limits<double>::max_digits10);
+  key << prob.env->getName() << ";" << std::hex << getEnvironmentHash(prob.env) << std::dec;
+
+  // The joints which are not part of the manipulator place the rest of the scene
+  auto scene_joints = sorted(prob.env_state.joints);
+  for (const auto& joint_name : joint_names)
+    scene_joints.erase(joint_name);
+
+  for (const auto& joint : scene_joints)
+    key << ";" << joint.first << "=" << joint.second;
+
+  const tesseract_collision::CollisionCheckConfig& config = prob.collision_check_config;
+  key << ";" << static_cast<int>(config.type) << ";" << config.longest_valid_segment_length << ";"
+      << static_cast<int>(config.contact_request.type);
+
+  // The contact checker already has the margins of the configuration applied to the margins of the environment
+  const tesseract_common::CollisionMarginData& margin_data = prob.contact_checker->getCollisionMarginData();
+  key << ";" << margin_data.getDefaultCollisionMargin();
+  for (const auto& pair : sorted(margin_data.getPairCollisionMargins()))
+    key << ";" << pair.first.first << "," << pair.first.second << "=" << pair.second;
+
+  key << ";" << static_cast<int>(config.contact_manager_config.acm_override_type);
+  for (const auto& pair : sorted(config.contact_manager_config.acm.getAllAllowedCollisions()))
+    key << ";" << pair.first.first << "," << pair.first.second;
+
+  for (const auto& link : sorted(config.contact_manager_config.modify_object_enabled))
+    key << ";" << link.first << "=" << link.second;
+
+  key << ";" << prob.manip->getName();
+  for (const auto& joint_name : joint_names)
+    key << ";" << joint_name;
+
+  key << ";" << state_space->getType() << ";" << state_space->getDimension();
+  return key.str();
+}
+
+std::string OMPLRoadmapCache::createKey(const std::string& problem_key,
+                                        const OMPLProblem& prob,
+                                        std::size_t planner_index)
+{
+  std::stringstream key;
+  key << problem_key << ";" << planner_index << ";" << static_cast<int>(prob.planners.at(planner_index)->getType());
+  return key.str();
+}
+
+ompl::base::PlannerPtr OMPLRoadmapCache::create(const std::string& key,
+                                                const OMPLPlannerConfigurator& configurator,
+                                                const ompl::base::SpaceInformationPtr& si)
+{
+  std::shared_ptr<const ompl::base::PlannerData> roadmap;
+  {
+    std::shared_lock lock(mutex_);
+    auto it = roadmaps_.find(key);
+    if (it != roadmaps_.end())
+      roadmap = it->second;
+  }
+
+  if (roadmap == nullptr && !directory_.empty())
+  {
+    roadmap = load(key, si);
+    if (roadmap != nullptr)
+    {
+      std::unique_lock lock(mutex_);
+      auto it = roadmaps_.find(key);
+      if (it == roadmaps_.end() || it->second->numVertices() < roadmap->numVertices())
+        roadmaps_[key] = roadmap;
+    }
+  }
+
+  // The planner must be created on the space information of the problem, so the roadmap is copied into planner data
+  // for it. The states are not copied here because the planner clones them while it is built.
+  ompl::base::PlannerData data(si);
+  if (roadmap != nullptr)
+  {
+    std::vector<unsigned> edges;
+    for (unsigned i = 0; i < roadmap->numVertices(); ++i)
+      data.addVertex(ompl::base::PlannerDataVertex(roadmap->getVertex(i).getState()));
+
+    for (unsigned i = 0; i < roadmap->numVertices(); ++i)
+    {
+      roadmap->getEdges(i, edges);
+      for (unsigned j : edges)
+      {
+        ompl::base::Cost weight;
+        roadmap->getEdgeWeight(i, j, &weight);
+        data.addEdge(i, j, ompl::base::PlannerDataEdge(), weight);
+      }
+    }
+  }
+
+  return configurator.createFromRoadmap(data);
+}
+
+void OMPLRoadmapCache::put(const std::string& key, const ompl::base::Planner& planner)
+{
+  // Store the roadmap on its own space information, so it does not keep the validity checkers of the problem alive
+  auto si = std::make_shared<ompl::base::SpaceInformation>(planner.getSpaceInformation()->getStateSpace());
+  auto roadmap = std::make_shared<ompl::base::PlannerData>(si);
+  planner.getPlannerData(*roadmap);
+  roadmap->decoupleFromPlanner();
+
+  std::unique_lock lock(mutex_);
+  auto it = roadmaps_.find(key);
+  if (it == roadmaps_.end() || it->second->numVertices() <= roadmap->numVertices())
+    roadmaps_[key] = roadmap;
+}
+
+bool OMPLRoadmapCache::save() const
+{
+  if (directory_.empty())
+  {
+    CONSOLE_BRIDGE_logError("OMPLRoadmapCache: No directory provided to save roadmaps");
+    return false;
+  }
+
+  std::unordered_map<std::string, std::shared_ptr<const ompl::base::PlannerData>> roadmaps;
+  {
+    std::shared_lock lock(mutex_);
+    roadmaps = roadmaps_;
+  }
+
+  tesseract_common::fs::create_directories(directory_);
+
+  bool success{ true };
+  ompl::base::PlannerDataStorage storage;
+  for (const auto& roadmap : roadmaps)
+  {
+    const std::string file_path = getFilePath(roadmap.first);
+    std::ofstream out(file_path, std::ios::binary);
+    if (out.is_open())
+    {
+      out << roadmap.first.size() << "\n";
+      out.write(roadmap.first.data(), static_cast<std::streamsize>(roadmap.first.size()));
+      storage.store(*roadmap.second, out);
+    }
+
+    if (!out.good())
+    {
+      CONSOLE_BRIDGE_logError("OMPLRoadmapCache: Failed to save roadmap to '%s'", file_path.c_str());
+      success = false;
+    }
+  }
+
+  return success;
+}
+
+const std::string& OMPLRoadmapCache::getDirectory() const { return directory_; }
+
+std::string OMPLRoadmapCache::getFilePath(const std::string& key) const
+{
+  // Keys contain link and joint names, so they are hashed to get a valid file name
+  FNV1aHashBuf key_hash;
+  key_hash.sputn(key.data(), static_cast<std::streamsize>(key.size()));
+
+  std::stringstream file_name;
+  file_name << std::hex << std::setw(16) << std::setfill('0') << key_hash.getHash() << ".roadmap";
+  return (tesseract_common::fs::path(directory_) / file_name.str()).string();
+}
+
+std::size_t OMPLRoadmapCache::size() const
+{
+  std::shared_lock lock(mutex_);
+  return roadmaps_.size();
+}
+
+std::size_t OMPLRoadmapCache::getNumVertices() const
+{
+  std::shared_lock lock(mutex_);
+  std::size_t num_vertices{ 0 };
+  for (const auto& roadmap : roadmaps_)
+    num_vertices += roadmap.second->numVertices();
+
+  return num_vertices;
+}
+
+void OMPLRoadmapCache::clear()
+{
+  std::unique_lock lock(mutex_);
+  roadmaps_.clear();
+}
+
+std::shared_ptr<const ompl::base::PlannerData> OMPLRoadmapCache::load(const std::string& key,
+                                                                      const ompl::base::SpaceInformationPtr& si) const
+{
+  const std::string file_path = getFilePath(key);
+  if (!tesseract_common::fs::exists(file_path))
+    return nullptr;
+
+  std::ifstream in(file_path, std::ios::binary);
+  if (!in.is_open())
+  {
+    CONSOLE_BRIDGE_logError("OMPLRoadmapCache: Failed to open roadmap '%s'", file_path.c_str());
+    return nullptr;
+  }
+
+  // The file starts with the key of the roadmap, which must match since different keys may have the same hash
+  std::size_t key_size{ 0 };
+  std::string file_key;
+  if (in >> key_size && in.get() == '\n' && key_size == key.size())
+  {
+    file_key.resize(key_size);
+    in.read(file_key.data(), static_cast<std::streamsize>(key_size));
+  }
+
+  if (!in.good() || file_key != key)
+  {
+    CONSOLE_BRIDGE_logWarn("OMPLRoadmapCache: Ignoring roadmap '%s' saved for another key", file_path.c_str());
+    return nullptr;
+  }
+
+  // The storage checks the state space signature and leaves the roadmap empty if it does not match
+  auto roadmap =
+      std::make_shared<ompl::base::PlannerData>(std::make_shared<ompl::base::SpaceInformation>(si->getStateSpace()));
+  ompl::base::PlannerDataStorage storage;
+  storage.load(in, *roadmap);
+  if (roadmap->numVertices() == 0)
+  {
+    CONSOLE_BRIDGE_logWarn("OMPLRoadmapCache: Ignoring empty or incompatible roadmap '%s'", file_path.c_str());
+    return nullptr;
+  }
+
+  CONSOLE_BRIDGE_logDebug("OMPLRoadmapCache: Loaded roadmap with %u vertices from '%s'",
+                          roadmap->numVertices(),
+                          file_path.c_str());
+  return roadmap;
+}
+
+}  // namespace tesseract_planning
@@ -52,6 +52,9 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
   const tinyxml2::XMLElement* state_space_element = xml_element.FirstChildElement("StateSpace");
   const tinyxml2::XMLElement* planning_time_element = xml_element.FirstChildElement("PlanningTime");
   const tinyxml2::XMLElement* max_solutions_element = xml_element.FirstChildElement("MaxSolutions");
+  const tinyxml2::XMLElement* solve_concurrently_element = xml_element.FirstChildElement("SolveConcurrently");
+  const tinyxml2::XMLElement* total_planning_time_element = xml_element.FirstChildElement("TotalPlanningTime");
+  const tinyxml2::XMLElement* motion_check_order_element = xml_element.FirstChildElement("MotionCheckOrder");
   const tinyxml2::XMLElement* simplify_element = xml_element.FirstChildElement("Simplify");
   const tinyxml2::XMLElement* optimize_element = xml_element.FirstChildElement("Optimize");
   const tinyxml2::XMLElement* planners_element = xml_element.FirstChildElement("Planners");
@@ -104,6 +107,40 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
     tesseract_common::toNumeric<int>(max_solutions_string, max_solutions);
   }
 
+  if (solve_concurrently_element != nullptr)
+  {
+    status = solve_concurrently_element->QueryBoolText(&solve_concurrently);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing SolveConcurrently string");
+  }
+
+  if (total_planning_time_element != nullptr)
+  {
+    std::string total_planning_time_string;
+    status = tesseract_common::QueryStringText(total_planning_time_element, total_planning_time_string);
+    if (status != tinyxml2::XML_NO_ATTRIBUTE && status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing TotalPlanningTime string");
+
+    if (!tesseract_common::isNumeric(total_planning_time_string))
+      throw std::runtime_error("OMPLPlanProfile: TotalPlanningTime is not a numeric values.");
+
+    tesseract_common::toNumeric<double>(total_planning_time_string, total_planning_time);
+  }
+
+  if (motion_check_order_element != nullptr)
+  {
+    auto type = static_cast<int>(OMPLMotionCheckOrder::LINEAR);
+    status = motion_check_order_element->QueryIntAttribute("type", &type);
+    if (status != tinyxml2::XML_SUCCESS)
+      throw std::runtime_error("OMPLPlanProfile: Error parsing MotionCheckOrder type attribute.");
+
+    if (type != static_cast<int>(OMPLMotionCheckOrder::LINEAR) &&
+        type != static_cast<int>(OMPLMotionCheckOrder::BISECTION))
+      throw std::runtime_error("OMPLPlanProfile: MotionCheckOrder type is not supported.");
+
+    motion_check_order = static_cast<OMPLMotionCheckOrder>(type);
+  }
+
   if (simplify_element != nullptr)
   {
     status = simplify_element->QueryBoolText(&simplify);
@@ -285,8 +322,12 @@ OMPLDefaultPlanProfile::OMPLDefaultPlanProfile(const tinyxml2::XMLElement& xml_e
 void OMPLDefaultPlanProfile::setup(OMPLProblem& prob) const
 {
   prob.planners = planners;
+  prob.roadmap_cache = roadmap_cache;
+  prob.collision_check_config = collision_check_config;
   prob.planning_time = planning_time;
   prob.max_solutions = max_solutions;
+  prob.solve_concurrently = solve_concurrently;
+  prob.total_planning_time = total_planning_time;
   prob.simplify = simplify;
   prob.optimize = optimize;
 
@@ -656,6 +697,18 @@ tinyxml2::XMLElement* OMPLDefaultPlanProfile::toXML(tinyxml2::XMLDocument& doc)
   xml_max_solutions->SetText(max_solutions);
   xml_ompl->InsertEndChild(xml_max_solutions);
 
+  tinyxml2::XMLElement* xml_solve_concurrently = doc.NewElement("SolveConcurrently");
+  xml_solve_concurrently->SetText(solve_concurrently);
+  xml_ompl->InsertEndChild(xml_solve_concurrently);
+
+  tinyxml2::XMLElement* xml_total_planning_time = doc.NewElement("TotalPlanningTime");
+  xml_total_planning_time->SetText(total_planning_time);
+  xml_ompl->InsertEndChild(xml_total_planning_time);
+
+  tinyxml2::XMLElement* xml_motion_check_order = doc.NewElement("MotionCheckOrder");
+  xml_motion_check_order->SetAttribute("type", std::to_string(static_cast<int>(motion_check_order)).c_str());
+  xml_ompl->InsertEndChild(xml_motion_check_order);
+
   tinyxml2::XMLElement* xml_simplify = doc.NewElement("Simplify");
   xml_simplify->SetText(simplify);
   xml_ompl->InsertEndChild(xml_simplify);
@@ -737,12 +790,13 @@ void OMPLDefaultPlanProfile::processMotionValidator(
                                                          *prob.env,
                                                          prob.manip,
                                                          collision_check_config,
-                                                         prob.extractor);
+                                                         prob.extractor,
+                                                         motion_check_order);
       }
       else
       {
         // Collision checking is preformed using the state validator which this calls.
-        mv = std::make_shared<DiscreteMotionValidator>(prob.simple_setup->getSpaceInformation());
+        mv = std::make_shared<DiscreteMotionValidator>(prob.simple_setup->getSpaceInformation(), motion_check_order);
       }
       prob.simple_setup->getSpaceInformation()->setMotionValidator(mv);
     }
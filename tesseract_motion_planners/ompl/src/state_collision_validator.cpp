@@ -26,7 +26,6 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <ompl/base/SpaceInformation.h>
-#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
@@ -44,6 +43,11 @@ StateCollisionValidator::StateCollisionValidator(
   , manip_(std::move(manip))
   , contact_manager_(env.getDiscreteContactManager())
   , extractor_(std::move(extractor))
+  , thread_data_([this]() {
+    auto data = std::make_unique<ThreadData>();
+    data->contact_manager = contact_manager_->clone();
+    return data;
+  })
 {
   links_ = manip_->getActiveLinkNames();
 
@@ -53,32 +57,35 @@ StateCollisionValidator::StateCollisionValidator(
 
 bool StateCollisionValidator::isValid(const ompl::base::State* state) const
 {
-  // It was time using chronos time elapsed and it was faster to cache the contact manager
-  unsigned long int hash = std::hash<std::thread::id>{}(std::this_thread::get_id());
-  tesseract_collision::DiscreteContactManager::Ptr cm;
-  mutex_.lock();
-  auto it = contact_managers_.find(hash);
-  if (it == contact_managers_.end())
-  {
-    cm = contact_manager_->clone();
-    contact_managers_[hash] = cm;
-  }
-  else
+  return checkState(thread_data_.get(), state);
+}
+
+std::size_t StateCollisionValidator::findFirstInvalid(const std::vector<const ompl::base::State*>& states,
+                                                      std::size_t count) const
+{
+  ThreadData& data = thread_data_.get();
+  for (std::size_t i = 0; i < count; ++i)
   {
-    cm = it->second;
+    if (!checkState(data, states[i]))
+      return i;
   }
-  mutex_.unlock();
 
+  return count;
+}
+
+bool StateCollisionValidator::checkState(ThreadData& data, const ompl::base::State* state) const
+{
   Eigen::Map<Eigen::VectorXd> finish_joints = extractor_(state);
   tesseract_common::TransformMap state1 = manip_->calcFwdKin(finish_joints);
 
   for (const auto& link_name : links_)
-    cm->setCollisionObjectsTransform(link_name, state1[link_name]);
+    data.contact_manager->setCollisionObjectsTransform(link_name, state1[link_name]);
 
-  tesseract_collision::ContactResultMap contact_map;
-  cm->contactTest(contact_map, tesseract_collision::ContactTestType::FIRST);
+  // Clearing keeps the memory allocated by previous checks
+  data.contact_map.clear();
+  data.contact_manager->contactTest(data.contact_map, tesseract_collision::ContactTestType::FIRST);
 
-  return contact_map.empty();
+  return data.contact_map.empty();
 }
 
 }  // namespace tesseract_planning
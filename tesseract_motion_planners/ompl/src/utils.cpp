@@ -37,6 +37,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/ompl/utils.h>
 #include <tesseract_motion_planners/ompl/weighted_real_vector_state_sampler.h>
+#include <tesseract_motion_planners/ompl/state_collision_validator.h>
+#include <tesseract_motion_planners/ompl/compound_state_validator.h>
 
 namespace tesseract_planning
 {
@@ -114,6 +116,53 @@ bool checkStateInCollision(OMPLProblem& prob,
   return (!contact_map.empty());
 }
 
+std::size_t findFirstInvalidState(const ompl::base::StateValidityChecker& validator,
+                                  const std::vector<const ompl::base::State*>& states,
+                                  std::size_t count)
+{
+  assert(count <= states.size());
+  if (const auto* collision_validator = dynamic_cast<const StateCollisionValidator*>(&validator))
+    return collision_validator->findFirstInvalid(states, count);
+
+  if (const auto* compound_validator = dynamic_cast<const CompoundStateValidator*>(&validator))
+    return compound_validator->findFirstInvalid(states, count);
+
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    if (!validator.isValid(states[i]))
+      return i;
+  }
+
+  return count;
+}
+
+void getBisectionOrder(std::size_t count, std::vector<std::size_t>& order)
+{
+  order.clear();
+  if (count == 0)
+    return;
+
+  order.reserve(count);
+  order.push_back(count - 1);
+
+  // Breadth first over the half open intervals of the remaining indices, the order doubles as the queue of midpoints
+  std::vector<std::pair<std::size_t, std::size_t>> intervals;
+  intervals.reserve(2 * count);
+  intervals.emplace_back(0, count - 1);
+  for (std::size_t i = 0; i < intervals.size(); ++i)
+  {
+    const auto [lo, hi] = intervals[i];
+    if (lo >= hi)
+      continue;
+
+    const std::size_t mid = lo + ((hi - lo) / 2);
+    order.push_back(mid);
+    intervals.emplace_back(lo, mid);
+    intervals.emplace_back(mid + 1, hi);
+  }
+  assert(order.size() == count);
+}
+
 ompl::base::StateSamplerPtr allocWeightedRealVectorStateSampler(const ompl::base::StateSpace* space,
                                                                 const Eigen::VectorXd& weights,
                                                                 const Eigen::MatrixX2d& limits)
@@ -0,0 +1,284 @@
+/**
+ * @file ompl_motion_validator_benchmark.cpp
+ * @brief Benchmark the motion validator check orders on the freespace OMPL example
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <ompl/base/SpaceInformation.h>
+#include <ompl/base/spaces/RealVectorStateSpace.h>
+#include <ompl/util/RandomNumbers.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands.h>
+#include <tesseract_geometry/impl/sphere.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
+#include <tesseract_motion_planners/ompl/state_collision_validator.h>
+#include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
+#include <tesseract_motion_planners/simple/interpolation.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+using namespace tesseract_scene_graph;
+
+static const std::string OMPL_DEFAULT_NAMESPACE = "OMPLMotionPlannerTask";
+
+/** @brief The number of random motions checked per iteration */
+static const int NUM_MOTIONS = 1000;
+
+/** @brief Create the environment of the freespace OMPL example, which places a sphere in front of the robot */
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+
+  Link link_sphere("sphere_attached");
+
+  Visual::Ptr visual = std::make_shared<Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.visual.push_back(visual);
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  env->applyCommand(std::make_shared<AddLinkCommand>(link_sphere, joint_sphere));
+  return env;
+}
+
+/** @brief The start and end state of the freespace OMPL example */
+static Eigen::VectorXd getExampleState(double joint_a1)
+{
+  Eigen::VectorXd state(7);
+  state << joint_a1, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  return state;
+}
+
+/** @brief Counts the states checked, forwarding to a state validity checker if provided */
+class CountingStateValidator : public ompl::base::StateValidityChecker
+{
+public:
+  CountingStateValidator(const ompl::base::SpaceInformationPtr& space_info,
+                         ompl::base::StateValidityCheckerPtr validator)
+    : StateValidityChecker(space_info), validator_(std::move(validator))
+  {
+  }
+
+  bool isValid(const ompl::base::State* state) const override
+  {
+    ++count;
+    return (validator_ == nullptr || validator_->isValid(state));
+  }
+
+  mutable std::atomic<std::size_t> count{ 0 };
+
+private:
+  ompl::base::StateValidityCheckerPtr validator_;
+};
+
+/**
+ * @brief Check random motions around the sphere
+ * @details Motions start near the start state of the example and end at a random state, so many of them pass through
+ * the sphere. For the discrete validator the checks are the states checked, for the continuous validator they are the
+ * segments checked.
+ */
+static void BM_CheckMotion(benchmark::State& state, OMPLMotionCheckOrder check_order, bool continuous)
+{
+  Environment::Ptr env = getEnvironment();
+  auto joint_group = env->getJointGroup("manipulator");
+  auto dof = static_cast<unsigned>(joint_group->numJoints());
+  auto limits = joint_group->getLimits().joint_limits;
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  auto rss = std::make_shared<ompl::base::RealVectorStateSpace>();
+  for (unsigned i = 0; i < dof; ++i)
+    rss->addDimension(joint_names[i], limits(i, 0), limits(i, 1));
+
+  tesseract_collision::CollisionCheckConfig config;
+  config.longest_valid_segment_length = 0.05;
+  processLongestValidSegment(rss, config);
+
+  auto si = std::make_shared<ompl::base::SpaceInformation>(rss);
+  OMPLStateExtractor extractor = [dof](const ompl::base::State* s) -> Eigen::Map<Eigen::VectorXd> {
+    return tesseract_planning::RealVectorStateSpaceExtractor(s, dof);
+  };
+
+  std::shared_ptr<CountingStateValidator> counter;
+  ompl::base::MotionValidatorPtr mv;
+  if (continuous)
+  {
+    counter = std::make_shared<CountingStateValidator>(si, nullptr);
+    si->setStateValidityChecker(std::make_shared<StateCollisionValidator>(si, *env, joint_group, config, extractor));
+    mv = std::make_shared<ContinuousMotionValidator>(si, counter, *env, joint_group, config, extractor, check_order);
+  }
+  else
+  {
+    auto svc = std::make_shared<StateCollisionValidator>(si, *env, joint_group, config, extractor);
+    counter = std::make_shared<CountingStateValidator>(si, svc);
+    si->setStateValidityChecker(counter);
+    mv = std::make_shared<DiscreteMotionValidator>(si, check_order);
+  }
+  si->setMotionValidator(mv);
+  si->setup();
+
+  // Sample the motions once so every check order checks the same motions
+  ompl::RNG rng(1);
+  const Eigen::VectorXd start = getExampleState(-0.4);
+  std::vector<ompl::base::State*> starts;
+  std::vector<ompl::base::State*> ends;
+  for (int i = 0; i < NUM_MOTIONS; ++i)
+  {
+    ompl::base::State* s1 = si->allocState();
+    ompl::base::State* s2 = si->allocState();
+    for (unsigned j = 0; j < dof; ++j)
+    {
+      extractor(s1)(j) = start(j) + rng.uniformReal(-0.05, 0.05);
+      extractor(s2)(j) = rng.uniformReal(limits(j, 0), limits(j, 1));
+    }
+    starts.push_back(s1);
+    ends.push_back(s2);
+  }
+
+  std::size_t valid{ 0 };
+  counter->count = 0;
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < starts.size(); ++i)
+    {
+      if (mv->checkMotion(starts[i], ends[i]))
+        ++valid;
+    }
+  }
+
+  state.counters["checks"] = benchmark::Counter(static_cast<double>(counter->count), benchmark::Counter::kIsRate);
+  state.counters["motions"] = benchmark::Counter(static_cast<double>(state.iterations()) * NUM_MOTIONS,
+                                                 benchmark::Counter::kIsRate);
+  state.counters["valid"] = static_cast<double>(valid) / static_cast<double>(state.iterations() * NUM_MOTIONS);
+
+  for (std::size_t i = 0; i < starts.size(); ++i)
+  {
+    si->freeState(starts[i]);
+    si->freeState(ends[i]);
+  }
+}
+
+/** @brief Plan the freespace OMPL example with RRTConnect */
+static void BM_PlanFreespace(benchmark::State& state, OMPLMotionCheckOrder check_order, bool continuous)
+{
+  Environment::Ptr env = getEnvironment();
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  std::vector<std::string> joint_names = env->getJointGroup(manip.manipulator)->getJointNames();
+  env->setState(joint_names, getExampleState(-0.4));
+  tesseract_scene_graph::SceneState cur_state = env->getState();
+
+  JointWaypointPoly wp0{ JointWaypoint(joint_names, getExampleState(-0.4)) };
+  JointWaypointPoly wp1{ JointWaypoint(joint_names, getExampleState(0.4)) };
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.type = (continuous) ? tesseract_collision::CollisionEvaluatorType::CONTINUOUS :
+                                                             tesseract_collision::CollisionEvaluatorType::DISCRETE;
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.05;
+  plan_profile->motion_check_order = check_order;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 1;
+  plan_profile->simplify = false;
+  plan_profile->planners = { std::make_shared<const RRTConnectConfigurator>() };
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  OMPLMotionPlanner planner(OMPL_DEFAULT_NAMESPACE);
+  std::size_t failed{ 0 };
+  for (auto _ : state)
+  {
+    PlannerResponse response = planner.solve(request);
+    if (!response.successful)
+      ++failed;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["failed"] = static_cast<double>(failed);
+}
+
+BENCHMARK_CAPTURE(BM_CheckMotion, Discrete_Linear, OMPLMotionCheckOrder::LINEAR, false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CheckMotion, Discrete_Bisection, OMPLMotionCheckOrder::BISECTION, false)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CheckMotion, Continuous_Linear, OMPLMotionCheckOrder::LINEAR, true)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_CheckMotion, Continuous_Bisection, OMPLMotionCheckOrder::BISECTION, true)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_PlanFreespace, Discrete_Linear, OMPLMotionCheckOrder::LINEAR, false)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PlanFreespace, Discrete_Bisection, OMPLMotionCheckOrder::BISECTION, false)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PlanFreespace, Continuous_Linear, OMPLMotionCheckOrder::LINEAR, true)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_PlanFreespace, Continuous_Bisection, OMPLMotionCheckOrder::BISECTION, true)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
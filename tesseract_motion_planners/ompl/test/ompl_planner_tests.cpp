@@ -26,6 +26,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <fstream>
 #include <ompl/geometric/planners/sbl/SBL.h>
 #include <ompl/geometric/planners/est/EST.h>
 #include <ompl/geometric/planners/kpiece/LBKPIECE1.h>
@@ -42,8 +43,13 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 
 #include <ompl/util/RandomNumbers.h>
 
+#include <ompl/base/spaces/RealVectorStateSpace.h>
+
+#include <algorithm>
+#include <atomic>
 #include <functional>
 #include <cmath>
+#include <thread>
 #include <gtest/gtest.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -53,9 +59,15 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_environment/utils.h>
 #include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
 #include <tesseract_motion_planners/ompl/ompl_planner_configurator.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_cache.h>
 #include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
 #include <tesseract_motion_planners/ompl/serialize.h>
 #include <tesseract_motion_planners/ompl/deserialize.h>
+#include <tesseract_motion_planners/ompl/state_collision_validator.h>
+#include <tesseract_motion_planners/ompl/compound_state_validator.h>
+#include <tesseract_motion_planners/ompl/discrete_motion_validator.h>
+#include <tesseract_motion_planners/ompl/continuous_motion_validator.h>
+#include <tesseract_motion_planners/ompl/utils.h>
 
 #include <tesseract_motion_planners/core/types.h>
 #include <tesseract_motion_planners/core/utils.h>
@@ -81,13 +93,14 @@ const static std::vector<double> start_state = { -0.5, 0.5, 0.0, -1.3348, 0.0, 1
 const static std::vector<double> end_state = { 0.5, 0.5, 0.0, -1.3348, 0.0, 1.4959, 0.0 };
 static const std::string OMPL_DEFAULT_NAMESPACE = "OMPLMotionPlannerTask";
 
-static void addBox(tesseract_environment::Environment& env)
+static void addBox(tesseract_environment::Environment& env,
+                   const Eigen::Vector3d& position = Eigen::Vector3d(0.5, 0, 0.55))
 {
   Link link_1("box_attached");
 
   Visual::Ptr visual = std::make_shared<Visual>();
   visual->origin = Eigen::Isometry3d::Identity();
-  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->origin.translation() = position;
   visual->geometry = std::make_shared<tesseract_geometry::Box>(0.4, 0.001, 0.4);
   link_1.visual.push_back(visual);
 
@@ -109,6 +122,9 @@ TEST(TesseractPlanningOMPLSerializeUnit, SerializeOMPLDefaultPlanToXml)  // NOLI
   // Write program to file
   OMPLDefaultPlanProfile plan_profile;
   plan_profile.simplify = true;
+  plan_profile.solve_concurrently = true;
+  plan_profile.total_planning_time = 12.5;
+  plan_profile.motion_check_order = OMPLMotionCheckOrder::BISECTION;
   plan_profile.planners.push_back(std::make_shared<const SBLConfigurator>());
   plan_profile.planners.push_back(std::make_shared<const ESTConfigurator>());
   plan_profile.planners.push_back(std::make_shared<const LBKPIECE1Configurator>());
@@ -135,6 +151,9 @@ TEST(TesseractPlanningOMPLSerializeUnit, SerializeOMPLDefaultPlanToXml)  // NOLI
   EXPECT_TRUE(
       toXMLFile(imported_plan_profile, tesseract_common::getTempPath() + "ompl_default_plan_example_input2.xml"));
   EXPECT_TRUE(plan_profile.simplify == imported_plan_profile.simplify);
+  EXPECT_EQ(plan_profile.solve_concurrently, imported_plan_profile.solve_concurrently);
+  EXPECT_DOUBLE_EQ(plan_profile.total_planning_time, imported_plan_profile.total_planning_time);
+  EXPECT_EQ(plan_profile.motion_check_order, imported_plan_profile.motion_check_order);
 }
 
 template <typename Configurator>
@@ -326,6 +345,423 @@ TYPED_TEST(OMPLTestFixture, OMPLFreespacePlannerUnit)  // NOLINT
   EXPECT_FALSE(planner_response);
 }
 
+TEST(TesseractPlanningOMPLUnit, OMPLFreespaceConcurrentSegmentsPlannerUnit)  // NOLINT
+{
+  // Step 1: Load scene and srdf
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  // Step 2: Add box to environment
+  addBox(*env);
+
+  // Step 3: Create a program with multiple independent segments
+  auto joint_group = env->getJointGroup(manip.manipulator);
+  auto cur_state = env->getState();
+
+  JointWaypointPoly wp1{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()))) };
+
+  JointWaypointPoly wp2{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()))) };
+
+  MoveInstruction start_instruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction plan_f1(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction plan_f2(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction plan_f3(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+  MoveInstruction plan_f4(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE");
+
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(start_instruction);
+  program.appendMoveInstruction(plan_f1);
+  program.appendMoveInstruction(plan_f2);
+  program.appendMoveInstruction(plan_f3);
+  program.appendMoveInstruction(plan_f4);
+
+  CompositeInstruction interpolated_program = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+
+  // Create Profiles
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.1;
+  plan_profile->collision_check_config.type = tesseract_collision::CollisionEvaluatorType::CONTINUOUS;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 2;
+  plan_profile->simplify = false;
+  plan_profile->planners = { std::make_shared<const RRTConnectConfigurator>() };
+  plan_profile->solve_concurrently = true;
+  plan_profile->total_planning_time = 20;
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = interpolated_program;
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  // Solve all four segments at the same time sharing a single planning time budget
+  std::atomic<std::size_t> num_jobs{ 0 };
+  request.parallel_for = [&num_jobs](std::size_t count, const std::function<void(std::size_t)>& job) {
+    num_jobs += count;
+    std::vector<std::thread> threads;
+    for (std::size_t i = 0; i < count; ++i)
+      threads.emplace_back(job, i);
+    for (auto& t : threads)
+      t.join();
+  };
+
+  OMPLMotionPlanner ompl_planner(OMPL_DEFAULT_NAMESPACE);
+  PlannerResponse planner_response = ompl_planner.solve(request);
+  EXPECT_EQ(num_jobs, 4);
+
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(planner_response.results.getMoveInstructionCount(), 41);  // 10 per segment + start a instruction
+  EXPECT_EQ(planner_response.results.size(), 41);
+  EXPECT_TRUE(wp1.getPosition().isApprox(
+      getJointPosition(planner_response.results.getFirstMoveInstruction()->getWaypoint()), 1e-5));
+  EXPECT_TRUE(wp1.getPosition().isApprox(
+      getJointPosition(planner_response.results.getLastMoveInstruction()->getWaypoint()), 1e-5));
+
+  // Segments must be stitched together in order
+  for (const auto& i : planner_response.results)
+  {
+    const auto& mi = i.as<MoveInstructionPoly>();
+    if (mi.getUUID() == plan_f1.getUUID() || mi.getUUID() == plan_f3.getUUID())
+      EXPECT_TRUE(wp2.getPosition().isApprox(getJointPosition(mi.getWaypoint()), 1e-5));
+
+    if (mi.getUUID() == plan_f2.getUUID() || mi.getUUID() == plan_f4.getUUID())
+      EXPECT_TRUE(wp1.getPosition().isApprox(getJointPosition(mi.getWaypoint()), 1e-5));
+  }
+
+  // The clone must also solve the segments concurrently
+  num_jobs = 0;
+  MotionPlanner::Ptr cloned_planner = ompl_planner.clone();
+  planner_response = cloned_planner->solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(planner_response.results.getMoveInstructionCount(), 41);
+  EXPECT_EQ(num_jobs, 4);
+
+  // The segments are solved in sequence if the profile does not enable it
+  num_jobs = 0;
+  plan_profile->solve_concurrently = false;
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(planner_response.results.getMoveInstructionCount(), 41);
+  EXPECT_EQ(num_jobs, 0);
+}
+
+TEST(TesseractPlanningOMPLUnit, OMPLRoadmapCacheUnit)  // NOLINT
+{
+  // Step 1: Load scene and srdf
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  // Step 2: Add box to environment, the other environment has the same name and revision but another scene
+  Environment::Ptr other_env = env->clone();
+  addBox(*env);
+  addBox(*other_env, Eigen::Vector3d(-1.0, 0, 0.55));
+
+  // Step 3: Create a freespace program
+  auto joint_group = env->getJointGroup(manip.manipulator);
+  auto cur_state = env->getState();
+
+  JointWaypointPoly wp1{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()))) };
+
+  JointWaypointPoly wp2{ JointWaypoint(
+      joint_group->getJointNames(),
+      Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()))) };
+
+  CompositeInstruction program;
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  CompositeInstruction interpolated_program = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+
+  // Create Profiles
+  const std::string directory = tesseract_common::getTempPath() + "ompl_roadmap_cache_unit";
+  tesseract_common::fs::remove_all(directory);
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.1;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 1;
+  plan_profile->simplify = false;
+  plan_profile->planners = { std::make_shared<const PRMConfigurator>() };
+  plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>(directory);
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = interpolated_program;
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  OMPLMotionPlanner ompl_planner(OMPL_DEFAULT_NAMESPACE);
+
+  // The first solve builds the roadmap and stores it in the cache
+  PlannerResponse planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 1);
+  std::size_t num_vertices = plan_profile->roadmap_cache->getNumVertices();
+  EXPECT_GT(num_vertices, 0);
+
+  // The second solve starts from the stored roadmap
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 1);
+  EXPECT_GE(plan_profile->roadmap_cache->getNumVertices(), num_vertices);
+  num_vertices = plan_profile->roadmap_cache->getNumVertices();
+
+  // A new cache using the same directory loads the saved roadmap
+  EXPECT_TRUE(plan_profile->roadmap_cache->save());
+  plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>(directory);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 0);
+
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 1);
+  EXPECT_GE(plan_profile->roadmap_cache->getNumVertices(), num_vertices);
+
+  // A scene with the same name and revision but another obstacle does not reuse the roadmap
+  EXPECT_EQ(other_env->getName(), env->getName());
+  EXPECT_EQ(other_env->getRevision(), env->getRevision());
+  PlannerRequest other_request = request;
+  other_request.env = other_env;
+  other_request.env_state = other_env->getState();
+  planner_response = ompl_planner.solve(other_request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 2);
+
+  // A saved roadmap is not loaded for another key, even from the file of that key
+  std::vector<OMPLProblemConfig> problems = ompl_planner.createProblems(request);
+  std::vector<OMPLProblemConfig> other_problems = ompl_planner.createProblems(other_request);
+  const OMPLProblem& prob = *problems.front().problem;
+  const OMPLProblem& other_prob = *other_problems.front().problem;
+  const std::string key = OMPLRoadmapCache::createKey(OMPLRoadmapCache::createKey(prob), prob, 0);
+  const std::string other_key = OMPLRoadmapCache::createKey(OMPLRoadmapCache::createKey(other_prob), other_prob, 0);
+  EXPECT_NE(key, other_key);
+  EXPECT_TRUE(plan_profile->roadmap_cache->save());
+  {
+    std::ifstream in(plan_profile->roadmap_cache->getFilePath(key), std::ios::binary);
+    std::ofstream out(plan_profile->roadmap_cache->getFilePath(other_key), std::ios::binary | std::ios::trunc);
+    out << in.rdbuf();
+  }
+
+  auto loading_cache = std::make_shared<OMPLRoadmapCache>(directory);
+  const ompl::base::SpaceInformationPtr& other_si = other_prob.simple_setup->getSpaceInformation();
+  EXPECT_NE(loading_cache->create(other_key, *other_prob.planners.front(), other_si), nullptr);
+  EXPECT_EQ(loading_cache->size(), 0);
+  const ompl::base::SpaceInformationPtr& si = prob.simple_setup->getSpaceInformation();
+  EXPECT_NE(loading_cache->create(key, *prob.planners.front(), si), nullptr);
+  EXPECT_EQ(loading_cache->size(), 1);
+
+  // Planners without a roadmap are not cached
+  plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>();
+  plan_profile->planners = { std::make_shared<const RRTConnectConfigurator>() };
+  planner_response = ompl_planner.solve(request);
+  EXPECT_TRUE(planner_response.successful);
+  EXPECT_EQ(plan_profile->roadmap_cache->size(), 0);
+  EXPECT_FALSE(plan_profile->roadmap_cache->save());
+
+  tesseract_common::fs::remove_all(directory);
+}
+
+TEST(TesseractPlanningOMPLUnit, StateCollisionValidatorBatchUnit)  // NOLINT
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+  addBox(*env);
+
+  auto joint_group = env->getJointGroup("manipulator");
+  auto dof = static_cast<unsigned>(joint_group->numJoints());
+  auto limits = joint_group->getLimits().joint_limits;
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  auto rss = std::make_shared<ompl::base::RealVectorStateSpace>();
+  for (unsigned i = 0; i < dof; ++i)
+    rss->addDimension(joint_names[i], limits(i, 0), limits(i, 1));
+
+  auto si = std::make_shared<ompl::base::SpaceInformation>(rss);
+  OMPLStateExtractor extractor = [dof](const ompl::base::State* state) -> Eigen::Map<Eigen::VectorXd> {
+    return tesseract_planning::RealVectorStateSpaceExtractor(state, dof);
+  };
+
+  tesseract_collision::CollisionCheckConfig config;
+  auto svc = std::make_shared<StateCollisionValidator>(si, *env, joint_group, config, extractor);
+  auto csvc = std::make_shared<CompoundStateValidator>();
+  csvc->addStateValidator([](const ompl::base::State*) { return true; });
+  csvc->addStateValidator(svc);
+  si->setStateValidityChecker(csvc);
+  si->setMotionValidator(std::make_shared<DiscreteMotionValidator>(si));
+  si->setup();
+
+  // Interpolate a motion which passes through the box
+  Eigen::Map<const Eigen::VectorXd> start(start_state.data(), static_cast<long>(start_state.size()));
+  Eigen::Map<const Eigen::VectorXd> end(end_state.data(), static_cast<long>(end_state.size()));
+  const std::size_t num_states = 50;
+  std::vector<ompl::base::State*> states;
+  std::vector<const ompl::base::State*> batch;
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    ompl::base::State* state = si->allocState();
+    double t = static_cast<double>(i) / static_cast<double>(num_states - 1);
+    extractor(state) = start + t * (end - start);
+    states.push_back(state);
+    batch.push_back(state);
+  }
+
+  std::size_t expected = num_states;
+  for (std::size_t i = 0; i < num_states; ++i)
+  {
+    if (!svc->isValid(states[i]))
+    {
+      expected = i;
+      break;
+    }
+  }
+  EXPECT_LT(expected, num_states);
+  EXPECT_TRUE(svc->isValid(states.front()));
+  EXPECT_EQ(svc->findFirstInvalid(batch, batch.size()), expected);
+  EXPECT_EQ(csvc->findFirstInvalid(batch, batch.size()), expected);
+  EXPECT_EQ(findFirstInvalidState(*csvc, batch, expected), expected);
+  EXPECT_FALSE(si->checkMotion(states.front(), states.back()));
+
+  // Each thread is given its own contact manager
+  std::vector<std::size_t> results(4, 0);
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < results.size(); ++t)
+  {
+    threads.emplace_back([&, t]() {
+      for (int j = 0; j < 10; ++j)
+        results[t] = findFirstInvalidState(*csvc, batch, batch.size());
+    });
+  }
+
+  for (auto& thread : threads)
+    thread.join();
+
+  for (std::size_t result : results)
+    EXPECT_EQ(result, expected);
+
+  for (ompl::base::State* state : states)
+    si->freeState(state);
+}
+
+TEST(TesseractPlanningOMPLUnit, MotionValidatorCheckOrderUnit)  // NOLINT
+{
+  // The bisection order is a permutation starting at the last index
+  std::vector<std::size_t> order;
+  for (std::size_t count = 0; count < 20; ++count)
+  {
+    getBisectionOrder(count, order);
+    ASSERT_EQ(order.size(), count);
+    if (count > 0)
+      EXPECT_EQ(order.front(), count - 1);
+
+    std::vector<std::size_t> sorted = order;
+    std::sort(sorted.begin(), sorted.end());
+    for (std::size_t i = 0; i < count; ++i)
+      EXPECT_EQ(sorted[i], i);
+  }
+
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  Environment::Ptr env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+  addBox(*env);
+
+  auto joint_group = env->getJointGroup("manipulator");
+  auto dof = static_cast<unsigned>(joint_group->numJoints());
+  auto limits = joint_group->getLimits().joint_limits;
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+
+  auto rss = std::make_shared<ompl::base::RealVectorStateSpace>();
+  for (unsigned i = 0; i < dof; ++i)
+    rss->addDimension(joint_names[i], limits(i, 0), limits(i, 1));
+
+  auto si = std::make_shared<ompl::base::SpaceInformation>(rss);
+  OMPLStateExtractor extractor = [dof](const ompl::base::State* state) -> Eigen::Map<Eigen::VectorXd> {
+    return tesseract_planning::RealVectorStateSpaceExtractor(state, dof);
+  };
+
+  tesseract_collision::CollisionCheckConfig config;
+  config.longest_valid_segment_length = 0.01;
+  si->setStateValidityChecker(std::make_shared<StateCollisionValidator>(si, *env, joint_group, config, extractor));
+  si->setStateValidityCheckingResolution(0.01);
+  si->setup();
+
+  std::vector<std::pair<ompl::base::MotionValidatorPtr, ompl::base::MotionValidatorPtr>> validators;
+  validators.emplace_back(std::make_shared<DiscreteMotionValidator>(si, OMPLMotionCheckOrder::LINEAR),
+                          std::make_shared<DiscreteMotionValidator>(si, OMPLMotionCheckOrder::BISECTION));
+  validators.emplace_back(
+      std::make_shared<ContinuousMotionValidator>(
+          si, nullptr, *env, joint_group, config, extractor, OMPLMotionCheckOrder::LINEAR),
+      std::make_shared<ContinuousMotionValidator>(
+          si, nullptr, *env, joint_group, config, extractor, OMPLMotionCheckOrder::BISECTION));
+
+  ompl::base::State* s1 = si->allocState();
+  ompl::base::State* s2 = si->allocState();
+  ompl::base::State* s3 = si->allocState();
+  ompl::base::State* linear_state = si->allocState();
+  ompl::base::State* bisection_state = si->allocState();
+  extractor(s1) = Eigen::Map<const Eigen::VectorXd>(start_state.data(), static_cast<long>(start_state.size()));
+  extractor(s2) = Eigen::Map<const Eigen::VectorXd>(end_state.data(), static_cast<long>(end_state.size()));
+  extractor(s3) = extractor(s1);
+  extractor(s3)(0) -= 0.2;
+
+  for (const auto& validator : validators)
+  {
+    // A motion passing through the box
+    std::pair<ompl::base::State*, double> linear_last_valid{ linear_state, 0 };
+    std::pair<ompl::base::State*, double> bisection_last_valid{ bisection_state, 0 };
+    EXPECT_FALSE(validator.first->checkMotion(s1, s2));
+    EXPECT_FALSE(validator.second->checkMotion(s1, s2));
+    EXPECT_FALSE(validator.first->checkMotion(s1, s2, linear_last_valid));
+    EXPECT_FALSE(validator.second->checkMotion(s1, s2, bisection_last_valid));
+    EXPECT_GT(linear_last_valid.second, 0);
+    EXPECT_LT(linear_last_valid.second, 1);
+    EXPECT_DOUBLE_EQ(bisection_last_valid.second, linear_last_valid.second);
+    EXPECT_TRUE(extractor(bisection_state).isApprox(extractor(linear_state)));
+
+    // A motion away from the box
+    EXPECT_TRUE(validator.first->checkMotion(s1, s3));
+    EXPECT_TRUE(validator.second->checkMotion(s1, s3));
+  }
+
+  for (ompl::base::State* state : { s1, s2, s3, linear_state, bisection_state })
+    si->freeState(state);
+}
+
 TYPED_TEST(OMPLTestFixture, OMPLFreespaceCartesianGoalPlannerUnit)  // NOLINT
 {
   EXPECT_EQ(ompl::RNG::getSeed(), SEED) << "Randomization seed does not match expected: " << ompl::RNG::getSeed()
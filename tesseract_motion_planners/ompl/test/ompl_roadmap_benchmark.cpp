@@ -0,0 +1,211 @@
+/**
+ * @file ompl_roadmap_benchmark.cpp
+ * @brief Benchmark cold and warm roadmap planner queries on the freespace OMPL example
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <ompl/util/Console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_common/utils.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands.h>
+#include <tesseract_geometry/impl/sphere.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_motion_planners/ompl/ompl_motion_planner.h>
+#include <tesseract_motion_planners/ompl/ompl_roadmap_cache.h>
+#include <tesseract_motion_planners/ompl/profile/ompl_default_plan_profile.h>
+#include <tesseract_motion_planners/simple/interpolation.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+using namespace tesseract_scene_graph;
+
+static const std::string OMPL_DEFAULT_NAMESPACE = "OMPLMotionPlannerTask";
+
+/** @brief How the roadmap is provided to the planner */
+enum class RoadmapSource
+{
+  /** @brief Every query builds a new roadmap */
+  COLD,
+  /** @brief Every query starts from the roadmap kept in memory */
+  WARM_MEMORY,
+  /** @brief Every query starts from the roadmap loaded from a file, like the first query after a restart */
+  WARM_FILE
+};
+
+/** @brief Create the environment of the freespace OMPL example, which places a sphere in front of the robot */
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+
+  Link link_sphere("sphere_attached");
+
+  Visual::Ptr visual = std::make_shared<Visual>();
+  visual->origin = Eigen::Isometry3d::Identity();
+  visual->origin.translation() = Eigen::Vector3d(0.5, 0, 0.55);
+  visual->geometry = std::make_shared<tesseract_geometry::Sphere>(0.15);
+  link_sphere.visual.push_back(visual);
+
+  Collision::Ptr collision = std::make_shared<Collision>();
+  collision->origin = visual->origin;
+  collision->geometry = visual->geometry;
+  link_sphere.collision.push_back(collision);
+
+  Joint joint_sphere("joint_sphere_attached");
+  joint_sphere.parent_link_name = "base_link";
+  joint_sphere.child_link_name = link_sphere.getName();
+  joint_sphere.type = JointType::FIXED;
+
+  env->applyCommand(std::make_shared<AddLinkCommand>(link_sphere, joint_sphere));
+  return env;
+}
+
+/** @brief The start and end state of the freespace OMPL example */
+static Eigen::VectorXd getExampleState(double joint_a1)
+{
+  Eigen::VectorXd state(7);
+  state << joint_a1, 0.2762, 0.0, -1.3348, 0.0, 1.4959, 0.0;
+  return state;
+}
+
+/**
+ * @brief Measure the latency of a query of the freespace OMPL example with a roadmap planner
+ * @details The warm benchmarks build the roadmap with a single query before timing, so they measure the latency of a
+ * repeated query in a static work cell.
+ */
+static void BM_RoadmapQuery(benchmark::State& state,
+                            const OMPLPlannerConfigurator::ConstPtr& configurator,
+                            RoadmapSource source)
+{
+  ompl::msg::setLogLevel(ompl::msg::LOG_WARN);
+
+  Environment::Ptr env = getEnvironment();
+
+  tesseract_common::ManipulatorInfo manip;
+  manip.manipulator = "manipulator";
+  manip.working_frame = "base_link";
+  manip.tcp_frame = "tool0";
+
+  std::vector<std::string> joint_names = env->getJointGroup(manip.manipulator)->getJointNames();
+  env->setState(joint_names, getExampleState(-0.4));
+  tesseract_scene_graph::SceneState cur_state = env->getState();
+
+  JointWaypointPoly wp0{ JointWaypoint(joint_names, getExampleState(-0.4)) };
+  JointWaypointPoly wp1{ JointWaypoint(joint_names, getExampleState(0.4)) };
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(wp0, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  const std::string directory = tesseract_common::getTempPath() + "ompl_roadmap_benchmark";
+  tesseract_common::fs::remove_all(directory);
+
+  auto plan_profile = std::make_shared<OMPLDefaultPlanProfile>();
+  plan_profile->collision_check_config.longest_valid_segment_length = 0.05;
+  plan_profile->planning_time = 10;
+  plan_profile->optimize = false;
+  plan_profile->max_solutions = 1;
+  plan_profile->simplify = false;
+  plan_profile->planners = { configurator };
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<OMPLPlanProfile>(OMPL_DEFAULT_NAMESPACE, "TEST_PROFILE", plan_profile);
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 10);
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  OMPLMotionPlanner planner(OMPL_DEFAULT_NAMESPACE);
+  if (source != RoadmapSource::COLD)
+  {
+    plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>(directory);
+    planner.solve(request);
+    plan_profile->roadmap_cache->save();
+  }
+
+  std::size_t failed{ 0 };
+  for (auto _ : state)
+  {
+    if (source == RoadmapSource::WARM_FILE)
+      plan_profile->roadmap_cache = std::make_shared<OMPLRoadmapCache>(directory);
+
+    PlannerResponse response = planner.solve(request);
+    if (!response.successful)
+      ++failed;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["failed"] = static_cast<double>(failed);
+  if (plan_profile->roadmap_cache != nullptr)
+    state.counters["vertices"] = static_cast<double>(plan_profile->roadmap_cache->getNumVertices());
+
+  tesseract_common::fs::remove_all(directory);
+}
+
+BENCHMARK_CAPTURE(BM_RoadmapQuery, PRM_Cold, std::make_shared<const PRMConfigurator>(), RoadmapSource::COLD)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RoadmapQuery,
+                  PRM_WarmMemory,
+                  std::make_shared<const PRMConfigurator>(),
+                  RoadmapSource::WARM_MEMORY)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RoadmapQuery, PRM_WarmFile, std::make_shared<const PRMConfigurator>(), RoadmapSource::WARM_FILE)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_CAPTURE(BM_RoadmapQuery,
+                  LazyPRMstar_Cold,
+                  std::make_shared<const LazyPRMstarConfigurator>(),
+                  RoadmapSource::COLD)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RoadmapQuery,
+                  LazyPRMstar_WarmMemory,
+                  std::make_shared<const LazyPRMstarConfigurator>(),
+                  RoadmapSource::WARM_MEMORY)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_RoadmapQuery,
+                  LazyPRMstar_WarmFile,
+                  std::make_shared<const LazyPRMstarConfigurator>(),
+                  RoadmapSource::WARM_FILE)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
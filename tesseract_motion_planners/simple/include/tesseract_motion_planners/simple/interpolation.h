@@ -35,18 +35,38 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_kinematics/core/joint_group.h>
 #include <tesseract_kinematics/core/kinematic_group.h>
 #include <tesseract_motion_planners/core/types.h>
+#include <tesseract_motion_planners/simple/kinematics_cache.h>
 
 namespace tesseract_planning
 {
 /** @brief The Joint Group Instruction Information struct */
 struct JointGroupInstructionInfo
 {
+  /**
+   * @brief Construct the instruction information
+   * @details This uses the kinematics cache of the request if the simple planner is solving it, see
+   * SimplePlannerKinematicsCache::getFromRequest(), otherwise the kinematics are created from the environment of the
+   * request.
+   * @param plan_instruction The plan instruction
+   * @param request The planning request
+   * @param manip_info The global manipulator information
+   */
   JointGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
                             const PlannerRequest& request,
                             const tesseract_common::ManipulatorInfo& manip_info);
 
+  /**
+   * @brief Construct the instruction information using the request scoped kinematics cache
+   * @param plan_instruction The plan instruction
+   * @param manip_info The global manipulator information
+   * @param cache The kinematics cache of the planning request
+   */
+  JointGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
+                            const tesseract_common::ManipulatorInfo& manip_info,
+                            SimplePlannerKinematicsCache& cache);
+
   const MoveInstructionPoly& instruction;
-  tesseract_kinematics::JointGroup::UPtr manip;
+  tesseract_kinematics::JointGroup::ConstPtr manip;
   std::string working_frame;
   Eigen::Isometry3d working_frame_transform{ Eigen::Isometry3d::Identity() };
   std::string tcp_frame;
@@ -86,18 +106,57 @@ struct JointGroupInstructionInfo
 /** @brief The Kinematic Group Instruction Information struct */
 struct KinematicGroupInstructionInfo
 {
+  /**
+   * @brief Construct the instruction information
+   * @details This uses the kinematics cache of the request if the simple planner is solving it, see
+   * SimplePlannerKinematicsCache::getFromRequest(), otherwise the kinematics are created from the environment of the
+   * request.
+   * @param plan_instruction The plan instruction
+   * @param request The planning request
+   * @param manip_info The global manipulator information
+   */
   KinematicGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
                                 const PlannerRequest& request,
                                 const tesseract_common::ManipulatorInfo& manip_info);
 
+  /**
+   * @brief Construct the instruction information using the request scoped kinematics cache
+   * @param plan_instruction The plan instruction
+   * @param manip_info The global manipulator information
+   * @param cache The kinematics cache of the planning request
+   */
+  KinematicGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
+                                const tesseract_common::ManipulatorInfo& manip_info,
+                                SimplePlannerKinematicsCache& cache);
+
   const MoveInstructionPoly& instruction;
-  tesseract_kinematics::KinematicGroup::UPtr manip;
+  tesseract_kinematics::KinematicGroup::ConstPtr manip;
   std::string working_frame;
   Eigen::Isometry3d working_frame_transform{ Eigen::Isometry3d::Identity() };
   std::string tcp_frame;
   Eigen::Isometry3d tcp_offset{ Eigen::Isometry3d::Identity() };
   bool has_cartesian_waypoint{ false };
 
+  /** @brief The inverse kinematics solver name of the kinematic group, empty for the default solver */
+  std::string ik_solver;
+
+  /** @brief The inverse kinematics solution cache, may be nullptr */
+  IKSolutionCache::Ptr ik_cache;
+
+  /** @brief The inverse kinematics frame signature of the kinematic group, only set if there is a solution cache */
+  std::shared_ptr<const tesseract_common::TransformMap> ik_frame_signature;
+
+  /** @brief The revision of the environment the kinematic group was created from */
+  int env_revision{ 0 };
+
+  /**
+   * @brief Solve inverse kinematics for the provided pose, using the inverse kinematics solution cache if available
+   * @param pose The pose of the tcp frame relative to the working frame, without the tcp offset
+   * @param seed The seed
+   * @return The inverse kinematics solutions
+   */
+  tesseract_kinematics::IKSolutions calcInvKin(const Eigen::Isometry3d& pose, const Eigen::VectorXd& seed) const;
+
   /**
    * @brief Calculate the cartesian pose given the joint solution
    * @param jp The joint solution to calculate the pose
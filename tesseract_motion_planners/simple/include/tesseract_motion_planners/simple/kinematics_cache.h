@@ -0,0 +1,129 @@
+/**
+ * @file kinematics_cache.h
+ * @brief A request scoped cache of the kinematic information used by the simple planner
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_SIMPLE_KINEMATICS_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_SIMPLE_KINEMATICS_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Geometry>
+#include <memory>
+#include <string>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_kinematics/core/joint_group.h>
+#include <tesseract_kinematics/core/kinematic_group.h>
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
+#include <tesseract_motion_planners/core/types.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A cache of kinematic groups, TCP offsets and working frame transforms for a single planning request
+ * @details Creating a kinematic group is expensive and for kinematic groups it also loads the inverse kinematics
+ * plugin, so the simple planner creates one cache per request which is shared by all of the plan profiles and
+ * interpolation helpers. The cache assumes the environment and state of the request do not change while it is alive.
+ *
+ * The planner passes its cache to the plan profiles as the planner data of the request, PlannerRequest::data, so
+ * profiles and instruction information created from the request use it through getFromRequest() without a change to
+ * the profile interface.
+ * @note This is not thread safe
+ */
+class SimplePlannerKinematicsCache
+{
+public:
+  /**
+   * @brief Constructor
+   * @param request The planning request, which must outlive the cache
+   * @param ik_cache The inverse kinematics solution cache shared across requests, may be nullptr
+   */
+  explicit SimplePlannerKinematicsCache(const PlannerRequest& request, IKSolutionCache::Ptr ik_cache = nullptr);
+
+  /**
+   * @brief Get the joint group for the provided manipulator
+   * @param manipulator The manipulator group name
+   * @return The joint group
+   */
+  std::shared_ptr<const tesseract_kinematics::JointGroup> getJointGroup(const std::string& manipulator);
+
+  /**
+   * @brief Get the kinematic group for the provided manipulator and inverse kinematics solver
+   * @param manipulator The manipulator group name
+   * @param ik_solver The inverse kinematics solver name, if empty the default solver is used
+   * @return The kinematic group
+   */
+  std::shared_ptr<const tesseract_kinematics::KinematicGroup> getKinematicGroup(const std::string& manipulator,
+                                                                                const std::string& ik_solver = "");
+
+  /**
+   * @brief Get the TCP offset for the provided manipulator information
+   * @param manip_info The combined manipulator information
+   * @return The TCP offset
+   */
+  Eigen::Isometry3d getTCPOffset(const tesseract_common::ManipulatorInfo& manip_info);
+
+  /**
+   * @brief Get the working frame transform relative to world for the request state
+   * @param working_frame The working frame name
+   * @return The working frame transform
+   */
+  const Eigen::Isometry3d& getWorkingFrameTransform(const std::string& working_frame) const;
+
+  /**
+   * @brief Get the inverse kinematics frame signature of the kinematic group for the provided manipulator
+   * @details It is computed once per kinematic group, see IKSolutionCache::getFrameSignature()
+   * @param manipulator The manipulator group name
+   * @param ik_solver The inverse kinematics solver name, if empty the default solver is used
+   * @return The frame signature
+   */
+  std::shared_ptr<const tesseract_common::TransformMap> getFrameSignature(const std::string& manipulator,
+                                                                          const std::string& ik_solver = "");
+
+  /** @brief Get the planning request associated with the cache */
+  const PlannerRequest& getRequest() const;
+
+  /** @brief Get the inverse kinematics solution cache, which may be nullptr */
+  const IKSolutionCache::Ptr& getIKSolutionCache() const;
+
+  /**
+   * @brief Get the cache stored as the planner data of the request
+   * @param request The planning request
+   * @return The cache of the request if its planner data is a cache created for it, otherwise nullptr
+   */
+  static SimplePlannerKinematicsCache* getFromRequest(const PlannerRequest& request);
+
+private:
+  const PlannerRequest& request_;
+  IKSolutionCache::Ptr ik_cache_;
+  std::unordered_map<std::string, std::shared_ptr<const tesseract_kinematics::JointGroup>> joint_groups_;
+  std::unordered_map<std::string, std::shared_ptr<const tesseract_kinematics::KinematicGroup>> kinematic_groups_;
+  std::unordered_map<std::string, std::shared_ptr<const tesseract_common::TransformMap>> frame_signatures_;
+  tesseract_common::TransformMap tcp_offsets_;
+};
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_MOTION_PLANNERS_SIMPLE_KINEMATICS_CACHE_H
@@ -34,6 +34,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/core/planner.h>
+#include <tesseract_motion_planners/core/ik_solution_cache.h>
+#include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_profile.h>
 
 namespace tesseract_planning
@@ -59,6 +61,14 @@ public:
   SimpleMotionPlanner(SimpleMotionPlanner&&) = delete;
   SimpleMotionPlanner& operator=(SimpleMotionPlanner&&) = delete;
 
+  /**
+   * @brief Solve the planning request
+   * @details The kinematics cache shared by the plan profiles is passed to them as the planner data of the request. If
+   * the planner data is not set the planner solves a copy of the request which holds a new cache, otherwise it must be
+   * a SimplePlannerKinematicsCache created for the request.
+   * @param request The planning request
+   * @return The response
+   */
   PlannerResponse solve(const PlannerRequest& request) const override;
 
   bool terminate() override;
@@ -67,11 +77,27 @@ public:
 
   MotionPlanner::Ptr clone() const override;
 
+  /**
+   * @brief Set the inverse kinematics solution cache used for cartesian waypoints
+   * @details The cache may be shared with other planners, for example the Descartes planner, and with clones of the
+   * planner. If nullptr, which is the default, inverse kinematics is solved for every cartesian waypoint.
+   * @param ik_cache The inverse kinematics solution cache
+   */
+  void setIKSolutionCache(IKSolutionCache::Ptr ik_cache);
+
+  /** @brief Get the inverse kinematics solution cache, which may be nullptr */
+  IKSolutionCache::Ptr getIKSolutionCache() const;
+
 protected:
-  CompositeInstruction processCompositeInstruction(const CompositeInstruction& instructions,
-                                                   MoveInstructionPoly& prev_instruction,
-                                                   MoveInstructionPoly& prev_seed,
-                                                   const PlannerRequest& request) const;
+  IKSolutionCache::Ptr ik_cache_;
+
+  CompositeInstruction
+  processCompositeInstruction(const CompositeInstruction& instructions,
+                              MoveInstructionPoly& prev_instruction,
+                              MoveInstructionPoly& prev_seed,
+                              const PlannerRequest& request,
+                              const ProfileSnapshot<SimplePlannerPlanProfile>& plan_profiles,
+                              SimplePlannerKinematicsCache& kin_cache) const;
 };
 
 }  // namespace tesseract_planning
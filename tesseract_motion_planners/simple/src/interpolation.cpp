@@ -24,6 +24,11 @@
  * limitations under the License.
  */
 
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <type_traits>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
 #include <tesseract_motion_planners/simple/interpolation.h>
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_lvs_no_ik_plan_profile.h>
@@ -33,10 +38,13 @@
 
 namespace tesseract_planning
 {
-JointGroupInstructionInfo::JointGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
-                                                     const PlannerRequest& request,
-                                                     const tesseract_common::ManipulatorInfo& manip_info)
-  : instruction(plan_instruction)
+namespace
+{
+template <typename InstructionInfo>
+void initInstructionInfo(InstructionInfo& info,
+                         const MoveInstructionPoly& plan_instruction,
+                         const tesseract_common::ManipulatorInfo& manip_info,
+                         SimplePlannerKinematicsCache& cache)
 {
   assert(!(manip_info.empty() && plan_instruction.getManipulatorInfo().empty()));
   tesseract_common::ManipulatorInfo mi = manip_info.getCombined(plan_instruction.getManipulatorInfo());
@@ -52,22 +60,59 @@ JointGroupInstructionInfo::JointGroupInstructionInfo(const MoveInstructionPoly&
     throw std::runtime_error("InstructionInfo, working frame is empty!");
 
   // Get Previous Instruction Kinematics
-  manip = request.env->getJointGroup(mi.manipulator);
+  if constexpr (std::is_same_v<InstructionInfo, JointGroupInstructionInfo>)
+  {
+    info.manip = cache.getJointGroup(mi.manipulator);
+  }
+  else
+  {
+    info.manip = cache.getKinematicGroup(mi.manipulator, mi.manipulator_ik_solver);
+    info.ik_solver = mi.manipulator_ik_solver;
+    info.ik_cache = cache.getIKSolutionCache();
+    if (info.ik_cache != nullptr)
+      info.ik_frame_signature = cache.getFrameSignature(mi.manipulator, mi.manipulator_ik_solver);
+
+    info.env_revision = cache.getRequest().env->getRevision();
+  }
 
   // Get Previous Instruction TCP and Working Frame
-  working_frame = mi.working_frame;
-  working_frame_transform = request.env_state.link_transforms.at(working_frame);
-  tcp_frame = mi.tcp_frame;
-  tcp_offset = request.env->findTCPOffset(mi);
+  info.working_frame = mi.working_frame;
+  info.working_frame_transform = cache.getWorkingFrameTransform(info.working_frame);
+  info.tcp_frame = mi.tcp_frame;
+  info.tcp_offset = cache.getTCPOffset(mi);
 
   // Get Previous Instruction Waypoint Info
   if (plan_instruction.getWaypoint().isStateWaypoint() || plan_instruction.getWaypoint().isJointWaypoint())
-    has_cartesian_waypoint = false;
+    info.has_cartesian_waypoint = false;
   else if (plan_instruction.getWaypoint().isCartesianWaypoint())
-    has_cartesian_waypoint = true;
+    info.has_cartesian_waypoint = true;
   else
     throw std::runtime_error("Simple planner currently only supports State, Joint and Cartesian Waypoint types!");
 }
+}  // namespace
+
+JointGroupInstructionInfo::JointGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
+                                                     const PlannerRequest& request,
+                                                     const tesseract_common::ManipulatorInfo& manip_info)
+  : instruction(plan_instruction)
+{
+  if (SimplePlannerKinematicsCache* request_cache = SimplePlannerKinematicsCache::getFromRequest(request))
+  {
+    initInstructionInfo(*this, plan_instruction, manip_info, *request_cache);
+    return;
+  }
+
+  SimplePlannerKinematicsCache cache(request);
+  initInstructionInfo(*this, plan_instruction, manip_info, cache);
+}
+
+JointGroupInstructionInfo::JointGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
+                                                     const tesseract_common::ManipulatorInfo& manip_info,
+                                                     SimplePlannerKinematicsCache& cache)
+  : instruction(plan_instruction)
+{
+  initInstructionInfo(*this, plan_instruction, manip_info, cache);
+}
 
 Eigen::Isometry3d JointGroupInstructionInfo::calcCartesianPose(const Eigen::VectorXd& jp, bool in_world) const
 {
@@ -100,35 +145,22 @@ KinematicGroupInstructionInfo::KinematicGroupInstructionInfo(const MoveInstructi
                                                              const tesseract_common::ManipulatorInfo& manip_info)
   : instruction(plan_instruction)
 {
-  assert(!(manip_info.empty() && plan_instruction.getManipulatorInfo().empty()));
-  tesseract_common::ManipulatorInfo mi = manip_info.getCombined(plan_instruction.getManipulatorInfo());
-
-  // Check required manipulator information
-  if (mi.manipulator.empty())
-    throw std::runtime_error("InstructionInfo, manipulator is empty!");
-
-  if (mi.tcp_frame.empty())
-    throw std::runtime_error("InstructionInfo, TCP frame is empty!");
-
-  if (mi.working_frame.empty())
-    throw std::runtime_error("InstructionInfo, working frame is empty!");
-
-  // Get Previous Instruction Kinematics
-  manip = request.env->getKinematicGroup(mi.manipulator, mi.manipulator_ik_solver);
+  if (SimplePlannerKinematicsCache* request_cache = SimplePlannerKinematicsCache::getFromRequest(request))
+  {
+    initInstructionInfo(*this, plan_instruction, manip_info, *request_cache);
+    return;
+  }
 
-  // Get Previous Instruction TCP and Working Frame
-  working_frame = mi.working_frame;
-  working_frame_transform = request.env_state.link_transforms.at(working_frame);
-  tcp_frame = mi.tcp_frame;
-  tcp_offset = request.env->findTCPOffset(mi);
+  SimplePlannerKinematicsCache cache(request);
+  initInstructionInfo(*this, plan_instruction, manip_info, cache);
+}
 
-  // Get Previous Instruction Waypoint Info
-  if (plan_instruction.getWaypoint().isStateWaypoint() || plan_instruction.getWaypoint().isJointWaypoint())
-    has_cartesian_waypoint = false;
-  else if (plan_instruction.getWaypoint().isCartesianWaypoint())
-    has_cartesian_waypoint = true;
-  else
-    throw std::runtime_error("Simple planner currently only supports State, Joint and Cartesian Waypoint types!");
+KinematicGroupInstructionInfo::KinematicGroupInstructionInfo(const MoveInstructionPoly& plan_instruction,
+                                                             const tesseract_common::ManipulatorInfo& manip_info,
+                                                             SimplePlannerKinematicsCache& cache)
+  : instruction(plan_instruction)
+{
+  initInstructionInfo(*this, plan_instruction, manip_info, cache);
 }
 
 Eigen::Isometry3d KinematicGroupInstructionInfo::calcCartesianPose(const Eigen::VectorXd& jp, bool in_world) const
@@ -157,6 +189,16 @@ const Eigen::VectorXd& KinematicGroupInstructionInfo::extractJointPosition() con
   return getJointPosition(instruction.getWaypoint());
 }
 
+tesseract_kinematics::IKSolutions KinematicGroupInstructionInfo::calcInvKin(const Eigen::Isometry3d& pose,
+                                                                           const Eigen::VectorXd& seed) const
+{
+  tesseract_kinematics::KinGroupIKInput ik_input(pose, working_frame, tcp_frame);
+  if (ik_cache != nullptr && ik_frame_signature != nullptr)
+    return ik_cache->calcInvKin(*manip, *ik_frame_signature, ik_input, seed, env_revision, ik_solver);
+
+  return manip->calcInvKin({ ik_input }, seed);
+}
+
 std::vector<MoveInstructionPoly> interpolateJointJointWaypoint(const KinematicGroupInstructionInfo& prev,
                                                                const KinematicGroupInstructionInfo& base,
                                                                int linear_steps,
@@ -1115,8 +1157,7 @@ Eigen::VectorXd getClosestJointSolution(const KinematicGroupInstructionInfo& inf
 
   Eigen::VectorXd jp_final;
   tesseract_kinematics::IKSolutions jp;
-  tesseract_kinematics::KinGroupIKInput ik_input(cwp, info.working_frame, info.tcp_frame);
-  tesseract_kinematics::IKSolutions solutions = info.manip->calcInvKin({ ik_input }, seed);
+  tesseract_kinematics::IKSolutions solutions = info.calcInvKin(cwp, seed);
   for (const auto& sol : solutions)
   {
     jp.push_back(sol);
@@ -1177,8 +1218,7 @@ std::array<Eigen::VectorXd, 2> getClosestJointSolution(const KinematicGroupInstr
   // Calculate IK for start and end
   Eigen::VectorXd j1_final;
   tesseract_kinematics::IKSolutions j1;
-  tesseract_kinematics::KinGroupIKInput ik_input1(cwp1, info1.working_frame, info1.tcp_frame);
-  tesseract_kinematics::IKSolutions j1_solutions = info1.manip->calcInvKin({ ik_input1 }, seed);
+  tesseract_kinematics::IKSolutions j1_solutions = info1.calcInvKin(cwp1, seed);
   j1_solutions.erase(std::remove_if(j1_solutions.begin(),
                                     j1_solutions.end(),
                                     [&manip1_limits](const Eigen::VectorXd& solution) {
@@ -1198,8 +1238,7 @@ std::array<Eigen::VectorXd, 2> getClosestJointSolution(const KinematicGroupInstr
 
   Eigen::VectorXd j2_final;
   tesseract_kinematics::IKSolutions j2;
-  tesseract_kinematics::KinGroupIKInput ik_input2(cwp2, info2.working_frame, info2.tcp_frame);
-  tesseract_kinematics::IKSolutions j2_solutions = info2.manip->calcInvKin({ ik_input2 }, seed);
+  tesseract_kinematics::IKSolutions j2_solutions = info2.calcInvKin(cwp2, seed);
   j2_solutions.erase(std::remove_if(j2_solutions.begin(),
                                     j2_solutions.end(),
                                     [&manip2_limits](const Eigen::VectorXd& solution) {
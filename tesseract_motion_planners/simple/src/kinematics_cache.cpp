@@ -0,0 +1,121 @@
+/**
+ * @file kinematics_cache.cpp
+ * @brief A request scoped cache of the kinematic information used by the simple planner
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <stdexcept>
+#include <variant>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/simple/kinematics_cache.h>
+#include <tesseract_environment/environment.h>
+
+namespace tesseract_planning
+{
+SimplePlannerKinematicsCache::SimplePlannerKinematicsCache(const PlannerRequest& request, IKSolutionCache::Ptr ik_cache)
+  : request_(request), ik_cache_(std::move(ik_cache))
+{
+}
+
+std::shared_ptr<const tesseract_kinematics::JointGroup>
+SimplePlannerKinematicsCache::getJointGroup(const std::string& manipulator)
+{
+  auto it = joint_groups_.find(manipulator);
+  if (it != joint_groups_.end())
+    return it->second;
+
+  std::shared_ptr<const tesseract_kinematics::JointGroup> manip = request_.env->getJointGroup(manipulator);
+  joint_groups_[manipulator] = manip;
+  return manip;
+}
+
+std::shared_ptr<const tesseract_kinematics::KinematicGroup>
+SimplePlannerKinematicsCache::getKinematicGroup(const std::string& manipulator, const std::string& ik_solver)
+{
+  std::string key = manipulator + "::" + ik_solver;
+  auto it = kinematic_groups_.find(key);
+  if (it != kinematic_groups_.end())
+    return it->second;
+
+  std::shared_ptr<const tesseract_kinematics::KinematicGroup> manip =
+      request_.env->getKinematicGroup(manipulator, ik_solver);
+  kinematic_groups_[key] = manip;
+  return manip;
+}
+
+std::shared_ptr<const tesseract_common::TransformMap>
+SimplePlannerKinematicsCache::getFrameSignature(const std::string& manipulator, const std::string& ik_solver)
+{
+  std::string key = manipulator + "::" + ik_solver;
+  auto it = frame_signatures_.find(key);
+  if (it != frame_signatures_.end())
+    return it->second;
+
+  auto frame_signature = std::make_shared<const tesseract_common::TransformMap>(
+      IKSolutionCache::getFrameSignature(*getKinematicGroup(manipulator, ik_solver)));
+  frame_signatures_[key] = frame_signature;
+  return frame_signature;
+}
+
+Eigen::Isometry3d SimplePlannerKinematicsCache::getTCPOffset(const tesseract_common::ManipulatorInfo& manip_info)
+{
+  if (std::holds_alternative<Eigen::Isometry3d>(manip_info.tcp_offset))
+    return std::get<Eigen::Isometry3d>(manip_info.tcp_offset);
+
+  // The offset is resolved by name so it is cached by manipulator, tcp frame and offset name
+  std::string key =
+      manip_info.manipulator + "::" + manip_info.tcp_frame + "::" + std::get<std::string>(manip_info.tcp_offset);
+  auto it = tcp_offsets_.find(key);
+  if (it != tcp_offsets_.end())
+    return it->second;
+
+  Eigen::Isometry3d tcp_offset = request_.env->findTCPOffset(manip_info);
+  tcp_offsets_[key] = tcp_offset;
+  return tcp_offset;
+}
+
+const Eigen::Isometry3d& SimplePlannerKinematicsCache::getWorkingFrameTransform(const std::string& working_frame) const
+{
+  auto it = request_.env_state.link_transforms.find(working_frame);
+  if (it == request_.env_state.link_transforms.end())
+    throw std::runtime_error("SimplePlannerKinematicsCache, working frame '" + working_frame + "' does not exist!");
+
+  return it->second;
+}
+
+const PlannerRequest& SimplePlannerKinematicsCache::getRequest() const { return request_; }
+
+const IKSolutionCache::Ptr& SimplePlannerKinematicsCache::getIKSolutionCache() const { return ik_cache_; }
+
+SimplePlannerKinematicsCache* SimplePlannerKinematicsCache::getFromRequest(const PlannerRequest& request)
+{
+  // The planner data of a request solved by the simple planner is its kinematics cache
+  auto* cache = static_cast<SimplePlannerKinematicsCache*>(request.data.get());
+  if (cache != nullptr && &cache->request_ == &request)
+    return cache;
+
+  return nullptr;
+}
+}  // namespace tesseract_planning
@@ -56,7 +56,16 @@ bool SimpleMotionPlanner::terminate()
 
 void SimpleMotionPlanner::clear() {}
 
-MotionPlanner::Ptr SimpleMotionPlanner::clone() const { return std::make_shared<SimpleMotionPlanner>(name_); }
+MotionPlanner::Ptr SimpleMotionPlanner::clone() const
+{
+  auto planner = std::make_shared<SimpleMotionPlanner>(name_);
+  planner->setIKSolutionCache(ik_cache_);
+  return planner;
+}
+
+void SimpleMotionPlanner::setIKSolutionCache(IKSolutionCache::Ptr ik_cache) { ik_cache_ = std::move(ik_cache); }
+
+IKSolutionCache::Ptr SimpleMotionPlanner::getIKSolutionCache() const { return ik_cache_; }
 
 PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
 {
@@ -68,12 +77,20 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
     return response;
   }
 
+  // The kinematics cache is passed to the plan profiles as the planner data of the request
+  SimplePlannerKinematicsCache* kin_cache = SimplePlannerKinematicsCache::getFromRequest(request);
+  if (kin_cache == nullptr)
+  {
+    PlannerRequest cached_request(request);
+    cached_request.data = std::make_shared<SimplePlannerKinematicsCache>(cached_request, ik_cache_);
+    return solve(cached_request);
+  }
+
   // Assume all the plan instructions have the same manipulator as the composite
   const std::string manipulator = request.instructions.getManipulatorInfo().manipulator;
   const std::string manipulator_ik_solver = request.instructions.getManipulatorInfo().manipulator_ik_solver;
 
-  // Initialize
-  tesseract_kinematics::JointGroup::UPtr manip = request.env->getJointGroup(manipulator);
+  tesseract_kinematics::JointGroup::ConstPtr manip = kin_cache->getJointGroup(manipulator);
 
   // Create seed
   CompositeInstruction seed;
@@ -86,8 +103,18 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   {
     MoveInstructionPoly start_instruction_copy = null_instruction;
     MoveInstructionPoly start_instruction_seed_copy = null_instruction;
-    seed =
-        processCompositeInstruction(request.instructions, start_instruction_copy, start_instruction_seed_copy, request);
+
+    // Resolve the plan profiles once for all instructions
+    ProfileSnapshot<SimplePlannerPlanProfile> plan_profiles(name_,
+                                                            *request.profiles,
+                                                            request.plan_profile_remapping,
+                                                            std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
+    seed = processCompositeInstruction(request.instructions,
+                                       start_instruction_copy,
+                                       start_instruction_seed_copy,
+                                       request,
+                                       plan_profiles,
+                                       *kin_cache);
   }
   catch (std::exception& e)
   {
@@ -129,10 +156,13 @@ PlannerResponse SimpleMotionPlanner::solve(const PlannerRequest& request) const
   return response;
 }
 
-CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const CompositeInstruction& instructions,
-                                                                      MoveInstructionPoly& prev_instruction,
-                                                                      MoveInstructionPoly& prev_seed,
-                                                                      const PlannerRequest& request) const
+CompositeInstruction
+SimpleMotionPlanner::processCompositeInstruction(const CompositeInstruction& instructions,
+                                                 MoveInstructionPoly& prev_instruction,
+                                                 MoveInstructionPoly& prev_seed,
+                                                 const PlannerRequest& request,
+                                                 const ProfileSnapshot<SimplePlannerPlanProfile>& plan_profiles,
+                                                 SimplePlannerKinematicsCache& kin_cache) const
 {
   CompositeInstruction seed(instructions);
   seed.clear();
@@ -143,8 +173,8 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
 
     if (instruction.isCompositeInstruction())
     {
-      seed.push_back(
-          processCompositeInstruction(instruction.as<CompositeInstruction>(), prev_instruction, prev_seed, request));
+      seed.push_back(processCompositeInstruction(
+          instruction.as<CompositeInstruction>(), prev_instruction, prev_seed, request, plan_profiles, kin_cache));
     }
     else if (instruction.isMoveInstruction())
     {
@@ -153,7 +183,7 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
       {
         const std::string manipulator = request.instructions.getManipulatorInfo().manipulator;
         const std::string manipulator_ik_solver = request.instructions.getManipulatorInfo().manipulator_ik_solver;
-        tesseract_kinematics::JointGroup::UPtr manip = request.env->getJointGroup(manipulator);
+        tesseract_kinematics::JointGroup::ConstPtr manip = kin_cache.getJointGroup(manipulator);
 
         prev_instruction = base_instruction;
         auto& start_waypoint = prev_instruction.getWaypoint();
@@ -166,7 +196,7 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
           if (!start_waypoint.as<CartesianWaypointPoly>().hasSeed())
           {
             // Run IK to find solution closest to start
-            KinematicGroupInstructionInfo info(prev_instruction, request, request.instructions.getManipulatorInfo());
+            KinematicGroupInstructionInfo info(prev_instruction, request.instructions.getManipulatorInfo(), kin_cache);
             auto start_seed = getClosestJointSolution(info, request.env_state.getJointValues(manip->getJointNames()));
             start_waypoint.as<CartesianWaypointPoly>().setSeed(
                 tesseract_common::JointState(manip->getJointNames(), start_seed));
@@ -195,20 +225,10 @@ CompositeInstruction SimpleMotionPlanner::processCompositeInstruction(const Comp
       // If a path profile exists for the instruction it should use that instead of the termination profile
       SimplePlannerPlanProfile::ConstPtr plan_profile;
       if (base_instruction.getPathProfile().empty())
-      {
-        std::string profile = getProfileString(name_, base_instruction.getProfile(), request.plan_profile_remapping);
-        plan_profile = getProfile<SimplePlannerPlanProfile>(
-            name_, profile, *request.profiles, std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
-        plan_profile = applyProfileOverrides(name_, profile, plan_profile, base_instruction.getProfileOverrides());
-      }
+        plan_profile = plan_profiles.getProfile(base_instruction.getProfile(), base_instruction.getProfileOverrides());
       else
-      {
-        std::string profile =
-            getProfileString(name_, base_instruction.getPathProfile(), request.plan_profile_remapping);
-        plan_profile = getProfile<SimplePlannerPlanProfile>(
-            name_, profile, *request.profiles, std::make_shared<SimplePlannerLVSNoIKPlanProfile>());
-        plan_profile = applyProfileOverrides(name_, profile, plan_profile, base_instruction.getProfileOverrides());
-      }
+        plan_profile =
+            plan_profiles.getProfile(base_instruction.getPathProfile(), base_instruction.getProfileOverrides());
 
       if (!plan_profile)
         throw std::runtime_error("SimpleMotionPlanner: Invalid profile");
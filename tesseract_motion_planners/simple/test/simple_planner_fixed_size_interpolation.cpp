@@ -30,11 +30,16 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands.h>
 #include <tesseract_motion_planners/simple/simple_motion_planner.h>
+#include <tesseract_motion_planners/simple/interpolation.h>
+#include <tesseract_motion_planners/simple/kinematics_cache.h>
 #include <tesseract_motion_planners/simple/profile/simple_planner_fixed_size_plan_profile.h>
 #include <tesseract_command_language/joint_waypoint.h>
 #include <tesseract_command_language/cartesian_waypoint.h>
 #include <tesseract_command_language/move_instruction.h>
+#include <tesseract_command_language/profile_dictionary.h>
+#include <tesseract_command_language/utils.h>
 #include <tesseract_support/tesseract_support_resource_locator.h>
 
 using namespace tesseract_environment;
@@ -240,6 +245,143 @@ TEST_F(TesseractPlanningSimplePlannerFixedSizeInterpolationUnit, CartCart_JointI
   EXPECT_TRUE(wp2.getTransform().isApprox(final_pose, 1e-3));
 }
 
+TEST_F(TesseractPlanningSimplePlannerFixedSizeInterpolationUnit, KinematicsCache)  // NOLINT
+{
+  PlannerRequest request;
+  request.env = env_;
+  request.env_state = env_->getState();
+
+  SimplePlannerKinematicsCache cache(request);
+  auto joint_group = cache.getJointGroup(manip_info_.manipulator);
+  EXPECT_EQ(joint_group, cache.getJointGroup(manip_info_.manipulator));
+  auto kin_group = cache.getKinematicGroup(manip_info_.manipulator);
+  EXPECT_EQ(kin_group, cache.getKinematicGroup(manip_info_.manipulator));
+  auto frame_signature = cache.getFrameSignature(manip_info_.manipulator);
+  EXPECT_EQ(frame_signature, cache.getFrameSignature(manip_info_.manipulator));
+  EXPECT_TRUE(cache.getTCPOffset(manip_info_).isApprox(env_->findTCPOffset(manip_info_)));
+  EXPECT_TRUE(cache.getWorkingFrameTransform(manip_info_.working_frame)
+                  .isApprox(request.env_state.link_transforms.at(manip_info_.working_frame)));
+  EXPECT_ANY_THROW(cache.getWorkingFrameTransform("does_not_exist"));  // NOLINT
+
+  // Instruction information created from the same cache share the kinematic group
+  JointWaypointPoly wp1{ JointWaypoint(joint_names_, Eigen::VectorXd::Zero(7)) };
+  MoveInstruction instr1(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE", manip_info_);
+  JointWaypointPoly wp2{ JointWaypoint(joint_names_, Eigen::VectorXd::Ones(7)) };
+  MoveInstruction instr2(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE", manip_info_);
+  KinematicGroupInstructionInfo info1(instr1, tesseract_common::ManipulatorInfo(), cache);
+  KinematicGroupInstructionInfo info2(instr2, tesseract_common::ManipulatorInfo(), cache);
+  EXPECT_EQ(info1.manip, kin_group);
+  EXPECT_EQ(info2.manip, kin_group);
+
+  // The frame signature is only needed with an inverse kinematics solution cache
+  EXPECT_TRUE(info1.ik_frame_signature == nullptr);
+  SimplePlannerKinematicsCache ik_cached(request, std::make_shared<IKSolutionCache>());
+  KinematicGroupInstructionInfo info3(instr1, tesseract_common::ManipulatorInfo(), ik_cached);
+  KinematicGroupInstructionInfo info4(instr2, tesseract_common::ManipulatorInfo(), ik_cached);
+  EXPECT_TRUE(info3.ik_frame_signature != nullptr);
+  EXPECT_EQ(info3.ik_frame_signature, info4.ik_frame_signature);
+
+  // Instruction information created from the request use the cache only if it is the planner data of the request
+  EXPECT_TRUE(SimplePlannerKinematicsCache::getFromRequest(request) == nullptr);
+  EXPECT_NE(KinematicGroupInstructionInfo(instr1, request, tesseract_common::ManipulatorInfo()).manip, kin_group);
+
+  InstructionPoly instr3;
+  SimplePlannerFixedSizePlanProfile profile(10, 10);
+  std::vector<MoveInstructionPoly> uncached =
+      profile.generate(instr1, instr1, instr2, instr3, request, tesseract_common::ManipulatorInfo());
+
+  PlannerRequest cached_request(request);
+  auto request_cache = std::make_shared<SimplePlannerKinematicsCache>(cached_request);
+  cached_request.data = request_cache;
+  EXPECT_EQ(SimplePlannerKinematicsCache::getFromRequest(cached_request), request_cache.get());
+  auto request_kin_group = request_cache->getKinematicGroup(manip_info_.manipulator);
+  EXPECT_EQ(KinematicGroupInstructionInfo(instr1, cached_request, tesseract_common::ManipulatorInfo()).manip,
+            request_kin_group);
+
+  // A cache created for another request is not used
+  PlannerRequest other_request(cached_request);
+  EXPECT_TRUE(SimplePlannerKinematicsCache::getFromRequest(other_request) == nullptr);
+
+  // The profile generates the same seed with and without the cache of the request
+  std::vector<MoveInstructionPoly> cached =
+      profile.generate(instr1, instr1, instr2, instr3, cached_request, tesseract_common::ManipulatorInfo());
+  ASSERT_EQ(cached.size(), uncached.size());
+  for (std::size_t i = 0; i < cached.size(); ++i)
+    EXPECT_TRUE(getJointPosition(cached[i].getWaypoint()).isApprox(getJointPosition(uncached[i].getWaypoint())));
+}
+
+TEST_F(TesseractPlanningSimplePlannerFixedSizeInterpolationUnit, IKSolutionCacheEnvironmentState)  // NOLINT
+{
+  // Add a working frame which is moved by a joint that is not part of the manipulator
+  tesseract_scene_graph::Link link("target_frame");
+  tesseract_scene_graph::Joint joint("target_frame_joint");
+  joint.parent_link_name = "base_link";
+  joint.child_link_name = link.getName();
+  joint.type = tesseract_scene_graph::JointType::REVOLUTE;
+  joint.axis = Eigen::Vector3d::UnitZ();
+  joint.parent_to_joint_origin_transform.translation() = Eigen::Vector3d(0.5, 0, 0.5);
+  joint.limits = std::make_shared<tesseract_scene_graph::JointLimits>();
+  joint.limits->lower = -1;
+  joint.limits->upper = 1;
+  joint.limits->velocity = 1;
+  joint.limits->acceleration = 1;
+  EXPECT_TRUE(env_->applyCommand(std::make_shared<AddLinkCommand>(link, joint)));
+
+  tesseract_common::ManipulatorInfo manip_info = manip_info_;
+  manip_info.working_frame = "target_frame";
+
+  JointWaypointPoly wp1{ JointWaypoint(joint_names_, Eigen::VectorXd::Zero(7)) };
+  CartesianWaypointPoly wp2{ CartesianWaypoint(Eigen::Isometry3d::Identity()) };
+  wp2.getTransform().translation() = Eigen::Vector3d(-0.25, 0, 0.5);
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip_info);
+  program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<SimplePlannerPlanProfile>(
+      "SimplePlanner", "TEST_PROFILE", std::make_shared<SimplePlannerFixedSizePlanProfile>(10, 10));
+
+  auto ik_cache = std::make_shared<IKSolutionCache>();
+  SimpleMotionPlanner planner("SimplePlanner");
+  planner.setIKSolutionCache(ik_cache);
+
+  auto solve = [&]() {
+    PlannerRequest request;
+    request.env = env_;
+    request.env_state = env_->getState();
+    request.instructions = program;
+    request.profiles = profiles;
+    PlannerResponse response = planner.solve(request);
+    EXPECT_TRUE(response.successful);
+
+    // The final seed reaches the target in the working frame of the current environment state
+    auto results = response.results.flatten(&moveFilter);
+    const auto& mi = results.back().get().as<MoveInstructionPoly>();
+    const Eigen::VectorXd& position = mi.getWaypoint().as<CartesianWaypointPoly>().getSeed().position;
+    tesseract_common::TransformMap poses = env_->getJointGroup(manip_info_.manipulator)->calcFwdKin(position);
+    Eigen::Isometry3d pose = poses.at("target_frame").inverse() * poses.at(manip_info_.tcp_frame);
+    EXPECT_TRUE(wp2.getTransform().isApprox(pose, 1e-3));
+  };
+
+  solve();
+  const std::size_t misses = ik_cache->getMisses();
+  EXPECT_GT(misses, 0);
+
+  // The same environment state reuses the cached solutions
+  solve();
+  EXPECT_EQ(ik_cache->getMisses(), misses);
+  EXPECT_GT(ik_cache->getHits(), 0);
+
+  // Setting the state moves the working frame without a new revision, the cached solutions must not be used
+  const int revision = env_->getRevision();
+  env_->setState({ "target_frame_joint" }, Eigen::VectorXd::Constant(1, 0.2));
+  EXPECT_EQ(env_->getRevision(), revision);
+  solve();
+  EXPECT_GT(ik_cache->getMisses(), misses);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
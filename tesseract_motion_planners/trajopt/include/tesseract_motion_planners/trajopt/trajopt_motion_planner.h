@@ -33,6 +33,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_motion_planners/core/planner.h>
 #include <tesseract_motion_planners/trajopt/profile/trajopt_profile.h>
+#include <tesseract_motion_planners/trajopt/trajopt_problem_cache.h>
 
 namespace tesseract_planning
 {
@@ -57,6 +58,22 @@ public:
   MotionPlanner::Ptr clone() const override;
 
   virtual std::shared_ptr<trajopt::ProblemConstructionInfo> createProblem(const PlannerRequest& request) const;
+
+  /**
+   * @brief Set the cache used to warm start re-planning of the same program
+   * @details When set, an unchanged request reuses the constructed problem and a request with the same program
+   * signature is seeded from the previous solution and trust region size. Fixed timesteps keep the values of the new
+   * request. The cache is shared with clones of the planner. If nullptr, which is the default, every request is
+   * constructed and solved from its own seed.
+   * @param cache The problem cache
+   */
+  void setProblemCache(TrajOptProblemCache::Ptr cache);
+
+  /** @brief Get the problem cache, which may be nullptr */
+  TrajOptProblemCache::Ptr getProblemCache() const;
+
+protected:
+  TrajOptProblemCache::Ptr problem_cache_;
 };
 
 }  // namespace tesseract_planning
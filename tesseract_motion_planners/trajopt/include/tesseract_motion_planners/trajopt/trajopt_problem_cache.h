@@ -0,0 +1,127 @@
+/**
+ * @file trajopt_problem_cache.h
+ * @brief A cache of constructed TrajOpt problems and solutions used to warm start re-planning
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_TRAJOPT_PROBLEM_CACHE_H
+#define TESSERACT_MOTION_PLANNERS_TRAJOPT_PROBLEM_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <trajopt/problem_description.hpp>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/core/types.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A cache of constructed TrajOpt problems and their last solution
+ * @details When a program is planned repeatedly with small changes, the TrajOptMotionPlanner uses this cache to
+ * reuse the constructed problem when the request is unchanged and to warm start the optimizer from the previous
+ * solution and trust region size when it is not.
+ *
+ * Entries are keyed by the program signature, which is built from the manipulator, profiles and waypoint types of
+ * the move instructions, so programs created from the same template share an entry. An entry is removed while it is
+ * being solved so that concurrent requests never share a problem.
+ */
+class TrajOptProblemCache
+{
+public:
+  using Ptr = std::shared_ptr<TrajOptProblemCache>;
+  using ConstPtr = std::shared_ptr<const TrajOptProblemCache>;
+
+  struct Entry
+  {
+    // LCOV_EXCL_START
+    EIGEN_MAKE_ALIGNED_OPERATOR_NEW
+    // LCOV_EXCL_STOP
+
+    using UPtr = std::unique_ptr<Entry>;
+
+    /** @brief The request the problem was constructed for, including the environment state but not the planner data */
+    PlannerRequest request;
+
+    /** @brief The environment revision the problem was constructed for */
+    int env_revision{ 0 };
+
+    /** @brief The version of the profile dictionary the problem was constructed with */
+    std::size_t profiles_version{ 0 };
+
+    /** @brief The problem construction info */
+    std::shared_ptr<trajopt::ProblemConstructionInfo> pci;
+
+    /** @brief The constructed problem */
+    trajopt::TrajOptProb::Ptr problem;
+
+    /** @brief The last solution */
+    tesseract_common::TrajArray solution;
+
+    /** @brief The trust region size when the last solution converged */
+    double trust_box_size{ 0 };
+
+    /** @brief Check if the problem was constructed for the request and can be solved again */
+    bool isReusable(const PlannerRequest& request) const;
+  };
+
+  /** @param max_size The maximum number of program signatures to keep */
+  explicit TrajOptProblemCache(std::size_t max_size = 16);
+
+  /**
+   * @brief Remove the entry for a signature so it can be solved
+   * @return The entry, otherwise nullptr
+   */
+  Entry::UPtr take(const std::string& signature);
+
+  /**
+   * @brief Store the entry for a signature, replacing any existing entry
+   * @details The least recently stored entry is removed if the cache is full
+   */
+  void put(const std::string& signature, Entry::UPtr entry);
+
+  /** @brief Remove all entries */
+  void clear();
+
+  /** @brief The number of entries */
+  std::size_t size() const;
+
+  /**
+   * @brief Get the program signature of a request
+   * @details Requests with the same signature flatten to the same number of move instructions with the same waypoint
+   * types, profiles and manipulator information, so the solution of one is a valid seed for the other.
+   */
+  static std::string getSignature(const PlannerRequest& request);
+
+private:
+  std::size_t max_size_;
+  mutable std::mutex mutex_;
+  /** @brief The entries with the most recently stored at the front */
+  std::list<std::pair<std::string, Entry::UPtr>> entries_;
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_TRAJOPT_PROBLEM_CACHE_H
@@ -25,6 +25,7 @@
  */
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
 #include <console_bridge/console.h>
 #include <trajopt/plot_callback.hpp>
 #include <trajopt/problem_description.hpp>
@@ -62,7 +63,16 @@ bool TrajOptMotionPlanner::terminate()
 
 void TrajOptMotionPlanner::clear() {}
 
-MotionPlanner::Ptr TrajOptMotionPlanner::clone() const { return std::make_shared<TrajOptMotionPlanner>(name_); }
+MotionPlanner::Ptr TrajOptMotionPlanner::clone() const
+{
+  auto planner = std::make_shared<TrajOptMotionPlanner>(name_);
+  planner->setProblemCache(problem_cache_);
+  return planner;
+}
+
+void TrajOptMotionPlanner::setProblemCache(TrajOptProblemCache::Ptr cache) { problem_cache_ = std::move(cache); }
+
+TrajOptProblemCache::Ptr TrajOptMotionPlanner::getProblemCache() const { return problem_cache_; }
 
 PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
 {
@@ -74,11 +84,26 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
     return response;
   }
 
+  // Look up the previous solve of this program, user provided problems are never cached
+  std::string signature;
+  TrajOptProblemCache::Entry::UPtr cache_entry;
+  if (problem_cache_ != nullptr && request.data == nullptr)
+  {
+    signature = TrajOptProblemCache::getSignature(request);
+    cache_entry = problem_cache_->take(signature);
+  }
+
   std::shared_ptr<trajopt::ProblemConstructionInfo> pci;
+  trajopt::TrajOptProb::Ptr problem;
   if (request.data)
   {
     pci = std::static_pointer_cast<trajopt::ProblemConstructionInfo>(request.data);
   }
+  else if (cache_entry != nullptr && cache_entry->isReusable(request))
+  {
+    pci = cache_entry->pci;
+    problem = cache_entry->problem;
+  }
   else
   {
     try
@@ -92,12 +117,41 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
       response.message = ERROR_INVALID_INPUT;
       return response;
     }
+  }
 
-    response.data = pci;
+  // Seed from the previous solution, keeping the values of fixed timesteps from this request
+  tesseract_common::TrajArray warm_start_traj;
+  if (cache_entry != nullptr && cache_entry->solution.rows() == pci->init_info.data.rows() &&
+      cache_entry->solution.cols() == pci->init_info.data.cols())
+  {
+    warm_start_traj = pci->init_info.data;
+    const std::vector<int>& fixed_steps = pci->basic_info.fixed_timesteps;
+    for (Eigen::Index i = 0; i < warm_start_traj.rows(); ++i)
+    {
+      if (std::find(fixed_steps.begin(), fixed_steps.end(), static_cast<int>(i)) == fixed_steps.end())
+        warm_start_traj.row(i) = cache_entry->solution.row(i);
+    }
   }
+  const bool warm_start = (warm_start_traj.size() > 0);
 
   // Construct Problem
-  trajopt::TrajOptProb::Ptr problem = trajopt::ConstructProblem(*pci);
+  if (problem == nullptr)
+  {
+    if (warm_start)
+      pci->init_info.data = warm_start_traj;
+
+    problem = trajopt::ConstructProblem(*pci);
+  }
+  else if (warm_start)
+  {
+    problem->SetInitTraj(warm_start_traj);
+  }
+
+  // The cache keeps the problem construction info for the next request, so the response gets its own copy
+  if (problem_cache_ != nullptr && request.data == nullptr)
+    response.data = std::make_shared<trajopt::ProblemConstructionInfo>(*pci);
+  else
+    response.data = pci;
 
   // Set Log Level
   if (request.verbose)
@@ -114,6 +168,12 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
 
   opt->setParameters(pci->opt_info);
 
+  // Start from the trust region size the previous solve converged with, it is reduced as the solution converges so
+  // a nearby seed does not need to search the full initial region again
+  if (warm_start)
+    opt->getParameters().trust_box_size = std::clamp(
+        cache_entry->trust_box_size, pci->opt_info.min_trust_box_size, pci->opt_info.trust_box_size);
+
   // Add all callbacks
   for (const sco::Optimizer::Callback& callback : pci->callbacks)
     opt->addCallback(callback);
@@ -143,6 +203,23 @@ PlannerResponse TrajOptMotionPlanner::solve(const PlannerRequest& request) const
     tesseract_common::enforcePositionLimits<double>(traj.row(i), joint_limits);
   }
 
+  // Store the problem and solution for the next request with this signature
+  if (problem_cache_ != nullptr && request.data == nullptr)
+  {
+    if (cache_entry == nullptr)
+      cache_entry = std::make_unique<TrajOptProblemCache::Entry>();
+
+    cache_entry->request = request;
+    cache_entry->request.data = nullptr;
+    cache_entry->env_revision = request.env->getRevision();
+    cache_entry->profiles_version = request.profiles->getVersion();
+    cache_entry->pci = pci;
+    cache_entry->problem = problem;
+    cache_entry->solution = traj;
+    cache_entry->trust_box_size = opt->getParameters().trust_box_size;
+    problem_cache_->put(signature, std::move(cache_entry));
+  }
+
   // Flatten the results to make them easier to process
   response.results = request.instructions;
   auto results_instructions = response.results.flatten(&moveFilter);
@@ -233,6 +310,10 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
   std::vector<Eigen::VectorXd> seed_states;
   seed_states.reserve(move_instructions.size());
 
+  // Resolve the plan profiles once for all instructions
+  ProfileSnapshot<TrajOptPlanProfile> plan_profiles(
+      name_, *request.profiles, request.plan_profile_remapping, std::make_shared<TrajOptDefaultPlanProfile>());
+
   for (int i = 0; i < move_instructions.size(); ++i)
   {
     const auto& move_instruction = move_instructions[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>();
@@ -250,10 +331,8 @@ TrajOptMotionPlanner::createProblem(const PlannerRequest& request) const
       throw std::runtime_error("TrajOpt, working_frame is empty!");
 
     // Get Plan Profile
-    std::string profile = getProfileString(name_, move_instruction.getProfile(), request.plan_profile_remapping);
-    TrajOptPlanProfile::ConstPtr cur_plan_profile = getProfile<TrajOptPlanProfile>(
-        name_, profile, *request.profiles, std::make_shared<TrajOptDefaultPlanProfile>());
-    cur_plan_profile = applyProfileOverrides(name_, profile, cur_plan_profile, move_instruction.getProfileOverrides());
+    TrajOptPlanProfile::ConstPtr cur_plan_profile =
+        plan_profiles.getProfile(move_instruction.getProfile(), move_instruction.getProfileOverrides());
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
 
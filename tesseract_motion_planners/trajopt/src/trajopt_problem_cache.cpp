@@ -0,0 +1,144 @@
+/**
+ * @file trajopt_problem_cache.cpp
+ * @brief A cache of constructed TrajOpt problems and solutions used to warm start re-planning
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/trajopt/trajopt_problem_cache.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+#include <tesseract_command_language/poly/joint_waypoint_poly.h>
+
+namespace tesseract_planning
+{
+bool TrajOptProblemCache::Entry::isReusable(const PlannerRequest& other) const
+{
+  if (problem == nullptr || other.env == nullptr || other.env != request.env)
+    return false;
+
+  if (other.env->getRevision() != env_revision)
+    return false;
+
+  // The profiles may have been changed in place since the problem was constructed
+  if (other.profiles == nullptr || other.profiles != request.profiles ||
+      other.profiles->getVersion() != profiles_version)
+    return false;
+
+  // The collision terms capture the state of the joints which are not part of the manipulator, and setting the state
+  // of the environment does not change its revision
+  if (other.env_state.joints != request.env_state.joints)
+    return false;
+
+  if (other.plan_profile_remapping != request.plan_profile_remapping ||
+      other.composite_profile_remapping != request.composite_profile_remapping)
+    return false;
+
+  return (other.instructions == request.instructions);
+}
+
+TrajOptProblemCache::TrajOptProblemCache(std::size_t max_size) : max_size_(std::max<std::size_t>(max_size, 1)) {}
+
+TrajOptProblemCache::Entry::UPtr TrajOptProblemCache::take(const std::string& signature)
+{
+  std::scoped_lock lock(mutex_);
+  auto it =
+      std::find_if(entries_.begin(), entries_.end(), [&signature](const auto& e) { return e.first == signature; });
+  if (it == entries_.end())
+    return nullptr;
+
+  Entry::UPtr entry = std::move(it->second);
+  entries_.erase(it);
+  return entry;
+}
+
+void TrajOptProblemCache::put(const std::string& signature, Entry::UPtr entry)
+{
+  std::scoped_lock lock(mutex_);
+  auto it =
+      std::find_if(entries_.begin(), entries_.end(), [&signature](const auto& e) { return e.first == signature; });
+  if (it != entries_.end())
+    entries_.erase(it);
+
+  entries_.emplace_front(signature, std::move(entry));
+  if (entries_.size() > max_size_)
+    entries_.pop_back();
+}
+
+void TrajOptProblemCache::clear()
+{
+  std::scoped_lock lock(mutex_);
+  entries_.clear();
+}
+
+std::size_t TrajOptProblemCache::size() const
+{
+  std::scoped_lock lock(mutex_);
+  return entries_.size();
+}
+
+std::string TrajOptProblemCache::getSignature(const PlannerRequest& request)
+{
+  const tesseract_common::ManipulatorInfo& composite_mi = request.instructions.getManipulatorInfo();
+
+  std::string signature;
+  signature.append(request.instructions.getProfile());
+  signature.append("|");
+  signature.append(composite_mi.manipulator);
+  signature.append("|");
+  signature.append(composite_mi.manipulator_ik_solver);
+
+  for (const auto& instruction : request.instructions.flatten(&moveFilter))
+  {
+    const auto& move_instruction = instruction.get().as<MoveInstructionPoly>();
+    const auto& wp = move_instruction.getWaypoint();
+
+    signature.append("|");
+    if (wp.isCartesianWaypoint())
+      signature.append("C");
+    else if (wp.isJointWaypoint())
+      signature.append(wp.as<JointWaypointPoly>().isConstrained() ? "J" : "U");
+    else
+      signature.append("S");
+
+    signature.append(std::to_string(static_cast<int>(move_instruction.getMoveType())));
+    signature.append(move_instruction.getProfile());
+
+    const tesseract_common::ManipulatorInfo& mi = move_instruction.getManipulatorInfo();
+    if (!mi.empty())
+    {
+      signature.append(":");
+      signature.append(mi.manipulator);
+      signature.append(":");
+      signature.append(mi.working_frame);
+      signature.append(":");
+      signature.append(mi.tcp_frame);
+    }
+  }
+
+  return signature;
+}
+
+}  // namespace tesseract_planning
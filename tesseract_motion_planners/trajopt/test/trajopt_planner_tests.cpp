@@ -31,10 +31,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_common/types.h>
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands/add_link_command.h>
 
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/joint_waypoint.h>
 #include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/state_waypoint.h>
 #include <tesseract_command_language/move_instruction.h>
 
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
@@ -719,6 +721,130 @@ TEST_F(TesseractPlanningTrajoptUnit, TrajoptArrayJointCost)  // NOLINT
       (tesseract_tests::vectorContainsType<sco::Cost::Ptr, trajopt::TrajOptCostFromErrFunc>(problem->getCosts())));
 }
 
+// This test checks re-planning the same program with a problem cache
+TEST_F(TesseractPlanningTrajoptUnit, TrajoptProblemCache)  // NOLINT
+{
+  // Add a joint which is not part of the manipulator
+  Link rail_link("rail_link");
+  Joint rail_joint("rail_joint");
+  rail_joint.type = JointType::PRISMATIC;
+  rail_joint.parent_link_name = env_->getRootLinkName();
+  rail_joint.child_link_name = rail_link.getName();
+  rail_joint.axis = Eigen::Vector3d::UnitX();
+  rail_joint.limits = std::make_shared<JointLimits>();
+  rail_joint.limits->lower = -1;
+  rail_joint.limits->upper = 1;
+  rail_joint.limits->velocity = 1;
+  rail_joint.limits->acceleration = 1;
+  EXPECT_TRUE(env_->applyCommand(std::make_shared<AddLinkCommand>(rail_link, rail_joint)));
+
+  auto joint_group = env_->getJointGroup(manip.manipulator);
+  std::vector<std::string> joint_names = joint_group->getJointNames();
+  auto cur_state = env_->getState();
+
+  auto createProgram = [&](double goal) {
+    JointWaypointPoly wp1{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+    wp1.getPosition() << 0, 0, 0, -1.57, 0, 0, 0;
+
+    JointWaypointPoly wp2{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+    wp2.getPosition() << 0, 0, 0, goal, 0, 0, 0;
+
+    CompositeInstruction program("TEST_PROFILE");
+    program.setManipulatorInfo(manip);
+    program.appendMoveInstruction(MoveInstruction(wp1, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+    program.appendMoveInstruction(MoveInstruction(wp2, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+    return generateInterpolatedProgram(program, cur_state, env_, 3.14, 1.0, 3.14, 10);
+  };
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<TrajOptPlanProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultPlanProfile>());
+  profiles->addProfile<TrajOptCompositeProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultCompositeProfile>());
+
+  auto cache = std::make_shared<TrajOptProblemCache>();
+  TrajOptMotionPlanner test_planner(TRAJOPT_DEFAULT_NAMESPACE);
+  test_planner.setProblemCache(cache);
+  EXPECT_EQ(test_planner.getProblemCache(), cache);
+  EXPECT_EQ(std::dynamic_pointer_cast<TrajOptMotionPlanner>(test_planner.clone())->getProblemCache(), cache);
+
+  PlannerRequest request;
+  request.instructions = createProgram(1.57);
+  request.env = env_;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+
+  // Programs which only differ by their targets share a signature
+  PlannerRequest other_request = request;
+  other_request.instructions = createProgram(1.0);
+  EXPECT_EQ(TrajOptProblemCache::getSignature(request), TrajOptProblemCache::getSignature(other_request));
+
+  const std::string signature = TrajOptProblemCache::getSignature(request);
+  auto getCachedProblem = [&cache, &signature]() {
+    TrajOptProblemCache::Entry::UPtr entry = cache->take(signature);
+    trajopt::TrajOptProb::Ptr problem = entry->problem;
+    std::shared_ptr<trajopt::ProblemConstructionInfo> pci = entry->pci;
+    cache->put(signature, std::move(entry));
+    return std::make_pair(problem, pci);
+  };
+
+  PlannerResponse response1 = test_planner.solve(request);
+  EXPECT_TRUE(response1.successful);
+  EXPECT_EQ(cache->size(), 1);
+  auto cached1 = getCachedProblem();
+
+  // The response gets a copy of the problem construction info the cache keeps
+  EXPECT_NE(response1.data, nullptr);
+  EXPECT_NE(response1.data, cached1.second);
+
+  // An unchanged request reuses the constructed problem
+  PlannerResponse response2 = test_planner.solve(request);
+  EXPECT_TRUE(response2.successful);
+  EXPECT_EQ(getCachedProblem().first, cached1.first);
+  EXPECT_NE(response2.data, response1.data);
+  EXPECT_EQ(cache->size(), 1);
+
+  // Changing only the state of a joint which is not part of the manipulator constructs a new problem
+  PlannerRequest moved_request = request;
+  moved_request.env_state = env_->getState({ "rail_joint" }, Eigen::VectorXd::Constant(1, 0.5));
+  EXPECT_TRUE(moved_request.env_state.getJointValues(joint_names).isApprox(cur_state.getJointValues(joint_names)));
+  PlannerResponse moved_response = test_planner.solve(moved_request);
+  EXPECT_TRUE(moved_response.successful);
+  auto moved_cached = getCachedProblem();
+  EXPECT_NE(moved_cached.first, cached1.first);
+  EXPECT_EQ(cache->size(), 1);
+
+  // Returning to the previous state constructs a new problem again
+  PlannerResponse response2b = test_planner.solve(request);
+  EXPECT_TRUE(response2b.successful);
+  auto cached2 = getCachedProblem();
+  EXPECT_NE(cached2.first, moved_cached.first);
+
+  // Changing the profiles in place constructs a new problem
+  const std::size_t profiles_version = profiles->getVersion();
+  profiles->addProfile<TrajOptPlanProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultPlanProfile>());
+  EXPECT_NE(profiles->getVersion(), profiles_version);
+  PlannerResponse response3 = test_planner.solve(request);
+  EXPECT_TRUE(response3.successful);
+  auto cached3 = getCachedProblem();
+  EXPECT_NE(cached3.first, cached2.first);
+  EXPECT_EQ(cache->size(), 1);
+
+  // A changed target constructs a new problem seeded from the previous solution
+  PlannerResponse response4 = test_planner.solve(other_request);
+  EXPECT_TRUE(response4.successful);
+  EXPECT_NE(getCachedProblem().first, cached3.first);
+  EXPECT_EQ(cache->size(), 1);
+
+  auto results = response4.results.flatten(&moveFilter);
+  const auto& last = results.back().get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+  EXPECT_NEAR(last.getPosition()(3), 1.0, 1e-3);
+
+  cache->clear();
+  EXPECT_EQ(cache->size(), 0);
+}
+
 TEST(TesseractPlanningTrajoptSerializeUnit, SerializeTrajoptDefaultCompositeToXml)  // NOLINT
 {
   // Write program to file
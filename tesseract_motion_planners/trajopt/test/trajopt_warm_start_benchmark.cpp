@@ -0,0 +1,147 @@
+/**
+ * @file trajopt_warm_start_benchmark.cpp
+ * @brief Benchmark re-planning a raster with and without the TrajOpt problem cache
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <array>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_command_language/composite_instruction.h>
+#include <tesseract_command_language/joint_waypoint.h>
+#include <tesseract_command_language/cartesian_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+#include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
+#include <tesseract_motion_planners/trajopt/profile/trajopt_default_plan_profile.h>
+#include <tesseract_motion_planners/trajopt/profile/trajopt_default_composite_profile.h>
+#include <tesseract_motion_planners/simple/interpolation.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+static const std::string TRAJOPT_DEFAULT_NAMESPACE = "TrajOptMotionPlannerTask";
+
+/** @brief The number of times the raster is planned */
+static const int NUM_REPLANS = 100;
+
+/** @brief The number of cartesian waypoints in the raster */
+static const int NUM_RASTER_POINTS = 10;
+
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+/** @brief Create a seeded raster along the x axis, shifted along the y axis by the offset */
+static PlannerRequest createRequest(const Environment::Ptr& env, double offset)
+{
+  tesseract_common::ManipulatorInfo manip;
+  manip.tcp_frame = "tool0";
+  manip.working_frame = "base_link";
+  manip.manipulator = "manipulator";
+  manip.manipulator_ik_solver = "KDLInvKinChainLMA";
+
+  std::vector<std::string> joint_names = env->getJointGroup(manip.manipulator)->getJointNames();
+  tesseract_scene_graph::SceneState cur_state = env->getState();
+
+  JointWaypointPoly start_wp{ JointWaypoint(joint_names, Eigen::VectorXd::Zero(7)) };
+  start_wp.getPosition() << 0, 0, 0, -1.57, 0, 0, 0;
+
+  CompositeInstruction program("TEST_PROFILE");
+  program.setManipulatorInfo(manip);
+  program.appendMoveInstruction(MoveInstruction(start_wp, MoveInstructionType::FREESPACE, "TEST_PROFILE"));
+  for (int i = 0; i < NUM_RASTER_POINTS; ++i)
+  {
+    double x = -0.2 + (0.4 * i) / (NUM_RASTER_POINTS - 1);
+    CartesianWaypointPoly wp{ CartesianWaypoint(Eigen::Isometry3d::Identity() *
+                                                Eigen::Translation3d(x, 0.4 + offset, 0.2) *
+                                                Eigen::Quaterniond(0, 0, 1.0, 0)) };
+    auto type = (i == 0) ? MoveInstructionType::FREESPACE : MoveInstructionType::LINEAR;
+    program.appendMoveInstruction(MoveInstruction(wp, type, "TEST_PROFILE"));
+  }
+
+  auto profiles = std::make_shared<ProfileDictionary>();
+  profiles->addProfile<TrajOptPlanProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultPlanProfile>());
+  profiles->addProfile<TrajOptCompositeProfile>(
+      TRAJOPT_DEFAULT_NAMESPACE, "TEST_PROFILE", std::make_shared<TrajOptDefaultCompositeProfile>());
+
+  PlannerRequest request;
+  request.instructions = generateInterpolatedProgram(program, cur_state, env, 3.14, 1.0, 3.14, 5);
+  request.env = env;
+  request.env_state = cur_state;
+  request.profiles = profiles;
+  return request;
+}
+
+/**
+ * @brief Re-plan the raster, alternating between two nearby rasters if shifted
+ * @details An unchanged raster reuses the cached problem, a shifted raster is constructed and warm started
+ */
+static void BM_TrajOptReplanRaster(benchmark::State& state, bool use_cache, bool shifted)
+{
+  Environment::Ptr env = getEnvironment();
+  std::array<PlannerRequest, 2> requests{ createRequest(env, 0), createRequest(env, shifted ? 0.005 : 0) };
+  requests[1].profiles = requests[0].profiles;
+
+  TrajOptMotionPlanner planner(TRAJOPT_DEFAULT_NAMESPACE);
+  if (use_cache)
+    planner.setProblemCache(std::make_shared<TrajOptProblemCache>());
+
+  std::size_t cnt{ 0 };
+  std::size_t failed{ 0 };
+  for (auto _ : state)
+  {
+    PlannerResponse response = planner.solve(requests[cnt++ % 2]);
+    if (!response.successful)
+      ++failed;
+
+    benchmark::DoNotOptimize(response);
+  }
+
+  state.counters["failed"] = static_cast<double>(failed);
+}
+
+BENCHMARK_CAPTURE(BM_TrajOptReplanRaster, Cold_Unchanged, false, false)
+    ->Iterations(NUM_REPLANS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TrajOptReplanRaster, Cached_Unchanged, true, false)
+    ->Iterations(NUM_REPLANS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TrajOptReplanRaster, Cold_Shifted, false, true)
+    ->Iterations(NUM_REPLANS)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TrajOptReplanRaster, WarmStart_Shifted, true, true)
+    ->Iterations(NUM_REPLANS)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,179 @@
+/**
+ * @file trajopt_ifopt_online_planner.h
+ * @brief A TrajOpt IFOPT planner that keeps its problem and solver between re-plans
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_ONLINE_PLANNER_H
+#define TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_ONLINE_PLANNER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <chrono>
+#include <memory>
+#include <vector>
+#include <Eigen/Geometry>
+#include <trajopt_ifopt/constraints/cartesian_position_constraint.h>
+#include <trajopt_sqp/osqp_eigen_solver.h>
+#include <trajopt_sqp/trust_region_sqp_solver.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_common/types.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_problem.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Re-plans a TrajOpt IFOPT problem in a loop as its start state and target change
+ * @details TrajOptIfoptMotionPlanner::solve builds the NLP, its variables and the QP solver on every call. This planner
+ * is constructed once from a problem (typically from TrajOptIfoptMotionPlanner::createProblem) and keeps the NLP, the
+ * JointPosition variables and the QP solver alive. Each call to replan steps the SQP solver from the previous solution
+ * until it converges or the iteration or time budget is exhausted.
+ *
+ * The start state and a joint target are pinned through the bounds of the first and last variable sets, so the
+ * problem should not carry a joint position term on the waypoints that are updated. Cartesian targets are updated
+ * through the constraints registered with addTargetPoseConstraint.
+ *
+ * @note This is not thread safe; each control loop should own its planner.
+ */
+class TrajOptIfoptOnlinePlanner
+{
+public:
+  using Ptr = std::shared_ptr<TrajOptIfoptOnlinePlanner>;
+  using ConstPtr = std::shared_ptr<const TrajOptIfoptOnlinePlanner>;
+
+  /**
+   * @brief Construct the planner and initialize the solver
+   * @param problem The problem to re-plan, nlp->setup() must already have been called
+   * @param verbose Enable solver output
+   */
+  TrajOptIfoptOnlinePlanner(std::shared_ptr<TrajOptIfoptProblem> problem, bool verbose = false);
+  ~TrajOptIfoptOnlinePlanner() = default;
+  TrajOptIfoptOnlinePlanner(const TrajOptIfoptOnlinePlanner&) = delete;
+  TrajOptIfoptOnlinePlanner& operator=(const TrajOptIfoptOnlinePlanner&) = delete;
+  TrajOptIfoptOnlinePlanner(TrajOptIfoptOnlinePlanner&&) = delete;
+  TrajOptIfoptOnlinePlanner& operator=(TrajOptIfoptOnlinePlanner&&) = delete;
+
+  /**
+   * @brief Set the maximum number of SQP steps taken by a single replan
+   * @param max_iterations The maximum number of steps, must be greater than zero
+   */
+  void setMaxIterations(int max_iterations);
+  int getMaxIterations() const;
+
+  /**
+   * @brief Set the time budget of a single replan
+   * @details The budget is checked between SQP steps, so a replan may overrun it by the duration of one step.
+   * @param time_budget The time budget, zero disables it
+   */
+  void setTimeBudget(std::chrono::nanoseconds time_budget);
+  std::chrono::nanoseconds getTimeBudget() const;
+
+  /**
+   * @brief Set the trust region size the solver is reset to before each replan
+   * @details The constraint penalties and the solution are kept between re-plans, only the trust region is reset.
+   * @param box_size The trust region size
+   */
+  void setBoxSize(double box_size);
+  double getBoxSize() const;
+
+  /**
+   * @brief Pin the first waypoint to a new start state
+   * @details The remaining waypoints of the previous solution are kept as the warm start.
+   * @param start_state The start joint values
+   */
+  void setStartState(const Eigen::Ref<const Eigen::VectorXd>& start_state);
+
+  /**
+   * @brief Pin the last waypoint to a joint target
+   * @param target_state The target joint values
+   */
+  void setTargetState(const Eigen::Ref<const Eigen::VectorXd>& target_state);
+
+  /**
+   * @brief Register a cartesian target constraint that is part of the problem
+   * @param constraint The constraint, it must already have been added to the problem's NLP
+   */
+  void addTargetPoseConstraint(trajopt_ifopt::CartPosConstraint::Ptr constraint);
+
+  /**
+   * @brief Update the target pose of all registered cartesian target constraints
+   * @param target_pose The target pose relative to the constraints' working frame
+   */
+  void setTargetPose(const Eigen::Isometry3d& target_pose);
+
+  /**
+   * @brief Re-plan from the previous solution
+   * @return True if the solver converged within the budget, otherwise the best solution found so far is kept
+   */
+  bool replan();
+
+  /** @brief The number of SQP steps taken by the last replan */
+  int getIterations() const;
+
+  /** @brief The status of the solver after the last replan */
+  trajopt_sqp::SQPStatus getStatus() const;
+
+  /** @brief Get the current trajectory, one row per waypoint */
+  tesseract_common::TrajArray getTrajectory() const;
+
+  /** @brief Get the problem being re-planned */
+  const std::shared_ptr<TrajOptIfoptProblem>& getProblem() const;
+
+protected:
+  /**
+   * @brief Trust region SQP solver which can be restarted after the problem changed
+   * @details TrustRegionSQPSolver::init also resets the constraint penalties and the solver results, which is only
+   * needed once.
+   */
+  class Solver : public trajopt_sqp::TrustRegionSQPSolver
+  {
+  public:
+    using trajopt_sqp::TrustRegionSQPSolver::TrustRegionSQPSolver;
+
+    /**
+     * @brief Restart the solver from the current variable values of the problem
+     * @param box_size The trust region size
+     * @param update_merit Re-evaluate the merit of the current variable values because the problem changed
+     */
+    void restart(double box_size, bool update_merit);
+  };
+
+  std::shared_ptr<TrajOptIfoptProblem> problem_;
+  std::shared_ptr<trajopt_sqp::OSQPEigenSolver> qp_solver_;
+  Solver solver_;
+  std::vector<trajopt_ifopt::CartPosConstraint::Ptr> target_pose_constraints_;
+
+  int max_iterations_{ 1 };
+  std::chrono::nanoseconds time_budget_{ 0 };
+  double box_size_{ 0.01 };
+  int iterations_{ 0 };
+
+  /** @brief Set when the problem was changed outside of the solver and the merit of the solution is out of date */
+  bool update_merit_{ false };
+
+  /** @brief Pin a variable set to the provided joint values */
+  void pinVariable(std::size_t index, const Eigen::Ref<const Eigen::VectorXd>& values);
+};
+
+}  // namespace tesseract_planning
+#endif  // TESSERACT_MOTION_PLANNERS_TRAJOPT_IFOPT_ONLINE_PLANNER_H
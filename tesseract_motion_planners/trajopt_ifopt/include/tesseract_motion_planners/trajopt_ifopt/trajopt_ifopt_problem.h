@@ -63,7 +63,9 @@ struct TrajOptIfoptProblem
   std::vector<trajopt_sqp::SQPCallback::Ptr> callbacks;
 
   trajopt_sqp::QPProblem::Ptr nlp;
-  std::vector<trajopt_ifopt::JointPosition::ConstPtr> vars;
+
+  /** @brief The variable sets of the nlp in waypoint order, their bounds may be changed between solves */
+  std::vector<trajopt_ifopt::JointPosition::Ptr> vars;
 };
 
 }  // namespace tesseract_planning
@@ -236,6 +236,10 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
   // Flatten the input for planning
   auto move_instructions = request.instructions.flatten(&moveFilter);
 
+  // Resolve the plan profiles once for all instructions
+  ProfileSnapshot<TrajOptIfoptPlanProfile> plan_profiles(
+      name_, *request.profiles, request.plan_profile_remapping, std::make_shared<TrajOptIfoptDefaultPlanProfile>());
+
   // ----------------
   // Translate TCL for MoveInstructions
   // ----------------
@@ -256,10 +260,8 @@ std::shared_ptr<TrajOptIfoptProblem> TrajOptIfoptMotionPlanner::createProblem(co
       throw std::runtime_error("TrajOpt, working_frame is empty!");
 
     // Get Plan Profile
-    std::string profile = getProfileString(name_, move_instruction.getProfile(), request.plan_profile_remapping);
-    TrajOptIfoptPlanProfile::ConstPtr cur_plan_profile = getProfile<TrajOptIfoptPlanProfile>(
-        name_, profile, *request.profiles, std::make_shared<TrajOptIfoptDefaultPlanProfile>());
-    cur_plan_profile = applyProfileOverrides(name_, profile, cur_plan_profile, move_instruction.getProfileOverrides());
+    TrajOptIfoptPlanProfile::ConstPtr cur_plan_profile =
+        plan_profiles.getProfile(move_instruction.getProfile(), move_instruction.getProfileOverrides());
     if (!cur_plan_profile)
       throw std::runtime_error("TrajOptMotionPlanner: Invalid profile");
 
@@ -0,0 +1,196 @@
+/**
+ * @file trajopt_ifopt_online_planner.cpp
+ * @brief A TrajOpt IFOPT planner that keeps its problem and solver between re-plans
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <console_bridge/console.h>
+#include <stdexcept>
+#include <trajopt_sqp/qp_problem.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_online_planner.h>
+
+namespace tesseract_planning
+{
+TrajOptIfoptOnlinePlanner::TrajOptIfoptOnlinePlanner(std::shared_ptr<TrajOptIfoptProblem> problem, bool verbose)
+  : problem_(std::move(problem)), qp_solver_(std::make_shared<trajopt_sqp::OSQPEigenSolver>()), solver_(qp_solver_)
+{
+  if (problem_ == nullptr || problem_->nlp == nullptr)
+    throw std::runtime_error("TrajOptIfoptOnlinePlanner, problem is not valid!");
+
+  if (problem_->vars.empty())
+    throw std::runtime_error("TrajOptIfoptOnlinePlanner, problem has no variables!");
+
+  // Same settings as TrajOptIfoptMotionPlanner::solve, warm start is what makes the re-plans cheap
+  qp_solver_->solver_.settings()->setVerbosity(verbose);
+  qp_solver_->solver_.settings()->setWarmStart(true);
+  qp_solver_->solver_.settings()->setPolish(true);
+  qp_solver_->solver_.settings()->setAdaptiveRho(false);
+  qp_solver_->solver_.settings()->setMaxIteration(8192);
+  qp_solver_->solver_.settings()->setAbsoluteTolerance(1e-4);
+  qp_solver_->solver_.settings()->setRelativeTolerance(1e-6);
+
+  solver_.params = problem_->opt_info;
+  box_size_ = problem_->opt_info.initial_trust_box_size;
+
+  for (const trajopt_sqp::SQPCallback::Ptr& callback : problem_->callbacks)
+    solver_.registerCallback(callback);
+
+  solver_.verbose = verbose;
+  solver_.params.initial_trust_box_size = box_size_;
+  solver_.init(problem_->nlp);
+}
+
+void TrajOptIfoptOnlinePlanner::setMaxIterations(int max_iterations)
+{
+  if (max_iterations < 1)
+    throw std::runtime_error("TrajOptIfoptOnlinePlanner, max iterations must be greater than zero!");
+
+  max_iterations_ = max_iterations;
+}
+
+int TrajOptIfoptOnlinePlanner::getMaxIterations() const { return max_iterations_; }
+
+void TrajOptIfoptOnlinePlanner::setTimeBudget(std::chrono::nanoseconds time_budget) { time_budget_ = time_budget; }
+
+std::chrono::nanoseconds TrajOptIfoptOnlinePlanner::getTimeBudget() const { return time_budget_; }
+
+void TrajOptIfoptOnlinePlanner::setBoxSize(double box_size) { box_size_ = box_size; }
+
+double TrajOptIfoptOnlinePlanner::getBoxSize() const { return box_size_; }
+
+void TrajOptIfoptOnlinePlanner::setStartState(const Eigen::Ref<const Eigen::VectorXd>& start_state)
+{
+  pinVariable(0, start_state);
+}
+
+void TrajOptIfoptOnlinePlanner::setTargetState(const Eigen::Ref<const Eigen::VectorXd>& target_state)
+{
+  pinVariable(problem_->vars.size() - 1, target_state);
+}
+
+void TrajOptIfoptOnlinePlanner::addTargetPoseConstraint(trajopt_ifopt::CartPosConstraint::Ptr constraint)
+{
+  if (constraint == nullptr)
+    throw std::runtime_error("TrajOptIfoptOnlinePlanner, target pose constraint is a nullptr!");
+
+  target_pose_constraints_.push_back(std::move(constraint));
+}
+
+void TrajOptIfoptOnlinePlanner::setTargetPose(const Eigen::Isometry3d& target_pose)
+{
+  if (target_pose_constraints_.empty())
+    CONSOLE_BRIDGE_logWarn("TrajOptIfoptOnlinePlanner, setTargetPose called without a target pose constraint");
+
+  for (const auto& constraint : target_pose_constraints_)
+    constraint->SetTargetPose(target_pose);
+
+  // The merit of the previous solution no longer matches the problem
+  update_merit_ = true;
+}
+
+bool TrajOptIfoptOnlinePlanner::replan()
+{
+  // Reset the trust region since it shrinks towards zero as the previous solution converged
+  solver_.restart(box_size_, update_merit_);
+  update_merit_ = false;
+
+  const auto start = std::chrono::steady_clock::now();
+  iterations_ = 0;
+  while (iterations_ < max_iterations_)
+  {
+    solver_.stepSQPSolver();
+    ++iterations_;
+
+    if (solver_.getStatus() == trajopt_sqp::SQPStatus::NLP_CONVERGED)
+      break;
+
+    if (time_budget_.count() > 0 && (std::chrono::steady_clock::now() - start) >= time_budget_)
+      break;
+  }
+
+  // Leave the problem at the best solution so the next replan is warm started from it
+  const Eigen::VectorXd& x = solver_.getResults().best_var_vals;
+  problem_->nlp->setVariables(x.data());
+
+  return (solver_.getStatus() == trajopt_sqp::SQPStatus::NLP_CONVERGED);
+}
+
+int TrajOptIfoptOnlinePlanner::getIterations() const { return iterations_; }
+
+trajopt_sqp::SQPStatus TrajOptIfoptOnlinePlanner::getStatus() const { return solver_.getStatus(); }
+
+tesseract_common::TrajArray TrajOptIfoptOnlinePlanner::getTrajectory() const
+{
+  Eigen::VectorXd x = problem_->nlp->getVariableValues();
+  return Eigen::Map<tesseract_common::TrajArray>(x.data(),
+                                                 static_cast<Eigen::Index>(problem_->vars.size()),
+                                                 static_cast<Eigen::Index>(problem_->vars[0]->GetValues().size()));
+}
+
+const std::shared_ptr<TrajOptIfoptProblem>& TrajOptIfoptOnlinePlanner::getProblem() const { return problem_; }
+
+void TrajOptIfoptOnlinePlanner::pinVariable(std::size_t index, const Eigen::Ref<const Eigen::VectorXd>& values)
+{
+  const Eigen::Index dof = problem_->vars[index]->GetValues().size();
+  if (values.size() != dof)
+    throw std::runtime_error("TrajOptIfoptOnlinePlanner, joint values do not match the number of joints!");
+
+  // The variable sets are stored in waypoint order, see TrajOptIfoptMotionPlanner::createProblem
+  Eigen::VectorXd x = problem_->nlp->getVariableValues();
+  x.segment(static_cast<Eigen::Index>(index) * dof, dof) = values;
+  problem_->nlp->setVariables(x.data());
+
+  // The NLP reads the bounds of its variables on every convexification
+  Eigen::MatrixX2d bounds(dof, 2);
+  bounds.col(0) = values;
+  bounds.col(1) = values;
+  problem_->vars[index]->SetBounds(bounds);
+
+  update_merit_ = true;
+}
+
+void TrajOptIfoptOnlinePlanner::Solver::restart(double box_size, bool update_merit)
+{
+  setBoxSize(box_size);
+  status_ = trajopt_sqp::SQPStatus::RUNNING;
+
+  // The iteration limits apply to each replan
+  results_.overall_iteration = 0;
+  results_.penalty_iteration = 0;
+  results_.convexify_iteration = 0;
+  results_.trust_region_iteration = 0;
+
+  if (!update_merit)
+    return;
+
+  // The constraint penalties are kept, only the solution and its merit are updated from the changed problem
+  results_.best_var_vals = qp_problem_->getVariableValues();
+  results_.best_exact_merit = qp_problem_->evaluateTotalExactCost(results_.best_var_vals);
+  results_.best_costs = qp_problem_->getExactCosts();
+  results_.best_constraint_violations = qp_problem_->getExactConstraintViolations();
+}
+
+}  // namespace tesseract_planning
@@ -0,0 +1,251 @@
+/**
+ * @file trajopt_ifopt_online_benchmark.cpp
+ * @brief Benchmark the re-plan latency of the online TrajOpt IFOPT planner
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <vector>
+#include <trajopt_sqp/trajopt_qp_problem.h>
+#include <trajopt_sqp/trust_region_sqp_solver.h>
+#include <trajopt_sqp/osqp_eigen_solver.h>
+#include <trajopt_ifopt/utils/ifopt_utils.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_environment/environment.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_online_planner.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_utils.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+/** @brief The number of re-plans, each moves the target and advances the start along the previous solution */
+static const int NUM_REPLANS = 500;
+
+/** @brief The number of waypoints in the trajectory */
+static const int NUM_STEPS = 12;
+
+static Environment::Ptr getEnvironment()
+{
+  auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+  auto env = std::make_shared<Environment>();
+  tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+  tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+  env->init(urdf_path, srdf_path, locator);
+  return env;
+}
+
+/** @brief The target joint state the target pose is computed from */
+static Eigen::VectorXd getTargetState()
+{
+  Eigen::VectorXd target(7);
+  target << 0.5, 0.5, 0, -1.0, 0, 0.5, 0;
+  return target;
+}
+
+/** @brief The target pose, moving on a small circle as the re-plan count increases */
+static Eigen::Isometry3d getTargetPose(const Eigen::Isometry3d& base_pose, int cnt)
+{
+  double angle = 0.05 * cnt;
+  return Eigen::Translation3d(0.05 * std::cos(angle), 0.05 * std::sin(angle), 0) * base_pose;
+}
+
+/**
+ * @brief Create a problem from the start state to a cartesian target with a velocity cost and collision costs
+ * @details The start state is pinned through the variable bounds so the online planner can update it
+ */
+static std::shared_ptr<TrajOptIfoptProblem> createProblem(const Environment::Ptr& env,
+                                                          const std::vector<Eigen::VectorXd>& initial_states,
+                                                          const Eigen::Isometry3d& target_pose,
+                                                          trajopt_ifopt::CartPosConstraint::Ptr& target_constraint)
+{
+  tesseract_common::ManipulatorInfo manip_info("manipulator", "base_link", "tool0");
+
+  auto problem = std::make_shared<TrajOptIfoptProblem>();
+  problem->environment = env;
+  problem->env_state = env->getState();
+  problem->manip = env->getJointGroup(manip_info.manipulator);
+  problem->nlp = std::make_shared<trajopt_sqp::TrajOptQPProblem>();
+
+  const Eigen::MatrixX2d joint_limits = problem->manip->getLimits().joint_limits;
+  for (std::size_t i = 0; i < initial_states.size(); ++i)
+  {
+    auto var = std::make_shared<trajopt_ifopt::JointPosition>(
+        initial_states[i], problem->manip->getJointNames(), "Joint_Position_" + std::to_string(i));
+    if (i == 0)
+    {
+      Eigen::MatrixX2d start_bounds(initial_states[i].size(), 2);
+      start_bounds << initial_states[i], initial_states[i];
+      var->SetBounds(start_bounds);
+    }
+    else
+    {
+      var->SetBounds(joint_limits);
+    }
+    problem->vars.push_back(var);
+    problem->nlp->addVariableSet(var);
+  }
+
+  auto constraint = createCartesianPositionConstraint(problem->vars.back(),
+                                                      problem->manip,
+                                                      manip_info.tcp_frame,
+                                                      manip_info.working_frame,
+                                                      Eigen::Isometry3d::Identity(),
+                                                      target_pose);
+  target_constraint = std::dynamic_pointer_cast<trajopt_ifopt::CartPosConstraint>(constraint);
+  problem->nlp->addConstraintSet(target_constraint);
+
+  const std::vector<trajopt_ifopt::JointPosition::ConstPtr> vars(problem->vars.begin(), problem->vars.end());
+  addJointVelocitySquaredCost(*problem->nlp, vars, Eigen::VectorXd::Ones(1));
+
+  auto collision_config = std::make_shared<trajopt_common::TrajOptCollisionConfig>(0.025, 20);
+  addCollisionCost(*problem->nlp, vars, env, manip_info, collision_config, { 0 });
+
+  problem->nlp->setup();
+  return problem;
+}
+
+/** @brief Report the p50 and p99 of the recorded re-plan latencies */
+static void reportLatency(benchmark::State& state, std::vector<double> latencies)
+{
+  if (latencies.empty())
+    return;
+
+  std::sort(latencies.begin(), latencies.end());
+  auto percentile = [&latencies](double p) {
+    auto idx = static_cast<std::size_t>(std::ceil(p * static_cast<double>(latencies.size()))) - 1;
+    return latencies[std::min(idx, latencies.size() - 1)];
+  };
+  state.counters["p50_ms"] = percentile(0.50);
+  state.counters["p99_ms"] = percentile(0.99);
+}
+
+/**
+ * @brief Re-plan by rebuilding the problem and solving it to convergence, as TrajOptIfoptMotionPlanner::solve does
+ */
+static void BM_TrajOptIfoptReplanCold(benchmark::State& state)
+{
+  Environment::Ptr env = getEnvironment();
+  auto manip = env->getJointGroup("manipulator");
+  const Eigen::VectorXd target_state = getTargetState();
+  const Eigen::Isometry3d base_pose = manip->calcFwdKin(target_state).at("tool0");
+
+  Eigen::VectorXd start_state = Eigen::VectorXd::Zero(7);
+  std::vector<Eigen::VectorXd> initial_states = trajopt_ifopt::interpolate(start_state, target_state, NUM_STEPS);
+
+  std::vector<double> latencies;
+  latencies.reserve(static_cast<std::size_t>(state.max_iterations));
+  int cnt{ 0 };
+  for (auto _ : state)
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+    auto problem = createProblem(env, initial_states, getTargetPose(base_pose, cnt++), target_constraint);
+
+    auto qp_solver = std::make_shared<trajopt_sqp::OSQPEigenSolver>();
+    trajopt_sqp::TrustRegionSQPSolver solver(qp_solver);
+    qp_solver->solver_.settings()->setVerbosity(false);
+    qp_solver->solver_.settings()->setWarmStart(true);
+    qp_solver->solver_.settings()->setPolish(true);
+    qp_solver->solver_.settings()->setAdaptiveRho(false);
+    qp_solver->solver_.settings()->setMaxIteration(8192);
+    qp_solver->solver_.settings()->setAbsoluteTolerance(1e-4);
+    qp_solver->solver_.settings()->setRelativeTolerance(1e-6);
+    solver.params = problem->opt_info;
+    solver.solve(problem->nlp);
+
+    // Advance the start along the solution as if it was being executed
+    const Eigen::VectorXd& x = solver.getResults().best_var_vals;
+    for (std::size_t i = 0; i < initial_states.size(); ++i)
+      initial_states[i] = x.segment(static_cast<Eigen::Index>(i) * 7, 7);
+    initial_states[0] = initial_states[1];
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    state.SetIterationTime(elapsed);
+    latencies.push_back(elapsed * 1000.0);
+  }
+
+  reportLatency(state, std::move(latencies));
+}
+
+/**
+ * @brief Re-plan with the online planner, which keeps the problem and solver and is warm started
+ * @param max_iterations The maximum number of SQP steps per re-plan
+ */
+static void BM_TrajOptIfoptReplanOnline(benchmark::State& state, int max_iterations)
+{
+  Environment::Ptr env = getEnvironment();
+  auto manip = env->getJointGroup("manipulator");
+  const Eigen::VectorXd target_state = getTargetState();
+  const Eigen::Isometry3d base_pose = manip->calcFwdKin(target_state).at("tool0");
+
+  Eigen::VectorXd start_state = Eigen::VectorXd::Zero(7);
+  std::vector<Eigen::VectorXd> initial_states = trajopt_ifopt::interpolate(start_state, target_state, NUM_STEPS);
+
+  trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+  TrajOptIfoptOnlinePlanner planner(createProblem(env, initial_states, base_pose, target_constraint));
+  planner.addTargetPoseConstraint(target_constraint);
+
+  // Converge once before measuring, the online planner is meant to track an existing solution
+  planner.setMaxIterations(100);
+  planner.replan();
+  planner.setMaxIterations(max_iterations);
+
+  std::vector<double> latencies;
+  latencies.reserve(static_cast<std::size_t>(state.max_iterations));
+  int cnt{ 0 };
+  for (auto _ : state)
+  {
+    auto start = std::chrono::steady_clock::now();
+
+    // Advance the start along the solution as if it was being executed
+    tesseract_common::TrajArray traj = planner.getTrajectory();
+    planner.setStartState(traj.row(1).transpose());
+    planner.setTargetPose(getTargetPose(base_pose, cnt++));
+    planner.replan();
+
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    state.SetIterationTime(elapsed);
+    latencies.push_back(elapsed * 1000.0);
+  }
+
+  reportLatency(state, std::move(latencies));
+}
+
+BENCHMARK(BM_TrajOptIfoptReplanCold)->Iterations(NUM_REPLANS)->UseManualTime()->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TrajOptIfoptReplanOnline, OneStep, 1)
+    ->Iterations(NUM_REPLANS)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_CAPTURE(BM_TrajOptIfoptReplanOnline, FiveSteps, 5)
+    ->Iterations(NUM_REPLANS)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
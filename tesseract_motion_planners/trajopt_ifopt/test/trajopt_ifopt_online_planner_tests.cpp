@@ -0,0 +1,241 @@
+/**
+ * @file trajopt_ifopt_online_planner_tests.cpp
+ * @brief Unit tests for the online TrajOpt IFOPT planner
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <gtest/gtest.h>
+#include <trajopt_sqp/trajopt_qp_problem.h>
+#include <trajopt_ifopt/utils/ifopt_utils.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_environment/environment.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_online_planner.h>
+#include <tesseract_motion_planners/trajopt_ifopt/trajopt_ifopt_utils.h>
+#include <tesseract_support/tesseract_support_resource_locator.h>
+
+using namespace tesseract_planning;
+using namespace tesseract_environment;
+
+/** @brief The number of waypoints in the trajectory */
+static const int NUM_STEPS = 8;
+
+class TesseractPlanningTrajoptIfoptOnlineUnit : public ::testing::Test
+{
+protected:
+  Environment::Ptr env_;
+  tesseract_common::ManipulatorInfo manip_info_{ "manipulator", "base_link", "tool0" };
+  tesseract_kinematics::JointGroup::ConstPtr manip_;
+  Eigen::VectorXd start_state_;
+  Eigen::VectorXd target_state_;
+  Eigen::Isometry3d target_pose_;
+
+  void SetUp() override
+  {
+    auto locator = std::make_shared<tesseract_common::TesseractSupportResourceLocator>();
+    Environment::Ptr env = std::make_shared<Environment>();
+    tesseract_common::fs::path urdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.urdf");
+    tesseract_common::fs::path srdf_path(std::string(TESSERACT_SUPPORT_DIR) + "/urdf/lbr_iiwa_14_r820.srdf");
+    EXPECT_TRUE(env->init(urdf_path, srdf_path, locator));
+    env_ = env;
+
+    manip_ = env_->getJointGroup(manip_info_.manipulator);
+    start_state_ = Eigen::VectorXd::Zero(7);
+    target_state_.resize(7);
+    target_state_ << 0.5, 0.5, 0, -1.0, 0, 0.5, 0;
+    target_pose_ = manip_->calcFwdKin(target_state_).at(manip_info_.tcp_frame);
+  }
+
+  /** @brief Create a problem from the start state to the cartesian target pose with a velocity cost */
+  std::shared_ptr<TrajOptIfoptProblem> createProblem(trajopt_ifopt::CartPosConstraint::Ptr& target_constraint) const
+  {
+    auto problem = std::make_shared<TrajOptIfoptProblem>();
+    problem->environment = env_;
+    problem->env_state = env_->getState();
+    problem->manip = manip_;
+    problem->nlp = std::make_shared<trajopt_sqp::TrajOptQPProblem>();
+
+    const Eigen::MatrixX2d joint_limits = manip_->getLimits().joint_limits;
+    std::vector<Eigen::VectorXd> initial_states = trajopt_ifopt::interpolate(start_state_, target_state_, NUM_STEPS);
+    for (std::size_t i = 0; i < initial_states.size(); ++i)
+    {
+      auto var = std::make_shared<trajopt_ifopt::JointPosition>(
+          initial_states[i], manip_->getJointNames(), "Joint_Position_" + std::to_string(i));
+      var->SetBounds(joint_limits);
+      problem->vars.push_back(var);
+      problem->nlp->addVariableSet(var);
+    }
+
+    auto constraint = createCartesianPositionConstraint(problem->vars.back(),
+                                                        manip_,
+                                                        manip_info_.tcp_frame,
+                                                        manip_info_.working_frame,
+                                                        Eigen::Isometry3d::Identity(),
+                                                        target_pose_);
+    target_constraint = std::dynamic_pointer_cast<trajopt_ifopt::CartPosConstraint>(constraint);
+    problem->nlp->addConstraintSet(target_constraint);
+
+    const std::vector<trajopt_ifopt::JointPosition::ConstPtr> vars(problem->vars.begin(), problem->vars.end());
+    addJointVelocitySquaredCost(*problem->nlp, vars, Eigen::VectorXd::Ones(1));
+
+    problem->nlp->setup();
+    return problem;
+  }
+
+  /** @brief Check if both bounds of a variable set are the joint values */
+  static bool isPinned(const trajopt_ifopt::JointPosition& var, const Eigen::VectorXd& values)
+  {
+    const std::vector<ifopt::Bounds> bounds = var.GetBounds();
+    for (std::size_t i = 0; i < bounds.size(); ++i)
+    {
+      const double value = values(static_cast<Eigen::Index>(i));
+      if (std::abs(bounds[i].lower_ - value) > 1e-12 || std::abs(bounds[i].upper_ - value) > 1e-12)
+        return false;
+    }
+    return (static_cast<Eigen::Index>(bounds.size()) == values.size());
+  }
+
+  /** @brief Get the tool pose of the last waypoint of a trajectory */
+  Eigen::Isometry3d getFinalPose(const tesseract_common::TrajArray& traj) const
+  {
+    return manip_->calcFwdKin(traj.bottomRows(1).transpose()).at(manip_info_.tcp_frame);
+  }
+};
+
+TEST_F(TesseractPlanningTrajoptIfoptOnlineUnit, TrajOptIfoptOnlinePlannerSettings)  // NOLINT
+{
+  EXPECT_ANY_THROW(TrajOptIfoptOnlinePlanner(nullptr));                                  // NOLINT
+  EXPECT_ANY_THROW(TrajOptIfoptOnlinePlanner(std::make_shared<TrajOptIfoptProblem>()));  // NOLINT
+
+  trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+  auto problem = createProblem(target_constraint);
+  TrajOptIfoptOnlinePlanner planner(problem);
+  EXPECT_EQ(planner.getProblem(), problem);
+
+  planner.setMaxIterations(10);
+  EXPECT_EQ(planner.getMaxIterations(), 10);
+  EXPECT_ANY_THROW(planner.setMaxIterations(0));  // NOLINT
+  EXPECT_EQ(planner.getMaxIterations(), 10);
+
+  planner.setTimeBudget(std::chrono::milliseconds(5));
+  EXPECT_EQ(planner.getTimeBudget(), std::chrono::milliseconds(5));
+
+  planner.setBoxSize(0.05);
+  EXPECT_DOUBLE_EQ(planner.getBoxSize(), 0.05);
+
+  EXPECT_ANY_THROW(planner.setStartState(Eigen::VectorXd::Zero(6)));   // NOLINT
+  EXPECT_ANY_THROW(planner.setTargetState(Eigen::VectorXd::Zero(8)));  // NOLINT
+  EXPECT_ANY_THROW(planner.addTargetPoseConstraint(nullptr));          // NOLINT
+
+  tesseract_common::TrajArray traj = planner.getTrajectory();
+  EXPECT_EQ(traj.rows(), static_cast<Eigen::Index>(problem->vars.size()));
+  EXPECT_EQ(traj.cols(), 7);
+}
+
+TEST_F(TesseractPlanningTrajoptIfoptOnlineUnit, TrajOptIfoptOnlinePlannerConverges)  // NOLINT
+{
+  trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+  TrajOptIfoptOnlinePlanner planner(createProblem(target_constraint));
+  planner.addTargetPoseConstraint(target_constraint);
+  planner.setMaxIterations(100);
+
+  EXPECT_TRUE(planner.replan());
+  EXPECT_EQ(planner.getStatus(), trajopt_sqp::SQPStatus::NLP_CONVERGED);
+  EXPECT_GT(planner.getIterations(), 0);
+  EXPECT_LE(planner.getIterations(), 100);
+  EXPECT_TRUE(getFinalPose(planner.getTrajectory()).isApprox(target_pose_, 1e-3));
+
+  // Re-planning an unchanged problem starts from the converged solution
+  tesseract_common::TrajArray traj = planner.getTrajectory();
+  EXPECT_TRUE(planner.replan());
+  EXPECT_TRUE(planner.getTrajectory().isApprox(traj, 1e-3));
+
+  // A single step leaves the best solution found so far in the problem
+  planner.setTargetPose(Eigen::Translation3d(0, 0, 0.05) * target_pose_);
+  planner.setMaxIterations(1);
+  planner.replan();
+  EXPECT_EQ(planner.getIterations(), 1);
+  EXPECT_EQ(planner.getTrajectory().rows(), traj.rows());
+}
+
+TEST_F(TesseractPlanningTrajoptIfoptOnlineUnit, TrajOptIfoptOnlinePlannerPinning)  // NOLINT
+{
+  trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+  auto problem = createProblem(target_constraint);
+  TrajOptIfoptOnlinePlanner planner(problem);
+  planner.addTargetPoseConstraint(target_constraint);
+  planner.setMaxIterations(100);
+
+  // The start state is pinned through the bounds of the first variable set
+  Eigen::VectorXd start_state(7);
+  start_state << 0.1, 0.1, 0, -0.1, 0, 0.1, 0;
+  planner.setStartState(start_state);
+  EXPECT_TRUE(isPinned(*problem->vars.front(), start_state));
+
+  EXPECT_TRUE(planner.replan());
+  tesseract_common::TrajArray traj = planner.getTrajectory();
+  EXPECT_TRUE(traj.row(0).transpose().isApprox(start_state, 1e-5));
+  EXPECT_TRUE(getFinalPose(traj).isApprox(target_pose_, 1e-3));
+
+  // The target state is pinned through the bounds of the last variable set
+  planner.setTargetState(target_state_);
+  EXPECT_TRUE(isPinned(*problem->vars.back(), target_state_));
+
+  EXPECT_TRUE(planner.replan());
+  traj = planner.getTrajectory();
+  EXPECT_TRUE(traj.row(0).transpose().isApprox(start_state, 1e-5));
+  EXPECT_TRUE(traj.bottomRows(1).transpose().isApprox(target_state_, 1e-5));
+}
+
+TEST_F(TesseractPlanningTrajoptIfoptOnlineUnit, TrajOptIfoptOnlinePlannerUpdates)  // NOLINT
+{
+  trajopt_ifopt::CartPosConstraint::Ptr target_constraint;
+  TrajOptIfoptOnlinePlanner planner(createProblem(target_constraint));
+  planner.addTargetPoseConstraint(target_constraint);
+  planner.setMaxIterations(100);
+  EXPECT_TRUE(planner.replan());
+
+  // Track a moving target while the start advances along the previous solution
+  for (int i = 1; i <= 5; ++i)
+  {
+    tesseract_common::TrajArray traj = planner.getTrajectory();
+    const Eigen::VectorXd start_state = traj.row(1).transpose();
+    const Eigen::Isometry3d target_pose = Eigen::Translation3d(0.01 * i, 0, 0) * target_pose_;
+
+    planner.setStartState(start_state);
+    planner.setTargetPose(target_pose);
+    EXPECT_TRUE(planner.replan());
+
+    traj = planner.getTrajectory();
+    EXPECT_TRUE(traj.row(0).transpose().isApprox(start_state, 1e-5));
+    EXPECT_TRUE(getFinalPose(traj).isApprox(target_pose, 1e-3));
+  }
+}
+
+int main(int argc, char** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+
+  return RUN_ALL_TESTS();
+}
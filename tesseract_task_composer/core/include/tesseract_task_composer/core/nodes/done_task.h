@@ -51,7 +51,11 @@ public:
   bool operator==(const DoneTask& rhs) const;
   bool operator!=(const DoneTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  DoneTask(const DoneTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -51,7 +51,11 @@ public:
   bool operator==(const ErrorTask& rhs) const;
   bool operator!=(const ErrorTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  ErrorTask(const ErrorTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
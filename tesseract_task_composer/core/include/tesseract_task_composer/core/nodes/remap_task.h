@@ -56,7 +56,11 @@ public:
   bool operator==(const RemapTask& rhs) const;
   bool operator!=(const RemapTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  RemapTask(const RemapTask&) = default;
+
   std::map<std::string, std::string> remap_;
   bool copy_{ false };
 
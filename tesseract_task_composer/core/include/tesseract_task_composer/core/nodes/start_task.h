@@ -50,7 +50,11 @@ public:
   bool operator==(const StartTask& rhs) const;
   bool operator!=(const StartTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  StartTask(const StartTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
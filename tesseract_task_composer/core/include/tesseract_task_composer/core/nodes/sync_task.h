@@ -60,7 +60,11 @@ public:
   bool operator==(const SyncTask& rhs) const;
   bool operator!=(const SyncTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  SyncTask(const SyncTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -37,7 +37,12 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-/** @brief A thread save data storage */
+/**
+ * @brief A thread save data storage
+ * @details The data is stored as immutable shared values, so copying the storage or remapping with copy does not copy
+ * the data itself. Tasks which only read their input should use getSharedData and tasks which produce new data should
+ * move it into the storage using setData.
+ */
 class TaskComposerDataStorage
 {
 public:
@@ -75,6 +80,23 @@ public:
    */
   tesseract_common::AnyPoly getData(const std::string& key) const;
 
+  /**
+   * @brief Get a shared read only reference to the data for the provided key
+   * @details This does not copy the data. The returned data is not modified if the key is assigned new data.
+   * @param key The key to retreive the data
+   * @return The data associated with the key, if the key does not exist it will be nullptr
+   */
+  std::shared_ptr<const tesseract_common::AnyPoly> getSharedData(const std::string& key) const;
+
+  /**
+   * @brief Take the data for the provided key, removing it from the storage
+   * @details The data is moved out of the storage unless it is still shared with another key or reader, in which case
+   * it is copied. If the key does not exist it will be null
+   * @param key The key to take the data from
+   * @return The data associated with the key
+   */
+  tesseract_common::AnyPoly takeData(const std::string& key);
+
   /**
    * @brief Remove data for the provide key
    * @param key The key to remove data for
@@ -90,7 +112,8 @@ public:
   /**
    * @brief Remap data from one key to another
    * @param remapping The key value pairs to remap data from the first to the second
-   * @param copy Default behavior is not move the data, but if copy is desired set this to true
+   * @param copy Default behavior is not move the data, but if copy is desired set this to true. The copy shares the
+   * data with the original key.
    * @return True if successful, otherwise false
    */
   bool remapData(const std::map<std::string, std::string>& remapping, bool copy = false);
@@ -106,7 +129,8 @@ protected:
   void serialize(Archive& ar, const unsigned int version);  // NOLINT
 
   mutable std::shared_mutex mutex_;
-  std::unordered_map<std::string, tesseract_common::AnyPoly> data_;
+  /** @brief The data, which is never modified while it is stored so it may be shared */
+  std::unordered_map<std::string, std::shared_ptr<tesseract_common::AnyPoly>> data_;
 };
 
 }  // namespace tesseract_planning
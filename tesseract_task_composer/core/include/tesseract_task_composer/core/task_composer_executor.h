@@ -28,6 +28,7 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <functional>
 #include <memory>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -65,6 +66,45 @@ public:
                                TaskComposerProblem::Ptr problem,
                                TaskComposerDataStorage::Ptr data_storage = std::make_shared<TaskComposerDataStorage>());
 
+  /**
+   * @brief Execute the provided node and call a function once it has finished
+   * @details The function is called by the executor before the returned future is ready, even if the future is never
+   * waited on. This is intended for storing results, like the result cache of the server.
+   * @param node The node to execute
+   * @param problem The problem
+   * @param data_storage The data storage object to leverage
+   * @param done The function called with the context of the finished execution, which must not throw
+   * @return The future associated with execution
+   */
+  TaskComposerFuture::UPtr run(const TaskComposerNode& node,
+                               TaskComposerProblem::Ptr problem,
+                               TaskComposerDataStorage::Ptr data_storage,
+                               std::function<void(const TaskComposerContext&)> done);
+
+  /**
+   * @brief Execute the provided node from within a running task and return once it has finished
+   * @details This is intended for dynamic tasking where a task builds a child graph and must wait on its results.
+   * Unlike run() followed by wait(), an executor supporting cooperative scheduling keeps the calling worker busy
+   * processing other work until the node has finished, so nested graphs do not starve the executor of threads.
+   * @param node The node to execute
+   * @param problem The problem
+   * @param data_storage The data storage object to leverage
+   * @return The context associated with the finished execution
+   */
+  TaskComposerContext::Ptr corun(const TaskComposerNode& node,
+                                 TaskComposerProblem::Ptr problem,
+                                 TaskComposerDataStorage::Ptr data_storage = std::make_shared<TaskComposerDataStorage>());
+
+  /**
+   * @brief Run independent jobs from within a running task and return once all of them have finished
+   * @details This is intended for tasks which split their own work, like a motion planner solving independent
+   * segments. The default implementation runs the jobs in sequence on the calling thread. An executor supporting
+   * cooperative scheduling runs them on its workers and keeps the calling worker busy, so no threads are created.
+   * @param count The number of jobs
+   * @param job The job, which is called with the index of each job and must not throw
+   */
+  virtual void corunFor(std::size_t count, const std::function<void(std::size_t)>& job);
+
   /** @brief Queries the number of workers (example: number of threads) */
   virtual long getWorkerCount() const = 0;
 
@@ -88,9 +128,22 @@ protected:
    * @details This should only be used for dynamic tasking
    * @param node The node to execute
    * @param context The context
+   * @param done The function called with the context once the node has finished, may be empty
    * @return The future associated with execution
    */
-  virtual TaskComposerFuture::UPtr run(const TaskComposerNode& node, TaskComposerContext::Ptr context) = 0;
+  virtual TaskComposerFuture::UPtr run(const TaskComposerNode& node,
+                                       TaskComposerContext::Ptr context,
+                                       std::function<void(const TaskComposerContext&)> done) = 0;
+
+  /**
+   * @brief Execute provided node provide the context and return once it has finished
+   * @details The default implementation calls run() and blocks on the future. Executors should override this if
+   * they are able to wait without blocking the calling worker.
+   * @param node The node to execute
+   * @param context The context
+   * @return The context associated with the finished execution
+   */
+  virtual TaskComposerContext::Ptr corun(const TaskComposerNode& node, TaskComposerContext::Ptr context);
 };
 }  // namespace tesseract_planning
 
@@ -53,7 +53,6 @@ public:
   TaskComposerGraph(std::string name = "TaskComposerGraph");
   TaskComposerGraph(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~TaskComposerGraph() override = default;
-  TaskComposerGraph(const TaskComposerGraph&) = delete;
   TaskComposerGraph& operator=(const TaskComposerGraph&) = delete;
   TaskComposerGraph(TaskComposerGraph&&) = delete;
   TaskComposerGraph& operator=(TaskComposerGraph&&) = delete;
@@ -121,7 +120,20 @@ public:
   bool operator==(const TaskComposerGraph& rhs) const;
   bool operator!=(const TaskComposerGraph& rhs) const;
 
+  /**
+   * @brief Create a copy of the graph with new uuids for the graph and all of its nodes
+   * @return The copy, or nullptr if any of the nodes does not support cloning
+   */
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  /**
+   * @brief Copy constructor used by clone
+   * @details Clones every node and maps the edges and terminals to the new node uuids
+   * @throws std::runtime_error if a node does not support cloning
+   */
+  TaskComposerGraph(const TaskComposerGraph& other);
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
 
@@ -29,6 +29,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <memory>
+#include <typeinfo>
 #include <vector>
 #include <boost/uuid/uuid.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -60,7 +61,6 @@ public:
                    bool conditional = false);
   explicit TaskComposerNode(std::string name, TaskComposerNodeType type, const YAML::Node& config);
   virtual ~TaskComposerNode() = default;
-  TaskComposerNode(const TaskComposerNode&) = delete;
   TaskComposerNode& operator=(const TaskComposerNode&) = delete;
   TaskComposerNode(TaskComposerNode&&) = delete;
   TaskComposerNode& operator=(TaskComposerNode&&) = delete;
@@ -130,7 +130,30 @@ public:
   bool operator==(const TaskComposerNode& rhs) const;
   bool operator!=(const TaskComposerNode& rhs) const;
 
+  /**
+   * @brief Create a copy of this node with a new uuid
+   * @details The copy is not part of a graph so it has no parent or edges. Graphs clone all of their child nodes.
+   * Derived classes must override this to support cloning, which allows the plugin factory to build a node once and
+   * create instances from it instead of parsing the configuration again.
+   * @throws std::runtime_error if a derived class inherits the implementation of its base, which would slice the copy
+   * @return The copy, or nullptr if the node type does not support cloning
+   */
+  virtual UPtr clone() const;
+
 protected:
+  /**
+   * @brief Copy constructor used by clone
+   * @details Copies the configuration of the node but generates a new uuid and does not copy the parent or edges
+   */
+  TaskComposerNode(const TaskComposerNode& other);
+
+  /**
+   * @brief Check that clone is called on the class implementing it and not inherited by a derived class
+   * @param type The type of the class implementing clone
+   * @throws std::runtime_error if the type of this node is not the provided type
+   */
+  void checkCloneType(const std::type_info& type) const;
+
   friend class TaskComposerGraph;
   friend class TaskComposerNodeInfo;
   friend struct tesseract_common::Serialization;
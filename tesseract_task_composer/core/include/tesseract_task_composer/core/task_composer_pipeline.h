@@ -57,7 +57,6 @@ public:
   TaskComposerPipeline(std::string name, bool conditional);
   TaskComposerPipeline(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~TaskComposerPipeline() override = default;
-  TaskComposerPipeline(const TaskComposerPipeline&) = delete;
   TaskComposerPipeline& operator=(const TaskComposerPipeline&) = delete;
   TaskComposerPipeline(TaskComposerPipeline&&) = delete;
   TaskComposerPipeline& operator=(TaskComposerPipeline&&) = delete;
@@ -67,7 +66,11 @@ public:
   bool operator==(const TaskComposerPipeline& rhs) const;
   bool operator!=(const TaskComposerPipeline& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  TaskComposerPipeline(const TaskComposerPipeline&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
 
@@ -30,6 +30,8 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <string>
 #include <map>
+#include <mutex>
+#include <unordered_map>
 #include <yaml-cpp/yaml.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
@@ -90,10 +92,10 @@ class TaskComposerPluginFactory
 public:
   TaskComposerPluginFactory();
   ~TaskComposerPluginFactory();
-  TaskComposerPluginFactory(const TaskComposerPluginFactory&) = default;
-  TaskComposerPluginFactory& operator=(const TaskComposerPluginFactory&) = default;
-  TaskComposerPluginFactory(TaskComposerPluginFactory&&) = default;
-  TaskComposerPluginFactory& operator=(TaskComposerPluginFactory&&) = default;
+  TaskComposerPluginFactory(const TaskComposerPluginFactory& other);
+  TaskComposerPluginFactory& operator=(const TaskComposerPluginFactory& other);
+  TaskComposerPluginFactory(TaskComposerPluginFactory&& other) noexcept;
+  TaskComposerPluginFactory& operator=(TaskComposerPluginFactory&& other) noexcept;
 
   /**
    * @brief Load plugins from a configuration object
@@ -271,6 +273,10 @@ public:
   /**
    * @brief Get task composer node object given name
    * @details This looks for task composer node plugin info. If not found nullptr is returned.
+   *
+   * The first node created for a name is kept as a prototype and later requests clone it, which avoids parsing the
+   * configuration and creating every child node from plugins again. If the node does not support clone it is created
+   * from the plugin every time.
    * @param name The name
    */
   TaskComposerNode::UPtr createTaskComposerNode(const std::string& name) const;
@@ -283,6 +289,12 @@ public:
   TaskComposerNode::UPtr createTaskComposerNode(const std::string& name,
                                                 const tesseract_common::PluginInfo& plugin_info) const;
 
+  /**
+   * @brief Clear the task composer node prototypes
+   * @details This is done automatically when the plugin information changes
+   */
+  void clearTaskComposerNodePrototypes() const;
+
   /**
    * @brief Save the plugin information to a yaml config file
    * @param file_path The file path
@@ -296,8 +308,16 @@ public:
   YAML::Node getConfig() const;
 
 private:
+  /** @brief Protects the node factories and prototypes, nodes are often created concurrently by running tasks */
+  mutable std::mutex mutex_;
   mutable std::map<std::string, TaskComposerExecutorFactory::Ptr> executor_factories_;
   mutable std::map<std::string, TaskComposerNodeFactory::Ptr> node_factories_;
+  /**
+   * @brief Immutable prototypes of named nodes which are cloned to create new instances
+   * @details A nullptr entry indicates the node does not support clone. These are not copied with the factory because
+   * nodes may keep a reference to the factory which created them.
+   */
+  mutable std::unordered_map<std::string, TaskComposerNode::ConstPtr> node_prototypes_;
   tesseract_common::PluginInfoContainer executor_plugin_info_;
   tesseract_common::PluginInfoContainer task_plugin_info_;
   tesseract_common::PluginLoader plugin_loader_;
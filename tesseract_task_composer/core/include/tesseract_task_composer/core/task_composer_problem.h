@@ -68,6 +68,15 @@ struct TaskComposerProblem
    */
   virtual TaskComposerProblem::UPtr clone() const;
 
+  /**
+   * @brief Get the key identifying the result of the problem, see TaskComposerResultCache
+   * @details Problems with equal keys must produce the same result. This is the binary serialization of the name,
+   * dotgraph and input. Derived problems should append everything else their result depends on.
+   * @throws If the input is not serializable
+   * @return The key
+   */
+  virtual std::string getResultCacheKey() const;
+
   bool operator==(const TaskComposerProblem& rhs) const;
   bool operator!=(const TaskComposerProblem& rhs) const;
 
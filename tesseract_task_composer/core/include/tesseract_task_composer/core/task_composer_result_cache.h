@@ -0,0 +1,151 @@
+/**
+ * @file task_composer_result_cache.h
+ * @brief A cache of task composer results
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TASK_COMPOSER_TASK_COMPOSER_RESULT_CACHE_H
+#define TESSERACT_TASK_COMPOSER_TASK_COMPOSER_RESULT_CACHE_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_context.h>
+#include <tesseract_task_composer/core/task_composer_data_storage.h>
+#include <tesseract_task_composer/core/task_composer_future.h>
+#include <tesseract_task_composer/core/task_composer_node_info.h>
+#include <tesseract_task_composer/core/task_composer_problem.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A thread safe cache of the results of successful task composer executions
+ * @details Results are content addressed by the key of the problem, see TaskComposerProblem::getResultCacheKey, and
+ * the serialized input data storage. The full key is stored with each result and compared on lookup, so problems
+ * whose keys only have an equal hash never share a result. A problem which was solved before returns a copy of the
+ * cached data storage and task infos without executing the task again. Since the data storage shares its immutable
+ * values, the copy does not copy the results themselves.
+ *
+ * The memory used by a result is estimated by the size of its key and its binary serialization. When the memory
+ * budget is exceeded the least recently used results are evicted.
+ */
+class TaskComposerResultCache
+{
+public:
+  using Ptr = std::shared_ptr<TaskComposerResultCache>;
+  using ConstPtr = std::shared_ptr<const TaskComposerResultCache>;
+
+  /**
+   * @brief Construct a result cache
+   * @param max_memory The memory budget in bytes
+   */
+  TaskComposerResultCache(std::size_t max_memory = 256 * 1024 * 1024);
+  ~TaskComposerResultCache() = default;
+  TaskComposerResultCache(const TaskComposerResultCache&) = delete;
+  TaskComposerResultCache& operator=(const TaskComposerResultCache&) = delete;
+  TaskComposerResultCache(TaskComposerResultCache&&) = delete;
+  TaskComposerResultCache& operator=(TaskComposerResultCache&&) = delete;
+
+  /**
+   * @brief Create the key of a problem and its input data storage
+   * @param problem The problem
+   * @param data_storage The input data storage
+   * @return The key, empty if the problem can not be cached
+   */
+  static std::optional<std::string> createKey(const TaskComposerProblem& problem,
+                                              const TaskComposerDataStorage& data_storage);
+
+  /**
+   * @brief Get the cached result of a key
+   * @details This counts as a hit if the key is cached, otherwise as a miss
+   * @param key The key
+   * @param problem The problem assigned to the context of the returned future
+   * @return A future which is ready, nullptr if the key is not cached
+   */
+  TaskComposerFuture::UPtr get(const std::string& key, TaskComposerProblem::Ptr problem);
+
+  /**
+   * @brief Store the result of a finished execution
+   * @details This does not throw so it can be called by the executor once the execution has finished
+   * @param key The key
+   * @param context The context of the finished execution
+   * @return True if the result was stored, false if it was not successful or exceeds the memory budget
+   */
+  bool put(const std::string& key, const TaskComposerContext& context) noexcept;
+
+  /** @brief Get the number of cached results */
+  std::size_t size() const;
+
+  /** @brief Get the estimated memory used by the cached results in bytes */
+  std::size_t getMemoryUsage() const;
+
+  /** @brief Get the memory budget in bytes */
+  std::size_t getMaxMemory() const;
+
+  /** @brief Get the number of lookups which returned a cached result */
+  std::size_t getHits() const;
+
+  /** @brief Get the number of lookups which did not find a cached result */
+  std::size_t getMisses() const;
+
+  /** @brief Get the ratio of hits to lookups, zero if there were no lookups */
+  double getHitRate() const;
+
+  /** @brief Reset the hit and miss counters */
+  void resetStatistics();
+
+  /** @brief Remove all cached results */
+  void clear();
+
+private:
+  struct Entry
+  {
+    std::string key;
+    TaskComposerDataStorage data_storage;
+    TaskComposerNodeInfoContainer task_infos;
+    std::size_t memory{ 0 };
+  };
+
+  std::size_t max_memory_;
+
+  mutable std::mutex mutex_;
+  std::size_t memory_{ 0 };
+  std::list<Entry> entries_;
+  /** @brief The entries by key, the keys are views of the key of each entry */
+  std::unordered_map<std::string_view, std::list<Entry>::iterator> index_;
+
+  std::atomic<std::size_t> hits_{ 0 };
+  std::atomic<std::size_t> misses_{ 0 };
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TASK_COMPOSER_TASK_COMPOSER_RESULT_CACHE_H
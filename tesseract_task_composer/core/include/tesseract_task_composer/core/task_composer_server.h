@@ -34,6 +34,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_node.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/core/task_composer_result_cache.h>
 
 namespace tesseract_planning
 {
@@ -114,8 +115,23 @@ public:
    */
   std::vector<std::string> getAvailableTasks() const;
 
+  /**
+   * @brief Set the cache of results used when running a task by the name of the problem
+   * @details By default no cache is used and every problem is executed
+   * @param cache The result cache, nullptr to disable caching
+   */
+  void setResultCache(TaskComposerResultCache::Ptr cache);
+
+  /**
+   * @brief Get the cache of results
+   * @return The result cache, nullptr if caching is disabled
+   */
+  TaskComposerResultCache::Ptr getResultCache() const;
+
   /**
    * @brief Execute the provided task graph
+   * @details If a result cache is set and the problem was solved before, the cached result is returned without
+   * executing the task
    * @param problem The task problem
    * @param name The name of the executor to use
    * @return The future associated with execution
@@ -146,6 +162,7 @@ protected:
   TaskComposerPluginFactory plugin_factory_;
   std::unordered_map<std::string, TaskComposerExecutor::Ptr> executors_;
   std::unordered_map<std::string, TaskComposerNode::UPtr> tasks_;
+  TaskComposerResultCache::Ptr result_cache_;
 
   void loadPlugins();
 };
@@ -53,7 +53,6 @@ public:
   explicit TaskComposerTask(std::string name, bool conditional);
   explicit TaskComposerTask(std::string name, const YAML::Node& config);
   ~TaskComposerTask() override = default;
-  TaskComposerTask(const TaskComposerTask&) = delete;
   TaskComposerTask& operator=(const TaskComposerTask&) = delete;
   TaskComposerTask(TaskComposerTask&&) = delete;
   TaskComposerTask& operator=(TaskComposerTask&&) = delete;
@@ -70,6 +69,8 @@ public:
   int run(TaskComposerContext& context, OptionalTaskComposerExecutor executor = std::nullopt) const;
 
 protected:
+  TaskComposerTask(const TaskComposerTask&) = default;
+
   /** @brief Indicate if task triggers abort */
   bool trigger_abort_{ false };
 
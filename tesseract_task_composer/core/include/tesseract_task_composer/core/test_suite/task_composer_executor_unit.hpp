@@ -29,14 +29,59 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <atomic>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/test_suite/task_composer_serialization_utils.hpp>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 #include <tesseract_task_composer/core/nodes/done_task.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
 
 namespace tesseract_planning::test_suite
 {
+/** @brief A task which runs a child node using the executor's corun, similar to dynamic raster tasks */
+class CorunTestTask : public TaskComposerTask
+{
+public:
+  explicit CorunTestTask(std::string name) : TaskComposerTask(std::move(name), false) {}
+
+protected:
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerContext& context,
+                                     OptionalTaskComposerExecutor executor = std::nullopt) const override final
+  {
+    DoneTask child("ChildDoneTask");
+    TaskComposerContext::Ptr child_context = executor.value().get().corun(child, context.problem, context.data_storage);
+
+    auto node_info = std::make_unique<TaskComposerNodeInfo>(*this);
+    node_info->return_value = child_context->isSuccessful() ? 1 : 0;
+    context.task_infos.mergeInfoMap(std::move(child_context->task_infos));
+    return node_info;
+  }
+};
+
+/** @brief A task which splits its work into jobs using the executor's corunFor, similar to motion planners */
+class CorunForTestTask : public TaskComposerTask
+{
+public:
+  explicit CorunForTestTask(std::string name, std::vector<std::atomic<int>>& calls)
+    : TaskComposerTask(std::move(name), false), calls_(&calls)
+  {
+  }
+
+protected:
+  std::vector<std::atomic<int>>* calls_;
+
+  TaskComposerNodeInfo::UPtr runImpl(TaskComposerContext& /*context*/,
+                                     OptionalTaskComposerExecutor executor = std::nullopt) const override final
+  {
+    executor.value().get().corunFor(calls_->size(), [this](std::size_t i) { ++(*calls_)[i]; });
+
+    auto node_info = std::make_unique<TaskComposerNodeInfo>(*this);
+    node_info->return_value = 1;
+    return node_info;
+  }
+};
+
 template <typename T>
 void runTaskComposerExecutorTest()
 {
@@ -408,6 +453,56 @@ void runTaskComposerExecutorTest()
     // Serialization
     test_suite::runSerializationPointerTest(executor, "TaskComposerExecutorTests");
   }
+
+  {  // corun outside of a worker
+    auto task = std::make_unique<DoneTask>("DoneTask");
+    tesseract_planning::TaskComposerExecutor::UPtr executor = std::make_unique<T>("TaskComposerExecutorTests", 1);
+
+    auto problem = std::make_unique<TaskComposerProblem>();
+    auto data_storage = std::make_unique<TaskComposerDataStorage>();
+    TaskComposerContext::Ptr context = executor->corun(*task, std::move(problem), std::move(data_storage));
+    EXPECT_EQ(context->isAborted(), false);
+    EXPECT_EQ(context->isSuccessful(), true);
+    EXPECT_EQ(context->task_infos.getInfoMap().size(), 1);
+  }
+
+  {  // corun nested within a task, which must not deadlock with a single worker
+    auto task = std::make_unique<CorunTestTask>("CorunTestTask");
+    tesseract_planning::TaskComposerExecutor::UPtr executor = std::make_unique<T>("TaskComposerExecutorTests", 1);
+
+    auto problem = std::make_unique<TaskComposerProblem>();
+    auto data_storage = std::make_unique<TaskComposerDataStorage>();
+    auto future = executor->run(*task, std::move(problem), std::move(data_storage));
+    EXPECT_EQ(future->waitFor(std::chrono::duration<double>(10)), std::future_status::ready);
+    EXPECT_EQ(future->context->isAborted(), false);
+    EXPECT_EQ(future->context->isSuccessful(), true);
+    EXPECT_EQ(future->context->task_infos.getInfoMap().size(), 2);
+  }
+
+  {  // corunFor outside of a worker
+    tesseract_planning::TaskComposerExecutor::UPtr executor = std::make_unique<T>("TaskComposerExecutorTests", 2);
+    std::vector<std::atomic<int>> calls(100);
+    executor->corunFor(calls.size(), [&calls](std::size_t i) { ++calls[i]; });
+    for (const auto& c : calls)
+      EXPECT_EQ(c.load(), 1);
+
+    executor->corunFor(0, [&calls](std::size_t i) { ++calls[i]; });
+  }
+
+  {  // corunFor nested within a task, which must not deadlock with a single worker
+    std::vector<std::atomic<int>> calls(10);
+    auto task = std::make_unique<CorunForTestTask>("CorunForTestTask", calls);
+    tesseract_planning::TaskComposerExecutor::UPtr executor = std::make_unique<T>("TaskComposerExecutorTests", 1);
+
+    auto problem = std::make_unique<TaskComposerProblem>();
+    auto data_storage = std::make_unique<TaskComposerDataStorage>();
+    auto future = executor->run(*task, std::move(problem), std::move(data_storage));
+    EXPECT_EQ(future->waitFor(std::chrono::duration<double>(10)), std::future_status::ready);
+    EXPECT_EQ(future->context->isAborted(), false);
+    EXPECT_EQ(future->context->isSuccessful(), true);
+    for (const auto& c : calls)
+      EXPECT_EQ(c.load(), 1);
+  }
 }
 }  // namespace tesseract_planning::test_suite
 
@@ -54,7 +54,11 @@ public:
   bool operator==(const TestTask& rhs) const;
   bool operator!=(const TestTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  TestTask(const TestTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
 
@@ -54,6 +54,12 @@ TaskComposerNodeInfo::UPtr DoneTask::runImpl(TaskComposerContext& /*context*/,
 bool DoneTask::operator==(const DoneTask& rhs) const { return TaskComposerTask::operator==(rhs); }
 bool DoneTask::operator!=(const DoneTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr DoneTask::clone() const
+{
+  checkCloneType(typeid(DoneTask));
+  return std::unique_ptr<DoneTask>(new DoneTask(*this));
+}
+
 template <class Archive>
 void DoneTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -54,6 +54,12 @@ TaskComposerNodeInfo::UPtr ErrorTask::runImpl(TaskComposerContext& /*context*/,
 bool ErrorTask::operator==(const ErrorTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool ErrorTask::operator!=(const ErrorTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr ErrorTask::clone() const
+{
+  checkCloneType(typeid(ErrorTask));
+  return std::unique_ptr<ErrorTask>(new ErrorTask(*this));
+}
+
 template <class Archive>
 void ErrorTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -87,6 +87,12 @@ bool RemapTask::operator==(const RemapTask& rhs) const
 }
 bool RemapTask::operator!=(const RemapTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr RemapTask::clone() const
+{
+  checkCloneType(typeid(RemapTask));
+  return std::unique_ptr<RemapTask>(new RemapTask(*this));
+}
+
 template <class Archive>
 void RemapTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
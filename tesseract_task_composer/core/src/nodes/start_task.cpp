@@ -59,6 +59,12 @@ TaskComposerNodeInfo::UPtr StartTask::runImpl(TaskComposerContext& /*context*/,
 bool StartTask::operator==(const StartTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool StartTask::operator!=(const StartTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr StartTask::clone() const
+{
+  checkCloneType(typeid(StartTask));
+  return std::unique_ptr<StartTask>(new StartTask(*this));
+}
+
 template <class Archive>
 void StartTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
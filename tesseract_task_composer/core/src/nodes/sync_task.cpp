@@ -59,6 +59,12 @@ TaskComposerNodeInfo::UPtr SyncTask::runImpl(TaskComposerContext& /*context*/,
 bool SyncTask::operator==(const SyncTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool SyncTask::operator!=(const SyncTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr SyncTask::clone() const
+{
+  checkCloneType(typeid(SyncTask));
+  return std::unique_ptr<SyncTask>(new SyncTask(*this));
+}
+
 template <class Archive>
 void SyncTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -81,20 +81,49 @@ bool TaskComposerDataStorage::hasKey(const std::string& key)
 
 void TaskComposerDataStorage::setData(const std::string& key, tesseract_common::AnyPoly data)
 {
+  auto shared_data = std::make_shared<tesseract_common::AnyPoly>(std::move(data));
   std::unique_lock lock(mutex_);
-  data_[key] = std::move(data);
+  data_[key] = std::move(shared_data);
 }
 
 tesseract_common::AnyPoly TaskComposerDataStorage::getData(const std::string& key) const
+{
+  std::shared_ptr<const tesseract_common::AnyPoly> data = getSharedData(key);
+  if (data == nullptr)
+    return {};
+
+  return *data;
+}
+
+std::shared_ptr<const tesseract_common::AnyPoly> TaskComposerDataStorage::getSharedData(const std::string& key) const
 {
   std::shared_lock lock(mutex_);
   auto it = data_.find(key);
   if (it == data_.end())
-    return {};
+    return nullptr;
 
   return it->second;
 }
 
+tesseract_common::AnyPoly TaskComposerDataStorage::takeData(const std::string& key)
+{
+  std::shared_ptr<tesseract_common::AnyPoly> data;
+  {
+    std::unique_lock lock(mutex_);
+    auto nh = data_.extract(key);
+    if (nh.empty())
+      return {};
+
+    data = std::move(nh.mapped());
+  }
+
+  // The storage no longer references the data, so if nothing else does it can be moved
+  if (data.use_count() == 1)
+    return std::move(*data);
+
+  return *data;
+}
+
 void TaskComposerDataStorage::removeData(const std::string& key)
 {
   std::unique_lock lock(mutex_);
@@ -104,7 +133,12 @@ void TaskComposerDataStorage::removeData(const std::string& key)
 std::unordered_map<std::string, tesseract_common::AnyPoly> TaskComposerDataStorage::getData() const
 {
   std::shared_lock lock(mutex_);
-  return data_;
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  data.reserve(data_.size());
+  for (const auto& pair : data_)
+    data[pair.first] = *pair.second;
+
+  return data;
 }
 
 bool TaskComposerDataStorage::remapData(const std::map<std::string, std::string>& remapping, bool copy)
@@ -156,7 +190,15 @@ bool TaskComposerDataStorage::operator==(const TaskComposerDataStorage& rhs) con
   std::scoped_lock lock{ lhs_lock, rhs_lock };
 
   bool equal = true;
-  equal &= data_ == rhs.data_;
+  equal &= (data_.size() == rhs.data_.size());
+  for (const auto& pair : data_)
+  {
+    if (!equal)
+      break;
+
+    auto it = rhs.data_.find(pair.first);
+    equal &= (it != rhs.data_.end() && (pair.second == it->second || *pair.second == *it->second));
+  }
   return equal;
 }
 
@@ -165,8 +207,24 @@ bool TaskComposerDataStorage::operator!=(const TaskComposerDataStorage& rhs) con
 template <class Archive>
 void TaskComposerDataStorage::serialize(Archive& ar, const unsigned int /*version*/)
 {
+  // The data is archived by value so the archive format does not depend on how the data is shared
   std::unique_lock lock(mutex_);
-  ar& boost::serialization::make_nvp("data", data_);
+  std::unordered_map<std::string, tesseract_common::AnyPoly> data;
+  if constexpr (Archive::is_saving::value)
+  {
+    data.reserve(data_.size());
+    for (const auto& pair : data_)
+      data[pair.first] = *pair.second;
+  }
+
+  ar& boost::serialization::make_nvp("data", data);
+
+  if constexpr (!Archive::is_saving::value)
+  {
+    data_.clear();
+    for (auto& pair : data)
+      data_[pair.first] = std::make_shared<tesseract_common::AnyPoly>(std::move(pair.second));
+  }
 }
 
 }  // namespace tesseract_planning
@@ -41,7 +41,36 @@ TaskComposerFuture::UPtr TaskComposerExecutor::run(const TaskComposerNode& node,
                                                    TaskComposerProblem::Ptr problem,
                                                    TaskComposerDataStorage::Ptr data_storage)
 {
-  return run(node, std::make_shared<TaskComposerContext>(std::move(problem), std::move(data_storage)));
+  return run(node, std::make_shared<TaskComposerContext>(std::move(problem), std::move(data_storage)), nullptr);
+}
+
+TaskComposerFuture::UPtr TaskComposerExecutor::run(const TaskComposerNode& node,
+                                                   TaskComposerProblem::Ptr problem,
+                                                   TaskComposerDataStorage::Ptr data_storage,
+                                                   std::function<void(const TaskComposerContext&)> done)
+{
+  return run(
+      node, std::make_shared<TaskComposerContext>(std::move(problem), std::move(data_storage)), std::move(done));
+}
+
+TaskComposerContext::Ptr TaskComposerExecutor::corun(const TaskComposerNode& node,
+                                                     TaskComposerProblem::Ptr problem,
+                                                     TaskComposerDataStorage::Ptr data_storage)
+{
+  return corun(node, std::make_shared<TaskComposerContext>(std::move(problem), std::move(data_storage)));
+}
+
+TaskComposerContext::Ptr TaskComposerExecutor::corun(const TaskComposerNode& node, TaskComposerContext::Ptr context)
+{
+  TaskComposerFuture::UPtr future = run(node, std::move(context), nullptr);
+  future->wait();
+  return future->context;
+}
+
+void TaskComposerExecutor::corunFor(std::size_t count, const std::function<void(std::size_t)>& job)
+{
+  for (std::size_t i = 0; i < count; ++i)
+    job(i);
 }
 
 bool TaskComposerExecutor::operator==(const TaskComposerExecutor& rhs) const { return (name_ == rhs.name_); }
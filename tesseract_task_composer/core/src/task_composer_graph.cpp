@@ -199,6 +199,36 @@ TaskComposerGraph::TaskComposerGraph(std::string name,
   }
 }
 
+TaskComposerGraph::TaskComposerGraph(const TaskComposerGraph& other) : TaskComposerNode(other)
+{
+  std::map<boost::uuids::uuid, boost::uuids::uuid> uuid_map;
+  for (const auto& pair : other.nodes_)
+  {
+    TaskComposerNode::UPtr node = pair.second->clone();
+    if (node == nullptr)
+      throw std::runtime_error("TaskComposerGraph '" + name_ + "' node '" + pair.second->getName() +
+                               "' does not support clone");
+
+    uuid_map[pair.first] = addNode(std::move(node));
+  }
+
+  for (const auto& pair : other.nodes_)
+  {
+    TaskComposerNode::Ptr& node = nodes_.at(uuid_map.at(pair.first));
+    node->outbound_edges_.reserve(pair.second->outbound_edges_.size());
+    for (const auto& edge : pair.second->outbound_edges_)
+      node->outbound_edges_.push_back(uuid_map.at(edge));
+
+    node->inbound_edges_.reserve(pair.second->inbound_edges_.size());
+    for (const auto& edge : pair.second->inbound_edges_)
+      node->inbound_edges_.push_back(uuid_map.at(edge));
+  }
+
+  terminals_.reserve(other.terminals_.size());
+  for (const auto& terminal : other.terminals_)
+    terminals_.push_back(uuid_map.at(terminal));
+}
+
 boost::uuids::uuid TaskComposerGraph::addNode(TaskComposerNode::UPtr task_node)
 {
   boost::uuids::uuid uuid = task_node->getUUID();
@@ -456,6 +486,20 @@ bool TaskComposerGraph::operator==(const TaskComposerGraph& rhs) const
 bool TaskComposerGraph::operator!=(const TaskComposerGraph& rhs) const { return !operator==(rhs); }
 // LCOV_EXCL_STOP
 
+TaskComposerNode::UPtr TaskComposerGraph::clone() const
+{
+  checkCloneType(typeid(TaskComposerGraph));
+  try
+  {
+    return std::unique_ptr<TaskComposerGraph>(new TaskComposerGraph(*this));
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logDebug("TaskComposerGraph '%s' could not be cloned, Details: %s", name_.c_str(), e.what());
+    return nullptr;
+  }
+}
+
 template <class Archive>
 void TaskComposerGraph::serialize(Archive& ar, const unsigned int /*version*/)
 {
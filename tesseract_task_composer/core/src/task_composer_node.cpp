@@ -27,6 +27,8 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <iostream>
+#include <typeinfo>
+#include <boost/core/demangle.hpp>
 #include <boost/serialization/vector.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 #include <boost/uuid/uuid_io.hpp>
@@ -37,15 +39,37 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+namespace
+{
+boost::uuids::uuid generateUUID()
+{
+  // Constructing a random_generator seeds a new Mersenne Twister from the system entropy source, which is much more
+  // expensive than generating a uuid, so keep one per thread
+  thread_local boost::uuids::random_generator generator;
+  return generator();
+}
+}  // namespace
+
 TaskComposerNode::TaskComposerNode(std::string name, TaskComposerNodeType type, bool conditional)
   : name_(std::move(name))
   , type_(type)
-  , uuid_(boost::uuids::random_generator()())
+  , uuid_(generateUUID())
   , uuid_str_(boost::uuids::to_string(uuid_))
   , conditional_(conditional)
 {
 }
 
+TaskComposerNode::TaskComposerNode(const TaskComposerNode& other)
+  : name_(other.name_)
+  , type_(other.type_)
+  , uuid_(generateUUID())
+  , uuid_str_(boost::uuids::to_string(uuid_))
+  , input_keys_(other.input_keys_)
+  , output_keys_(other.output_keys_)
+  , conditional_(other.conditional_)
+{
+}
+
 TaskComposerNode::TaskComposerNode(std::string name, TaskComposerNodeType type, const YAML::Node& config)
   : TaskComposerNode::TaskComposerNode(std::move(name), type)
 {
@@ -225,6 +249,19 @@ bool TaskComposerNode::operator==(const TaskComposerNode& rhs) const
 }
 bool TaskComposerNode::operator!=(const TaskComposerNode& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr TaskComposerNode::clone() const { return nullptr; }
+
+void TaskComposerNode::checkCloneType(const std::type_info& type) const
+{
+  if (typeid(*this) == type)
+    return;
+
+  const std::string node_type = boost::core::demangle(typeid(*this).name());
+  const std::string clone_type = boost::core::demangle(type.name());
+  throw std::runtime_error("TaskComposerNode '" + name_ + "' of type '" + node_type +
+                           "' does not implement clone, it is inherited from '" + clone_type + "'");
+}
+
 template <class Archive>
 void TaskComposerNode::serialize(Archive& ar, const unsigned int /*version*/)
 {
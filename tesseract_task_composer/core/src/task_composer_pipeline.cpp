@@ -184,6 +184,20 @@ bool TaskComposerPipeline::operator==(const TaskComposerPipeline& rhs) const
 }
 bool TaskComposerPipeline::operator!=(const TaskComposerPipeline& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr TaskComposerPipeline::clone() const
+{
+  checkCloneType(typeid(TaskComposerPipeline));
+  try
+  {
+    return std::unique_ptr<TaskComposerPipeline>(new TaskComposerPipeline(*this));
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logDebug("TaskComposerPipeline '%s' could not be cloned, Details: %s", name_.c_str(), e.what());
+    return nullptr;
+  }
+}
+
 template <class Archive>
 void TaskComposerPipeline::serialize(Archive& ar, const unsigned int /*version*/)
 {
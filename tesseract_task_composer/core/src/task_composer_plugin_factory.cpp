@@ -75,6 +75,44 @@ TaskComposerPluginFactory::TaskComposerPluginFactory(const std::string& config)
 // If not the forward declare of PluginLoader cause compiler error.
 TaskComposerPluginFactory::~TaskComposerPluginFactory() = default;
 
+TaskComposerPluginFactory::TaskComposerPluginFactory(const TaskComposerPluginFactory& other) { *this = other; }
+
+TaskComposerPluginFactory& TaskComposerPluginFactory::operator=(const TaskComposerPluginFactory& other)
+{
+  if (this == &other)
+    return *this;
+
+  std::scoped_lock lock(mutex_, other.mutex_);
+  executor_factories_ = other.executor_factories_;
+  node_factories_ = other.node_factories_;
+  node_prototypes_.clear();
+  executor_plugin_info_ = other.executor_plugin_info_;
+  task_plugin_info_ = other.task_plugin_info_;
+  plugin_loader_ = other.plugin_loader_;
+  return *this;
+}
+
+TaskComposerPluginFactory::TaskComposerPluginFactory(TaskComposerPluginFactory&& other) noexcept
+{
+  *this = std::move(other);
+}
+
+TaskComposerPluginFactory& TaskComposerPluginFactory::operator=(TaskComposerPluginFactory&& other) noexcept
+{
+  if (this == &other)
+    return *this;
+
+  std::scoped_lock lock(mutex_, other.mutex_);
+  executor_factories_ = std::move(other.executor_factories_);
+  node_factories_ = std::move(other.node_factories_);
+  node_prototypes_.clear();
+  other.node_prototypes_.clear();
+  executor_plugin_info_ = std::move(other.executor_plugin_info_);
+  task_plugin_info_ = std::move(other.task_plugin_info_);
+  plugin_loader_ = std::move(other.plugin_loader_);
+  return *this;
+}
+
 void TaskComposerPluginFactory::loadConfig(const tesseract_common::TaskComposerPluginInfo& config)
 {
   plugin_loader_.search_libraries.insert(config.search_libraries.begin(), config.search_libraries.end());
@@ -86,6 +124,7 @@ void TaskComposerPluginFactory::loadConfig(const tesseract_common::TaskComposerP
 
   task_plugin_info_.plugins.insert(config.task_plugin_infos.plugins.begin(), config.task_plugin_infos.plugins.end());
   task_plugin_info_.default_plugin = config.task_plugin_infos.default_plugin;
+  clearTaskComposerNodePrototypes();
 }
 
 void TaskComposerPluginFactory::loadConfig(const YAML::Node& config)
@@ -98,6 +137,7 @@ void TaskComposerPluginFactory::loadConfig(const YAML::Node& config)
                                            tc_plugin_info.search_libraries.end());
     executor_plugin_info_ = tc_plugin_info.executor_plugin_infos;
     task_plugin_info_ = tc_plugin_info.task_plugin_infos;
+    clearTaskComposerNodePrototypes();
   }
 }
 
@@ -108,20 +148,33 @@ void TaskComposerPluginFactory::loadConfig(const tesseract_common::fs::path& con
 
 void TaskComposerPluginFactory::loadConfig(const std::string& config) { loadConfig(YAML::Load(config)); }
 
-void TaskComposerPluginFactory::addSearchPath(const std::string& path) { plugin_loader_.search_paths.insert(path); }
+void TaskComposerPluginFactory::addSearchPath(const std::string& path)
+{
+  plugin_loader_.search_paths.insert(path);
+  clearTaskComposerNodePrototypes();
+}
 
 std::set<std::string> TaskComposerPluginFactory::getSearchPaths() const { return plugin_loader_.search_paths; }
 
-void TaskComposerPluginFactory::clearSearchPaths() { plugin_loader_.search_paths.clear(); }
+void TaskComposerPluginFactory::clearSearchPaths()
+{
+  plugin_loader_.search_paths.clear();
+  clearTaskComposerNodePrototypes();
+}
 
 void TaskComposerPluginFactory::addSearchLibrary(const std::string& library_name)
 {
   plugin_loader_.search_libraries.insert(library_name);
+  clearTaskComposerNodePrototypes();
 }
 
 std::set<std::string> TaskComposerPluginFactory::getSearchLibraries() const { return plugin_loader_.search_libraries; }
 
-void TaskComposerPluginFactory::clearSearchLibraries() { plugin_loader_.search_libraries.clear(); }
+void TaskComposerPluginFactory::clearSearchLibraries()
+{
+  plugin_loader_.search_libraries.clear();
+  clearTaskComposerNodePrototypes();
+}
 
 void TaskComposerPluginFactory::addTaskComposerExecutorPlugin(const std::string& name,
                                                               tesseract_common::PluginInfo plugin_info)
@@ -178,6 +231,7 @@ void TaskComposerPluginFactory::addTaskComposerNodePlugin(const std::string& nam
                                                           tesseract_common::PluginInfo plugin_info)
 {
   task_plugin_info_.plugins[name] = std::move(plugin_info);
+  clearTaskComposerNodePrototypes();
 }
 
 bool TaskComposerPluginFactory::hasTaskComposerNodePlugins() const { return !task_plugin_info_.plugins.empty(); }
@@ -198,6 +252,8 @@ void TaskComposerPluginFactory::removeTaskComposerNodePlugin(const std::string&
 
   if (task_plugin_info_.default_plugin == name)
     task_plugin_info_.default_plugin.clear();
+
+  clearTaskComposerNodePrototypes();
 }
 
 void TaskComposerPluginFactory::setDefaultTaskComposerNodePlugin(const std::string& name)
@@ -273,7 +329,45 @@ TaskComposerNode::UPtr TaskComposerPluginFactory::createTaskComposerNode(const s
     return nullptr;
   }
 
-  return createTaskComposerNode(name, cm_it->second);
+  TaskComposerNode::ConstPtr prototype;
+  bool has_prototype{ false };
+  {
+    std::scoped_lock lock(mutex_);
+    auto it = node_prototypes_.find(name);
+    if (it != node_prototypes_.end())
+    {
+      prototype = it->second;
+      has_prototype = true;
+    }
+  }
+
+  if (prototype != nullptr)
+  {
+    TaskComposerNode::UPtr node = prototype->clone();
+    if (node != nullptr)
+      return node;
+  }
+
+  TaskComposerNode::UPtr node = createTaskComposerNode(name, cm_it->second);
+  if (node != nullptr && !has_prototype)
+  {
+    // The factory may create nodes which do not support clone so store nullptr to avoid trying again
+    TaskComposerNode::ConstPtr new_prototype;
+    try
+    {
+      new_prototype = node->clone();
+    }
+    catch (const std::exception& e)
+    {
+      CONSOLE_BRIDGE_logDebug(
+          "TaskComposerPluginFactory, node '%s' can not be cloned, Details: %s", name.c_str(), e.what());
+    }
+
+    std::scoped_lock lock(mutex_);
+    node_prototypes_.emplace(name, std::move(new_prototype));
+  }
+
+  return node;
 }
 
 TaskComposerNode::UPtr
@@ -282,17 +376,27 @@ TaskComposerPluginFactory::createTaskComposerNode(const std::string& name,
 {
   try
   {
-    auto it = node_factories_.find(plugin_info.class_name);
-    if (it != node_factories_.end())
-      return it->second->create(name, plugin_info.config, *this);
-
-    auto plugin = plugin_loader_.instantiate<TaskComposerNodeFactory>(plugin_info.class_name);
-    if (plugin == nullptr)
+    TaskComposerNodeFactory::Ptr plugin;
     {
-      CONSOLE_BRIDGE_logWarn("Failed to load symbol '%s'", plugin_info.class_name.c_str());
-      return nullptr;
+      std::scoped_lock lock(mutex_);
+      auto it = node_factories_.find(plugin_info.class_name);
+      if (it != node_factories_.end())
+      {
+        plugin = it->second;
+      }
+      else
+      {
+        plugin = plugin_loader_.instantiate<TaskComposerNodeFactory>(plugin_info.class_name);
+        if (plugin == nullptr)
+        {
+          CONSOLE_BRIDGE_logWarn("Failed to load symbol '%s'", plugin_info.class_name.c_str());
+          return nullptr;
+        }
+        node_factories_[plugin_info.class_name] = plugin;
+      }
     }
-    node_factories_[plugin_info.class_name] = plugin;
+
+    // Created outside of the lock because graphs recursively create their nodes using this factory
     return plugin->create(name, plugin_info.config, *this);
   }
   catch (const std::exception& e)
@@ -302,6 +406,12 @@ TaskComposerPluginFactory::createTaskComposerNode(const std::string& name,
   }
 }
 
+void TaskComposerPluginFactory::clearTaskComposerNodePrototypes() const
+{
+  std::scoped_lock lock(mutex_);
+  node_prototypes_.clear();
+}
+
 void TaskComposerPluginFactory::saveConfig(const tesseract_common::fs::path& file_path) const
 {
   YAML::Node config = getConfig();
@@ -26,6 +26,8 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <sstream>
+#include <boost/archive/binary_oarchive.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
 #include <boost/serialization/library_version_type.hpp>
@@ -41,6 +43,18 @@ TaskComposerProblem::TaskComposerProblem(std::string name, bool dotgraph) : name
 
 TaskComposerProblem::UPtr TaskComposerProblem::clone() const { return std::make_unique<TaskComposerProblem>(*this); }
 
+std::string TaskComposerProblem::getResultCacheKey() const
+{
+  std::ostringstream os;
+  {
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << boost::serialization::make_nvp("name", name);
+    oa << boost::serialization::make_nvp("dotgraph", dotgraph);
+    oa << boost::serialization::make_nvp("input", input);
+  }
+  return os.str();
+}
+
 bool TaskComposerProblem::operator==(const TaskComposerProblem& rhs) const
 {
   bool equal = true;
@@ -0,0 +1,228 @@
+/**
+ * @file task_composer_result_cache.cpp
+ * @brief A cache of task composer results
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <sstream>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/nvp.hpp>
+#include <console_bridge/console.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_task_composer/core/task_composer_result_cache.h>
+
+namespace tesseract_planning
+{
+namespace
+{
+/** @brief A stream buffer which only counts the number of characters written to it */
+class CountingStreamBuf : public std::streambuf
+{
+public:
+  std::size_t count{ 0 };
+
+protected:
+  std::streamsize xsputn(const char* /*s*/, std::streamsize n) override
+  {
+    count += static_cast<std::size_t>(n);
+    return n;
+  }
+
+  int_type overflow(int_type ch) override
+  {
+    if (!traits_type::eq_int_type(ch, traits_type::eof()))
+      ++count;
+
+    return traits_type::not_eof(ch);
+  }
+};
+
+/** @brief The future returned for a cached result, which is always ready */
+class TaskComposerResultCacheFuture : public TaskComposerFuture
+{
+public:
+  TaskComposerResultCacheFuture(TaskComposerContext::Ptr context) : TaskComposerFuture(std::move(context)) {}
+
+  void clear() override final { context = nullptr; }
+
+  bool valid() const override final { return (context != nullptr); }
+
+  bool ready() const override final { return true; }
+
+  void wait() const override final {}
+
+  std::future_status waitFor(const std::chrono::duration<double>& /*duration*/) const override final
+  {
+    return std::future_status::ready;
+  }
+
+  std::future_status
+  waitUntil(const std::chrono::time_point<std::chrono::high_resolution_clock>& /*abs*/) const override final
+  {
+    return std::future_status::ready;
+  }
+
+  TaskComposerFuture::UPtr copy() const override final
+  {
+    return std::make_unique<TaskComposerResultCacheFuture>(context);
+  }
+};
+}  // namespace
+
+TaskComposerResultCache::TaskComposerResultCache(std::size_t max_memory) : max_memory_(max_memory) {}
+
+std::optional<std::string> TaskComposerResultCache::createKey(const TaskComposerProblem& problem,
+                                                              const TaskComposerDataStorage& data_storage)
+{
+  try
+  {
+    std::ostringstream os;
+    os << problem.getResultCacheKey();
+    {
+      boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+      oa << boost::serialization::make_nvp("data_storage", data_storage);
+    }
+    return os.str();
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logDebug(
+        "TaskComposerResultCache, problem '%s' can not be cached: %s", problem.name.c_str(), e.what());
+    return std::nullopt;
+  }
+}
+
+TaskComposerFuture::UPtr TaskComposerResultCache::get(const std::string& key, TaskComposerProblem::Ptr problem)
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  auto it = index_.find(key);
+  if (it == index_.end())
+  {
+    ++misses_;
+    return nullptr;
+  }
+
+  ++hits_;
+  entries_.splice(entries_.begin(), entries_, it->second);
+
+  auto data_storage = std::make_shared<TaskComposerDataStorage>(it->second->data_storage);
+  auto context = std::make_shared<TaskComposerContext>(std::move(problem), std::move(data_storage));
+  context->task_infos = it->second->task_infos;
+  return std::make_unique<TaskComposerResultCacheFuture>(std::move(context));
+}
+
+bool TaskComposerResultCache::put(const std::string& key, const TaskComposerContext& context) noexcept
+{
+  if (!context.isSuccessful() || context.data_storage == nullptr)
+    return false;
+
+  try
+  {
+    Entry entry;
+    entry.key = key;
+    entry.data_storage = *context.data_storage;
+    entry.task_infos = context.task_infos;
+
+    CountingStreamBuf buffer;
+    {
+      boost::archive::binary_oarchive oa(buffer, boost::archive::no_header);
+      oa << boost::serialization::make_nvp("data_storage", *context.data_storage);
+      oa << boost::serialization::make_nvp("task_infos", context.task_infos);
+    }
+    entry.memory = sizeof(Entry) + key.size() + buffer.count;
+
+    if (entry.memory > max_memory_)
+      return false;
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    auto it = index_.find(key);
+    if (it != index_.end())
+    {
+      auto entry_it = it->second;
+      index_.erase(it);
+      memory_ -= entry_it->memory;
+      entries_.erase(entry_it);
+    }
+
+    while (!entries_.empty() && (memory_ + entry.memory) > max_memory_)
+    {
+      memory_ -= entries_.back().memory;
+      index_.erase(entries_.back().key);
+      entries_.pop_back();
+    }
+
+    memory_ += entry.memory;
+    entries_.push_front(std::move(entry));
+    index_[entries_.front().key] = entries_.begin();
+    return true;
+  }
+  catch (const std::exception& e)
+  {
+    CONSOLE_BRIDGE_logDebug("TaskComposerResultCache, result of problem can not be cached: %s", e.what());
+    return false;
+  }
+}
+
+std::size_t TaskComposerResultCache::size() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t TaskComposerResultCache::getMemoryUsage() const
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  return memory_;
+}
+
+std::size_t TaskComposerResultCache::getMaxMemory() const { return max_memory_; }
+
+std::size_t TaskComposerResultCache::getHits() const { return hits_; }
+
+std::size_t TaskComposerResultCache::getMisses() const { return misses_; }
+
+double TaskComposerResultCache::getHitRate() const
+{
+  const std::size_t hits = hits_;
+  const std::size_t lookups = hits + misses_;
+  return (lookups == 0) ? 0 : static_cast<double>(hits) / static_cast<double>(lookups);
+}
+
+void TaskComposerResultCache::resetStatistics()
+{
+  hits_ = 0;
+  misses_ = 0;
+}
+
+void TaskComposerResultCache::clear()
+{
+  std::unique_lock<std::mutex> lock(mutex_);
+  index_.clear();
+  entries_.clear();
+  memory_ = 0;
+}
+
+}  // namespace tesseract_planning
@@ -104,6 +104,10 @@ std::vector<std::string> TaskComposerServer::getAvailableTasks() const
   return tasks;
 }
 
+void TaskComposerServer::setResultCache(TaskComposerResultCache::Ptr cache) { result_cache_ = std::move(cache); }
+
+TaskComposerResultCache::Ptr TaskComposerServer::getResultCache() const { return result_cache_; }
+
 TaskComposerFuture::UPtr TaskComposerServer::run(TaskComposerProblem::Ptr problem,
                                                  TaskComposerDataStorage::Ptr data_storage,
                                                  const std::string& name)
@@ -116,7 +120,27 @@ TaskComposerFuture::UPtr TaskComposerServer::run(TaskComposerProblem::Ptr proble
   if (t_it == tasks_.end())
     throw std::runtime_error("Task with name '" + problem->name + "' does not exist!");
 
-  return e_it->second->run(*t_it->second, std::move(problem), std::move(data_storage));
+  if (result_cache_ == nullptr)
+    return e_it->second->run(*t_it->second, std::move(problem), std::move(data_storage));
+
+  std::optional<std::string> key = TaskComposerResultCache::createKey(
+      *problem, (data_storage != nullptr) ? *data_storage : TaskComposerDataStorage());
+  if (!key.has_value())
+    return e_it->second->run(*t_it->second, std::move(problem), std::move(data_storage));
+
+  TaskComposerFuture::UPtr future = result_cache_->get(key.value(), problem);
+  if (future != nullptr)
+    return future;
+
+  // The result is stored once the execution has finished, even if the future is never waited on
+  std::weak_ptr<TaskComposerResultCache> cache = result_cache_;
+  return e_it->second->run(*t_it->second,
+                           std::move(problem),
+                           std::move(data_storage),
+                           [cache, key = std::move(key.value())](const TaskComposerContext& context) {
+                             if (auto locked_cache = cache.lock())
+                               locked_cache->put(key, context);
+                           });
 }
 
 TaskComposerFuture::UPtr TaskComposerServer::run(const TaskComposerNode& node,
@@ -63,6 +63,12 @@ bool TestTask::operator==(const TestTask& rhs) const
 }
 bool TestTask::operator!=(const TestTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr TestTask::clone() const
+{
+  checkCloneType(typeid(TestTask));
+  return std::unique_ptr<TestTask>(new TestTask(*this));
+}
+
 template <class Archive>
 void TestTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -50,7 +50,6 @@ public:
   explicit CheckInputTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
 
   ~CheckInputTask() override = default;
-  CheckInputTask(const CheckInputTask&) = delete;
   CheckInputTask& operator=(const CheckInputTask&) = delete;
   CheckInputTask(CheckInputTask&&) = delete;
   CheckInputTask& operator=(CheckInputTask&&) = delete;
@@ -58,7 +57,11 @@ public:
   bool operator==(const CheckInputTask& rhs) const;
   bool operator!=(const CheckInputTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  CheckInputTask(const CheckInputTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -54,7 +54,6 @@ public:
                                       const TaskComposerPluginFactory& plugin_factory);
 
   ~ContinuousContactCheckTask() override = default;
-  ContinuousContactCheckTask(const ContinuousContactCheckTask&) = delete;
   ContinuousContactCheckTask& operator=(const ContinuousContactCheckTask&) = delete;
   ContinuousContactCheckTask(ContinuousContactCheckTask&&) = delete;
   ContinuousContactCheckTask& operator=(ContinuousContactCheckTask&&) = delete;
@@ -62,7 +61,11 @@ public:
   bool operator==(const ContinuousContactCheckTask& rhs) const;
   bool operator!=(const ContinuousContactCheckTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  ContinuousContactCheckTask(const ContinuousContactCheckTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
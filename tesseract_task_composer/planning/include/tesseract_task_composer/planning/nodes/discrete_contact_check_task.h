@@ -54,7 +54,6 @@ public:
                                     const TaskComposerPluginFactory& plugin_factory);
 
   ~DiscreteContactCheckTask() override = default;
-  DiscreteContactCheckTask(const DiscreteContactCheckTask&) = delete;
   DiscreteContactCheckTask& operator=(const DiscreteContactCheckTask&) = delete;
   DiscreteContactCheckTask(DiscreteContactCheckTask&&) = delete;
   DiscreteContactCheckTask& operator=(DiscreteContactCheckTask&&) = delete;
@@ -62,7 +61,11 @@ public:
   bool operator==(const DiscreteContactCheckTask& rhs) const;
   bool operator!=(const DiscreteContactCheckTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  DiscreteContactCheckTask(const DiscreteContactCheckTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -55,7 +55,6 @@ public:
                               const YAML::Node& config,
                               const TaskComposerPluginFactory& plugin_factory);
   ~FixStateBoundsTask() override = default;
-  FixStateBoundsTask(const FixStateBoundsTask&) = delete;
   FixStateBoundsTask& operator=(const FixStateBoundsTask&) = delete;
   FixStateBoundsTask(FixStateBoundsTask&&) = delete;
   FixStateBoundsTask& operator=(FixStateBoundsTask&&) = delete;
@@ -63,7 +62,11 @@ public:
   bool operator==(const FixStateBoundsTask& rhs) const;
   bool operator!=(const FixStateBoundsTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  FixStateBoundsTask(const FixStateBoundsTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -67,7 +67,6 @@ public:
                                  const YAML::Node& config,
                                  const TaskComposerPluginFactory& plugin_factory);
   ~FixStateCollisionTask() override = default;
-  FixStateCollisionTask(const FixStateCollisionTask&) = delete;
   FixStateCollisionTask& operator=(const FixStateCollisionTask&) = delete;
   FixStateCollisionTask(FixStateCollisionTask&&) = delete;
   FixStateCollisionTask& operator=(FixStateCollisionTask&&) = delete;
@@ -75,7 +74,11 @@ public:
   bool operator==(const FixStateCollisionTask& rhs) const;
   bool operator!=(const FixStateCollisionTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  FixStateCollisionTask(const FixStateCollisionTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -67,7 +67,6 @@ public:
                              const YAML::Node& config,
                              const TaskComposerPluginFactory& plugin_factory);
   ~FormatAsInputTask() override = default;
-  FormatAsInputTask(const FormatAsInputTask&) = delete;
   FormatAsInputTask& operator=(const FormatAsInputTask&) = delete;
   FormatAsInputTask(FormatAsInputTask&&) = delete;
   FormatAsInputTask& operator=(FormatAsInputTask&&) = delete;
@@ -75,7 +74,11 @@ public:
   bool operator==(const FormatAsInputTask& rhs) const;
   bool operator!=(const FormatAsInputTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  FormatAsInputTask(const FormatAsInputTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
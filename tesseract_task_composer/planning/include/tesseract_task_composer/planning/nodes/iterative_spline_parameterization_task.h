@@ -56,7 +56,6 @@ public:
                                                const YAML::Node& config,
                                                const TaskComposerPluginFactory& plugin_factory);
   ~IterativeSplineParameterizationTask() override = default;
-  IterativeSplineParameterizationTask(const IterativeSplineParameterizationTask&) = delete;
   IterativeSplineParameterizationTask& operator=(const IterativeSplineParameterizationTask&) = delete;
   IterativeSplineParameterizationTask(IterativeSplineParameterizationTask&&) = delete;
   IterativeSplineParameterizationTask& operator=(IterativeSplineParameterizationTask&&) = delete;
@@ -64,7 +63,11 @@ public:
   bool operator==(const IterativeSplineParameterizationTask& rhs) const;
   bool operator!=(const IterativeSplineParameterizationTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  IterativeSplineParameterizationTask(const IterativeSplineParameterizationTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
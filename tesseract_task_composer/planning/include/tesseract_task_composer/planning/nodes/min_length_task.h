@@ -51,7 +51,6 @@ public:
   explicit MinLengthTask(std::string name, std::string input_key, std::string output_key, bool conditional = false);
   explicit MinLengthTask(std::string name, const YAML::Node& config, const TaskComposerPluginFactory& plugin_factory);
   ~MinLengthTask() override = default;
-  MinLengthTask(const MinLengthTask&) = delete;
   MinLengthTask& operator=(const MinLengthTask&) = delete;
   MinLengthTask(MinLengthTask&&) = delete;
   MinLengthTask& operator=(MinLengthTask&&) = delete;
@@ -59,7 +58,11 @@ public:
   bool operator==(const MinLengthTask& rhs) const;
   bool operator!=(const MinLengthTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  MinLengthTask(const MinLengthTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
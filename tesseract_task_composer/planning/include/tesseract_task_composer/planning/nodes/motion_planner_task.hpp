@@ -32,6 +32,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <boost/serialization/access.hpp>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
+#include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_task.h>
 #include <tesseract_task_composer/planning/nodes/motion_planner_task_info.h>
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
@@ -99,7 +100,21 @@ public:
 
   bool operator!=(const MotionPlannerTask& rhs) const { return !operator==(rhs); }
 
+  TaskComposerNode::UPtr clone() const override
+  {
+    checkCloneType(typeid(MotionPlannerTask));
+    return std::unique_ptr<MotionPlannerTask>(new MotionPlannerTask(*this));
+  }
+
 protected:
+  /** @brief Copy constructor used by clone, the copy gets its own planner if the other task has one */
+  MotionPlannerTask(const MotionPlannerTask& other)
+    : TaskComposerTask(other)
+    , planner_((other.planner_ != nullptr) ? std::make_shared<MotionPlannerType>(other.planner_->getName()) : nullptr)
+    , format_result_as_input_(other.format_result_as_input_)
+  {
+  }
+
   std::shared_ptr<MotionPlannerType> planner_;
   bool format_result_as_input_{ true };
 
@@ -113,7 +128,7 @@ protected:
   }
 
   TaskComposerNodeInfo::UPtr runImpl(TaskComposerContext& context,
-                                     OptionalTaskComposerExecutor /*executor*/ = std::nullopt) const override
+                                     OptionalTaskComposerExecutor executor = std::nullopt) const override
   {
     // Get the problem
     auto& problem = dynamic_cast<PlanningTaskComposerProblem&>(*context.problem);
@@ -125,31 +140,41 @@ protected:
     // --------------------
     // Check that inputs are valid
     // --------------------
-    auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-    if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+    auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+    if (input_data_poly == nullptr || input_data_poly->isNull() ||
+        input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
     {
       info->message = "Input instructions to MotionPlannerTask: " + name_ + " must be a composite instruction";
       CONSOLE_BRIDGE_logError("%s", info->message.c_str());
       return info;
     }
 
-    // Make a non-const copy of the input instructions to update the start/end
-    auto& instructions = input_data_poly.template as<CompositeInstruction>();
-    assert(!(problem.manip_info.empty() && instructions.getManipulatorInfo().empty()));
-    instructions.setManipulatorInfo(instructions.getManipulatorInfo().getCombined(problem.manip_info));
-
     // --------------------
     // Fill out request
     // --------------------
     PlannerRequest request;
     request.env_state = problem.env->getState();
     request.env = problem.env;
-    request.instructions = instructions;
+
+    // The request holds the only copy of the input instructions, which is updated with the manipulator information
+    request.instructions = input_data_poly->template as<CompositeInstruction>();
+    CompositeInstruction& instructions = request.instructions;
+    assert(!(problem.manip_info.empty() && instructions.getManipulatorInfo().empty()));
+    instructions.setManipulatorInfo(instructions.getManipulatorInfo().getCombined(problem.manip_info));
     request.profiles = problem.profiles;
     request.plan_profile_remapping = problem.move_profile_remapping;
     request.composite_profile_remapping = problem.composite_profile_remapping;
     request.format_result_as_input = format_result_as_input_;
 
+    // Independent planner jobs run on the executor instead of threads created by the planner
+    if (executor.has_value())
+    {
+      TaskComposerExecutor& task_executor = executor.value().get();
+      request.parallel_for = [&task_executor](std::size_t count, const std::function<void(std::size_t)>& job) {
+        task_executor.corunFor(count, job);
+      };
+    }
+
     // --------------------
     // Fill out response
     // --------------------
@@ -163,7 +188,7 @@ protected:
     // --------------------
     if (response)
     {
-      context.data_storage->setData(output_keys_[0], response.results);
+      context.data_storage->setData(output_keys_[0], std::move(response.results));
 
       info->return_value = 1;
       info->color = "green";
@@ -180,7 +205,7 @@ protected:
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->message = response.message;
     return info;
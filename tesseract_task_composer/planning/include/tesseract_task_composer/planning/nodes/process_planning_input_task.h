@@ -53,7 +53,6 @@ public:
                                     const TaskComposerPluginFactory& plugin_factory);
 
   ~ProcessPlanningInputTask() override = default;
-  ProcessPlanningInputTask(const ProcessPlanningInputTask&) = delete;
   ProcessPlanningInputTask& operator=(const ProcessPlanningInputTask&) = delete;
   ProcessPlanningInputTask(ProcessPlanningInputTask&&) = delete;
   ProcessPlanningInputTask& operator=(ProcessPlanningInputTask&&) = delete;
@@ -61,7 +60,11 @@ public:
   bool operator==(const ProcessPlanningInputTask& rhs) const;
   bool operator!=(const ProcessPlanningInputTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  ProcessPlanningInputTask(const ProcessPlanningInputTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
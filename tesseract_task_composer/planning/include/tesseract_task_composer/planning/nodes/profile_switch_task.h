@@ -52,7 +52,6 @@ public:
                              const YAML::Node& config,
                              const TaskComposerPluginFactory& plugin_factory);
   ~ProfileSwitchTask() override = default;
-  ProfileSwitchTask(const ProfileSwitchTask&) = delete;
   ProfileSwitchTask& operator=(const ProfileSwitchTask&) = delete;
   ProfileSwitchTask(ProfileSwitchTask&&) = delete;
   ProfileSwitchTask& operator=(ProfileSwitchTask&&) = delete;
@@ -60,7 +59,11 @@ public:
   bool operator==(const ProfileSwitchTask& rhs) const;
   bool operator!=(const ProfileSwitchTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  ProfileSwitchTask(const ProfileSwitchTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
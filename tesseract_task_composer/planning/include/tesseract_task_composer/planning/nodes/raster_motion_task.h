@@ -81,7 +81,6 @@ public:
                             const TaskComposerPluginFactory& plugin_factory);
 
   ~RasterMotionTask() override = default;
-  RasterMotionTask(const RasterMotionTask&) = delete;
   RasterMotionTask& operator=(const RasterMotionTask&) = delete;
   RasterMotionTask(RasterMotionTask&&) = delete;
   RasterMotionTask& operator=(RasterMotionTask&&) = delete;
@@ -89,7 +88,11 @@ public:
   bool operator==(const RasterMotionTask& rhs) const;
   bool operator!=(const RasterMotionTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  RasterMotionTask(const RasterMotionTask&) = default;
+
   TaskFactory freespace_task_factory_;
   TaskFactory raster_task_factory_;
   TaskFactory transition_task_factory_;
@@ -75,7 +75,6 @@ public:
                                 const TaskComposerPluginFactory& plugin_factory);
 
   ~RasterOnlyMotionTask() override = default;
-  RasterOnlyMotionTask(const RasterOnlyMotionTask&) = delete;
   RasterOnlyMotionTask& operator=(const RasterOnlyMotionTask&) = delete;
   RasterOnlyMotionTask(RasterOnlyMotionTask&&) = delete;
   RasterOnlyMotionTask& operator=(RasterOnlyMotionTask&&) = delete;
@@ -83,7 +82,11 @@ public:
   bool operator==(const RasterOnlyMotionTask& rhs) const;
   bool operator!=(const RasterOnlyMotionTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  RasterOnlyMotionTask(const RasterOnlyMotionTask&) = default;
+
   TaskFactory raster_task_factory_;
   TaskFactory transition_task_factory_;
 
@@ -51,7 +51,6 @@ public:
                                          const YAML::Node& config,
                                          const TaskComposerPluginFactory& plugin_factory);
   ~RuckigTrajectorySmoothingTask() override = default;
-  RuckigTrajectorySmoothingTask(const RuckigTrajectorySmoothingTask&) = delete;
   RuckigTrajectorySmoothingTask& operator=(const RuckigTrajectorySmoothingTask&) = delete;
   RuckigTrajectorySmoothingTask(RuckigTrajectorySmoothingTask&&) = delete;
   RuckigTrajectorySmoothingTask& operator=(RuckigTrajectorySmoothingTask&&) = delete;
@@ -59,7 +58,11 @@ public:
   bool operator==(const RuckigTrajectorySmoothingTask& rhs) const;
   bool operator!=(const RuckigTrajectorySmoothingTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  RuckigTrajectorySmoothingTask(const RuckigTrajectorySmoothingTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
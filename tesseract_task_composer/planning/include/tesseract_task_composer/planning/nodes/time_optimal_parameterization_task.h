@@ -55,7 +55,6 @@ public:
                                            const YAML::Node& config,
                                            const TaskComposerPluginFactory& /*plugin_factory*/);
   ~TimeOptimalParameterizationTask() override = default;
-  TimeOptimalParameterizationTask(const TimeOptimalParameterizationTask&) = delete;
   TimeOptimalParameterizationTask& operator=(const TimeOptimalParameterizationTask&) = delete;
   TimeOptimalParameterizationTask(TimeOptimalParameterizationTask&&) = delete;
   TimeOptimalParameterizationTask& operator=(TimeOptimalParameterizationTask&&) = delete;
@@ -63,7 +62,11 @@ public:
   bool operator==(const TimeOptimalParameterizationTask& rhs) const;
   bool operator!=(const TimeOptimalParameterizationTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  TimeOptimalParameterizationTask(const TimeOptimalParameterizationTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -57,7 +57,11 @@ public:
   bool operator==(const UpdateEndStateTask& rhs) const;
   bool operator!=(const UpdateEndStateTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  UpdateEndStateTask(const UpdateEndStateTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
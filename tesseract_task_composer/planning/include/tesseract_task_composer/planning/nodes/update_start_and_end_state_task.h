@@ -61,7 +61,11 @@ public:
   bool operator==(const UpdateStartAndEndStateTask& rhs) const;
   bool operator!=(const UpdateStartAndEndStateTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  UpdateStartAndEndStateTask(const UpdateStartAndEndStateTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -56,7 +56,11 @@ public:
   bool operator==(const UpdateStartStateTask& rhs) const;
   bool operator!=(const UpdateStartStateTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  UpdateStartStateTask(const UpdateStartStateTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
@@ -60,7 +60,6 @@ public:
                                   const YAML::Node& config,
                                   const TaskComposerPluginFactory& plugin_factory);
   ~UpsampleTrajectoryTask() override = default;
-  UpsampleTrajectoryTask(const UpsampleTrajectoryTask&) = delete;
   UpsampleTrajectoryTask& operator=(const UpsampleTrajectoryTask&) = delete;
   UpsampleTrajectoryTask(UpsampleTrajectoryTask&&) = delete;
   UpsampleTrajectoryTask& operator=(UpsampleTrajectoryTask&&) = delete;
@@ -68,7 +67,11 @@ public:
   bool operator==(const UpsampleTrajectoryTask& rhs) const;
   bool operator!=(const UpsampleTrajectoryTask& rhs) const;
 
+  TaskComposerNode::UPtr clone() const override;
+
 protected:
+  UpsampleTrajectoryTask(const UpsampleTrajectoryTask&) = default;
+
   friend struct tesseract_common::Serialization;
   friend class boost::serialization::access;
   template <class Archive>
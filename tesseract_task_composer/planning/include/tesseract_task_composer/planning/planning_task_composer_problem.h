@@ -100,6 +100,16 @@ struct PlanningTaskComposerProblem : public TaskComposerProblem
 
   TaskComposerProblem::UPtr clone() const override;
 
+  /**
+   * @copydoc TaskComposerProblem::getResultCacheKey
+   * @details This also includes the name, revision, joint state and a hash of the command history of the environment,
+   * the manipulator info, the profile remapping and the version of the profile dictionary. Hashing the command history
+   * identifies the content of the environment, since the name and revision are not unique across environments. The
+   * profiles are not serializable, so the version changes whenever a profile is added or removed, see
+   * ProfileDictionary::getVersion. Modifying a profile already in the dictionary is not detected.
+   */
+  std::string getResultCacheKey() const override;
+
   bool operator==(const PlanningTaskComposerProblem& rhs) const;
   bool operator!=(const PlanningTaskComposerProblem& rhs) const;
 
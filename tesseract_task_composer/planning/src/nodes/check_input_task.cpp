@@ -72,15 +72,16 @@ TaskComposerNodeInfo::UPtr CheckInputTask::runImpl(TaskComposerContext& context,
   info->return_value = 0;
   for (const auto& key : input_keys_)
   {
-    auto input_data_poly = context.data_storage->getData(key);
-    if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+    auto input_data_poly = context.data_storage->getSharedData(key);
+    if (input_data_poly == nullptr || input_data_poly->isNull() ||
+        input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
     {
       info->message = "Input key '" + key + "' is missing";
       CONSOLE_BRIDGE_logError("%s", info->message.c_str());
       return info;
     }
 
-    const auto& ci = input_data_poly.as<CompositeInstruction>();
+    const auto& ci = input_data_poly->as<CompositeInstruction>();
     std::string profile = ci.getProfile();
     profile = getProfileString(name_, profile, problem.composite_profile_remapping);
     auto cur_composite_profile =
@@ -103,6 +104,12 @@ TaskComposerNodeInfo::UPtr CheckInputTask::runImpl(TaskComposerContext& context,
 bool CheckInputTask::operator==(const CheckInputTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool CheckInputTask::operator!=(const CheckInputTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr CheckInputTask::clone() const
+{
+  checkCloneType(typeid(CheckInputTask));
+  return std::unique_ptr<CheckInputTask>(new CheckInputTask(*this));
+}
+
 template <class Archive>
 void CheckInputTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -37,9 +37,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/planning/nodes/continuous_contact_check_task.h>
 #include <tesseract_task_composer/planning/profiles/contact_check_profile.h>
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
+#include <tesseract_task_composer/core/task_composer_executor.h>
 
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_motion_planners/core/utils.h>
+#include <tesseract_motion_planners/core/contact_manager_pool.h>
 #include <tesseract_motion_planners/planner_utils.h>
 #include <tesseract_collision/core/serialization.h>
 
@@ -67,7 +69,7 @@ ContinuousContactCheckTask::ContinuousContactCheckTask(std::string name,
 }
 
 TaskComposerNodeInfo::UPtr ContinuousContactCheckTask::runImpl(TaskComposerContext& context,
-                                                               OptionalTaskComposerExecutor /*executor*/) const
+                                                               OptionalTaskComposerExecutor executor) const
 {
   // Get the problem
   auto& problem = dynamic_cast<PlanningTaskComposerProblem&>(*context.problem);
@@ -79,8 +81,9 @@ TaskComposerNodeInfo::UPtr ContinuousContactCheckTask::runImpl(TaskComposerConte
   // --------------------
   // Check that inputs are valid
   // --------------------
-  auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+  if (input_data_poly == nullptr || input_data_poly->isNull() ||
+      input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input seed to ContinuousContactCheckTask must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -89,7 +92,7 @@ TaskComposerNodeInfo::UPtr ContinuousContactCheckTask::runImpl(TaskComposerConte
   }
 
   // Get Composite Profile
-  const auto& ci = input_data_poly.as<CompositeInstruction>();
+  const auto& ci = input_data_poly->as<CompositeInstruction>();
   std::string profile = ci.getProfile();
   profile = getProfileString(name_, profile, problem.composite_profile_remapping);
   auto default_profile = std::make_shared<ContactCheckProfile>();
@@ -102,12 +105,22 @@ TaskComposerNodeInfo::UPtr ContinuousContactCheckTask::runImpl(TaskComposerConte
   tesseract_kinematics::JointGroup::UPtr manip = problem.env->getJointGroup(manip_info.manipulator);
   tesseract_scene_graph::StateSolver::UPtr state_solver = problem.env->getStateSolver();
 
-  tesseract_collision::ContinuousContactManager::Ptr manager = problem.env->getContinuousContactManager();
-  manager->setActiveCollisionObjects(manip->getActiveLinkNames());
-  manager->applyContactManagerConfig(cur_composite_profile->config.contact_manager_config);
+  tesseract_collision::ContinuousContactManager::Ptr manager =
+      ContactManagerPool::getDefault().getContinuousContactManager(
+          problem.env, manip->getActiveLinkNames(), cur_composite_profile->config.contact_manager_config);
+
+  // The chunks of the program are checked on the executor
+  PlannerParallelFor parallel_for;
+  if (executor.has_value())
+  {
+    TaskComposerExecutor& task_executor = executor.value().get();
+    parallel_for = [&task_executor](std::size_t count, const std::function<void(std::size_t)>& job) {
+      task_executor.corunFor(count, job);
+    };
+  }
 
   std::vector<tesseract_collision::ContactResultMap> contacts;
-  if (contactCheckProgram(contacts, *manager, *state_solver, ci, cur_composite_profile->config))
+  if (contactCheckProgram(contacts, *manager, *state_solver, ci, cur_composite_profile->config, parallel_for))
   {
     info->message = "Results are not contact free for process input: " + ci.getDescription();
     CONSOLE_BRIDGE_logInform("%s", info->message.c_str());
@@ -134,6 +147,12 @@ bool ContinuousContactCheckTask::operator==(const ContinuousContactCheckTask& rh
 }
 bool ContinuousContactCheckTask::operator!=(const ContinuousContactCheckTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr ContinuousContactCheckTask::clone() const
+{
+  checkCloneType(typeid(ContinuousContactCheckTask));
+  return std::unique_ptr<ContinuousContactCheckTask>(new ContinuousContactCheckTask(*this));
+}
+
 template <class Archive>
 void ContinuousContactCheckTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
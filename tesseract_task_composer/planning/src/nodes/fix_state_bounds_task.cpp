@@ -122,7 +122,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
               // If the output key is not the same as the input key the output data should be assigned the input data
               // for error branching
               if (output_keys_[0] != input_keys_[0])
-                context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+                context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
               info->message = "Failed to clamp to joint limits";
               return info;
@@ -148,7 +148,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
               // If the output key is not the same as the input key the output data should be assigned the input data
               // for error branching
               if (output_keys_[0] != input_keys_[0])
-                context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+                context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
               info->message = "Failed to clamp to joint limits";
               return info;
@@ -164,7 +164,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
       if (flattened.empty())
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], input_data_poly);
+          context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
         info->color = "green";
         info->message = "FixStateBoundsTask found no MoveInstructions to process";
@@ -194,7 +194,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             info->message = "Failed to clamp to joint limits";
             return info;
@@ -206,7 +206,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
     case FixStateBoundsProfile::Settings::DISABLED:
     {
       if (output_keys_[0] != input_keys_[0])
-        context.data_storage->setData(output_keys_[0], input_data_poly);
+        context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
       info->color = "green";
       info->message = "Successful, DISABLED";
       info->return_value = 1;
@@ -214,7 +214,7 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
     }
   }
 
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -226,6 +226,12 @@ TaskComposerNodeInfo::UPtr FixStateBoundsTask::runImpl(TaskComposerContext& cont
 bool FixStateBoundsTask::operator==(const FixStateBoundsTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool FixStateBoundsTask::operator!=(const FixStateBoundsTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr FixStateBoundsTask::clone() const
+{
+  checkCloneType(typeid(FixStateBoundsTask));
+  return std::unique_ptr<FixStateBoundsTask>(new FixStateBoundsTask(*this));
+}
+
 template <class Archive>
 void FixStateBoundsTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -41,6 +41,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/utils.h>
 #include <tesseract_motion_planners/planner_utils.h>
+#include <tesseract_motion_planners/core/contact_manager_pool.h>
 #include <tesseract_collision/core/serialization.h>
 
 namespace tesseract_planning
@@ -57,9 +58,9 @@ bool stateInCollision(const Eigen::Ref<const Eigen::VectorXd>& start_pos,
   tesseract_common::ManipulatorInfo mi = manip_info.getCombined(problem.manip_info);
   auto joint_group = problem.env->getJointGroup(mi.manipulator);
 
-  DiscreteContactManager::Ptr manager = problem.env->getDiscreteContactManager();
-  manager->setActiveCollisionObjects(joint_group->getActiveLinkNames());
-  manager->applyContactManagerConfig(profile.collision_check_config.contact_manager_config);
+  // Cloning the contact manager is far more expensive than the check itself, so reuse managers from the pool
+  DiscreteContactManager::Ptr manager = ContactManagerPool::getDefault().getDiscreteContactManager(
+      problem.env, joint_group->getActiveLinkNames(), profile.collision_check_config.contact_manager_config);
 
   tesseract_common::TransformMap state = joint_group->calcFwdKin(start_pos);
   contacts.clear();
@@ -214,10 +215,10 @@ bool moveWaypointFromCollisionTrajopt(WaypointPoly& waypoint,
     CONSOLE_BRIDGE_logError("MoveWaypointFromCollision did not converge");
 
     tesseract_collision::ContactResultMap collisions;
-    tesseract_collision::DiscreteContactManager::Ptr manager = pci.env->getDiscreteContactManager();
+    tesseract_collision::DiscreteContactManager::Ptr manager =
+        ContactManagerPool::getDefault().getDiscreteContactManager(
+            problem.env, pci.kin->getActiveLinkNames(), profile.collision_check_config.contact_manager_config);
     tesseract_common::TransformMap state = pci.kin->calcFwdKin(start_pos);
-    manager->setActiveCollisionObjects(pci.kin->getActiveLinkNames());
-    manager->applyContactManagerConfig(profile.collision_check_config.contact_manager_config);
     manager->setCollisionObjectsTransform(state);
     manager->contactTest(collisions, profile.collision_check_config.contact_request);
 
@@ -390,7 +391,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -419,7 +420,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -439,7 +440,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
       if (flattened.empty())
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+          context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
         info->message = "FixStateCollisionTask found no MoveInstructions to process";
         info->return_value = 1;
@@ -450,7 +451,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
       if (flattened.size() <= 2)
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+          context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
         info->message = "FixStateCollisionTask found no intermediate MoveInstructions to process";
         info->return_value = 1;
@@ -484,7 +485,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -504,7 +505,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
       if (flattened.empty())
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+          context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
         info->message = "FixStateCollisionTask found no MoveInstructions to process";
         info->return_value = 1;
@@ -538,7 +539,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -558,7 +559,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
       if (flattened.empty())
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+          context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
         info->message = "FixStateCollisionTask found no MoveInstructions to process";
         info->return_value = 1;
@@ -592,7 +593,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -612,7 +613,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
       if (flattened.size() <= 1)
       {
         if (output_keys_[0] != input_keys_[0])
-          context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+          context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
         info->message = "FixStateCollisionTask found no MoveInstructions to process";
         info->return_value = 1;
@@ -646,7 +647,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
             // If the output key is not the same as the input key the output data should be assigned the input data for
             // error branching
             if (output_keys_[0] != input_keys_[0])
-              context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+              context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
             // Save space
             for (auto& contact_map : info->contact_results)
@@ -662,7 +663,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
     case FixStateCollisionProfile::Settings::DISABLED:
     {
       if (output_keys_[0] != input_keys_[0])
-        context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+        context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
       info->message = "Successful, DISABLED";
       info->return_value = 1;
@@ -670,7 +671,7 @@ TaskComposerNodeInfo::UPtr FixStateCollisionTask::runImpl(TaskComposerContext& c
     }
   }
 
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -685,6 +686,12 @@ bool FixStateCollisionTask::operator==(const FixStateCollisionTask& rhs) const
 }
 bool FixStateCollisionTask::operator!=(const FixStateCollisionTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr FixStateCollisionTask::clone() const
+{
+  checkCloneType(typeid(FixStateCollisionTask));
+  return std::unique_ptr<FixStateCollisionTask>(new FixStateCollisionTask(*this));
+}
+
 template <class Archive>
 void FixStateCollisionTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
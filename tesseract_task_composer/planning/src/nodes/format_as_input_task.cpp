@@ -86,9 +86,9 @@ TaskComposerNodeInfo::UPtr FormatAsInputTask::runImpl(TaskComposerContext& conte
     return info;
   }
 
-  auto input_unformatted_data_poly = context.data_storage->getData(input_keys_[1]);
-  if (input_unformatted_data_poly.isNull() ||
-      input_unformatted_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_unformatted_data_poly = context.data_storage->getSharedData(input_keys_[1]);
+  if (input_unformatted_data_poly == nullptr || input_unformatted_data_poly->isNull() ||
+      input_unformatted_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input[1] instruction to FormatAsInputTask must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -96,7 +96,7 @@ TaskComposerNodeInfo::UPtr FormatAsInputTask::runImpl(TaskComposerContext& conte
   }
 
   auto& ci_formatted_data = input_formatted_data_poly.as<CompositeInstruction>();
-  const auto& ci_unformatted_data = input_unformatted_data_poly.as<CompositeInstruction>();
+  const auto& ci_unformatted_data = input_unformatted_data_poly->as<CompositeInstruction>();
 
   std::vector<std::reference_wrapper<InstructionPoly>> mi_formatted_data = ci_formatted_data.flatten();
   std::vector<std::reference_wrapper<const InstructionPoly>> mi_unformatted_data =
@@ -139,7 +139,7 @@ TaskComposerNodeInfo::UPtr FormatAsInputTask::runImpl(TaskComposerContext& conte
     }
   }
 
-  context.data_storage->setData(output_keys_[0], input_formatted_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_formatted_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -150,6 +150,12 @@ TaskComposerNodeInfo::UPtr FormatAsInputTask::runImpl(TaskComposerContext& conte
 bool FormatAsInputTask::operator==(const FormatAsInputTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool FormatAsInputTask::operator!=(const FormatAsInputTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr FormatAsInputTask::clone() const
+{
+  checkCloneType(typeid(FormatAsInputTask));
+  return std::unique_ptr<FormatAsInputTask>(new FormatAsInputTask(*this));
+}
+
 template <class Archive>
 void FormatAsInputTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -37,7 +37,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/poly/move_instruction_poly.h>
-#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
 
 namespace tesseract_planning
 {
@@ -127,7 +127,7 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->color = "green";
     info->message = "Iterative spline time parameterization found no MoveInstructions to process";
@@ -161,9 +161,9 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
     }
   }
 
-  // Solve using parameters
-  TrajectoryContainer::Ptr trajectory = std::make_shared<InstructionsTrajectory>(ci);
-  if (!solver_.compute(*trajectory,
+  // Solve using parameters on a contiguous copy of the trajectory, the results are written back on success
+  DenseTrajectory trajectory(ci);
+  if (!solver_.compute(trajectory,
                        limits.velocity_limits,
                        limits.acceleration_limits,
                        velocity_scaling_factors,
@@ -172,7 +172,7 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->message =
         "Failed to perform iterative spline time parameterization for process input: " + ci.getDescription();
@@ -180,9 +180,11 @@ TaskComposerNodeInfo::UPtr IterativeSplineParameterizationTask::runImpl(TaskComp
     return info;
   }
 
+  trajectory.assign(ci);
+
   info->color = "green";
   info->message = "Successful";
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
   info->return_value = 1;
   CONSOLE_BRIDGE_logDebug("Iterative spline time parameterization succeeded");
   return info;
@@ -200,6 +202,12 @@ bool IterativeSplineParameterizationTask::operator!=(const IterativeSplineParame
   return !operator==(rhs);
 }
 
+TaskComposerNode::UPtr IterativeSplineParameterizationTask::clone() const
+{
+  checkCloneType(typeid(IterativeSplineParameterizationTask));
+  return std::unique_ptr<IterativeSplineParameterizationTask>(new IterativeSplineParameterizationTask(*this));
+}
+
 template <class Archive>
 void IterativeSplineParameterizationTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -79,8 +79,9 @@ TaskComposerNodeInfo::UPtr MinLengthTask::runImpl(TaskComposerContext& context,
   info->return_value = 0;
 
   // Check that inputs are valid
-  auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+  if (input_data_poly == nullptr || input_data_poly->isNull() ||
+      input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input seed to MinLengthTask must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -88,7 +89,7 @@ TaskComposerNodeInfo::UPtr MinLengthTask::runImpl(TaskComposerContext& context,
   }
 
   // Get Composite Profile
-  const auto& ci = input_data_poly.as<CompositeInstruction>();
+  const auto& ci = input_data_poly->as<CompositeInstruction>();
   long cnt = ci.getMoveInstructionCount();
   std::string profile = ci.getProfile();
   profile = getProfileString(name_, profile, problem.composite_profile_remapping);
@@ -133,11 +134,11 @@ TaskComposerNodeInfo::UPtr MinLengthTask::runImpl(TaskComposerContext& context,
       return info;
     }
 
-    context.data_storage->setData(output_keys_[0], response.results);
+    context.data_storage->setData(output_keys_[0], std::move(response.results));
   }
-  else
+  else if (output_keys_[0] != input_keys_[0])
   {
-    context.data_storage->setData(output_keys_[0], ci);
+    context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
   }
 
   info->color = "green";
@@ -150,6 +151,12 @@ TaskComposerNodeInfo::UPtr MinLengthTask::runImpl(TaskComposerContext& context,
 bool MinLengthTask::operator==(const MinLengthTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool MinLengthTask::operator!=(const MinLengthTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr MinLengthTask::clone() const
+{
+  checkCloneType(typeid(MinLengthTask));
+  return std::unique_ptr<MinLengthTask>(new MinLengthTask(*this));
+}
+
 template <class Archive>
 void MinLengthTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -91,6 +91,12 @@ bool ProcessPlanningInputTask::operator==(const ProcessPlanningInputTask& rhs) c
 }
 bool ProcessPlanningInputTask::operator!=(const ProcessPlanningInputTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr ProcessPlanningInputTask::clone() const
+{
+  checkCloneType(typeid(ProcessPlanningInputTask));
+  return std::unique_ptr<ProcessPlanningInputTask>(new ProcessPlanningInputTask(*this));
+}
+
 template <class Archive>
 void ProcessPlanningInputTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -72,8 +72,9 @@ TaskComposerNodeInfo::UPtr ProfileSwitchTask::runImpl(TaskComposerContext& conte
   // --------------------
   // Check that inputs are valid
   // --------------------
-  auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+  if (input_data_poly == nullptr || input_data_poly->isNull() ||
+      input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input instruction to ProfileSwitch must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -81,7 +82,7 @@ TaskComposerNodeInfo::UPtr ProfileSwitchTask::runImpl(TaskComposerContext& conte
   }
 
   // Get Composite Profile
-  const auto& ci = input_data_poly.as<CompositeInstruction>();
+  const auto& ci = input_data_poly->as<CompositeInstruction>();
   std::string profile = ci.getProfile();
   profile = getProfileString(name_, profile, problem.composite_profile_remapping);
   auto cur_composite_profile =
@@ -100,6 +101,12 @@ TaskComposerNodeInfo::UPtr ProfileSwitchTask::runImpl(TaskComposerContext& conte
 bool ProfileSwitchTask::operator==(const ProfileSwitchTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool ProfileSwitchTask::operator!=(const ProfileSwitchTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr ProfileSwitchTask::clone() const
+{
+  checkCloneType(typeid(ProfileSwitchTask));
+  return std::unique_ptr<ProfileSwitchTask>(new ProfileSwitchTask(*this));
+}
+
 template <class Archive>
 void ProfileSwitchTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
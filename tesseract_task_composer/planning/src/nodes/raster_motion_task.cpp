@@ -32,7 +32,6 @@
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
 
 #include <tesseract_task_composer/core/nodes/start_task.h>
-#include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 
@@ -324,6 +323,12 @@ RasterMotionTask::RasterMotionTask(std::string name,
 bool RasterMotionTask::operator==(const RasterMotionTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool RasterMotionTask::operator!=(const RasterMotionTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr RasterMotionTask::clone() const
+{
+  checkCloneType(typeid(RasterMotionTask));
+  return std::unique_ptr<RasterMotionTask>(new RasterMotionTask(*this));
+}
+
 template <class Archive>
 void RasterMotionTask::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
 {
@@ -390,7 +395,7 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerContext& contex
     raster_results.node->setConditional(false);
     auto raster_uuid = task_graph.addNode(std::move(raster_results.node));
     raster_tasks.emplace_back(raster_uuid, std::make_pair(raster_results.input_key, raster_results.output_key));
-    context.data_storage->setData(raster_results.input_key, raster_input);
+    context.data_storage->setData(raster_results.input_key, std::move(raster_input));
 
     task_graph.addEdges(start_uuid, { raster_uuid });
 
@@ -436,7 +441,7 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerContext& contex
                                                                             false);
     auto transition_mux_uuid = task_graph.addNode(std::move(transition_mux_task));
 
-    context.data_storage->setData(transition_results.input_key, transition_input);
+    context.data_storage->setData(transition_results.input_key, std::move(transition_input));
 
     task_graph.addEdges(transition_mux_uuid, { transition_uuid });
     task_graph.addEdges(prev.first, { transition_mux_uuid });
@@ -460,7 +465,7 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerContext& contex
                                                                     false);
   auto update_end_state_uuid = task_graph.addNode(std::move(update_end_state_task));
 
-  context.data_storage->setData(from_start_results.input_key, from_start_input);
+  context.data_storage->setData(from_start_results.input_key, std::move(from_start_input));
 
   task_graph.addEdges(update_end_state_uuid, { from_start_pipeline_uuid });
   task_graph.addEdges(raster_tasks[0].first, { update_end_state_uuid });
@@ -485,18 +490,19 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerContext& contex
       "UpdateStartStateTask", to_end_results.input_key, last_raster_output_key, to_end_results.output_key, false);
   auto update_start_state_uuid = task_graph.addNode(std::move(update_start_state_task));
 
-  context.data_storage->setData(to_end_results.input_key, to_end_input);
+  context.data_storage->setData(to_end_results.input_key, std::move(to_end_input));
 
   task_graph.addEdges(update_start_state_uuid, { to_end_pipeline_uuid });
   task_graph.addEdges(raster_tasks.back().first, { update_start_state_uuid });
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context.problem, context.data_storage);
-  future->wait();
+  // Run the child graph cooperatively so this worker keeps processing tasks instead of blocking
+  TaskComposerContext::Ptr child_context =
+      executor.value().get().corun(task_graph, context.problem, context.data_storage);
 
   // Merge child context data into parent context
-  context.task_infos.mergeInfoMap(std::move(future->context->task_infos));
-  if (future->context->isAborted())
-    context.abort(future->context->task_infos.getAbortingNode());
+  context.task_infos.mergeInfoMap(std::move(child_context->task_infos));
+  if (child_context->isAborted())
+    context.abort(child_context->task_infos.getAbortingNode());
 
   auto info_map = context.task_infos.getInfoMap();
   if (context.problem->dotgraph)
@@ -516,28 +522,65 @@ TaskComposerNodeInfo::UPtr RasterMotionTask::runImpl(TaskComposerContext& contex
     return info;
   }
 
-  program.clear();
-  program.emplace_back(context.data_storage->getData(from_start_results.output_key).as<CompositeInstruction>());
-  for (std::size_t i = 0; i < raster_tasks.size(); ++i)
+  // The results of the child tasks are only used to assemble the program, so they are moved out of the data storage
+  std::string missing_key;
+  auto take_result = [&context, &missing_key](const std::string& key, CompositeInstruction& result) {
+    tesseract_common::AnyPoly data = context.data_storage->takeData(key);
+    if (data.isNull() || data.getType() != std::type_index(typeid(CompositeInstruction)))
+    {
+      missing_key = key;
+      return false;
+    }
+
+    result = std::move(data.as<CompositeInstruction>());
+    return true;
+  };
+
+  CompositeInstruction from_start;
+  CompositeInstruction to_end;
+  std::vector<CompositeInstruction> segments;
+  segments.reserve(program.size());
+  bool taken = take_result(from_start_results.output_key, from_start);
+  for (std::size_t i = 0; taken && i < raster_tasks.size(); ++i)
   {
-    const auto& raster_output_key = raster_tasks[i].second.second;
-    CompositeInstruction segment = context.data_storage->getData(raster_output_key).as<CompositeInstruction>();
+    CompositeInstruction segment;
+    taken = take_result(raster_tasks[i].second.second, segment);
+    if (!taken)
+      break;
+
     segment.erase(segment.begin());
-    program.emplace_back(segment);
+    segments.push_back(std::move(segment));
 
     if (i < raster_tasks.size() - 1)
     {
-      const auto& transition_output_key = transition_keys[i].second;
-      CompositeInstruction transition = context.data_storage->getData(transition_output_key).as<CompositeInstruction>();
+      CompositeInstruction transition;
+      taken = take_result(transition_keys[i].second, transition);
+      if (!taken)
+        break;
+
       transition.erase(transition.begin());
-      program.emplace_back(transition);
+      segments.push_back(std::move(transition));
     }
   }
-  CompositeInstruction to_end = context.data_storage->getData(to_end_results.output_key).as<CompositeInstruction>();
+
+  if (taken)
+    taken = take_result(to_end_results.output_key, to_end);
+
+  if (!taken)
+  {
+    info->message = "RasterMotionTask, the output '" + missing_key + "' of a child task is not a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return info;
+  }
+
   to_end.erase(to_end.begin());
-  program.emplace_back(to_end);
+  program.clear();
+  program.emplace_back(std::move(from_start));
+  for (auto& segment : segments)
+    program.emplace_back(std::move(segment));
+  program.emplace_back(std::move(to_end));
 
-  context.data_storage->setData(output_keys_[0], program);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -32,7 +32,6 @@
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
 
 #include <tesseract_task_composer/core/nodes/start_task.h>
-#include <tesseract_task_composer/core/task_composer_future.h>
 #include <tesseract_task_composer/core/task_composer_executor.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 
@@ -262,6 +261,12 @@ bool RasterOnlyMotionTask::operator==(const RasterOnlyMotionTask& rhs) const
 }
 bool RasterOnlyMotionTask::operator!=(const RasterOnlyMotionTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr RasterOnlyMotionTask::clone() const
+{
+  checkCloneType(typeid(RasterOnlyMotionTask));
+  return std::unique_ptr<RasterOnlyMotionTask>(new RasterOnlyMotionTask(*this));
+}
+
 template <class Archive>
 void RasterOnlyMotionTask::serialize(Archive& ar, const unsigned int /*version*/)  // NOLINT
 {
@@ -331,7 +336,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerContext& co
     raster_results.node->setConditional(false);
     auto raster_uuid = task_graph.addNode(std::move(raster_results.node));
     raster_tasks.emplace_back(raster_uuid, std::make_pair(raster_results.input_key, raster_results.output_key));
-    context.data_storage->setData(raster_results.input_key, raster_input);
+    context.data_storage->setData(raster_results.input_key, std::move(raster_input));
 
     task_graph.addEdges(start_uuid, { raster_uuid });
 
@@ -376,7 +381,7 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerContext& co
                                                                             false);
     auto transition_mux_uuid = task_graph.addNode(std::move(transition_mux_task));
 
-    context.data_storage->setData(transition_results.input_key, transition_input);
+    context.data_storage->setData(transition_results.input_key, std::move(transition_input));
 
     task_graph.addEdges(transition_mux_uuid, { transition_uuid });
     task_graph.addEdges(prev.first, { transition_mux_uuid });
@@ -385,13 +390,14 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerContext& co
     transition_idx++;
   }
 
-  TaskComposerFuture::UPtr future = executor.value().get().run(task_graph, context.problem, context.data_storage);
-  future->wait();
+  // Run the child graph cooperatively so this worker keeps processing tasks instead of blocking
+  TaskComposerContext::Ptr child_context =
+      executor.value().get().corun(task_graph, context.problem, context.data_storage);
 
   // Merge child context data into parent context
-  context.task_infos.mergeInfoMap(std::move(future->context->task_infos));
-  if (future->context->isAborted())
-    context.abort(future->context->task_infos.getAbortingNode());
+  context.task_infos.mergeInfoMap(std::move(child_context->task_infos));
+  if (child_context->isAborted())
+    context.abort(child_context->task_infos.getAbortingNode());
 
   auto info_map = context.task_infos.getInfoMap();
   if (context.problem->dotgraph)
@@ -411,26 +417,60 @@ TaskComposerNodeInfo::UPtr RasterOnlyMotionTask::runImpl(TaskComposerContext& co
     return info;
   }
 
-  program.clear();
-  for (std::size_t i = 0; i < raster_tasks.size(); ++i)
+  // The results of the child tasks are only used to assemble the program, so they are moved out of the data storage
+  std::string missing_key;
+  auto take_result = [&context, &missing_key](const std::string& key, CompositeInstruction& result) {
+    tesseract_common::AnyPoly data = context.data_storage->takeData(key);
+    if (data.isNull() || data.getType() != std::type_index(typeid(CompositeInstruction)))
+    {
+      missing_key = key;
+      return false;
+    }
+
+    result = std::move(data.as<CompositeInstruction>());
+    return true;
+  };
+
+  std::vector<CompositeInstruction> segments;
+  segments.reserve(program.size());
+  bool taken = true;
+  for (std::size_t i = 0; taken && i < raster_tasks.size(); ++i)
   {
-    CompositeInstruction segment =
-        context.data_storage->getData(raster_tasks[i].second.second).as<CompositeInstruction>();
+    CompositeInstruction segment;
+    taken = take_result(raster_tasks[i].second.second, segment);
+    if (!taken)
+      break;
+
     if (i != 0)
       segment.erase(segment.begin());
 
-    program.emplace_back(segment);
+    segments.push_back(std::move(segment));
 
     if (i < raster_tasks.size() - 1)
     {
-      CompositeInstruction transition =
-          context.data_storage->getData(transition_keys[i].second).as<CompositeInstruction>();
+      CompositeInstruction transition;
+      taken = take_result(transition_keys[i].second, transition);
+      if (!taken)
+        break;
+
       transition.erase(transition.begin());
-      program.emplace_back(transition);
+      segments.push_back(std::move(transition));
     }
   }
 
-  context.data_storage->setData(output_keys_[0], program);
+  if (!taken)
+  {
+    info->message =
+        "RasterOnlyMotionTask, the output '" + missing_key + "' of a child task is not a composite instruction";
+    CONSOLE_BRIDGE_logError("%s", info->message.c_str());
+    return info;
+  }
+
+  program.clear();
+  for (auto& segment : segments)
+    program.emplace_back(std::move(segment));
+
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -35,7 +35,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/composite_instruction.h>
 #include <tesseract_command_language/poly/move_instruction_poly.h>
-#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
 #include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
 
 namespace tesseract_planning
@@ -115,7 +115,7 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerCo
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->color = "green";
     info->message = "Ruckig trajectory smoothing found no MoveInstructions to process";
@@ -152,9 +152,9 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerCo
     }
   }
 
-  // Solve using parameters
-  TrajectoryContainer::Ptr trajectory = std::make_shared<InstructionsTrajectory>(ci);
-  if (!solver.compute(*trajectory,
+  // Solve using parameters on a contiguous copy of the trajectory, the results are written back on success
+  DenseTrajectory trajectory(ci);
+  if (!solver.compute(trajectory,
                       limits.velocity_limits,
                       limits.acceleration_limits,
                       Eigen::VectorXd::Constant(limits.velocity_limits.rows(), 1000),
@@ -165,14 +165,15 @@ TaskComposerNodeInfo::UPtr RuckigTrajectorySmoothingTask::runImpl(TaskComposerCo
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->message = "Failed to perform ruckig trajectory smoothing for process input: %s" + ci.getDescription();
     CONSOLE_BRIDGE_logInform("%s", info->message.c_str());
     return info;
   }
 
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  trajectory.assign(ci);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -190,6 +191,12 @@ bool RuckigTrajectorySmoothingTask::operator!=(const RuckigTrajectorySmoothingTa
   return !operator==(rhs);
 }
 
+TaskComposerNode::UPtr RuckigTrajectorySmoothingTask::clone() const
+{
+  checkCloneType(typeid(RuckigTrajectorySmoothingTask));
+  return std::unique_ptr<RuckigTrajectorySmoothingTask>(new RuckigTrajectorySmoothingTask(*this));
+}
+
 template <class Archive>
 void RuckigTrajectorySmoothingTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
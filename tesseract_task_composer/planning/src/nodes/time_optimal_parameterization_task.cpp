@@ -40,7 +40,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_command_language/poly/move_instruction_poly.h>
 #include <tesseract_command_language/utils.h>
 #include <tesseract_time_parameterization/totg/time_optimal_trajectory_generation.h>
-#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
 #include <tesseract_time_parameterization/core/utils.h>
 
 namespace tesseract_planning
@@ -91,15 +91,16 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
   // --------------------
   // Check that inputs are valid
   // --------------------
-  auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+  if (input_data_poly == nullptr || input_data_poly->isNull() ||
+      input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input results to TOTG must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
     return info;
   }
 
-  auto& ci = input_data_poly.as<CompositeInstruction>();
+  const auto& ci = input_data_poly->as<CompositeInstruction>();
   const tesseract_common::ManipulatorInfo& manip_info = ci.getManipulatorInfo();
   auto joint_group = problem.env->getJointGroup(manip_info.manipulator);
   auto limits = joint_group->getLimits();
@@ -118,7 +119,7 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->color = "green";
     info->message = "TOTG found no MoveInstructions to process";
@@ -135,10 +136,9 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
   info->max_velocity_scaling_factor = cur_composite_profile->max_velocity_scaling_factor;
   info->max_acceleration_scaling_factor = cur_composite_profile->max_acceleration_scaling_factor;
 
-  // Copy the Composite before passing in because it will get flattened and resampled
-  CompositeInstruction copy_ci(ci);
-  InstructionsTrajectory traj_wrapper(copy_ci);
-  if (!solver.computeTimeStamps(traj_wrapper,
+  // Solve on a contiguous copy of the trajectory, the input composite is only copied once the solve succeeded
+  DenseTrajectory trajectory(ci);
+  if (!solver.computeTimeStamps(trajectory,
                                 limits.velocity_limits,
                                 limits.acceleration_limits,
                                 cur_composite_profile->max_velocity_scaling_factor,
@@ -147,14 +147,16 @@ TaskComposerNodeInfo::UPtr TimeOptimalParameterizationTask::runImpl(TaskComposer
     // If the output key is not the same as the input key the output data should be assigned the input data for error
     // branching
     if (output_keys_[0] != input_keys_[0])
-      context.data_storage->setData(output_keys_[0], context.data_storage->getData(input_keys_[0]));
+      context.data_storage->remapData({ { input_keys_[0], output_keys_[0] } }, true);
 
     info->message = "Failed to perform TOTG for process input: " + ci.getDescription();
     CONSOLE_BRIDGE_logInform("%s", info->message.c_str());
     return info;
   }
 
-  context.data_storage->setData(output_keys_[0], copy_ci);
+  CompositeInstruction copy_ci(ci);
+  trajectory.assign(copy_ci);
+  context.data_storage->setData(output_keys_[0], std::move(copy_ci));
 
   info->color = "green";
   info->message = "Successful";
@@ -172,6 +174,12 @@ bool TimeOptimalParameterizationTask::operator!=(const TimeOptimalParameterizati
   return !operator==(rhs);
 }
 
+TaskComposerNode::UPtr TimeOptimalParameterizationTask::clone() const
+{
+  checkCloneType(typeid(TimeOptimalParameterizationTask));
+  return std::unique_ptr<TimeOptimalParameterizationTask>(new TimeOptimalParameterizationTask(*this));
+}
+
 template <class Archive>
 void TimeOptimalParameterizationTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -64,7 +64,7 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerContext& cont
   info->return_value = 0;
 
   auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  auto input_next_data_poly = context.data_storage->getData(input_keys_[1]);
+  auto input_next_data_poly = context.data_storage->getSharedData(input_keys_[1]);
 
   // --------------------
   // Check that inputs are valid
@@ -76,7 +76,8 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerContext& cont
     return info;
   }
 
-  if (input_next_data_poly.isNull() || input_next_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  if (input_next_data_poly == nullptr || input_next_data_poly->isNull() ||
+      input_next_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "UpdateEndStateTask: Input data for key '" + input_keys_[1] + "' must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -89,7 +90,7 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerContext& cont
   /** @todo Should the waypoint profile be updated to the path profile if it exists? **/
 
   // Update end instruction
-  const auto* next_start_move = input_next_data_poly.as<CompositeInstruction>().getFirstMoveInstruction();
+  const auto* next_start_move = input_next_data_poly->as<CompositeInstruction>().getFirstMoveInstruction();
   if (next_start_move->getWaypoint().isCartesianWaypoint())
     last_move_instruction->assignCartesianWaypoint(next_start_move->getWaypoint().as<CartesianWaypointPoly>());
   else if (next_start_move->getWaypoint().isJointWaypoint())
@@ -100,7 +101,7 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerContext& cont
     throw std::runtime_error("Invalid waypoint type");
 
   // Store results
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -111,6 +112,12 @@ TaskComposerNodeInfo::UPtr UpdateEndStateTask::runImpl(TaskComposerContext& cont
 bool UpdateEndStateTask::operator==(const UpdateEndStateTask& rhs) const { return (TaskComposerTask::operator==(rhs)); }
 bool UpdateEndStateTask::operator!=(const UpdateEndStateTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr UpdateEndStateTask::clone() const
+{
+  checkCloneType(typeid(UpdateEndStateTask));
+  return std::unique_ptr<UpdateEndStateTask>(new UpdateEndStateTask(*this));
+}
+
 template <class Archive>
 void UpdateEndStateTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -68,8 +68,8 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerConte
   info->return_value = 0;
 
   auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  auto input_prev_data_poly = context.data_storage->getData(input_keys_[1]);
-  auto input_next_data_poly = context.data_storage->getData(input_keys_[2]);
+  auto input_prev_data_poly = context.data_storage->getSharedData(input_keys_[1]);
+  auto input_next_data_poly = context.data_storage->getSharedData(input_keys_[2]);
 
   // --------------------
   // Check that inputs are valid
@@ -82,7 +82,8 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerConte
     return info;
   }
 
-  if (input_prev_data_poly.isNull() || input_prev_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  if (input_prev_data_poly == nullptr || input_prev_data_poly->isNull() ||
+      input_prev_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message =
         "UpdateStartAndEndStateTask: Input data for key '" + input_keys_[1] + "' must be a composite instruction";
@@ -90,7 +91,8 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerConte
     return info;
   }
 
-  if (input_next_data_poly.isNull() || input_next_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  if (input_next_data_poly == nullptr || input_next_data_poly->isNull() ||
+      input_next_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message =
         "UpdateStartAndEndStateTask: Input data for key '" + input_keys_[2] + "' must be a composite instruction";
@@ -100,8 +102,8 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerConte
 
   // Make a non-const copy of the input instructions to update the start/end
   auto& instructions = input_data_poly.as<CompositeInstruction>();
-  const auto* prev_last_move = input_prev_data_poly.as<CompositeInstruction>().getLastMoveInstruction();
-  const auto* next_start_move = input_next_data_poly.as<CompositeInstruction>().getFirstMoveInstruction();
+  const auto* prev_last_move = input_prev_data_poly->as<CompositeInstruction>().getLastMoveInstruction();
+  const auto* next_start_move = input_next_data_poly->as<CompositeInstruction>().getFirstMoveInstruction();
   auto* first_move_instruction = instructions.getFirstMoveInstruction();
   auto* last_move_instruction = instructions.getLastMoveInstruction();
   /** @todo Should the waypoint profile be updated to the path profile if it exists? **/
@@ -127,7 +129,7 @@ TaskComposerNodeInfo::UPtr UpdateStartAndEndStateTask::runImpl(TaskComposerConte
     throw std::runtime_error("Invalid waypoint type");
 
   // Store results
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -142,6 +144,12 @@ bool UpdateStartAndEndStateTask::operator==(const UpdateStartAndEndStateTask& rh
 }
 bool UpdateStartAndEndStateTask::operator!=(const UpdateStartAndEndStateTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr UpdateStartAndEndStateTask::clone() const
+{
+  checkCloneType(typeid(UpdateStartAndEndStateTask));
+  return std::unique_ptr<UpdateStartAndEndStateTask>(new UpdateStartAndEndStateTask(*this));
+}
+
 template <class Archive>
 void UpdateStartAndEndStateTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
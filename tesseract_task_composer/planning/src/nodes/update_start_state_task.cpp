@@ -64,7 +64,7 @@ TaskComposerNodeInfo::UPtr UpdateStartStateTask::runImpl(TaskComposerContext& co
   info->return_value = 0;
 
   auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  auto input_prev_data_poly = context.data_storage->getData(input_keys_[1]);
+  auto input_prev_data_poly = context.data_storage->getSharedData(input_keys_[1]);
 
   // --------------------
   // Check that inputs are valid
@@ -76,7 +76,8 @@ TaskComposerNodeInfo::UPtr UpdateStartStateTask::runImpl(TaskComposerContext& co
     return info;
   }
 
-  if (input_prev_data_poly.isNull() || input_prev_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  if (input_prev_data_poly == nullptr || input_prev_data_poly->isNull() ||
+      input_prev_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "UpdateStartStateTask: Input data for key '" + input_keys_[1] + "' must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -89,7 +90,7 @@ TaskComposerNodeInfo::UPtr UpdateStartStateTask::runImpl(TaskComposerContext& co
   /** @todo Should the waypoint profile be updated to the path profile if it exists? **/
 
   // Update start instruction
-  const auto* prev_last_move = input_prev_data_poly.as<CompositeInstruction>().getLastMoveInstruction();
+  const auto* prev_last_move = input_prev_data_poly->as<CompositeInstruction>().getLastMoveInstruction();
   if (prev_last_move->getWaypoint().isCartesianWaypoint())
     first_move_instruction->assignCartesianWaypoint(prev_last_move->getWaypoint().as<CartesianWaypointPoly>());
   else if (prev_last_move->getWaypoint().isJointWaypoint())
@@ -100,7 +101,7 @@ TaskComposerNodeInfo::UPtr UpdateStartStateTask::runImpl(TaskComposerContext& co
     throw std::runtime_error("Invalid waypoint type");
 
   // Store results
-  context.data_storage->setData(output_keys_[0], input_data_poly);
+  context.data_storage->setData(output_keys_[0], std::move(input_data_poly));
 
   info->color = "green";
   info->message = "Successful";
@@ -114,6 +115,12 @@ bool UpdateStartStateTask::operator==(const UpdateStartStateTask& rhs) const
 }
 bool UpdateStartStateTask::operator!=(const UpdateStartStateTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr UpdateStartStateTask::clone() const
+{
+  checkCloneType(typeid(UpdateStartStateTask));
+  return std::unique_ptr<UpdateStartStateTask>(new UpdateStartStateTask(*this));
+}
+
 template <class Archive>
 void UpdateStartStateTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
@@ -79,8 +79,9 @@ TaskComposerNodeInfo::UPtr UpsampleTrajectoryTask::runImpl(TaskComposerContext&
   info->return_value = 0;
 
   // Check that inputs are valid
-  auto input_data_poly = context.data_storage->getData(input_keys_[0]);
-  if (input_data_poly.isNull() || input_data_poly.getType() != std::type_index(typeid(CompositeInstruction)))
+  auto input_data_poly = context.data_storage->getSharedData(input_keys_[0]);
+  if (input_data_poly == nullptr || input_data_poly->isNull() ||
+      input_data_poly->getType() != std::type_index(typeid(CompositeInstruction)))
   {
     info->message = "Input seed to UpsampleTrajectoryTask must be a composite instruction";
     CONSOLE_BRIDGE_logError("%s", info->message.c_str());
@@ -88,7 +89,7 @@ TaskComposerNodeInfo::UPtr UpsampleTrajectoryTask::runImpl(TaskComposerContext&
   }
 
   // Get Composite Profile
-  const auto& ci = input_data_poly.as<CompositeInstruction>();
+  const auto& ci = input_data_poly->as<CompositeInstruction>();
   std::string profile = ci.getProfile();
   profile = getProfileString(name_, profile, problem.composite_profile_remapping);
   auto cur_composite_profile = getProfile<UpsampleTrajectoryProfile>(
@@ -101,7 +102,7 @@ TaskComposerNodeInfo::UPtr UpsampleTrajectoryTask::runImpl(TaskComposerContext&
   new_results.clear();
 
   upsample(new_results, ci, start_instruction, cur_composite_profile->longest_valid_segment_length);
-  context.data_storage->setData(output_keys_[0], new_results);
+  context.data_storage->setData(output_keys_[0], std::move(new_results));
 
   info->color = "green";
   info->message = "Successful";
@@ -181,6 +182,12 @@ bool UpsampleTrajectoryTask::operator==(const UpsampleTrajectoryTask& rhs) const
 }
 bool UpsampleTrajectoryTask::operator!=(const UpsampleTrajectoryTask& rhs) const { return !operator==(rhs); }
 
+TaskComposerNode::UPtr UpsampleTrajectoryTask::clone() const
+{
+  checkCloneType(typeid(UpsampleTrajectoryTask));
+  return std::unique_ptr<UpsampleTrajectoryTask>(new UpsampleTrajectoryTask(*this));
+}
+
 template <class Archive>
 void UpsampleTrajectoryTask::serialize(Archive& ar, const unsigned int /*version*/)
 {
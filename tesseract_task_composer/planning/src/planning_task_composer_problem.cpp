@@ -26,6 +26,11 @@
 
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cstdint>
+#include <map>
+#include <sstream>
+#include <boost/archive/binary_oarchive.hpp>
+#include <boost/serialization/map.hpp>
 #include <boost/serialization/shared_ptr.hpp>
 #if (BOOST_VERSION >= 107400) && (BOOST_VERSION < 107500)
 #include <boost/serialization/library_version_type.hpp>
@@ -34,6 +39,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/planning/planning_task_composer_problem.h>
+#include <tesseract_motion_planners/core/environment_hash.h>
 
 namespace tesseract_planning
 {
@@ -95,6 +101,51 @@ TaskComposerProblem::UPtr PlanningTaskComposerProblem::clone() const
   return std::make_unique<PlanningTaskComposerProblem>(*this);
 }
 
+std::string PlanningTaskComposerProblem::getResultCacheKey() const
+{
+  std::string env_name;
+  int env_revision{ -1 };
+  std::uint64_t env_commands_hash{ 0 };
+  std::map<std::string, double> env_joint_state;
+  if (env != nullptr)
+  {
+    env_name = env->getName();
+    env_revision = env->getRevision();
+    const auto joint_state = env->getState().joints;
+    env_joint_state.insert(joint_state.begin(), joint_state.end());
+
+    // The commands which built the environment identify its content, the hash is only computed once per revision
+    env_commands_hash = getEnvironmentHash(env);
+  }
+
+  // Sort the remapping so equal remappings have equal keys
+  auto sortRemapping = [](const ProfileRemapping& remapping) {
+    std::map<std::string, std::map<std::string, std::string>> sorted;
+    for (const auto& planner : remapping)
+      sorted[planner.first].insert(planner.second.begin(), planner.second.end());
+    return sorted;
+  };
+
+  const std::size_t profiles_version = (profiles != nullptr) ? profiles->getVersion() : 0;
+  const auto move_remapping = sortRemapping(move_profile_remapping);
+  const auto composite_remapping = sortRemapping(composite_profile_remapping);
+
+  std::ostringstream os;
+  os << TaskComposerProblem::getResultCacheKey();
+  {
+    boost::archive::binary_oarchive oa(os, boost::archive::no_header);
+    oa << boost::serialization::make_nvp("env_name", env_name);
+    oa << boost::serialization::make_nvp("env_revision", env_revision);
+    oa << boost::serialization::make_nvp("env_commands_hash", env_commands_hash);
+    oa << boost::serialization::make_nvp("env_joint_state", env_joint_state);
+    oa << boost::serialization::make_nvp("manip_info", manip_info);
+    oa << boost::serialization::make_nvp("profiles_version", profiles_version);
+    oa << boost::serialization::make_nvp("move_profile_remapping", move_remapping);
+    oa << boost::serialization::make_nvp("composite_profile_remapping", composite_remapping);
+  }
+  return os.str();
+}
+
 bool PlanningTaskComposerProblem::operator==(const PlanningTaskComposerProblem& rhs) const
 {
   bool equal = true;
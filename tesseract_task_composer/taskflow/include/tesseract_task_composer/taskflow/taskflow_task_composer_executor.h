@@ -61,6 +61,13 @@ public:
   TaskflowTaskComposerExecutor(TaskflowTaskComposerExecutor&&) = delete;
   TaskflowTaskComposerExecutor& operator=(TaskflowTaskComposerExecutor&&) = delete;
 
+  /**
+   * @brief Run the jobs on the workers of this executor
+   * @details If called from one of this executor's workers, the worker keeps running other tasks (work-stealing)
+   * until the jobs have finished instead of blocking. Otherwise this waits for the jobs to finish.
+   */
+  void corunFor(std::size_t count, const std::function<void(std::size_t)>& job) override final;
+
   long getWorkerCount() const override final;
 
   long getTaskCount() const override final;
@@ -88,7 +95,21 @@ protected:
   std::map<boost::uuids::uuid, TaskComposerFuture::UPtr> futures_;
   void removeFuture(const boost::uuids::uuid& uuid);
 
-  TaskComposerFuture::UPtr run(const TaskComposerNode& node, TaskComposerContext::Ptr context) override final;
+  TaskComposerFuture::UPtr run(const TaskComposerNode& node,
+                               TaskComposerContext::Ptr context,
+                               std::function<void(const TaskComposerContext&)> done) override final;
+
+  /**
+   * @brief Execute the node cooperatively using tf::Executor::corun
+   * @details If called from one of this executor's workers, the worker keeps running other tasks (work-stealing)
+   * until the node has finished instead of blocking. Otherwise this falls back to run() and wait().
+   */
+  TaskComposerContext::Ptr corun(const TaskComposerNode& node, TaskComposerContext::Ptr context) override final;
+
+  static void convertToTaskflow(const TaskComposerNode& node,
+                                TaskComposerContext& task_context,
+                                TaskComposerExecutor& task_executor,
+                                tf::Taskflow* taskflow);
 
   static tf::Task convertToTaskflow(const TaskComposerGraph& task_graph,
                                     TaskComposerContext& task_context,
@@ -80,28 +80,59 @@ void TaskflowTaskComposerExecutor::removeFuture(const boost::uuids::uuid& uuid)
 }
 
 TaskComposerFuture::UPtr TaskflowTaskComposerExecutor::run(const TaskComposerNode& node,
-                                                           TaskComposerContext::Ptr context)
+                                                           TaskComposerContext::Ptr context,
+                                                           std::function<void(const TaskComposerContext&)> done)
 {
   auto taskflow = std::make_unique<tf::Taskflow>(node.getName());
-  if (node.getType() == TaskComposerNodeType::TASK)
-    convertToTaskflow(static_cast<const TaskComposerTask&>(node), *context, *this, taskflow.get());
-  else if (node.getType() == TaskComposerNodeType::PIPELINE)
-    convertToTaskflow(static_cast<const TaskComposerPipeline&>(node), *context, *this, taskflow.get());
-  else if (node.getType() == TaskComposerNodeType::GRAPH)
-    convertToTaskflow(static_cast<const TaskComposerGraph&>(node), *context, *this, taskflow.get(), nullptr);
-  else
-    throw std::runtime_error("TaskComposerExecutor, unsupported node type!");
+  convertToTaskflow(node, *context, *this, taskflow.get());
 
   // Inorder to better support dynamic tasking within pipelines we store all futures internally
   // and cleanup when finished because the data cannot go out of scope.
   std::unique_lock<std::mutex> lock(futures_mutex_);
   boost::uuids::uuid uuid = boost::uuids::random_generator()();
-  std::shared_future<void> f = executor_->run(*taskflow, [this, uuid]() { removeFuture(uuid); });
+
+  // The callback is called once the taskflow has finished, before the future is ready
+  std::shared_future<void> f = executor_->run(*taskflow, [this, uuid, context, done = std::move(done)]() {
+    if (done)
+      done(*context);
+
+    removeFuture(uuid);
+  });
   auto future = std::make_unique<TaskflowTaskComposerFuture>(f, std::move(taskflow), std::move(context));
   futures_[uuid] = future->copy();
   return future;
 }
 
+TaskComposerContext::Ptr TaskflowTaskComposerExecutor::corun(const TaskComposerNode& node,
+                                                             TaskComposerContext::Ptr context)
+{
+  // tf::Executor::corun may only be called by a worker of the same executor
+  if (executor_->this_worker_id() < 0)
+    return TaskComposerExecutor::corun(node, std::move(context));
+
+  // The calling task is still running so the taskflow only needs to live until corun returns
+  tf::Taskflow taskflow(node.getName());
+  convertToTaskflow(node, *context, *this, &taskflow);
+  executor_->corun(taskflow);
+  return context;
+}
+
+void TaskflowTaskComposerExecutor::corunFor(std::size_t count, const std::function<void(std::size_t)>& job)
+{
+  if (count == 0)
+    return;
+
+  tf::Taskflow taskflow("corunFor");
+  for (std::size_t i = 0; i < count; ++i)
+    taskflow.emplace([&job, i] { job(i); });
+
+  // tf::Executor::corun may only be called by a worker of the same executor
+  if (executor_->this_worker_id() < 0)
+    executor_->run(taskflow).wait();
+  else
+    executor_->corun(taskflow);
+}
+
 long TaskflowTaskComposerExecutor::getWorkerCount() const { return static_cast<long>(executor_->num_workers()); }
 
 long TaskflowTaskComposerExecutor::getTaskCount() const { return static_cast<long>(executor_->num_topologies()); }
@@ -141,6 +172,21 @@ void TaskflowTaskComposerExecutor::serialize(Archive& ar, const unsigned int ver
   boost::serialization::split_member(ar, *this, version);
 }
 
+void TaskflowTaskComposerExecutor::convertToTaskflow(const TaskComposerNode& node,
+                                                     TaskComposerContext& task_context,
+                                                     TaskComposerExecutor& task_executor,
+                                                     tf::Taskflow* taskflow)
+{
+  if (node.getType() == TaskComposerNodeType::TASK)
+    convertToTaskflow(static_cast<const TaskComposerTask&>(node), task_context, task_executor, taskflow);
+  else if (node.getType() == TaskComposerNodeType::PIPELINE)
+    convertToTaskflow(static_cast<const TaskComposerPipeline&>(node), task_context, task_executor, taskflow);
+  else if (node.getType() == TaskComposerNodeType::GRAPH)
+    convertToTaskflow(static_cast<const TaskComposerGraph&>(node), task_context, task_executor, taskflow, nullptr);
+  else
+    throw std::runtime_error("TaskComposerExecutor, unsupported node type!");
+}
+
 tf::Task TaskflowTaskComposerExecutor::convertToTaskflow(const TaskComposerGraph& task_graph,
                                                          TaskComposerContext& task_context,
                                                          TaskComposerExecutor& task_executor,
@@ -0,0 +1,158 @@
+/**
+ * @file task_composer_plugin_factory_benchmark.cpp
+ * @brief Benchmark creating task composer graphs from their configuration against cloning a prototype
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <string>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+
+using namespace tesseract_planning;
+
+/** @brief A raster pipeline with a nested pipeline for each of its freespace, transition and raster segments */
+static const std::string CONFIG = R"(task_composer_plugins:
+  search_paths:
+    - /usr/local/lib
+  search_libraries:
+    - tesseract_task_composer_factories
+  tasks:
+    plugins:
+      SegmentPipeline:
+        class: PipelineTaskFactory
+        config:
+          conditional: true
+          inputs: input_data
+          outputs: output_data
+          nodes:
+            StartTask:
+              class: StartTaskFactory
+              config:
+                conditional: false
+            RemapTask:
+              class: RemapTaskFactory
+              config:
+                conditional: false
+                remap:
+                  input_data: output_data
+            SyncTask:
+              class: SyncTaskFactory
+              config:
+                conditional: false
+            DoneTask:
+              class: DoneTaskFactory
+              config:
+                conditional: false
+            ErrorTask:
+              class: ErrorTaskFactory
+              config:
+                conditional: false
+          edges:
+            - source: StartTask
+              destinations: [RemapTask]
+            - source: RemapTask
+              destinations: [SyncTask]
+            - source: SyncTask
+              destinations: [ErrorTask, DoneTask]
+          terminals: [ErrorTask, DoneTask]
+      RasterPipeline:
+        class: PipelineTaskFactory
+        config:
+          conditional: true
+          inputs: input_data
+          outputs: output_data
+          nodes:
+            StartTask:
+              class: StartTaskFactory
+              config:
+                conditional: false
+            FreespaceTask:
+              task: SegmentPipeline
+            TransitionTask:
+              task: SegmentPipeline
+            RasterTask:
+              task: SegmentPipeline
+            DoneTask:
+              class: DoneTaskFactory
+              config:
+                conditional: false
+          edges:
+            - source: StartTask
+              destinations: [FreespaceTask]
+            - source: FreespaceTask
+              destinations: [TransitionTask]
+            - source: TransitionTask
+              destinations: [RasterTask]
+            - source: RasterTask
+              destinations: [DoneTask]
+          terminals: [DoneTask])";
+
+static const std::string PIPELINE = "RasterPipeline";
+
+/**
+ * @brief Create the pipeline from its plugin information, parsing the configuration every time
+ * @details The prototypes are cleared before every pipeline so the nested pipelines are also created from their
+ * configuration, like every request did before the factory kept prototypes.
+ */
+static void BM_CreateNodeFromPlugin(benchmark::State& state)
+{
+  TaskComposerPluginFactory factory(CONFIG);
+  const tesseract_common::PluginInfo plugin_info = factory.getTaskComposerNodePlugins().at(PIPELINE);
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < state.range(0); ++i)
+    {
+      factory.clearTaskComposerNodePrototypes();
+      TaskComposerNode::UPtr node = factory.createTaskComposerNode(PIPELINE, plugin_info);
+      benchmark::DoNotOptimize(node);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief Create the pipeline by name, which clones the prototype the factory built for the first request */
+static void BM_CreateNodeFromPrototype(benchmark::State& state)
+{
+  TaskComposerPluginFactory factory(CONFIG);
+  benchmark::DoNotOptimize(factory.createTaskComposerNode(PIPELINE));
+
+  for (auto _ : state)
+  {
+    for (long i = 0; i < state.range(0); ++i)
+    {
+      TaskComposerNode::UPtr node = factory.createTaskComposerNode(PIPELINE);
+      benchmark::DoNotOptimize(node);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+// The number of pipelines created per iteration, a raster program creates one for every segment
+BENCHMARK(BM_CreateNodeFromPlugin)->RangeMultiplier(10)->Range(1, 100);
+BENCHMARK(BM_CreateNodeFromPrototype)->RangeMultiplier(10)->Range(1, 100);
+
+BENCHMARK_MAIN();
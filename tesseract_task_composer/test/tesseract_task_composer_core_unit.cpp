@@ -2,7 +2,9 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
 #include <yaml-cpp/yaml.h>
+#include <chrono>
 #include <sstream>
+#include <thread>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/joint_state.h>
 #include <tesseract_common/utils.h>
@@ -12,6 +14,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_task_composer/core/task_composer_node_info.h>
 #include <tesseract_task_composer/core/task_composer_task.h>
 #include <tesseract_task_composer/core/task_composer_pipeline.h>
+#include <tesseract_task_composer/core/task_composer_result_cache.h>
 #include <tesseract_task_composer/core/task_composer_server.h>
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
 
@@ -29,6 +32,20 @@ TESSERACT_ANY_EXPORT(tesseract_common, JointState)
 
 using namespace tesseract_planning;
 
+/** @brief A graph which inherits clone from its base class */
+class NoCloneGraph : public TaskComposerGraph
+{
+public:
+  using TaskComposerGraph::TaskComposerGraph;
+};
+
+/** @brief A task which inherits clone from its base class */
+class NoCloneDoneTask : public DoneTask
+{
+public:
+  using DoneTask::DoneTask;
+};
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageTests)  // NOLINT
 {
   std::string key{ "joint_state" };
@@ -114,6 +131,38 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerDataStorageTests)  // NOLINT
     EXPECT_TRUE(remap_move.hasKey(key));
     EXPECT_FALSE(remap_move.hasKey("remap_" + key));
   }
+
+  {  // Test Shared Data
+    TaskComposerDataStorage shared;
+    EXPECT_TRUE(shared.getSharedData(key) == nullptr);
+
+    shared.setData(key, js);
+    auto snapshot = shared.getSharedData(key);
+    ASSERT_TRUE(snapshot != nullptr);
+    EXPECT_EQ(snapshot->as<tesseract_common::JointState>(), js);
+
+    // Remap copy shares the stored value instead of copying it
+    std::map<std::string, std::string> remap;
+    remap[key] = "remap_" + key;
+    EXPECT_TRUE(shared.remapData(remap, true));
+    EXPECT_EQ(shared.getSharedData(key), shared.getSharedData("remap_" + key));
+
+    // Replacing the value does not modify an outstanding snapshot
+    tesseract_common::JointState js2(joint_names, Eigen::Vector2d(1, 2));
+    shared.setData(key, js2);
+    EXPECT_EQ(snapshot->as<tesseract_common::JointState>(), js);
+    EXPECT_EQ(shared.getSharedData(key)->as<tesseract_common::JointState>(), js2);
+
+    // Take while a snapshot is outstanding copies and leaves the snapshot intact
+    EXPECT_EQ(shared.takeData("remap_" + key).as<tesseract_common::JointState>(), js);
+    EXPECT_FALSE(shared.hasKey("remap_" + key));
+    EXPECT_EQ(snapshot->as<tesseract_common::JointState>(), js);
+
+    // Take a uniquely owned value
+    EXPECT_EQ(shared.takeData(key).as<tesseract_common::JointState>(), js2);
+    EXPECT_FALSE(shared.hasKey(key));
+    EXPECT_TRUE(shared.takeData(key).isNull());
+  }
 }
 
 TEST(TesseractTaskComposerCoreUnit, TaskComposerContextTests)  // NOLINT
@@ -1383,6 +1432,39 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerGraphTests)  // NOLINT
     EXPECT_EQ(task2->getInboundEdges().size(), 1);
     EXPECT_EQ(task2->getInboundEdges().front(), task1->getUUID());
     EXPECT_EQ(task2->getOutboundEdges().size(), 0);
+
+    // Clone
+    TaskComposerNode::UPtr clone = pipeline->clone();
+    ASSERT_TRUE(clone != nullptr);
+    auto& graph_clone = dynamic_cast<TaskComposerGraph&>(*clone);
+    EXPECT_EQ(graph_clone.getName(), pipeline->getName());
+    EXPECT_NE(graph_clone.getUUID(), pipeline->getUUID());
+    EXPECT_EQ(graph_clone.getInputKeys(), pipeline->getInputKeys());
+    EXPECT_EQ(graph_clone.getOutputKeys(), pipeline->getOutputKeys());
+    EXPECT_EQ(graph_clone.getNodes().size(), 2);
+    auto clone_task1 = graph_clone.getNodeByName("StartTask");
+    auto clone_task2 = graph_clone.getNodeByName("DoneTask");
+    ASSERT_TRUE(clone_task1 != nullptr);
+    ASSERT_TRUE(clone_task2 != nullptr);
+    EXPECT_NE(clone_task1->getUUID(), task1->getUUID());
+    EXPECT_NE(clone_task2->getUUID(), task2->getUUID());
+    EXPECT_EQ(clone_task1->getParentUUID(), graph_clone.getUUID());
+    EXPECT_EQ(clone_task2->getParentUUID(), graph_clone.getUUID());
+    EXPECT_EQ(graph_clone.getTerminals(), std::vector<boost::uuids::uuid>({ clone_task2->getUUID() }));
+    EXPECT_EQ(clone_task1->getOutboundEdges(), std::vector<boost::uuids::uuid>({ clone_task2->getUUID() }));
+    EXPECT_EQ(clone_task2->getInboundEdges(), std::vector<boost::uuids::uuid>({ clone_task1->getUUID() }));
+
+    // A node which does not support clone prevents cloning the graph
+    auto unsupported = std::make_unique<TaskComposerGraph>(name);
+    unsupported->addNode(std::make_unique<TaskComposerNode>());
+    EXPECT_TRUE(unsupported->clone() == nullptr);
+
+    // Derived classes which inherit clone throw instead of returning a sliced copy
+    EXPECT_ANY_THROW(NoCloneGraph(name).clone());      // NOLINT
+    EXPECT_ANY_THROW(NoCloneDoneTask("abc").clone());  // NOLINT
+    auto derived_child = std::make_unique<TaskComposerGraph>(name);
+    derived_child->addNode(std::make_unique<NoCloneDoneTask>("abc"));
+    EXPECT_TRUE(derived_child->clone() == nullptr);
   }
 
   {  // Failure conditional graph is currently not supported
@@ -1972,6 +2054,88 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerSyncTaskTests)  // NOLINT
   }
 }
 
+TEST(TesseractTaskComposerCoreUnit, TaskComposerResultCacheTests)  // NOLINT
+{
+  tesseract_common::JointState joint_state;
+  joint_state.joint_names = { "joint_1", "joint_2", "joint_3" };
+  joint_state.position = Eigen::VectorXd::Constant(3, 5);
+
+  auto problem = std::make_shared<TaskComposerProblem>("TaskComposerResultCacheTests");
+  problem->input = joint_state;
+  TaskComposerDataStorage data_storage;
+  data_storage.setData("input_data", joint_state);
+
+  // Keys
+  const std::optional<std::string> key_value = TaskComposerResultCache::createKey(*problem, data_storage);
+  ASSERT_TRUE(key_value.has_value());
+  const std::string key = key_value.value();
+  EXPECT_EQ(key, TaskComposerResultCache::createKey(*problem->clone(), TaskComposerDataStorage(data_storage)).value());
+
+  auto problem2 = std::make_shared<TaskComposerProblem>(*problem);
+  joint_state.position(0) = 6;
+  problem2->input = joint_state;
+  const std::string key2 = TaskComposerResultCache::createKey(*problem2, data_storage).value();
+  EXPECT_NE(key, key2);
+  EXPECT_NE(key, TaskComposerResultCache::createKey(*problem, TaskComposerDataStorage()).value());
+
+  // Get and put
+  auto cache = std::make_shared<TaskComposerResultCache>();
+  EXPECT_EQ(cache->get(key, problem), nullptr);
+  EXPECT_EQ(cache->getMisses(), 1);
+  EXPECT_EQ(cache->getHits(), 0);
+
+  TaskComposerNode node;
+  auto context = std::make_shared<TaskComposerContext>(problem, std::make_shared<TaskComposerDataStorage>());
+  context->data_storage->setData("output_data", joint_state);
+  context->task_infos.addInfo(std::make_unique<TaskComposerNodeInfo>(node));
+  EXPECT_TRUE(cache->put(key, *context));
+  EXPECT_EQ(cache->size(), 1);
+  EXPECT_GT(cache->getMemoryUsage(), 0);
+
+  TaskComposerFuture::UPtr future = cache->get(key, problem);
+  ASSERT_NE(future, nullptr);
+  EXPECT_TRUE(future->valid());
+  EXPECT_TRUE(future->ready());
+  EXPECT_EQ(future->waitFor(std::chrono::seconds(0)), std::future_status::ready);
+  EXPECT_TRUE(future->context->isSuccessful());
+  EXPECT_EQ(future->context->problem, problem);
+  EXPECT_EQ(future->context->data_storage->getData("output_data"), joint_state);
+  EXPECT_EQ(future->context->task_infos.getInfoMap().size(), 1);
+  EXPECT_EQ(cache->getHits(), 1);
+  EXPECT_DOUBLE_EQ(cache->getHitRate(), 0.5);
+
+  // The cached result is not modified by the returned context
+  future->context->data_storage->removeData("output_data");
+  EXPECT_EQ(cache->get(key, problem)->context->data_storage->getData("output_data"), joint_state);
+
+  // Aborted results are not cached
+  auto aborted_context = std::make_shared<TaskComposerContext>(problem2, std::make_shared<TaskComposerDataStorage>());
+  aborted_context->abort();
+  EXPECT_FALSE(cache->put(key2, *aborted_context));
+  EXPECT_EQ(cache->size(), 1);
+
+  // The least recently used result is evicted once the memory budget is exceeded
+  const std::size_t memory = cache->getMemoryUsage();
+  auto small_cache = std::make_shared<TaskComposerResultCache>(memory + (memory / 2));
+  EXPECT_TRUE(small_cache->put(key, *context));
+  EXPECT_TRUE(small_cache->put(key2, *context));
+  EXPECT_EQ(small_cache->size(), 1);
+  EXPECT_EQ(small_cache->get(key, problem), nullptr);
+  EXPECT_NE(small_cache->get(key2, problem2), nullptr);
+
+  auto tiny_cache = std::make_shared<TaskComposerResultCache>(memory / 2);
+  EXPECT_FALSE(tiny_cache->put(key, *context));
+  EXPECT_EQ(tiny_cache->size(), 0);
+
+  cache->resetStatistics();
+  EXPECT_EQ(cache->getHits(), 0);
+  EXPECT_EQ(cache->getMisses(), 0);
+  EXPECT_DOUBLE_EQ(cache->getHitRate(), 0);
+  cache->clear();
+  EXPECT_EQ(cache->size(), 0);
+  EXPECT_EQ(cache->getMemoryUsage(), 0);
+}
+
 TEST(TesseractTaskComposerCoreUnit, TaskComposerServerTests)  // NOLINT
 {
   std::string str = R"(task_composer_plugins:
@@ -2093,6 +2257,38 @@ TEST(TesseractTaskComposerCoreUnit, TaskComposerServerTests)  // NOLINT
       EXPECT_TRUE(future->context->task_infos.getAbortingNode().is_nil());
     }
 
+    {  // Run method using a result cache
+      auto cache = std::make_shared<TaskComposerResultCache>();
+      server.setResultCache(cache);
+      EXPECT_EQ(server.getResultCache(), cache);
+      for (int i = 0; i < 2; ++i)
+      {
+        auto problem = std::make_unique<TaskComposerProblem>("TestPipeline");
+        auto data_storage = std::make_unique<TaskComposerDataStorage>();
+        auto future = server.run(std::move(problem), std::move(data_storage), "TaskflowExecutor");
+        future->wait();
+
+        EXPECT_EQ(future->context->isSuccessful(), true);
+        EXPECT_EQ(future->context->task_infos.getInfoMap().size(), 4);
+      }
+      EXPECT_EQ(cache->getMisses(), 1);
+      EXPECT_EQ(cache->getHits(), 1);
+      EXPECT_EQ(cache->size(), 1);
+
+      // The result is stored once the execution has finished without waiting on the future
+      cache->clear();
+      {
+        auto problem = std::make_unique<TaskComposerProblem>("TestPipeline");
+        auto data_storage = std::make_unique<TaskComposerDataStorage>();
+        auto future = server.run(std::move(problem), std::move(data_storage), "TaskflowExecutor");
+        auto start = std::chrono::steady_clock::now();
+        while (cache->size() == 0 && (std::chrono::steady_clock::now() - start) < std::chrono::seconds(10))
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      EXPECT_EQ(cache->size(), 1);
+      server.setResultCache(nullptr);
+    }
+
     {  // Failures, executor does not exist
       auto problem = std::make_unique<TaskComposerProblem>("TestPipeline");
       auto data_storage = std::make_unique<TaskComposerDataStorage>();
@@ -31,6 +31,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_motion_planners/trajopt/trajopt_motion_planner.h>
 
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
+#include <tesseract_task_composer/core/task_composer_result_cache.h>
 #include <tesseract_task_composer/core/test_suite/task_composer_serialization_utils.hpp>
 #include <tesseract_task_composer/core/test_suite/test_programs.hpp>
 
@@ -47,6 +48,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_common/joint_state.h>
 
 #include <tesseract_environment/environment.h>
+#include <tesseract_environment/commands.h>
 
 using namespace tesseract_planning;
 
@@ -166,6 +168,51 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerPlanningProblemTests)  //
   }
 }
 
+TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerPlanningProblemResultCacheKeyTests)  // NOLINT
+{
+  auto profiles = std::make_shared<ProfileDictionary>();
+  auto env = env_->clone();
+  PlanningTaskComposerProblem problem(env, manip_, profiles, "abc");
+  problem.input = test_suite::freespaceExampleProgramABB();
+  const TaskComposerDataStorage data_storage;
+
+  const std::string key = TaskComposerResultCache::createKey(problem, data_storage).value();
+  EXPECT_EQ(key, TaskComposerResultCache::createKey(*problem.clone(), data_storage).value());
+
+  // Modifying the profile dictionary changes the key
+  auto profile = std::make_shared<ContactCheckProfile>();
+  profiles->addProfile<ContactCheckProfile>(
+      "TaskComposerPlanningProblemResultCacheKeyTests", DEFAULT_PROFILE_KEY, profile);
+  const std::string profiles_key = TaskComposerResultCache::createKey(problem, data_storage).value();
+  EXPECT_NE(key, profiles_key);
+
+  // Another profile dictionary with the same profiles changes the key
+  auto other_profiles = std::make_shared<ProfileDictionary>();
+  other_profiles->addProfile<ContactCheckProfile>(
+      "TaskComposerPlanningProblemResultCacheKeyTests", DEFAULT_PROFILE_KEY, profile);
+  problem.profiles = other_profiles;
+  EXPECT_NE(profiles_key, TaskComposerResultCache::createKey(problem, data_storage).value());
+  problem.profiles = profiles;
+  EXPECT_EQ(profiles_key, TaskComposerResultCache::createKey(problem, data_storage).value());
+
+  // Modifying the environment changes the revision and the key
+  const int revision = env->getRevision();
+  EXPECT_TRUE(env->applyCommand(std::make_shared<tesseract_environment::ChangeJointPositionLimitsCommand>(
+      "joint_1", -1.0, 1.0)));
+  EXPECT_NE(env->getRevision(), revision);
+  const std::string revision_key = TaskComposerResultCache::createKey(problem, data_storage).value();
+  EXPECT_NE(profiles_key, revision_key);
+
+  // An environment with the same name and revision but different content has a different key
+  auto other_env = env_->clone();
+  EXPECT_TRUE(other_env->applyCommand(std::make_shared<tesseract_environment::ChangeJointPositionLimitsCommand>(
+      "joint_1", -2.0, 2.0)));
+  EXPECT_EQ(other_env->getName(), env->getName());
+  EXPECT_EQ(other_env->getRevision(), env->getRevision());
+  problem.env = other_env;
+  EXPECT_NE(revision_key, TaskComposerResultCache::createKey(problem, data_storage).value());
+}
+
 TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerPlanningTaskComposerProblemTests)  // NOLINT
 {
   {  // Construction
@@ -2155,6 +2202,23 @@ TEST_F(TesseractTaskComposerPlanningUnit, TaskComposerMotionPlannerTaskTests)  /
     test_suite::runSerializationPointerTest(task, "TaskComposerMotionPlannerTaskTests");
   }
 
+  {  // Clone
+    MotionPlannerTask<TrajOptMotionPlanner> task("abc", "input_data", "output_data", false, true);
+    TaskComposerNode::UPtr clone = task.clone();
+    ASSERT_TRUE(clone != nullptr);
+    EXPECT_EQ(clone->getName(), task.getName());
+    EXPECT_NE(clone->getUUID(), task.getUUID());
+    EXPECT_EQ(clone->getInputKeys(), task.getInputKeys());
+    EXPECT_EQ(clone->getOutputKeys(), task.getOutputKeys());
+    EXPECT_TRUE(dynamic_cast<MotionPlannerTask<TrajOptMotionPlanner>*>(clone.get()) != nullptr);
+
+    // Default constructed and deserialized tasks have no planner
+    MotionPlannerTask<TrajOptMotionPlanner> default_task;
+    TaskComposerNode::UPtr default_clone;
+    EXPECT_NO_THROW(default_clone = default_task.clone());  // NOLINT
+    EXPECT_TRUE(default_clone != nullptr);
+  }
+
   {  // Test run method
     auto data = std::make_unique<TaskComposerDataStorage>();
     {
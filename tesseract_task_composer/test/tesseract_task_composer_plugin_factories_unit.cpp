@@ -26,6 +26,7 @@
 #include <tesseract_common/macros.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <gtest/gtest.h>
+#include <typeinfo>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_task_composer/core/task_composer_plugin_factory.h>
@@ -82,6 +83,19 @@ void runTaskComposerFactoryTest(TaskComposerPluginFactory& factory, YAML::Node p
 
     TaskComposerNode::UPtr cm = factory.createTaskComposerNode(name);
     EXPECT_TRUE(cm != nullptr);
+
+    // Later nodes are cloned from the prototype
+    TaskComposerNode::UPtr cm_clone = factory.createTaskComposerNode(name);
+    ASSERT_TRUE(cm_clone != nullptr);
+    const TaskComposerNode& node = *cm;
+    const TaskComposerNode& node_clone = *cm_clone;
+    EXPECT_EQ(typeid(node_clone), typeid(node));
+    EXPECT_NE(cm_clone->getUUID(), cm->getUUID());
+    EXPECT_EQ(cm_clone->getName(), cm->getName());
+    EXPECT_EQ(cm_clone->getType(), cm->getType());
+    EXPECT_EQ(cm_clone->isConditional(), cm->isConditional());
+    EXPECT_EQ(cm_clone->getInputKeys(), cm->getInputKeys());
+    EXPECT_EQ(cm_clone->getOutputKeys(), cm->getOutputKeys());
   }
 
   factory.saveConfig(tesseract_common::fs::path(tesseract_common::getTempPath()) / "task_composer_plugins_export.yaml");
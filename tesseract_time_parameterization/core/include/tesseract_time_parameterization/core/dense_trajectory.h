@@ -0,0 +1,109 @@
+/**
+ * @file dense_trajectory.h
+ * @brief Trajectory Container implementation storing the waypoints in contiguous memory
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TIME_PARAMETERIZATION_DENSE_TRAJECTORY_H
+#define TESSERACT_TIME_PARAMETERIZATION_DENSE_TRAJECTORY_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_time_parameterization/core/trajectory_container.h>
+#include <tesseract_command_language/composite_instruction.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief A trajectory container which stores the waypoints in contiguous memory
+ *
+ * The positions, velocities and accelerations are stored in dof x size column major matrices, so the data of each
+ * waypoint is contiguous and no type erased instruction is accessed while the trajectory is time parameterized.
+ * The state waypoints of a program are gathered once on construction and the velocities, accelerations and times are
+ * scattered back once using assign().
+ */
+class DenseTrajectory : public TrajectoryContainer
+{
+public:
+  /**
+   * @brief Construct a trajectory from positions
+   * @details The velocities, accelerations and times are initialized to zero
+   * @param positions The positions, each column is a waypoint
+   */
+  explicit DenseTrajectory(Eigen::MatrixXd positions);
+
+  /**
+   * @brief Construct a trajectory from the move instructions of a program
+   * @details All move instructions must have a state waypoint. Velocities and accelerations which are not set on the
+   * waypoints are initialized to zero.
+   * @param program The program
+   */
+  explicit DenseTrajectory(const CompositeInstruction& program);
+
+  Eigen::Ref<const Eigen::VectorXd> getPosition(Eigen::Index i) const final;
+  Eigen::Ref<Eigen::VectorXd> getPosition(Eigen::Index i) final;
+  Eigen::Ref<const Eigen::VectorXd> getVelocity(Eigen::Index i) const final;
+  Eigen::Ref<Eigen::VectorXd> getVelocity(Eigen::Index i) final;
+  Eigen::Ref<const Eigen::VectorXd> getAcceleration(Eigen::Index i) const final;
+  Eigen::Ref<Eigen::VectorXd> getAcceleration(Eigen::Index i) final;
+  double getTimeFromStart(Eigen::Index i) const final;
+
+  void setData(Eigen::Index i,
+               const Eigen::Ref<const Eigen::VectorXd>& velocity,
+               const Eigen::Ref<const Eigen::VectorXd>& acceleration,
+               double time) final;
+
+  Eigen::Index size() const final;
+  Eigen::Index dof() const final;
+  bool empty() const final;
+
+  /** @brief The positions, each column is a waypoint */
+  const Eigen::MatrixXd& getPositions() const;
+
+  /** @brief The velocities, each column is a waypoint */
+  const Eigen::MatrixXd& getVelocities() const;
+
+  /** @brief The accelerations, each column is a waypoint */
+  const Eigen::MatrixXd& getAccelerations() const;
+
+  /** @brief The times from start */
+  const Eigen::VectorXd& getTimesFromStart() const;
+
+  /**
+   * @brief Assign the velocities, accelerations and times to the move instructions of a program
+   * @details The program must have the same move instructions as the program this trajectory was created from. The
+   * positions are not assigned because time parameterization does not change them.
+   * @param program The program
+   */
+  void assign(CompositeInstruction& program) const;
+
+private:
+  Eigen::MatrixXd positions_;
+  Eigen::MatrixXd velocities_;
+  Eigen::MatrixXd accelerations_;
+  Eigen::VectorXd times_;
+};
+}  // namespace tesseract_planning
+#endif  // TESSERACT_TIME_PARAMETERIZATION_DENSE_TRAJECTORY_H
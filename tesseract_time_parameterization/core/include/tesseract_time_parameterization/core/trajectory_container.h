@@ -53,24 +53,24 @@ public:
    * @param i The index to extract position data
    * @return The position data
    */
-  virtual const Eigen::VectorXd& getPosition(Eigen::Index i) const = 0;
-  virtual Eigen::VectorXd& getPosition(Eigen::Index i) = 0;
+  virtual Eigen::Ref<const Eigen::VectorXd> getPosition(Eigen::Index i) const = 0;
+  virtual Eigen::Ref<Eigen::VectorXd> getPosition(Eigen::Index i) = 0;
 
   /**
    * @brief Get the velocity data at a given index
    * @param i The index to extract velocity data
    * @return The velocity data
    */
-  virtual const Eigen::VectorXd& getVelocity(Eigen::Index i) const = 0;
-  virtual Eigen::VectorXd& getVelocity(Eigen::Index i) = 0;
+  virtual Eigen::Ref<const Eigen::VectorXd> getVelocity(Eigen::Index i) const = 0;
+  virtual Eigen::Ref<Eigen::VectorXd> getVelocity(Eigen::Index i) = 0;
 
   /**
    * @brief Get the acceleration data at a given index
    * @param i The index to extract acceleration data
    * @return The acceleration data
    */
-  virtual const Eigen::VectorXd& getAcceleration(Eigen::Index i) const = 0;
-  virtual Eigen::VectorXd& getAcceleration(Eigen::Index i) = 0;
+  virtual Eigen::Ref<const Eigen::VectorXd> getAcceleration(Eigen::Index i) const = 0;
+  virtual Eigen::Ref<Eigen::VectorXd> getAcceleration(Eigen::Index i) = 0;
 
   /**
    * @brief Get the time from start at a given index
@@ -86,8 +86,10 @@ public:
    * @param acceleration The acceleration data to assign to index
    * @param time The time from start to assign to index
    */
-  virtual void
-  setData(Eigen::Index i, const Eigen::VectorXd& velocity, const Eigen::VectorXd& acceleration, double time) = 0;
+  virtual void setData(Eigen::Index i,
+                       const Eigen::Ref<const Eigen::VectorXd>& velocity,
+                       const Eigen::Ref<const Eigen::VectorXd>& acceleration,
+                       double time) = 0;
 
   /** @brief The size of the path */
   virtual Eigen::Index size() const = 0;
@@ -0,0 +1,134 @@
+/**
+ * @file trajectory_sampler.h
+ * @brief Sampling of a time parameterized trajectory at a fixed rate
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef TESSERACT_TIME_PARAMETERIZATION_TRAJECTORY_SAMPLER_H
+#define TESSERACT_TIME_PARAMETERIZATION_TRAJECTORY_SAMPLER_H
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <Eigen/Core>
+#include <memory>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_time_parameterization/core/trajectory_container.h>
+
+namespace tesseract_planning
+{
+/**
+ * @brief Samples a time parameterized trajectory, for example to stream setpoints to a controller
+ *
+ * The trajectory is interpolated between waypoints using quintic polynomials which match the position, velocity and
+ * acceleration at both waypoints. The polynomial coefficients are computed once on construction and sampling does not
+ * allocate.
+ *
+ * The sampler only knows the waypoints, so it is exact only if every segment of the original trajectory is a
+ * polynomial of at most fifth order between consecutive waypoints. This is the case for IterativeSplineParameterization
+ * without add_points, whose cubic splines are reproduced exactly. For IterativeSplineParameterization with add_points
+ * the spline has knots which are not waypoints, and for TimeOptimalTrajectoryGeneration and Ruckig the motion between
+ * waypoints is not a single polynomial, so the samples only interpolate the waypoints and may slightly exceed the
+ * velocity and acceleration limits between them. To sample TimeOptimalTrajectoryGeneration exactly use
+ * TOTGTrajectorySampler with the trajectory returned by TimeOptimalTrajectoryGeneration::computeTimeStamps.
+ *
+ * The sampler keeps a cursor to the segment of the last sample, so sampling with increasing times is O(1) amortized.
+ * Sampling an earlier time falls back to a binary search. Times outside of the trajectory are clamped to its start and
+ * end. Since the cursor is modified while sampling, a sampler should not be shared between threads.
+ */
+class TrajectorySampler
+{
+public:
+  using Ptr = std::shared_ptr<TrajectorySampler>;
+  using ConstPtr = std::shared_ptr<const TrajectorySampler>;
+
+  /**
+   * @brief Construct a sampler of a time parameterized trajectory
+   * @details The data is copied so the trajectory may be modified or destroyed afterwards
+   * @param trajectory The trajectory, the times from start must be non-decreasing
+   */
+  explicit TrajectorySampler(const TrajectoryContainer& trajectory);
+
+  /** @brief The time of the first waypoint */
+  double getStartTime() const;
+
+  /** @brief The time of the last waypoint */
+  double getEndTime() const;
+
+  /** @brief The duration of the trajectory */
+  double getDuration() const;
+
+  /** @brief The number of joints */
+  Eigen::Index dof() const;
+
+  /**
+   * @brief The number of samples needed to sample the trajectory from start to end with a fixed time step
+   * @param dt The time step
+   * @return The number of samples, the last sample is at or before the end of the trajectory
+   */
+  Eigen::Index getNumSamples(double dt) const;
+
+  /** @brief Reset the cursor to the start of the trajectory */
+  void reset();
+
+  /**
+   * @brief Sample the trajectory at a given time
+   * @param time The time from start
+   * @param position The position, must be of size dof()
+   * @param velocity The velocity, must be of size dof()
+   * @param acceleration The acceleration, must be of size dof()
+   */
+  void sample(double time,
+              Eigen::Ref<Eigen::VectorXd> position,
+              Eigen::Ref<Eigen::VectorXd> velocity,
+              Eigen::Ref<Eigen::VectorXd> acceleration);
+
+  /**
+   * @brief Sample the trajectory with a fixed time step into preallocated buffers
+   * @details Column i is sampled at start_time + i * dt, the number of samples is the number of columns of the buffers
+   * @param start_time The time of the first sample
+   * @param dt The time step
+   * @param positions The positions, must have dof() rows
+   * @param velocities The velocities, must have the same size as positions
+   * @param accelerations The accelerations, must have the same size as positions
+   */
+  void sampleUniform(double start_time,
+                     double dt,
+                     Eigen::Ref<Eigen::MatrixXd> positions,
+                     Eigen::Ref<Eigen::MatrixXd> velocities,
+                     Eigen::Ref<Eigen::MatrixXd> accelerations);
+
+private:
+  /** @brief The time of each waypoint */
+  Eigen::VectorXd times_;
+  /** @brief The six polynomial coefficients of each segment, stored in consecutive columns */
+  Eigen::MatrixXd coeffs_;
+  /** @brief The segment of the last sample */
+  Eigen::Index cursor_{ 0 };
+
+  /** @brief Move the cursor to the segment containing time, which must be within the trajectory */
+  void seek(double time);
+};
+
+}  // namespace tesseract_planning
+
+#endif  // TESSERACT_TIME_PARAMETERIZATION_TRAJECTORY_SAMPLER_H
@@ -0,0 +1,135 @@
+/**
+ * @file dense_trajectory.cpp
+ * @brief Trajectory Container implementation storing the waypoints in contiguous memory
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_command_language/poly/move_instruction_poly.h>
+#include <tesseract_command_language/poly/state_waypoint_poly.h>
+
+namespace tesseract_planning
+{
+DenseTrajectory::DenseTrajectory(Eigen::MatrixXd positions)
+  : positions_(std::move(positions))
+  , velocities_(Eigen::MatrixXd::Zero(positions_.rows(), positions_.cols()))
+  , accelerations_(Eigen::MatrixXd::Zero(positions_.rows(), positions_.cols()))
+  , times_(Eigen::VectorXd::Zero(positions_.cols()))
+{
+  if (positions_.cols() == 0)
+    throw std::runtime_error("Tried to construct DenseTrajectory with empty trajectory!");
+}
+
+DenseTrajectory::DenseTrajectory(const CompositeInstruction& program)
+{
+  const auto flattened = program.flatten(moveFilter);
+  if (flattened.empty())
+    throw std::runtime_error("Tried to construct DenseTrajectory with empty trajectory!");
+
+  const auto num_points = static_cast<Eigen::Index>(flattened.size());
+  const Eigen::Index dof =
+      flattened.front().get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getPosition().rows();
+
+  positions_.resize(dof, num_points);
+  velocities_.setZero(dof, num_points);
+  accelerations_.setZero(dof, num_points);
+  times_.resize(num_points);
+
+  for (Eigen::Index i = 0; i < num_points; ++i)
+  {
+    const auto& instruction = flattened[static_cast<std::size_t>(i)].get();
+    assert(instruction.as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
+    const auto& swp = instruction.as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+    if (swp.getPosition().rows() != dof)
+      throw std::runtime_error("DenseTrajectory: All state waypoints must have the same number of joints!");
+
+    positions_.col(i) = swp.getPosition();
+    if (swp.getVelocity().rows() == dof)
+      velocities_.col(i) = swp.getVelocity();
+
+    if (swp.getAcceleration().rows() == dof)
+      accelerations_.col(i) = swp.getAcceleration();
+
+    times_(i) = swp.getTime();
+  }
+}
+
+Eigen::Ref<const Eigen::VectorXd> DenseTrajectory::getPosition(Eigen::Index i) const { return positions_.col(i); }
+
+Eigen::Ref<Eigen::VectorXd> DenseTrajectory::getPosition(Eigen::Index i) { return positions_.col(i); }
+
+Eigen::Ref<const Eigen::VectorXd> DenseTrajectory::getVelocity(Eigen::Index i) const { return velocities_.col(i); }
+
+Eigen::Ref<Eigen::VectorXd> DenseTrajectory::getVelocity(Eigen::Index i) { return velocities_.col(i); }
+
+Eigen::Ref<const Eigen::VectorXd> DenseTrajectory::getAcceleration(Eigen::Index i) const
+{
+  return accelerations_.col(i);
+}
+
+Eigen::Ref<Eigen::VectorXd> DenseTrajectory::getAcceleration(Eigen::Index i) { return accelerations_.col(i); }
+
+double DenseTrajectory::getTimeFromStart(Eigen::Index i) const { return times_(i); }
+
+void DenseTrajectory::setData(Eigen::Index i,
+                              const Eigen::Ref<const Eigen::VectorXd>& velocity,
+                              const Eigen::Ref<const Eigen::VectorXd>& acceleration,
+                              double time)
+{
+  velocities_.col(i) = velocity;
+  accelerations_.col(i) = acceleration;
+  times_(i) = time;
+}
+
+Eigen::Index DenseTrajectory::size() const { return positions_.cols(); }
+
+Eigen::Index DenseTrajectory::dof() const { return positions_.rows(); }
+
+bool DenseTrajectory::empty() const { return (positions_.cols() == 0); }
+
+const Eigen::MatrixXd& DenseTrajectory::getPositions() const { return positions_; }
+
+const Eigen::MatrixXd& DenseTrajectory::getVelocities() const { return velocities_; }
+
+const Eigen::MatrixXd& DenseTrajectory::getAccelerations() const { return accelerations_; }
+
+const Eigen::VectorXd& DenseTrajectory::getTimesFromStart() const { return times_; }
+
+void DenseTrajectory::assign(CompositeInstruction& program) const
+{
+  auto flattened = program.flatten(moveFilter);
+  if (static_cast<Eigen::Index>(flattened.size()) != size())
+    throw std::runtime_error("DenseTrajectory: The program does not have the same number of move instructions!");
+
+  for (Eigen::Index i = 0; i < size(); ++i)
+  {
+    auto& instruction = flattened[static_cast<std::size_t>(i)].get();
+    assert(instruction.as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
+    auto& swp = instruction.as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
+    swp.getVelocity() = velocities_.col(i);
+    swp.getAcceleration() = accelerations_.col(i);
+    swp.setTime(times_(i));
+  }
+}
+
+}  // namespace tesseract_planning
@@ -52,7 +52,7 @@ InstructionsTrajectory::InstructionsTrajectory(CompositeInstruction& program)
   dof_ = trajectory_.front().get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getPosition().rows();
 }
 
-const Eigen::VectorXd& InstructionsTrajectory::getPosition(Eigen::Index i) const
+Eigen::Ref<const Eigen::VectorXd> InstructionsTrajectory::getPosition(Eigen::Index i) const
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -64,7 +64,7 @@ const Eigen::VectorXd& InstructionsTrajectory::getPosition(Eigen::Index i) const
       .getPosition();
 }
 
-Eigen::VectorXd& InstructionsTrajectory::getPosition(Eigen::Index i)
+Eigen::Ref<Eigen::VectorXd> InstructionsTrajectory::getPosition(Eigen::Index i)
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -76,7 +76,7 @@ Eigen::VectorXd& InstructionsTrajectory::getPosition(Eigen::Index i)
       .getPosition();
 }
 
-const Eigen::VectorXd& InstructionsTrajectory::getVelocity(Eigen::Index i) const
+Eigen::Ref<const Eigen::VectorXd> InstructionsTrajectory::getVelocity(Eigen::Index i) const
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -88,7 +88,7 @@ const Eigen::VectorXd& InstructionsTrajectory::getVelocity(Eigen::Index i) const
       .getVelocity();
 }
 
-Eigen::VectorXd& InstructionsTrajectory::getVelocity(Eigen::Index i)
+Eigen::Ref<Eigen::VectorXd> InstructionsTrajectory::getVelocity(Eigen::Index i)
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -100,7 +100,7 @@ Eigen::VectorXd& InstructionsTrajectory::getVelocity(Eigen::Index i)
       .getVelocity();
 }
 
-const Eigen::VectorXd& InstructionsTrajectory::getAcceleration(Eigen::Index i) const
+Eigen::Ref<const Eigen::VectorXd> InstructionsTrajectory::getAcceleration(Eigen::Index i) const
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -112,7 +112,7 @@ const Eigen::VectorXd& InstructionsTrajectory::getAcceleration(Eigen::Index i) c
       .getAcceleration();
 }
 
-Eigen::VectorXd& InstructionsTrajectory::getAcceleration(Eigen::Index i)
+Eigen::Ref<Eigen::VectorXd> InstructionsTrajectory::getAcceleration(Eigen::Index i)
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
@@ -137,16 +137,17 @@ double InstructionsTrajectory::getTimeFromStart(Eigen::Index i) const
 }
 
 void InstructionsTrajectory::setData(Eigen::Index i,
-                                     const Eigen::VectorXd& velocity,
-                                     const Eigen::VectorXd& acceleration,
+                                     const Eigen::Ref<const Eigen::VectorXd>& velocity,
+                                     const Eigen::Ref<const Eigen::VectorXd>& acceleration,
                                      double time)
 {
   assert(trajectory_[static_cast<std::size_t>(i)].get().isMoveInstruction());
   assert(trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().isStateWaypoint());
   auto& swp =
       trajectory_[static_cast<std::size_t>(i)].get().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>();
-  swp.setVelocity(velocity);
-  swp.setAcceleration(acceleration);
+  // Assign in place so the waypoint storage is reused when it already has the correct size
+  swp.getVelocity() = velocity;
+  swp.getAcceleration() = acceleration;
   swp.setTime(time);
 }
 
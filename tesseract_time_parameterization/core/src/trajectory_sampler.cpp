@@ -0,0 +1,164 @@
+/**
+ * @file trajectory_sampler.cpp
+ * @brief Sampling of a time parameterized trajectory at a fixed rate
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <stdexcept>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <tesseract_time_parameterization/core/trajectory_sampler.h>
+
+namespace tesseract_planning
+{
+TrajectorySampler::TrajectorySampler(const TrajectoryContainer& trajectory)
+{
+  if (trajectory.empty())
+    throw std::runtime_error("Tried to construct TrajectorySampler with empty trajectory!");
+
+  const Eigen::Index num_points = trajectory.size();
+  const Eigen::Index dof = trajectory.dof();
+  const Eigen::Index num_segments = std::max<Eigen::Index>(num_points - 1, 1);
+
+  times_.resize(num_points);
+  coeffs_.resize(dof, 6 * num_segments);
+  for (Eigen::Index i = 0; i < num_points; ++i)
+  {
+    times_(i) = trajectory.getTimeFromStart(i);
+    if (i > 0 && times_(i) < times_(i - 1))
+      throw std::runtime_error("TrajectorySampler: The times from start must be non-decreasing!");
+
+    if (trajectory.getVelocity(i).rows() != dof || trajectory.getAcceleration(i).rows() != dof)
+      throw std::runtime_error("TrajectorySampler: The trajectory must have velocities and accelerations!");
+  }
+
+  if (num_points == 1)
+  {
+    coeffs_.setZero();
+    coeffs_.col(0) = trajectory.getPosition(0);
+    return;
+  }
+
+  for (Eigen::Index s = 0; s < num_segments; ++s)
+  {
+    const Eigen::Ref<const Eigen::VectorXd> p0 = trajectory.getPosition(s);
+    const Eigen::Ref<const Eigen::VectorXd> v0 = trajectory.getVelocity(s);
+    const Eigen::Ref<const Eigen::VectorXd> a0 = trajectory.getAcceleration(s);
+    const Eigen::Ref<const Eigen::VectorXd> p1 = trajectory.getPosition(s + 1);
+    const Eigen::Ref<const Eigen::VectorXd> v1 = trajectory.getVelocity(s + 1);
+    const Eigen::Ref<const Eigen::VectorXd> a1 = trajectory.getAcceleration(s + 1);
+    auto c = coeffs_.middleCols<6>(6 * s);
+
+    const double h = times_(s + 1) - times_(s);
+    if (h <= 0)
+    {
+      // A segment without duration is never sampled inside, hold the state of the next waypoint
+      c.setZero();
+      c.col(0) = p1;
+      continue;
+    }
+
+    // Quintic Hermite polynomial matching the position, velocity and acceleration at both waypoints
+    const double h2 = h * h;
+    const double h3 = h2 * h;
+    c.col(0) = p0;
+    c.col(1) = v0;
+    c.col(2) = 0.5 * a0;
+    c.col(3) = (20 * (p1 - p0) - (8 * v1 + 12 * v0) * h - (3 * a0 - a1) * h2) / (2 * h3);
+    c.col(4) = (30 * (p0 - p1) + (14 * v1 + 16 * v0) * h + (3 * a0 - 2 * a1) * h2) / (2 * h3 * h);
+    c.col(5) = (12 * (p1 - p0) - 6 * (v1 + v0) * h + (a1 - a0) * h2) / (2 * h3 * h2);
+  }
+}
+
+double TrajectorySampler::getStartTime() const { return times_(0); }
+
+double TrajectorySampler::getEndTime() const { return times_(times_.size() - 1); }
+
+double TrajectorySampler::getDuration() const { return getEndTime() - getStartTime(); }
+
+Eigen::Index TrajectorySampler::dof() const { return coeffs_.rows(); }
+
+Eigen::Index TrajectorySampler::getNumSamples(double dt) const
+{
+  if (dt <= 0)
+    throw std::runtime_error("TrajectorySampler: The time step must be greater than zero!");
+
+  // The tolerance keeps a sample at the end when the duration is a multiple of the time step
+  return static_cast<Eigen::Index>(std::floor((getDuration() / dt) + 1e-9)) + 1;
+}
+
+void TrajectorySampler::reset() { cursor_ = 0; }
+
+void TrajectorySampler::seek(double time)
+{
+  const Eigen::Index num_segments = coeffs_.cols() / 6;
+  if (time < times_(cursor_))
+  {
+    // Sampling backwards in time, search the segments before the cursor
+    const double* it = std::upper_bound(times_.data(), times_.data() + cursor_, time);
+    cursor_ = std::max<Eigen::Index>(static_cast<Eigen::Index>(it - times_.data()) - 1, 0);
+    return;
+  }
+
+  while ((cursor_ + 1) < num_segments && times_(cursor_ + 1) <= time)
+    ++cursor_;
+}
+
+void TrajectorySampler::sample(double time,
+                               Eigen::Ref<Eigen::VectorXd> position,
+                               Eigen::Ref<Eigen::VectorXd> velocity,
+                               Eigen::Ref<Eigen::VectorXd> acceleration)
+{
+  assert(position.rows() == dof() && velocity.rows() == dof() && acceleration.rows() == dof());
+
+  time = std::clamp(time, getStartTime(), getEndTime());
+  seek(time);
+
+  const double t = time - times_(cursor_);
+  const auto c = coeffs_.middleCols<6>(6 * cursor_);
+  position = c.col(0) + t * (c.col(1) + t * (c.col(2) + t * (c.col(3) + t * (c.col(4) + t * c.col(5)))));
+  velocity = c.col(1) + t * (2 * c.col(2) + t * (3 * c.col(3) + t * (4 * c.col(4) + t * 5 * c.col(5))));
+  acceleration = 2 * c.col(2) + t * (6 * c.col(3) + t * (12 * c.col(4) + t * 20 * c.col(5)));
+}
+
+void TrajectorySampler::sampleUniform(double start_time,
+                                      double dt,
+                                      Eigen::Ref<Eigen::MatrixXd> positions,
+                                      Eigen::Ref<Eigen::MatrixXd> velocities,
+                                      Eigen::Ref<Eigen::MatrixXd> accelerations)
+{
+  assert(positions.rows() == dof());
+  assert(velocities.rows() == positions.rows() && velocities.cols() == positions.cols());
+  assert(accelerations.rows() == positions.rows() && accelerations.cols() == positions.cols());
+
+  // The time of each sample is computed from its index so the error does not accumulate
+  for (Eigen::Index i = 0; i < positions.cols(); ++i)
+    sample(start_time + (static_cast<double>(i) * dt), positions.col(i), velocities.col(i), accelerations.col(i));
+}
+
+}  // namespace tesseract_planning
@@ -47,16 +47,85 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
-static void fit_cubic_spline(long n, const double dt[], const double x[], double x1[], double x2[]);  // NOLINT
-static void adjust_two_positions(long n,
-                                 const double dt[],  // NOLINT
-                                 double x[],         // NOLINT
-                                 double x1[],        // NOLINT
-                                 double x2[],        // NOLINT
-                                 double x2_i,        // NOLINT
-                                 double x2_f);       // NOLINT
-static void
-init_times(long n, double dt[], const double x[], const double max_velocity[], double min_velocity[]);  // NOLINT
+// Values of all joints in [point][joint] order. Each row holds one point so the spline
+// recurrences update every joint of a point with a single vectorized operation.
+using JointArrayMap = Eigen::Map<Eigen::Array<double, Eigen::Dynamic, Eigen::Dynamic, Eigen::RowMajor>>;
+using ArrayMap = Eigen::Map<Eigen::ArrayXd>;
+
+// The path of all joints: positions, velocities, and accelerations
+// The min velocity and acceleration are the negated max velocity and acceleration
+struct SplineWorkspace
+{
+  SplineWorkspace(double* data, Eigen::Index num_points, Eigen::Index num_joints)
+    : positions(data, num_points, num_joints)
+    , velocities(positions.data() + positions.size(), num_points, num_joints)
+    , accelerations(velocities.data() + velocities.size(), num_points, num_joints)
+    , max_velocity(accelerations.data() + accelerations.size(), num_points, num_joints)
+    , max_acceleration(max_velocity.data() + max_velocity.size(), num_points, num_joints)
+    , joint_factors(max_acceleration.data() + max_acceleration.size(), num_points, num_joints)
+    , slopes(joint_factors.data() + joint_factors.size(), num_points - 1, num_joints)
+    , time_diff(slopes.data() + slopes.size(), num_points - 1)
+    , point_factors(time_diff.data() + time_diff.size(), num_points)
+    , c(point_factors.data() + point_factors.size(), num_points)
+    , initial_acceleration(c.data() + c.size(), num_joints)
+    , final_acceleration(initial_acceleration.data() + initial_acceleration.size(), num_joints)
+    , x2_start(final_acceleration.data() + final_acceleration.size(), num_joints)
+    , x2_end(x2_start.data() + x2_start.size(), num_joints)
+  {
+  }
+
+  // The number of doubles required to store a workspace
+  static std::size_t size(Eigen::Index num_points, Eigen::Index num_joints)
+  {
+    return static_cast<std::size_t>((7 * num_points * num_joints) - num_joints + (3 * num_points) - 1 +
+                                    (4 * num_joints));
+  }
+
+  JointArrayMap positions;  // joint's position at time[x]
+  JointArrayMap velocities;
+  JointArrayMap accelerations;
+  JointArrayMap max_velocity;
+  JointArrayMap max_acceleration;
+  JointArrayMap joint_factors;  // scratch space for the time stretch of each joint
+  JointArrayMap slopes;         // scratch space for the position difference over time of each segment
+  ArrayMap time_diff;           // time difference between each point
+  ArrayMap point_factors;       // scratch space for the time stretch of each point
+  ArrayMap c;                   // tridiagonal coefficients, which only depend on the time differences
+  ArrayMap initial_acceleration;
+  ArrayMap final_acceleration;
+  ArrayMap x2_start;  // scratch space used when adjusting the 2nd and 2nd-last points
+  ArrayMap x2_end;
+};
+
+// The largest workspace storage in doubles (8 MiB) a thread keeps between calls
+static const std::size_t MAX_RETAINED_WORKSPACE_SIZE = std::size_t(1) << 20;
+
+// Releases the workspace storage when it goes out of scope if it is larger than the retained size,
+// so a single long trajectory does not hold its memory for the lifetime of the thread
+struct WorkspaceStorageGuard
+{
+  explicit WorkspaceStorageGuard(std::vector<double>& storage) : storage(storage) {}
+  ~WorkspaceStorageGuard()
+  {
+    if (storage.capacity() > MAX_RETAINED_WORKSPACE_SIZE)
+    {
+      storage.clear();
+      storage.shrink_to_fit();
+    }
+  }
+  WorkspaceStorageGuard(const WorkspaceStorageGuard&) = delete;
+  WorkspaceStorageGuard& operator=(const WorkspaceStorageGuard&) = delete;
+  WorkspaceStorageGuard(WorkspaceStorageGuard&&) = delete;
+  WorkspaceStorageGuard& operator=(WorkspaceStorageGuard&&) = delete;
+
+  std::vector<double>& storage;
+};
+
+static void fit_slopes(SplineWorkspace& t2);
+static void fit_end_slopes(SplineWorkspace& t2);
+static void fit_cubic_spline(SplineWorkspace& t2, bool fit_velocities = true);
+static void adjust_two_positions(SplineWorkspace& t2);
+static void init_times(SplineWorkspace& t2);
 // static int fit_spline_and_adjust_times(const int n,
 //                                       double dt[],
 //                                       const double x[],
@@ -67,34 +136,8 @@ init_times(long n, double dt[], const double x[], const double max_velocity[], d
 //                                       const double max_acceleration,
 //                                       const double min_acceleration,
 //                                       const double tfactor);
-static double global_adjustment_factor(long n,
-                                       double dt[],                       // NOLINT
-                                       const double x[],                  // NOLINT
-                                       double x1[],                       // NOLINT
-                                       double x2[],                       // NOLINT
-                                       const double max_velocity[],       // NOLINT
-                                       const double min_velocity[],       // NOLINT
-                                       const double max_acceleration[],   // NOLINT
-                                       const double min_acceleration[]);  // NOLINT
-
-// The path of a single joint: positions, velocities, and accelerations
-struct SingleJointTrajectory
-{
-  std::vector<double> positions_;  // joint's position at time[x]
-  std::vector<double> velocities_;
-  std::vector<double> accelerations_;
-  double initial_acceleration_{ 0 };
-  double final_acceleration_{ 0 };
-  std::vector<double> min_velocity_;
-  std::vector<double> max_velocity_;
-  std::vector<double> min_acceleration_;
-  std::vector<double> max_acceleration_;
-};
-
-void globalAdjustment(std::vector<SingleJointTrajectory>& t2,
-                      long num_joints,
-                      long num_points,
-                      std::vector<double>& time_diff);
+static double global_adjustment_factor(const SplineWorkspace& t2);
+static void globalAdjustment(SplineWorkspace& t2);
 
 IterativeSplineParameterization::IterativeSplineParameterization(bool add_points) : add_points_(add_points) {}
 
@@ -152,7 +195,6 @@ bool IterativeSplineParameterization::compute(
 
   Eigen::VectorXd velocity_scaling_factor = Eigen::VectorXd::Ones(trajectory.size());
   Eigen::VectorXd acceleration_scaling_factor = Eigen::VectorXd::Ones(trajectory.size());
-  auto num_points = static_cast<std::size_t>(trajectory.size());
 
   if (max_velocity.size() != trajectory.dof() || max_acceleration.size() != trajectory.dof())
     return false;
@@ -212,189 +254,125 @@ bool IterativeSplineParameterization::compute(
       }
     }
   }
+  bool add_points = add_points_;
+  if (trajectory.size() < 2)
+    add_points = false;
 
-  // JointTrajectory indexes in [point][joint] order.
-  // We need [joint][point] order to solve efficiently,
-  // so convert form here.
+  const Eigen::Index num_joints = trajectory.dof();
+  const Eigen::Index num_points = trajectory.size() + (add_points ? 2 : 0);
 
-  std::vector<SingleJointTrajectory> t2(static_cast<std::size_t>(trajectory.dof()));
+  // JointTrajectory indexes in [point][joint] order, which is also the order used to solve
+  // so all joints of a point are processed together. The storage of each thread is kept
+  // between calls so repeated time parameterization does not allocate, unless it is larger
+  // than MAX_RETAINED_WORKSPACE_SIZE.
+  thread_local std::vector<double> buffer;
+  if (buffer.size() < SplineWorkspace::size(num_points, num_joints))
+    buffer.resize(SplineWorkspace::size(num_points, num_joints));
+  WorkspaceStorageGuard buffer_guard(buffer);
 
-  const Eigen::VectorXd& start_vel = trajectory.getVelocity(0);
-  const Eigen::VectorXd& last_vel = trajectory.getVelocity(static_cast<Eigen::Index>(num_points - 1));
-  const Eigen::VectorXd& start_acc = trajectory.getAcceleration(0);
-  const Eigen::VectorXd& last_acc = trajectory.getAcceleration(static_cast<Eigen::Index>(num_points - 1));
+  SplineWorkspace t2(buffer.data(), num_points, num_joints);
 
-  for (std::size_t j = 0; j < static_cast<std::size_t>(trajectory.dof()); j++)
+  const Eigen::Ref<const Eigen::VectorXd> start_vel = trajectory.getVelocity(0);
+  const Eigen::Ref<const Eigen::VectorXd> last_vel = trajectory.getVelocity(trajectory.size() - 1);
+  const Eigen::Ref<const Eigen::VectorXd> start_acc = trajectory.getAcceleration(0);
+  const Eigen::Ref<const Eigen::VectorXd> last_acc = trajectory.getAcceleration(trajectory.size() - 1);
+
+  // Copy positions and set bounds based on inputs, leaving room for the 2nd and 2nd-last points if added
+  for (Eigen::Index i = 0; i < trajectory.size(); i++)
   {
-    // Copy positions
-    t2[j].positions_.resize(num_points, 0.0);
-    for (std::size_t i = 0; i < num_points; i++)
-      t2[j].positions_[i] = trajectory.getPosition(static_cast<Eigen::Index>(i))[static_cast<Eigen::Index>(j)];
-
-    // Initialize velocities
-    t2[j].velocities_.resize(num_points, 0.0);
-
-    // Copy initial/final velocities if specified
-    if (start_vel.size() > 0)
-      t2[j].velocities_[0] = start_vel[static_cast<Eigen::Index>(j)];
-    if (last_vel.size() > 0)
-      t2[j].velocities_[num_points - 1] = last_vel[static_cast<Eigen::Index>(j)];
-
-    // Initialize accelerations
-    t2[j].accelerations_.resize(num_points, 0.0);
-    t2[j].initial_acceleration_ = 0.0;
-    t2[j].final_acceleration_ = 0.0;
-
-    // Copy initial/final accelerations if specified
-    if (start_acc.size() > 0)
-      t2[j].initial_acceleration_ = start_acc[static_cast<Eigen::Index>(j)];
-    t2[j].accelerations_[0] = t2[j].initial_acceleration_;
-    if (last_acc.size() > 0)
-      t2[j].final_acceleration_ = last_acc[static_cast<Eigen::Index>(j)];
-    t2[j].accelerations_[num_points - 1] = t2[j].final_acceleration_;
-
-    // Set bounds based on inputs
-    t2[j].max_velocity_.resize(num_points);
-    t2[j].min_velocity_.resize(num_points);
-    t2[j].max_acceleration_.resize(num_points);
-    t2[j].min_acceleration_.resize(num_points);
-    Eigen::Map<Eigen::VectorXd> max_velocity_eigen(t2[j].max_velocity_.data(), static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> min_velocity_eigen(t2[j].min_velocity_.data(), static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> max_acceleration_eigen(t2[j].max_acceleration_.data(),
-                                                       static_cast<Eigen::Index>(num_points));
-    Eigen::Map<Eigen::VectorXd> min_acceleration_eigen(t2[j].min_acceleration_.data(),
-                                                       static_cast<Eigen::Index>(num_points));
-
-    max_velocity_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * max_velocity[static_cast<Eigen::Index>(j)];
-    min_velocity_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * -max_velocity[static_cast<Eigen::Index>(j)];
-    max_velocity_eigen.array() *= velocity_scaling_factor.array();
-    min_velocity_eigen.array() *= velocity_scaling_factor.array();
-
-    max_acceleration_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * max_acceleration[static_cast<Eigen::Index>(j)];
-    min_acceleration_eigen =
-        Eigen::VectorXd::Ones(static_cast<Eigen::Index>(num_points)) * -max_acceleration[static_cast<Eigen::Index>(j)];
-    max_acceleration_eigen.array() *= acceleration_scaling_factor.array();
-    min_acceleration_eigen.array() *= acceleration_scaling_factor.array();
-
-    // Error out if bounds don't make sense
-    if ((max_velocity_eigen.array() <= 0.0).any() || (max_acceleration_eigen.array() <= 0.0).any())
-    {
-      CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Joint %d max velocity %f and max acceleration %f "
-                              "must be greater than zero or a solution won't be found.",
-                              j,
-                              t2[j].max_velocity_[0],
-                              t2[j].max_acceleration_[0]);
-      return false;
-    }
-    if ((min_velocity_eigen.array() >= 0.0).any() || (min_acceleration_eigen.array() >= 0.0).any())
-    {
-      CONSOLE_BRIDGE_logError("trajectory_processing.iterative_spline_parameterization: Joint %d min velocity %f and "
-                              "min acceleration %f must be less than zero or a solution won't be found.",
-                              j,
-                              t2[j].min_velocity_[0],
-                              t2[j].min_acceleration_[0]);
-      return false;
-    }
+    Eigen::Index row = i;
+    if (add_points && i > 0)
+      row = (i == trajectory.size() - 1) ? i + 2 : i + 1;
+
+    t2.positions.row(row) = trajectory.getPosition(i).transpose().array();
+    t2.max_velocity.row(row) = velocity_scaling_factor[i] * max_velocity.transpose().array();
+    t2.max_acceleration.row(row) = acceleration_scaling_factor[i] * max_acceleration.transpose().array();
   }
 
-  bool add_points = add_points_;
-  if (num_points < 2)
-    add_points = false;
+  // Initialize velocities and copy initial/final velocities if specified
+  t2.velocities.setZero();
+  if (start_vel.size() > 0)
+    t2.velocities.row(0) = start_vel.transpose().array();
+  if (last_vel.size() > 0)
+    t2.velocities.row(num_points - 1) = last_vel.transpose().array();
+
+  // Initialize accelerations and copy initial/final accelerations if specified
+  t2.initial_acceleration.setZero();
+  t2.final_acceleration.setZero();
+  if (start_acc.size() > 0)
+    t2.initial_acceleration = start_acc.array();
+  if (last_acc.size() > 0)
+    t2.final_acceleration = last_acc.array();
+
+  t2.accelerations.setZero();
+  t2.accelerations.row(0) = t2.initial_acceleration.transpose();
+  t2.accelerations.row(num_points - 1) = t2.final_acceleration.transpose();
 
   if (add_points)
   {
     // Insert 2nd and 2nd-last points
     // (required to force acceleration to specified values at endpoints)
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      double value = 0.9 * t2[j].positions_[0] + 0.1 * t2[j].positions_[1];
-      t2[j].positions_.insert(t2[j].positions_.begin() + 1, value);
-
-      value = t2[j].velocities_.front();
-      t2[j].velocities_.insert(t2[j].velocities_.begin() + 1, value);
-
-      value = t2[j].accelerations_.front();
-      t2[j].accelerations_.insert(t2[j].accelerations_.begin() + 1, value);
-
-      value = t2[j].max_velocity_.front();
-      t2[j].max_velocity_.insert(t2[j].max_velocity_.begin() + 1, value);
-
-      value = t2[j].min_velocity_.front();
-      t2[j].min_velocity_.insert(t2[j].min_velocity_.begin() + 1, value);
+    t2.positions.row(1) = 0.9 * t2.positions.row(0) + 0.1 * trajectory.getPosition(1).transpose().array();
+    t2.positions.row(num_points - 2) =
+        0.1 * t2.positions.row(num_points - 3) + 0.9 * t2.positions.row(num_points - 1);
 
-      value = t2[j].max_acceleration_.front();
-      t2[j].max_acceleration_.insert(t2[j].max_acceleration_.begin() + 1, value);
-
-      value = t2[j].min_acceleration_.front();
-      t2[j].min_acceleration_.insert(t2[j].min_acceleration_.begin() + 1, value);
+    for (JointArrayMap* values : { &t2.velocities, &t2.accelerations, &t2.max_velocity, &t2.max_acceleration })
+    {
+      values->row(1) = values->row(0);
+      values->row(num_points - 2) = values->row(num_points - 1);
     }
-    num_points++;
+  }
 
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
+  // Error out if bounds don't make sense
+  for (Eigen::Index j = 0; j < num_joints; j++)
+  {
+    if ((t2.max_velocity.col(j) <= 0.0).any() || (t2.max_acceleration.col(j) <= 0.0).any())
     {
-      double value = 0.1 * t2[j].positions_[num_points - 2] + 0.9 * t2[j].positions_[num_points - 1];
-      t2[j].positions_.insert(t2[j].positions_.end() - 1, value);
-
-      value = t2[j].velocities_.back();
-      t2[j].velocities_.insert(t2[j].velocities_.end() - 1, value);
-
-      value = t2[j].accelerations_.back();
-      t2[j].accelerations_.insert(t2[j].accelerations_.end() - 1, value);
-
-      value = t2[j].max_velocity_.back();
-      t2[j].max_velocity_.insert(t2[j].max_velocity_.end() - 1, value);
-
-      value = t2[j].min_velocity_.back();
-      t2[j].min_velocity_.insert(t2[j].min_velocity_.end() - 1, value);
-
-      value = t2[j].max_acceleration_.back();
-      t2[j].max_acceleration_.insert(t2[j].max_acceleration_.end() - 1, value);
-
-      value = t2[j].min_acceleration_.back();
-      t2[j].min_acceleration_.insert(t2[j].min_acceleration_.end() - 1, value);
+      CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Joint %d max velocity %f and max acceleration %f "
+                              "must be greater than zero or a solution won't be found.",
+                              static_cast<int>(j),
+                              t2.max_velocity(0, j),
+                              t2.max_acceleration(0, j));
+      return false;
     }
-    num_points++;
   }
 
   // Error check
   if (num_points < 4)
   {
     CONSOLE_BRIDGE_logError("iterative_spline_parameterization: number of waypoints %d, needs to be greater than 3.",
-                            num_points);
+                            static_cast<int>(num_points));
     return false;
   }
-  for (std::size_t j = 0; j < static_cast<std::size_t>(trajectory.dof()); j++)
+  for (Eigen::Index j = 0; j < num_joints; j++)
   {
-    if (t2[j].velocities_[0] > t2[j].max_velocity_[0] || t2[j].velocities_[0] < t2[j].min_velocity_[0])
+    if (t2.velocities(0, j) > t2.max_velocity(0, j) || t2.velocities(0, j) < -t2.max_velocity(0, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Initial velocity %f out of bounds.",
-                              t2[j].velocities_[0]);
+                              t2.velocities(0, j));
       return false;
     }
 
-    if (t2[j].velocities_[num_points - 1] > t2[j].max_velocity_[num_points - 1] ||
-        t2[j].velocities_[num_points - 1] < t2[j].min_velocity_[num_points - 1])
+    if (t2.velocities(num_points - 1, j) > t2.max_velocity(num_points - 1, j) ||
+        t2.velocities(num_points - 1, j) < -t2.max_velocity(num_points - 1, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Final velocity %f out of bounds.",
-                              t2[j].velocities_[num_points - 1]);
+                              t2.velocities(num_points - 1, j));
       return false;
     }
 
-    if (t2[j].accelerations_[0] > t2[j].max_acceleration_[0] || t2[j].accelerations_[0] < t2[j].min_acceleration_[0])
+    if (t2.accelerations(0, j) > t2.max_acceleration(0, j) || t2.accelerations(0, j) < -t2.max_acceleration(0, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Initial acceleration %f out of bounds\n",
-                              t2[j].accelerations_[0]);
+                              t2.accelerations(0, j));
       return false;
     }
 
-    if (t2[j].accelerations_[num_points - 1] > t2[j].max_acceleration_[num_points - 1] ||
-        t2[j].accelerations_[num_points - 1] < t2[j].min_acceleration_[num_points - 1])
+    if (t2.accelerations(num_points - 1, j) > t2.max_acceleration(num_points - 1, j) ||
+        t2.accelerations(num_points - 1, j) < -t2.max_acceleration(num_points - 1, j))
     {
       CONSOLE_BRIDGE_logError("iterative_spline_parameterization: Final acceleration %f out of bounds\n",
-                              t2[j].accelerations_[num_points - 1]);
+                              t2.accelerations(num_points - 1, j));
       return false;
     }
   }
@@ -402,93 +380,56 @@ bool IterativeSplineParameterization::compute(
   // Initialize times
   // start with valid velocities, then expand intervals
   // epsilon to prevent divide-by-zero
-  std::vector<double> time_diff(static_cast<std::size_t>(num_points - 1), std::numeric_limits<double>::epsilon());
-  for (unsigned int j = 0; j < trajectory.dof(); j++)
-    init_times(static_cast<long>(num_points),
-               time_diff.data(),
-               t2[j].positions_.data(),
-               t2[j].max_velocity_.data(),
-               t2[j].min_velocity_.data());
+  t2.time_diff.setConstant(std::numeric_limits<double>::epsilon());
+  init_times(t2);
 
   // Stretch intervals until close to the bounds
   while (true)
   {
-    int loop = 0;
+    // The time differences changed so the slopes of every segment are updated
+    fit_slopes(t2);
 
-    // Calculate the interval stretches due to acceleration
-    std::vector<double> time_factor(static_cast<std::size_t>(num_points - 1), 1.00);
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      // Move points to satisfy initial/final acceleration
-      if (add_points)
-      {
-        adjust_two_positions(static_cast<int>(num_points),
-                             time_diff.data(),
-                             t2[j].positions_.data(),
-                             t2[j].velocities_.data(),
-                             t2[j].accelerations_.data(),
-                             t2[j].initial_acceleration_,
-                             t2[j].final_acceleration_);
-      }
+    // Move points to satisfy initial/final acceleration
+    if (add_points)
+      adjust_two_positions(t2);
 
-      fit_cubic_spline(static_cast<int>(num_points),
-                       time_diff.data(),
-                       t2[j].positions_.data(),
-                       t2[j].velocities_.data(),
-                       t2[j].accelerations_.data());
-      for (unsigned i = 0; i < num_points; i++)
-      {
-        const double acc = t2[j].accelerations_[i];
-        double atfactor = 1.0;
-        if (acc > t2[j].max_acceleration_[i])
-          atfactor = sqrt(acc / t2[j].max_acceleration_[i]);
-        if (acc < t2[j].min_acceleration_[i])
-          atfactor = sqrt(acc / t2[j].min_acceleration_[i]);
-        if (atfactor > 1.01)  // within 1%
-          loop = 1;
-        atfactor = (atfactor - 1.0) / 16.0 + 1.0;  // 1/16th
-        if (i > 0)
-          time_factor[i - 1] = std::max(time_factor[i - 1], atfactor);
-        if (i < num_points - 1)
-          time_factor[i] = std::max(time_factor[i], atfactor);
-      }
-    }
+    fit_cubic_spline(t2);
 
-    if (loop == 0)
-      break;  // finished
+    // Calculate the interval stretches due to acceleration
+    // |acc| / max_acc is the same as acc / min_acc when the acceleration is negative
+    t2.joint_factors = (t2.accelerations.abs() / t2.max_acceleration).sqrt().max(1.0);
+    if (!(t2.joint_factors > 1.01).any())  // within 1%
+      break;                               // finished
+
+    t2.point_factors = ((t2.joint_factors - 1.0) / 16.0 + 1.0).rowwise().maxCoeff();  // 1/16th
 
     // Stretch
-    for (unsigned i = 0; i < num_points - 1; i++)
-      time_diff[i] *= time_factor[i];
+    t2.time_diff *= t2.point_factors.head(num_points - 1).max(t2.point_factors.tail(num_points - 1));
   }
 
   // Final adjustment forces the trajectory within bounds
-  globalAdjustment(t2, trajectory.dof(), static_cast<long>(num_points), time_diff);
+  globalAdjustment(t2);
 
   // Convert back to JointTrajectory form
   double time = 0;
   Eigen::Index idx = 0;
-  for (unsigned int i = 0; i < num_points; i++)
+  Eigen::VectorXd uv(num_joints);
+  Eigen::VectorXd ua(num_joints);
+  for (Eigen::Index i = 0; i < num_points; i++)
   {
-    Eigen::VectorXd uv(trajectory.dof());
-    Eigen::VectorXd ua(trajectory.dof());
-    for (unsigned int j = 0; j < trajectory.dof(); j++)
-    {
-      uv[j] = t2[j].velocities_[i];
-      ua[j] = t2[j].accelerations_[i];
-    }
-
     // Calculate time from start
     if (i > 0)
-      time = time + time_diff[i - 1];
+      time = time + t2.time_diff[i - 1];
 
     // Do not process added points
     if (add_points && (i == 1 || i == num_points - 2))
     {
-      time = time + time_diff[i - 1];
+      time = time + t2.time_diff[i - 1];
       continue;
     }
 
+    uv = t2.velocities.row(i).transpose().matrix();
+    ua = t2.accelerations.row(i).transpose().matrix();
     trajectory.setData(idx++, uv, ua, time);
   }
 
@@ -521,6 +462,7 @@ bool IterativeSplineParameterization::compute(
   using the tridiagonal algorithm.
   There is a forward propogation pass followed by a backsubstitution pass.
 
+  All joints are solved at once, each row of the workspace holds one point.
   n is the number of points
   dt contains the time difference between each point (size=n-1)
   x  contains the positions                          (size=n)
@@ -528,43 +470,50 @@ bool IterativeSplineParameterization::compute(
      x1[0] and x1[n-1] MUST be specified.
   x2 contains the 2nd derivative (accelerations)     (size=n)
   x1 and x2 are filled in by the algorithm.
+
+  The slopes (x[i+1]-x[i])/dt[i] appear in the equations of two points and the 1st derivative
+  so they are computed once by fit_slopes, which must be called after x or dt change.
+  If fit_velocities is false only x2 is filled in.
 */
-// NOLINTNEXTLINE
-static void fit_cubic_spline(const long n, const double dt[], const double x[], double x1[], double x2[])
+static void fit_cubic_spline(SplineWorkspace& t2, bool fit_velocities)
 {
-  long i{ 0 };
-  const double x1_i = x1[0], x1_f = x1[n - 1];
+  const Eigen::Index n = t2.positions.rows();
+  const ArrayMap& dt = t2.time_diff;
+  JointArrayMap& x1 = t2.velocities;
+  JointArrayMap& x2 = t2.accelerations;
+  ArrayMap& c = t2.c;
+  const JointArrayMap& s = t2.slopes;
 
   // Tridiagonal alg - forward sweep
-  // x1 and x2 used to store the temporary coefficients c and d
+  // c only depends on the time differences so it is shared by all joints
+  // x2 used to store the temporary coefficients d
   // (will get overwritten during backsubstitution)
-  double *c = x1, *d = x2;
   c[0] = 0.5;
-  d[0] = 3.0 * ((x[1] - x[0]) / dt[0] - x1_i) / dt[0];
-  for (i = 1; i <= n - 2; i++)
+  x2.row(0) = 3.0 * (s.row(0) - x1.row(0)) / dt[0];
+  for (Eigen::Index i = 1; i <= n - 2; i++)
   {
     const double dt2 = dt[i - 1] + dt[i];
     const double a = dt[i - 1] / dt2;
     const double denom = 2.0 - a * c[i - 1];
     c[i] = (1.0 - a) / denom;
-    d[i] = 6.0 * ((x[i + 1] - x[i]) / dt[i] - (x[i] - x[i - 1]) / dt[i - 1]) / dt2;
-    d[i] = (d[i] - a * d[i - 1]) / denom;
+    x2.row(i) = 6.0 * (s.row(i) - s.row(i - 1)) / dt2;
+    x2.row(i) = (x2.row(i) - a * x2.row(i - 1)) / denom;
   }
   const double denom = dt[n - 2] * (2.0 - c[n - 2]);
-  d[n - 1] = 6.0 * (x1_f - (x[n - 1] - x[n - 2]) / dt[n - 2]);
-  d[n - 1] = (d[n - 1] - dt[n - 2] * d[n - 2]) / denom;
+  x2.row(n - 1) = 6.0 * (x1.row(n - 1) - s.row(n - 2));
+  x2.row(n - 1) = (x2.row(n - 1) - dt[n - 2] * x2.row(n - 2)) / denom;
 
   // Tridiagonal alg - backsubstitution sweep
   // 2nd derivative
-  x2[n - 1] = d[n - 1];
-  for (i = n - 2; i >= 0; i--)
-    x2[i] = d[i] - c[i] * x2[i + 1];
-
-  // 1st derivative
-  x1[0] = x1_i;
-  for (i = 1; i < n - 1; i++)
-    x1[i] = (x[i + 1] - x[i]) / dt[i] - (2 * x2[i] + x2[i + 1]) * dt[i] / 6.0;
-  x1[n - 1] = x1_f;
+  for (Eigen::Index i = n - 2; i >= 0; i--)
+    x2.row(i) -= c[i] * x2.row(i + 1);
+
+  if (!fit_velocities)
+    return;
+
+  // 1st derivative, x1[0] and x1[n-1] are left unchanged
+  for (Eigen::Index i = 1; i < n - 1; i++)
+    x1.row(i) = s.row(i) - (2.0 * x2.row(i) + x2.row(i + 1)) * dt[i] / 6.0;
 }
 
 /*
@@ -576,56 +525,75 @@ static void fit_cubic_spline(const long n, const double dt[], const double x[],
   x2_i and x2_f are the (initial and final) 2nd derivative at 0 and N-1
 */
 
-static void adjust_two_positions(const long n,
-                                 const double dt[],  // NOLINT
-                                 double x[],         // NOLINT
-                                 double x1[],        // NOLINT
-                                 double x2[],        // NOLINT
-                                 const double x2_i,
-                                 const double x2_f)
+static void adjust_two_positions(SplineWorkspace& t2)
 {
-  x[1] = x[0];
-  x[n - 2] = x[n - 3];
-  fit_cubic_spline(n, dt, x, x1, x2);
-  double a0 = x2[0];
-  double b0 = x2[n - 1];
-
-  x[1] = x[2];
-  x[n - 2] = x[n - 1];
-  fit_cubic_spline(n, dt, x, x1, x2);
-  double a2 = x2[0];
-  double b2 = x2[n - 1];
-
-  // we can solve this with linear equation (use two-point form)
-  // if (a2 != a0)
-  if (!tesseract_common::almostEqualRelativeAndAbs(a2, a0, 1e-5))
-    x[1] = x[0] + ((x[2] - x[0]) / (a2 - a0)) * (x2_i - a0);
-
-  // if (b2 != b0)
-  if (!tesseract_common::almostEqualRelativeAndAbs(b2, b0, 1e-5))
-    x[n - 2] = x[n - 3] + ((x[n - 1] - x[n - 3]) / (b2 - b0)) * (x2_f - b0);
+  const Eigen::Index n = t2.positions.rows();
+  JointArrayMap& x = t2.positions;
+  const JointArrayMap& x2 = t2.accelerations;
+  const ArrayMap& x2_i = t2.initial_acceleration;
+  const ArrayMap& x2_f = t2.final_acceleration;
+
+  x.row(1) = x.row(0);
+  x.row(n - 2) = x.row(n - 3);
+  fit_end_slopes(t2);
+  fit_cubic_spline(t2, false);
+  t2.x2_start = x2.row(0).transpose();
+  t2.x2_end = x2.row(n - 1).transpose();
+
+  x.row(1) = x.row(2);
+  x.row(n - 2) = x.row(n - 1);
+  fit_end_slopes(t2);
+  fit_cubic_spline(t2, false);
+
+  for (Eigen::Index j = 0; j < x.cols(); j++)
+  {
+    const double a0 = t2.x2_start[j];
+    const double b0 = t2.x2_end[j];
+    const double a2 = x2(0, j);
+    const double b2 = x2(n - 1, j);
+
+    // we can solve this with linear equation (use two-point form)
+    // if (a2 != a0)
+    if (!tesseract_common::almostEqualRelativeAndAbs(a2, a0, 1e-5))
+      x(1, j) = x(0, j) + ((x(2, j) - x(0, j)) / (a2 - a0)) * (x2_i[j] - a0);
+
+    // if (b2 != b0)
+    if (!tesseract_common::almostEqualRelativeAndAbs(b2, b0, 1e-5))
+      x(n - 2, j) = x(n - 3, j) + ((x(n - 1, j) - x(n - 3, j)) / (b2 - b0)) * (x2_f[j] - b0);
+  }
+  fit_end_slopes(t2);
+}
+
+// Compute the slope (x[i+1]-x[i])/dt[i] of every segment
+static void fit_slopes(SplineWorkspace& t2)
+{
+  const Eigen::Index n = t2.positions.rows();
+  t2.slopes = (t2.positions.bottomRows(n - 1) - t2.positions.topRows(n - 1)).colwise() / t2.time_diff;
+}
+
+// Only x[1] and x[N-2] are moved by adjust_two_positions, so only the slopes of the first
+// and last two segments need to be updated
+static void fit_end_slopes(SplineWorkspace& t2)
+{
+  const Eigen::Index n = t2.positions.rows();
+  for (Eigen::Index i : { Eigen::Index(0), Eigen::Index(1), n - 3, n - 2 })
+    t2.slopes.row(i) = (t2.positions.row(i + 1) - t2.positions.row(i)) / t2.time_diff[i];
 }
 
 /*
   Find time required to go max velocity on each segment.
   Increase a segment's time interval if the current time isn't long enough.
 */
-// NOLINTNEXTLINE
-static void init_times(long n, double dt[], const double x[], const double max_velocity[], double min_velocity[])
+static void init_times(SplineWorkspace& t2)
 {
-  for (long i = 0; i < n - 1; i++)
-  {
-    double time{ NAN };
-    double dx = x[i + 1] - x[i];
-    if (dx >= 0.0)
-      time = (dx / max_velocity[i]);
-    else
-      time = (dx / min_velocity[i]);
-    time += std::numeric_limits<double>::epsilon();  // prevent divide-by-zero
-
-    if (dt[i] < time)
-      dt[i] = time;
-  }
+  const Eigen::Index n = t2.positions.rows();
+
+  // |dx| / max_velocity is the same as dx / min_velocity when moving in the negative direction
+  auto time = t2.joint_factors.topRows(n - 1);
+  time = (t2.positions.bottomRows(n - 1) - t2.positions.topRows(n - 1)).abs() / t2.max_velocity.topRows(n - 1);
+  time += std::numeric_limits<double>::epsilon();  // prevent divide-by-zero
+
+  t2.time_diff = t2.time_diff.max(time.rowwise().maxCoeff());
 }
 
 /*
@@ -696,77 +664,28 @@ static void init_times(long n, double dt[], const double x[], const double max_v
 // to force within bounds.
 // Assumes that the spline is already fit
 // (fit_cubic_spline must have been called before this).
-static double global_adjustment_factor(long n,
-                                       double /*dt*/[],                  // NOLINT
-                                       const double /*x*/[],             // NOLINT
-                                       double x1[],                      // NOLINT
-                                       double x2[],                      // NOLINT
-                                       const double max_velocity[],      // NOLINT
-                                       const double min_velocity[],      // NOLINT
-                                       const double max_acceleration[],  // NOLINT
-                                       const double min_acceleration[])  // NOLINT
+static double global_adjustment_factor(const SplineWorkspace& t2)
 {
   double tfactor2 = 1.00;
 
-  // fit_cubic_spline(n, dt, x, x1, x2);
+  // fit_cubic_spline(t2);
 
-  for (long i = 0; i < n; i++)
-  {
-    double tfactor{ NAN };
-    tfactor = x1[i] / max_velocity[i];
-    if (tfactor2 < tfactor)
-      tfactor2 = tfactor;
-    tfactor = x1[i] / min_velocity[i];
-    if (tfactor2 < tfactor)
-      tfactor2 = tfactor;
-
-    if (x2[i] >= 0)
-    {
-      tfactor = sqrt(fabs(x2[i] / max_acceleration[i]));
-      if (tfactor2 < tfactor)
-        tfactor2 = tfactor;
-    }
-    else
-    {
-      tfactor = sqrt(fabs(x2[i] / min_acceleration[i]));
-      if (tfactor2 < tfactor)
-        tfactor2 = tfactor;
-    }
-  }
+  // |x1| / max_velocity and |x2| / max_acceleration cover both the max and min bounds
+  tfactor2 = std::max(tfactor2, (t2.velocities.abs() / t2.max_velocity).maxCoeff());
+  tfactor2 = std::max(tfactor2, (t2.accelerations.abs() / t2.max_acceleration).sqrt().maxCoeff());
 
   return tfactor2;
 }
 
 // Expands the entire trajectory to fit exactly within bounds
-void globalAdjustment(std::vector<SingleJointTrajectory>& t2,
-                      long num_joints,
-                      long num_points,
-                      std::vector<double>& time_diff)
+static void globalAdjustment(SplineWorkspace& t2)
 {
-  double gtfactor = 1.0;
-  for (std::size_t j = 0; j < static_cast<std::size_t>(num_joints); j++)
-  {
-    double tfactor = global_adjustment_factor(num_points,
-                                              time_diff.data(),
-                                              t2[j].positions_.data(),
-                                              t2[j].velocities_.data(),
-                                              t2[j].accelerations_.data(),
-                                              t2[j].max_velocity_.data(),
-                                              t2[j].min_velocity_.data(),
-                                              t2[j].max_acceleration_.data(),
-                                              t2[j].min_acceleration_.data());
-    if (tfactor > gtfactor)
-      gtfactor = tfactor;
-  }
+  const double gtfactor = global_adjustment_factor(t2);
 
   // printf("# Global adjustment: %0.4f%%\n", 100.0 * (gtfactor - 1.0));
-  for (std::size_t i = 0; i < static_cast<std::size_t>(num_points - 1); i++)
-    time_diff[i] *= gtfactor;
+  t2.time_diff *= gtfactor;
 
-  for (std::size_t j = 0; j < static_cast<std::size_t>(num_joints); j++)
-  {
-    fit_cubic_spline(
-        num_points, time_diff.data(), t2[j].positions_.data(), t2[j].velocities_.data(), t2[j].accelerations_.data());
-  }
+  fit_slopes(t2);
+  fit_cubic_spline(t2);
 }
 }  // namespace tesseract_planning
@@ -0,0 +1,107 @@
+/**
+ * @file iterative_spline_benchmark.cpp
+ * @brief Benchmark iterative spline parameterization on long trajectories
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
+#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+
+using namespace tesseract_planning;
+
+/** @brief Create a seven joint program which moves along joint 1 while the remaining joints oscillate */
+static CompositeInstruction createProgram(long num_points)
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4",
+                                           "joint_5", "joint_6", "joint_7" };
+
+  CompositeInstruction program;
+  for (long i = 0; i < num_points; ++i)
+  {
+    Eigen::VectorXd point(7);
+    point(0) = 0.005 * static_cast<double>(i);
+    for (Eigen::Index j = 1; j < 7; ++j)
+      point(j) = 0.2 * std::sin((0.01 * static_cast<double>(i)) + static_cast<double>(j));
+
+    StateWaypointPoly swp{ StateWaypoint(joint_names, point) };
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+  return program;
+}
+
+/** @brief Time parameterize the full program, the workspace of the thread is reused between iterations */
+static void BM_ISPCompute(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(state.range(0));
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(7, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(7, 1.0);
+  IterativeSplineParameterization solver(true);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction copy = program;
+    InstructionsTrajectory trajectory(copy);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(solver.compute(trajectory, max_velocity, max_acceleration));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief Time parameterize the full program on a dense copy, including gathering and assigning the results */
+static void BM_ISPComputeDense(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(state.range(0));
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(7, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(7, 1.0);
+  IterativeSplineParameterization solver(true);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction copy = program;
+    state.ResumeTiming();
+
+    DenseTrajectory trajectory(copy);
+    benchmark::DoNotOptimize(solver.compute(trajectory, max_velocity, max_acceleration));
+    trajectory.assign(copy);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_ISPCompute)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ISPCompute)->Arg(5000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ISPComputeDense)->RangeMultiplier(10)->Range(100, 10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ISPComputeDense)->Arg(5000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
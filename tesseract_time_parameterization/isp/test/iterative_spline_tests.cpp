@@ -44,6 +44,8 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_command_language/state_waypoint.h>
 #include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
 #include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_time_parameterization/core/trajectory_sampler.h>
 
 using namespace tesseract_planning;
 
@@ -88,6 +90,56 @@ CompositeInstruction createStraightTrajectory()
   return program;
 }
 
+// Initialize three joints moving in different directions with a velocity and acceleration limit each
+CompositeInstruction createMultiJointTrajectory()
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3" };
+  Eigen::MatrixXd positions(6, 3);
+  positions << 0.0, 0.0, 0.0,  //
+      0.2, -0.1, 0.3,          //
+      0.5, -0.4, 0.4,          //
+      0.6, -0.2, 0.1,          //
+      0.9, 0.1, -0.2,          //
+      1.0, 0.3, -0.3;
+
+  CompositeInstruction program;
+  for (Eigen::Index i = 0; i < positions.rows(); i++)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, positions.row(i).transpose()) };
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  return program;
+}
+
+/** @brief Check the solution of the multi joint trajectory against the expected [point][joint] values */
+void checkMultiJointTrajectory(bool add_points,
+                               const std::vector<double>& times,
+                               const std::vector<double>& velocities,
+                               const std::vector<double>& accelerations)
+{
+  IterativeSplineParameterization time_parameterization(add_points);
+  std::vector<double> max_velocity = { 1.0, 0.8, 1.2 };
+  std::vector<double> max_acceleration = { 2.0, 1.5, 1.0 };
+
+  CompositeInstruction program = createMultiJointTrajectory();
+  InstructionsTrajectory trajectory(program);
+  EXPECT_TRUE(time_parameterization.compute(trajectory, max_velocity, max_acceleration));
+  ASSERT_EQ(static_cast<std::size_t>(trajectory.size()), times.size());
+
+  for (Eigen::Index i = 0; i < trajectory.size(); i++)
+  {
+    const auto idx = static_cast<std::size_t>(i);
+    EXPECT_NEAR(trajectory.getTimeFromStart(i), times[idx], 1e-9);
+    for (Eigen::Index j = 0; j < trajectory.dof(); j++)
+    {
+      const auto pidx = (idx * 3) + static_cast<std::size_t>(j);
+      EXPECT_NEAR(trajectory.getVelocity(i)(j), velocities[pidx], 1e-9);
+      EXPECT_NEAR(trajectory.getAcceleration(i)(j), accelerations[pidx], 1e-9);
+    }
+  }
+}
+
 TEST(IterativeSplineParameterizationUnit, Solve)  // NOLINT
 {
   EXPECT_TRUE(true);
@@ -115,6 +167,187 @@ TEST(TestTimeParameterization, TestIterativeSplineAddPoints)  // NOLINT
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 5.0);
 }
 
+TEST(TestTimeParameterization, TestIterativeSplineDenseTrajectory)  // NOLINT
+{
+  IterativeSplineParameterization time_parameterization(true);
+  std::vector<double> max_velocity = { 2.088, 2.082, 3.27, 3.6, 3.3, 3.078 };
+  std::vector<double> max_acceleration = { 1, 1, 1, 1, 1, 1 };
+
+  CompositeInstruction expected_program = createStraightTrajectory();
+  InstructionsTrajectory expected_trajectory(expected_program);
+  EXPECT_TRUE(time_parameterization.compute(expected_trajectory, max_velocity, max_acceleration));
+
+  CompositeInstruction program = createStraightTrajectory();
+  DenseTrajectory trajectory(program);
+  EXPECT_EQ(trajectory.size(), expected_trajectory.size());
+  EXPECT_EQ(trajectory.dof(), 6);
+  EXPECT_TRUE(time_parameterization.compute(trajectory, max_velocity, max_acceleration));
+
+  // The program is not modified until the results are assigned
+  EXPECT_NEAR(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 0, 1e-12);
+  trajectory.assign(program);
+
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    EXPECT_TRUE(trajectory.getPosition(i).isApprox(expected_trajectory.getPosition(i), 1e-12));
+    EXPECT_TRUE(trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_TRUE(trajectory.getAcceleration(i).isApprox(expected_trajectory.getAcceleration(i), 1e-12));
+    EXPECT_NEAR(trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+  }
+
+  InstructionsTrajectory assigned_trajectory(program);
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    EXPECT_TRUE(assigned_trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_NEAR(assigned_trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+  }
+
+  // The program must have the same number of move instructions
+  CompositeInstruction short_program = createRepeatedPointTrajectory();
+  EXPECT_ANY_THROW(trajectory.assign(short_program));  // NOLINT
+  EXPECT_ANY_THROW(DenseTrajectory{ CompositeInstruction() });  // NOLINT
+}
+
+TEST(TestTimeParameterization, TestIterativeSplineMultiJoint)  // NOLINT
+{
+  // Expected values are the results of the implementation which solved one joint at a time
+  std::vector<double> times = { 0,
+                                1.03058163925743,
+                                1.97004746775665,
+                                2.59635802008946,
+                                3.13195815200633,
+                                3.73871211213071 };
+  std::vector<double> velocities = { 0,
+                                     0,
+                                     0,
+                                     0.352140036743369,
+                                     -0.32033116531134,
+                                     0.358002440911505,
+                                     0.142420307754857,
+                                     0.00132999139829815,
+                                     -0.253292286069323,
+                                     0.408162020788511,
+                                     0.528451206822836,
+                                     -0.618460545268964,
+                                     0.453768711837043,
+                                     0.53773267911157,
+                                     -0.397919363799596,
+                                     0,
+                                     0,
+                                     0 };
+  std::vector<double> accelerations = { 0.446457537219869,
+                                        0.05673187001274,
+                                        1,
+                                        0.236923620234284,
+                                        -0.678383087362491,
+                                        -0.305241957988968,
+                                        -0.683389521657299,
+                                        1.36315766234301,
+                                        -0.996124645110073,
+                                        1.5319836002461,
+                                        0.320100630084519,
+                                        -0.169968622325712,
+                                        -1.36168233133002,
+                                        -0.285442414988434,
+                                        0.993497849923428,
+                                        -0.134043256498123,
+                                        -1.48704763683205,
+                                        0.318135497201419 };
+  checkMultiJointTrajectory(false, times, velocities, accelerations);
+}
+
+TEST(TestTimeParameterization, TestIterativeSplineMultiJointAddPoints)  // NOLINT
+{
+  // Expected values are the results of the implementation which solved one joint at a time
+  std::vector<double> times = { 0,
+                                1.15486366540786,
+                                2.09461945173332,
+                                2.71699167307408,
+                                3.2517375574381,
+                                4.44458503052089 };
+  std::vector<double> velocities = { 0,
+                                     0,
+                                     0,
+                                     0.356091655249947,
+                                     -0.319856643676252,
+                                     0.367412963627115,
+                                     0.141820820604627,
+                                     0.00387903171037629,
+                                     -0.258111934547231,
+                                     0.408961974497226,
+                                     0.528735587644307,
+                                     -0.619885326745785,
+                                     0.45466023487947,
+                                     0.541973163080727,
+                                     -0.398762633440791,
+                                     0,
+                                     0,
+                                     0 };
+  std::vector<double> accelerations = { -0.015626499419169,
+                                        -0.0312354425423266,
+                                        0.0155670569549458,
+                                        0.220677520570704,
+                                        -0.684989374005435,
+                                        -0.335155413393552,
+                                        -0.676691386647849,
+                                        1.37396768113024,
+                                        -0.99609448637075,
+                                        1.53515243208816,
+                                        0.312664652180671,
+                                        -0.166468300956728,
+                                        -1.36423663182317,
+                                        -0.263154872588206,
+                                        0.993488011703934,
+                                        0.0186857071896719,
+                                        -0.00933760526959043,
+                                        0.0279219414657992 };
+  checkMultiJointTrajectory(true, times, velocities, accelerations);
+}
+
+TEST(TestTimeParameterization, TestIterativeSplineTrajectorySampler)  // NOLINT
+{
+  IterativeSplineParameterization time_parameterization(false);
+  Eigen::VectorXd max_velocity(3);
+  max_velocity << 1.0, 0.8, 1.2;
+  Eigen::VectorXd max_acceleration(3);
+  max_acceleration << 2.0, 1.5, 1.0;
+
+  CompositeInstruction program = createMultiJointTrajectory();
+  DenseTrajectory trajectory(program);
+  ASSERT_TRUE(time_parameterization.compute(trajectory, max_velocity, max_acceleration));
+
+  // Without added points every spline knot is a waypoint, so the samples between waypoints are on the cubic spline
+  TrajectorySampler sampler(trajectory);
+  Eigen::VectorXd position(3);
+  Eigen::VectorXd velocity(3);
+  Eigen::VectorXd acceleration(3);
+  for (Eigen::Index i = 1; i < trajectory.size(); ++i)
+  {
+    const double t0 = trajectory.getTimeFromStart(i - 1);
+    const double t1 = trajectory.getTimeFromStart(i);
+    sampler.sample(0.5 * (t0 + t1), position, velocity, acceleration);
+    const Eigen::VectorXd expected_acceleration =
+        0.5 * (trajectory.getAcceleration(i - 1) + trajectory.getAcceleration(i));
+    EXPECT_TRUE(acceleration.isApprox(expected_acceleration, 1e-8));
+  }
+
+  // The velocity and acceleration limits hold between the waypoints
+  const double dt = 0.001;
+  const Eigen::Index num_samples = sampler.getNumSamples(dt);
+  Eigen::MatrixXd positions(3, num_samples);
+  Eigen::MatrixXd velocities(3, num_samples);
+  Eigen::MatrixXd accelerations(3, num_samples);
+  sampler.sampleUniform(0, dt, positions, velocities, accelerations);
+  for (Eigen::Index i = 0; i < num_samples; ++i)
+  {
+    for (Eigen::Index j = 0; j < 3; ++j)
+    {
+      EXPECT_LE(std::abs(velocities(j, i)), max_velocity(j) + 1e-6);
+      EXPECT_LE(std::abs(accelerations(j, i)), max_acceleration(j) + 1e-6);
+    }
+  }
+}
+
 TEST(TestTimeParameterization, TestIterativeSplineDynamicParams)  // NOLINT
 {
   IterativeSplineParameterization time_parameterization(false);
@@ -152,6 +385,54 @@ TEST(TestTimeParameterization, TestRepeatedPoint)  // NOLINT
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 0.001);
 }
 
+TEST(TestTimeParameterization, TestIterativeSplineRepeatedCompute)  // NOLINT
+{
+  // The solver reuses the storage of the thread, so results must not depend on the previous call
+  auto createOscillatingTrajectory = [](int num) {
+    std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+    CompositeInstruction program;
+    for (int i = 0; i < num; i++)
+    {
+      StateWaypointPoly swp{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+      for (Eigen::Index j = 0; j < 6; j++)
+        swp.getPosition()[j] = 0.5 * std::sin((0.05 * i) + static_cast<double>(j));
+      program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+    }
+    return program;
+  };
+
+  IterativeSplineParameterization time_parameterization(true);
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Ones(6);
+
+  CompositeInstruction long_program = createOscillatingTrajectory(200);
+  InstructionsTrajectory long_trajectory(long_program);
+  EXPECT_TRUE(time_parameterization.compute(long_trajectory, max_velocity, max_acceleration));
+
+  for (Eigen::Index i = 0; i < long_trajectory.size(); i++)
+  {
+    EXPECT_TRUE((long_trajectory.getVelocity(i).array().abs() <= max_velocity.array() + 1e-6).all());
+    EXPECT_TRUE((long_trajectory.getAcceleration(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+  }
+
+  CompositeInstruction short_program = createOscillatingTrajectory(10);
+  InstructionsTrajectory short_trajectory(short_program);
+  EXPECT_TRUE(time_parameterization.compute(short_trajectory, max_velocity, max_acceleration));
+
+  CompositeInstruction repeated_program = createOscillatingTrajectory(200);
+  InstructionsTrajectory repeated_trajectory(repeated_program);
+  EXPECT_TRUE(time_parameterization.compute(repeated_trajectory, max_velocity, max_acceleration));
+
+  for (Eigen::Index i = 0; i < long_trajectory.size(); i++)
+  {
+    EXPECT_DOUBLE_EQ(long_trajectory.getTimeFromStart(i), repeated_trajectory.getTimeFromStart(i));
+    EXPECT_TRUE(long_trajectory.getVelocity(i).isApprox(repeated_trajectory.getVelocity(i)));
+    EXPECT_TRUE(long_trajectory.getAcceleration(i).isApprox(repeated_trajectory.getAcceleration(i)));
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
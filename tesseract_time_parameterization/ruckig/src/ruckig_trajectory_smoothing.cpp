@@ -41,7 +41,9 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
 #include <tesseract_common/kinematic_limits.h>
 
+#include <algorithm>
 #include <memory>
+#include <optional>
 
 #include <ruckig/input_parameter.hpp>
 #include <ruckig/ruckig.hpp>
@@ -151,9 +153,9 @@ bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
   //  input.max_jerk = {4.0, 3.0, 2.0};
 
   {  // Set start position
-    const Eigen::VectorXd& position = trajectory.getPosition(static_cast<Eigen::Index>(0));
-    const Eigen::VectorXd& velocity = trajectory.getVelocity(static_cast<Eigen::Index>(0));
-    const Eigen::VectorXd& accleration = trajectory.getAcceleration(static_cast<Eigen::Index>(0));
+    const Eigen::Ref<const Eigen::VectorXd> position = trajectory.getPosition(static_cast<Eigen::Index>(0));
+    const Eigen::Ref<const Eigen::VectorXd> velocity = trajectory.getVelocity(static_cast<Eigen::Index>(0));
+    const Eigen::Ref<const Eigen::VectorXd> accleration = trajectory.getAcceleration(static_cast<Eigen::Index>(0));
 
     input.current_position = std::vector<double>(position.data(), position.data() + position.rows());
 
@@ -165,9 +167,10 @@ bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
   }
 
   {  // Set end position
-    const Eigen::VectorXd& position = trajectory.getPosition(static_cast<Eigen::Index>(end_index));
-    const Eigen::VectorXd& velocity = trajectory.getVelocity(static_cast<Eigen::Index>(end_index));
-    const Eigen::VectorXd& accleration = trajectory.getAcceleration(static_cast<Eigen::Index>(end_index));
+    const Eigen::Ref<const Eigen::VectorXd> position = trajectory.getPosition(static_cast<Eigen::Index>(end_index));
+    const Eigen::Ref<const Eigen::VectorXd> velocity = trajectory.getVelocity(static_cast<Eigen::Index>(end_index));
+    const Eigen::Ref<const Eigen::VectorXd> accleration =
+        trajectory.getAcceleration(static_cast<Eigen::Index>(end_index));
 
     input.target_position = std::vector<double>(position.data(), position.data() + position.rows());
 
@@ -193,7 +196,15 @@ bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
 }
 #else
 
-void getNextRuckigInput(ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_input,
+template <class Values>
+void setRuckigValues(Values& values, const Eigen::Ref<const Eigen::VectorXd>& source)
+{
+  // Works for both the std::array of static DOFs and the std::vector (sized at construction) of dynamic DOFs
+  std::copy(source.data(), source.data() + source.rows(), values.begin());
+}
+
+template <std::size_t DOFs>
+void getNextRuckigInput(ruckig::InputParameter<DOFs>& ruckig_input,
                         TrajectoryContainer& trajectory,
                         Eigen::Index current_index,
                         Eigen::Index next_index,
@@ -201,47 +212,44 @@ void getNextRuckigInput(ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_inpu
                         const Eigen::Ref<const Eigen::VectorXd>& max_acceleration)
 {
   // Set current state
-  const auto& current_position = trajectory.getPosition(current_index);
-  Eigen::VectorXd& current_velocity = trajectory.getVelocity(current_index);
-  Eigen::VectorXd& current_accleration = trajectory.getAcceleration(current_index);
+  const Eigen::Ref<const Eigen::VectorXd> current_position = trajectory.getPosition(current_index);
+  Eigen::Ref<Eigen::VectorXd> current_velocity = trajectory.getVelocity(current_index);
+  Eigen::Ref<Eigen::VectorXd> current_accleration = trajectory.getAcceleration(current_index);
 
   // clamp due to small numerical errors
   current_velocity = current_velocity.array().min(max_velocity.array()).max((-1.0 * max_velocity).array());
   current_accleration =
       current_accleration.array().min(max_acceleration.array()).max((-1.0 * max_acceleration).array());
 
-  const Eigen::VectorXd& next_position = trajectory.getPosition(next_index);
-  Eigen::VectorXd& next_velocity = trajectory.getVelocity(next_index);
-  Eigen::VectorXd& next_accleration = trajectory.getAcceleration(next_index);
+  const Eigen::Ref<const Eigen::VectorXd> next_position = trajectory.getPosition(next_index);
+  Eigen::Ref<Eigen::VectorXd> next_velocity = trajectory.getVelocity(next_index);
+  Eigen::Ref<Eigen::VectorXd> next_accleration = trajectory.getAcceleration(next_index);
 
   // clamp due to small numerical errors
   next_velocity = next_velocity.array().min(max_velocity.array()).max((-1.0 * max_velocity).array());
   next_accleration = next_accleration.array().min(max_acceleration.array()).max((-1.0 * max_acceleration).array());
 
   // Update input
-  ruckig_input.current_position =
-      std::vector<double>(current_position.data(), current_position.data() + current_position.rows());
-  ruckig_input.current_velocity =
-      std::vector<double>(current_velocity.data(), current_velocity.data() + current_velocity.rows());
-  ruckig_input.current_acceleration =
-      std::vector<double>(current_accleration.data(), current_accleration.data() + current_accleration.rows());
-
-  ruckig_input.target_position = std::vector<double>(next_position.data(), next_position.data() + next_position.rows());
-  ruckig_input.target_velocity = std::vector<double>(next_velocity.data(), next_velocity.data() + next_velocity.rows());
-  ruckig_input.target_acceleration =
-      std::vector<double>(next_accleration.data(), next_accleration.data() + next_accleration.rows());
+  setRuckigValues(ruckig_input.current_position, current_position);
+  setRuckigValues(ruckig_input.current_velocity, current_velocity);
+  setRuckigValues(ruckig_input.current_acceleration, current_accleration);
+
+  setRuckigValues(ruckig_input.target_position, next_position);
+  setRuckigValues(ruckig_input.target_velocity, next_velocity);
+  setRuckigValues(ruckig_input.target_acceleration, next_accleration);
 }
 
-void initializeRuckigState(ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_input,
-                           ruckig::OutputParameter<ruckig::DynamicDOFs>& ruckig_output,
+template <std::size_t DOFs>
+void initializeRuckigState(ruckig::InputParameter<DOFs>& ruckig_input,
+                           ruckig::OutputParameter<DOFs>& ruckig_output,
                            TrajectoryContainer& trajectory,
                            const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
                            const Eigen::Ref<const Eigen::VectorXd>& max_acceleration)
 {
   // Set current state
-  const Eigen::VectorXd& current_position = trajectory.getPosition(0);
-  Eigen::VectorXd& current_velocity = trajectory.getVelocity(0);
-  Eigen::VectorXd& current_accleration = trajectory.getAcceleration(0);
+  const Eigen::Ref<const Eigen::VectorXd> current_position = trajectory.getPosition(0);
+  Eigen::Ref<Eigen::VectorXd> current_velocity = trajectory.getVelocity(0);
+  Eigen::Ref<Eigen::VectorXd> current_accleration = trajectory.getAcceleration(0);
 
   // clamp due to small numerical errors
   current_velocity = current_velocity.array().min(max_velocity.array()).max((-1.0 * max_velocity).array());
@@ -249,53 +257,55 @@ void initializeRuckigState(ruckig::InputParameter<ruckig::DynamicDOFs>& ruckig_i
       current_accleration.array().min(max_acceleration.array()).max((-1.0 * max_acceleration).array());
 
   // Intialize Ruckig state
-  ruckig_input.current_position =
-      std::vector<double>(current_position.data(), current_position.data() + current_position.rows());
-  ruckig_input.current_velocity =
-      std::vector<double>(current_velocity.data(), current_velocity.data() + current_velocity.rows());
-  ruckig_input.current_acceleration =
-      std::vector<double>(current_accleration.data(), current_accleration.data() + current_accleration.rows());
+  setRuckigValues(ruckig_input.current_position, current_position);
+  setRuckigValues(ruckig_input.current_velocity, current_velocity);
+  setRuckigValues(ruckig_input.current_acceleration, current_accleration);
 
   ruckig_output.new_position = ruckig_input.current_position;
   ruckig_output.new_velocity = ruckig_input.current_velocity;
   ruckig_output.new_acceleration = ruckig_input.current_acceleration;
 }
 
-bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
-                                        const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
-                                        const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
-                                        const Eigen::Ref<const Eigen::VectorXd>& max_jerk,
-                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_velocity_scaling_factors*/,
-                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_acceleration_scaling_factors*/,
-                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_jerk_scaling_factors*/) const
+/**
+ * @brief Smooth the trajectory using Ruckig with DOFs degrees of freedom
+ * @details Statically sized DOFs keep the Ruckig state on the stack, ruckig::DynamicDOFs is used for any other size.
+ */
+template <std::size_t DOFs>
+ruckig::Result smoothTrajectory(TrajectoryContainer& trajectory,
+                                const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
+                                const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
+                                const Eigen::Ref<const Eigen::VectorXd>& max_jerk,
+                                double duration_extension_fraction,
+                                double max_duration_extension_factor)
 {
-  if (trajectory.size() < 2)
-    return true;
-
-  if (max_velocity.size() != trajectory.dof() || max_acceleration.size() != trajectory.dof())
-    return false;
-
   // Create input parameters
   const auto dof = static_cast<std::size_t>(trajectory.dof());
   const auto num_waypoints = static_cast<std::size_t>(trajectory.size());
-  ruckig::InputParameter<ruckig::DynamicDOFs> ruckig_input{ dof };
-  ruckig::OutputParameter<ruckig::DynamicDOFs> ruckig_output{ dof };
+  auto ruckig_input = [dof]() {
+    if constexpr (DOFs == ruckig::DynamicDOFs)
+      return ruckig::InputParameter<DOFs>{ dof };
+    else
+      return ruckig::InputParameter<DOFs>{};
+  }();
+  auto ruckig_output = [dof]() {
+    if constexpr (DOFs == ruckig::DynamicDOFs)
+      return ruckig::OutputParameter<DOFs>{ dof };
+    else
+      return ruckig::OutputParameter<DOFs>{};
+  }();
 
   const Eigen::VectorXd max_scaled_velocity =
       max_velocity;  // (max_velocity.array() * max_velocity_scaling_factors.array()).transpose();
-  ruckig_input.max_velocity =
-      std::vector<double>(max_scaled_velocity.data(), max_scaled_velocity.data() + max_scaled_velocity.rows());
+  setRuckigValues(ruckig_input.max_velocity, max_scaled_velocity);
 
   const Eigen::VectorXd max_scaled_acceleration =
       max_acceleration;  // max_acceleration.array() * max_acceleration_scaling_factors.array();
-  ruckig_input.max_acceleration = std::vector<double>(max_scaled_acceleration.data(),
-                                                      max_scaled_acceleration.data() + max_scaled_acceleration.rows());
+  setRuckigValues(ruckig_input.max_acceleration, max_scaled_acceleration);
 
   if (!(max_jerk.array() < 0).all())
   {
     const Eigen::VectorXd max_scaled_jerk = max_jerk;  // max_jerk.array() * max_jerk_scaling_factors.array();
-    ruckig_input.max_jerk =
-        std::vector<double>(max_scaled_jerk.data(), max_scaled_jerk.data() + max_scaled_jerk.rows());
+    setRuckigValues(ruckig_input.max_jerk, max_scaled_jerk);
   }
 
   // Get origina data
@@ -322,64 +332,118 @@ bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
 
   // Initialize Ruckig
   double timestep = original_duration_from_previous.sum() / static_cast<double>(num_waypoints - 1);
-  auto ruckig_ptr = std::make_unique<ruckig::Ruckig<ruckig::DynamicDOFs> >(dof, timestep);
+  std::optional<ruckig::Ruckig<DOFs>> ruckig_solver;
+  auto resetRuckig = [&ruckig_solver, dof](double delta_time) {
+    if constexpr (DOFs == ruckig::DynamicDOFs)
+      ruckig_solver.emplace(dof, delta_time);
+    else
+      ruckig_solver.emplace(delta_time);
+  };
+  resetRuckig(timestep);
   initializeRuckigState(ruckig_input, ruckig_output, trajectory, max_scaled_velocity, max_scaled_acceleration);
 
   // Smooth trajectory
+  // Segments are smoothed in order starting at the segment which last failed, wrapping around to the first
+  // segment, until every segment reached its waypoint using the current duration extension factor.
+  const auto num_segments = static_cast<Eigen::Index>(num_waypoints - 1);
   ruckig::Result ruckig_result{};
   double duration_extension_factor{ 1 };
-  bool smoothing_complete{ false };
-  while ((duration_extension_factor < max_duration_extension_factor_) && !smoothing_complete)
+  Eigen::Index waypoint_idx{ 0 };
+  Eigen::Index num_finished{ 0 };
+  while ((duration_extension_factor < max_duration_extension_factor) && (num_finished < num_segments))
   {
-    for (Eigen::Index waypoint_idx = 0; waypoint_idx < num_waypoints - 1; ++waypoint_idx)
+    // Get Next Input
+    getNextRuckigInput(
+        ruckig_input, trajectory, waypoint_idx, waypoint_idx + 1, max_scaled_velocity, max_scaled_acceleration);
+
+    // Run Ruckig
+    ruckig_result = ruckig_solver->update(ruckig_input, ruckig_output);
+
+    if (ruckig_result == ruckig::Result::Finished)
+    {
+      ++num_finished;
+      waypoint_idx = (waypoint_idx + 1) % num_segments;
+      continue;
+    }
+
+    // Extend the trajectory duration if Ruckig could not reach the waypoint successfully
+    duration_extension_factor *= duration_extension_fraction;
+    Eigen::VectorXd new_duration_from_previous = original_duration_from_previous;
+
+    double time_from_start = original_duration_from_previous(0);
+    for (Eigen::Index time_stretch_idx = 1; time_stretch_idx < static_cast<Eigen::Index>(num_waypoints);
+         ++time_stretch_idx)
     {
-      // Get Next Input
-      getNextRuckigInput(
-          ruckig_input, trajectory, waypoint_idx, waypoint_idx + 1, max_scaled_velocity, max_scaled_acceleration);
-
-      // Run Ruckig
-      ruckig_result = ruckig_ptr->update(ruckig_input, ruckig_output);
-
-      if ((waypoint_idx == num_waypoints - 2) && ruckig_result == ruckig::Result::Finished)
-      {
-        smoothing_complete = true;
-        break;
-      }
-
-      // Extend the trajectory duration if Ruckig could not reach the waypoint successfully
-      if (ruckig_result != ruckig::Result::Finished)
-      {
-        duration_extension_factor *= duration_extension_fraction_;
-        Eigen::VectorXd new_duration_from_previous = original_duration_from_previous;
-
-        double time_from_start = original_duration_from_previous(0);
-        for (Eigen::Index time_stretch_idx = 1; time_stretch_idx < num_waypoints; ++time_stretch_idx)
-        {
-          assert(time_stretch_idx < original_duration_from_previous.rows());
-          const double duration_from_previous =
-              duration_extension_factor * original_duration_from_previous(time_stretch_idx);
-          new_duration_from_previous(time_stretch_idx) = duration_from_previous;
-          time_from_start += duration_from_previous;
-
-          // re-calculate waypoint velocity and acceleration
-          timestep = new_duration_from_previous.sum() / static_cast<double>(new_duration_from_previous.rows() - 1);
-          Eigen::VectorXd new_velocity =
-              (1 / duration_extension_factor) * original_velocities[static_cast<std::size_t>(time_stretch_idx)];
-          Eigen::VectorXd new_acceleration = (new_velocity - trajectory.getVelocity(time_stretch_idx - 1)) / timestep;
-          trajectory.setData(time_stretch_idx, new_velocity, new_acceleration, time_from_start);
-        }
-        ruckig_ptr = std::make_unique<ruckig::Ruckig<ruckig::DynamicDOFs> >(dof, timestep);
-        initializeRuckigState(ruckig_input, ruckig_output, trajectory, max_scaled_velocity, max_scaled_acceleration);
-
-        // Begin the while() loop again
-        break;
-      }
+      assert(time_stretch_idx < original_duration_from_previous.rows());
+      const double duration_from_previous =
+          duration_extension_factor * original_duration_from_previous(time_stretch_idx);
+      new_duration_from_previous(time_stretch_idx) = duration_from_previous;
+      time_from_start += duration_from_previous;
+
+      // re-calculate waypoint velocity and acceleration
+      timestep = new_duration_from_previous.sum() / static_cast<double>(new_duration_from_previous.rows() - 1);
+      Eigen::VectorXd new_velocity =
+          (1 / duration_extension_factor) * original_velocities[static_cast<std::size_t>(time_stretch_idx)];
+      Eigen::VectorXd new_acceleration = (new_velocity - trajectory.getVelocity(time_stretch_idx - 1)) / timestep;
+      trajectory.setData(time_stretch_idx, new_velocity, new_acceleration, time_from_start);
     }
+    resetRuckig(timestep);
+    initializeRuckigState(ruckig_input, ruckig_output, trajectory, max_scaled_velocity, max_scaled_acceleration);
+
+    // Continue from the failed segment, the segments before it are smoothed again after the last segment
+    num_finished = 0;
+  }
+
+  return ruckig_result;
+}
+
+bool RuckigTrajectorySmoothing::compute(TrajectoryContainer& trajectory,
+                                        const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
+                                        const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
+                                        const Eigen::Ref<const Eigen::VectorXd>& max_jerk,
+                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_velocity_scaling_factors*/,
+                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_acceleration_scaling_factors*/,
+                                        const Eigen::Ref<const Eigen::VectorXd>& /*max_jerk_scaling_factors*/) const
+{
+  if (trajectory.size() < 2)
+    return true;
+
+  if (max_velocity.size() != trajectory.dof() || max_acceleration.size() != trajectory.dof())
+    return false;
+
+  // Most robots are six or seven DOF, which use a statically sized Ruckig
+  ruckig::Result ruckig_result{};
+  switch (trajectory.dof())
+  {
+    case 6:
+      ruckig_result = smoothTrajectory<6>(trajectory,
+                                          max_velocity,
+                                          max_acceleration,
+                                          max_jerk,
+                                          duration_extension_fraction_,
+                                          max_duration_extension_factor_);
+      break;
+    case 7:
+      ruckig_result = smoothTrajectory<7>(trajectory,
+                                          max_velocity,
+                                          max_acceleration,
+                                          max_jerk,
+                                          duration_extension_fraction_,
+                                          max_duration_extension_factor_);
+      break;
+    default:
+      ruckig_result = smoothTrajectory<ruckig::DynamicDOFs>(trajectory,
+                                                            max_velocity,
+                                                            max_acceleration,
+                                                            max_jerk,
+                                                            duration_extension_fraction_,
+                                                            max_duration_extension_factor_);
+      break;
   }
 
   if (ruckig_result != ruckig::Result::Finished)
   {
-    CONSOLE_BRIDGE_logError("Ruckig trajectory smoothing failed. Ruckig error: %s", ruckig_result);
+    CONSOLE_BRIDGE_logError("Ruckig trajectory smoothing failed. Ruckig error: %d", static_cast<int>(ruckig_result));
     return false;
   }
 
@@ -0,0 +1,140 @@
+/**
+ * @file ruckig_trajectory_smoothing_benchmark.cpp
+ * @brief Benchmark ruckig trajectory smoothing on long trajectories
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <cmath>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
+#include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
+#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+
+using namespace tesseract_planning;
+
+/** @brief Create a program which moves along joint 1 while the remaining joints oscillate */
+static CompositeInstruction createProgram(long num_points, Eigen::Index num_joints)
+{
+  std::vector<std::string> joint_names;
+  for (Eigen::Index j = 0; j < num_joints; ++j)
+    joint_names.push_back("joint_" + std::to_string(j + 1));
+
+  CompositeInstruction program;
+  for (long i = 0; i < num_points; ++i)
+  {
+    Eigen::VectorXd point(num_joints);
+    point(0) = 0.005 * static_cast<double>(i);
+    for (Eigen::Index j = 1; j < num_joints; ++j)
+      point(j) = 0.2 * std::sin((0.01 * static_cast<double>(i)) + static_cast<double>(j));
+
+    StateWaypointPoly swp{ StateWaypoint(joint_names, point) };
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+  return program;
+}
+
+/**
+ * @brief Smooth a time parameterized program
+ * @details The first argument is the number of points and the second the number of joints. Six and seven joints use
+ * a statically sized Ruckig, any other number of joints uses the dynamic fallback.
+ */
+static void BM_RuckigCompute(benchmark::State& state)
+{
+  const auto num_joints = static_cast<Eigen::Index>(state.range(1));
+  CompositeInstruction program = createProgram(state.range(0), num_joints);
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(num_joints, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(num_joints, 1.0);
+  Eigen::VectorXd max_jerk = Eigen::VectorXd::Constant(num_joints, 1000.0);
+
+  {
+    InstructionsTrajectory trajectory(program);
+    IterativeSplineParameterization time_parameterization(false);
+    if (!time_parameterization.compute(trajectory, max_velocity, max_acceleration))
+    {
+      state.SkipWithError("Failed to time parameterize the program");
+      return;
+    }
+  }
+
+  RuckigTrajectorySmoothing solver;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction copy = program;
+    InstructionsTrajectory trajectory(copy);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(solver.compute(trajectory, max_velocity, max_acceleration, max_jerk));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief Smooth a time parameterized program on a dense copy, including gathering and assigning the results */
+static void BM_RuckigComputeDense(benchmark::State& state)
+{
+  const auto num_joints = static_cast<Eigen::Index>(state.range(1));
+  CompositeInstruction program = createProgram(state.range(0), num_joints);
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(num_joints, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(num_joints, 1.0);
+  Eigen::VectorXd max_jerk = Eigen::VectorXd::Constant(num_joints, 1000.0);
+
+  {
+    DenseTrajectory trajectory(program);
+    IterativeSplineParameterization time_parameterization(false);
+    if (!time_parameterization.compute(trajectory, max_velocity, max_acceleration))
+    {
+      state.SkipWithError("Failed to time parameterize the program");
+      return;
+    }
+    trajectory.assign(program);
+  }
+
+  RuckigTrajectorySmoothing solver;
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction copy = program;
+    state.ResumeTiming();
+
+    DenseTrajectory trajectory(copy);
+    benchmark::DoNotOptimize(solver.compute(trajectory, max_velocity, max_acceleration, max_jerk));
+    trajectory.assign(copy);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_RuckigCompute)
+    ->ArgsProduct({ benchmark::CreateRange(100, 10000, 10), { 6, 7, 8 } })
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_RuckigComputeDense)
+    ->ArgsProduct({ benchmark::CreateRange(100, 10000, 10), { 6, 7, 8 } })
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -9,6 +9,7 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 #include <tesseract_time_parameterization/ruckig/ruckig_trajectory_smoothing.h>
 #include <tesseract_time_parameterization/isp/iterative_spline_parameterization.h>
 #include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
 
 #include <ruckig/input_parameter.hpp>
 #include <ruckig/ruckig.hpp>
@@ -57,6 +58,28 @@ CompositeInstruction createStraightTrajectory()
   return program;
 }
 
+// Initialize n-joint, straight-line trajectory
+CompositeInstruction createStraightTrajectory(Eigen::Index num_joints)
+{
+  const int num = 10;
+  const double max = 2.0;
+
+  std::vector<std::string> joint_names;
+  for (Eigen::Index j = 0; j < num_joints; ++j)
+    joint_names.push_back("joint_" + std::to_string(j + 1));
+
+  CompositeInstruction program;
+  for (int i = 0; i <= num; i++)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(num_joints)) };
+    swp.getPosition()[0] = i * max / num;
+    swp.getPosition()[num_joints - 1] = -i * max / (2 * num);
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+
+  return program;
+}
+
 TEST(RuckigTrajectorySmoothingTest, Example)  // NOLINT
 {
   // Create input parameters
@@ -123,6 +146,39 @@ TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingSolve)  // NOLINT
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 8.0);
 }
 
+TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingDenseTrajectory)  // NOLINT
+{
+  IterativeSplineParameterization time_parameterization(false);
+  RuckigTrajectorySmoothing traj_smoothing;
+  std::vector<double> max_velocity = { 2.088, 2.082, 3.27, 3.6, 3.3, 3.078 };
+  std::vector<double> max_acceleration = { 1, 1, 1, 1, 1, 1 };
+  std::vector<double> max_jerk = { 1000, 1000, 1000, 1000, 1000, 1000 };
+
+  CompositeInstruction expected_program = createStraightTrajectory();
+  InstructionsTrajectory expected_trajectory(expected_program);
+  EXPECT_TRUE(time_parameterization.compute(expected_trajectory, max_velocity, max_acceleration));
+  EXPECT_TRUE(traj_smoothing.compute(expected_trajectory, max_velocity, max_acceleration, max_jerk));
+
+  CompositeInstruction program = createStraightTrajectory();
+  DenseTrajectory trajectory(program);
+  EXPECT_TRUE(time_parameterization.compute(trajectory, max_velocity, max_acceleration));
+  EXPECT_TRUE(traj_smoothing.compute(trajectory, max_velocity, max_acceleration, max_jerk));
+  trajectory.assign(program);
+
+  // Both containers give the same result
+  ASSERT_EQ(trajectory.size(), expected_trajectory.size());
+  InstructionsTrajectory assigned_trajectory(program);
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    EXPECT_TRUE(trajectory.getPosition(i).isApprox(expected_trajectory.getPosition(i), 1e-12));
+    EXPECT_TRUE(trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_TRUE(trajectory.getAcceleration(i).isApprox(expected_trajectory.getAcceleration(i), 1e-12));
+    EXPECT_NEAR(trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+    EXPECT_TRUE(assigned_trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_NEAR(assigned_trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+  }
+}
+
 TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingRepeatedPointSolve)  // NOLINT
 {
   IterativeSplineParameterization time_parameterization(true);
@@ -139,6 +195,33 @@ TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingRepeatedPointSolve)
   ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 0.001);
 }
 
+TEST(RuckigTrajectorySmoothingTest, RuckigTrajectorySmoothingDOFSolve)  // NOLINT
+{
+  // Seven joints use a statically sized Ruckig, three and eight joints use the dynamic fallback
+  for (Eigen::Index num_joints : { 3, 7, 8 })
+  {
+    IterativeSplineParameterization time_parameterization(false);
+    CompositeInstruction program = createStraightTrajectory(num_joints);
+    Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(num_joints, 2.0);
+    Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(num_joints, 1.0);
+    Eigen::VectorXd max_jerk = Eigen::VectorXd::Constant(num_joints, 1000.0);
+    TrajectoryContainer::Ptr trajectory = std::make_shared<InstructionsTrajectory>(program);
+    EXPECT_TRUE(time_parameterization.compute(*trajectory, max_velocity, max_acceleration));
+    ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 5.0);
+
+    RuckigTrajectorySmoothing traj_smoothing;
+    EXPECT_TRUE(traj_smoothing.compute(*trajectory, max_velocity, max_acceleration, max_jerk));
+    ASSERT_LT(program.back().as<MoveInstructionPoly>().getWaypoint().as<StateWaypointPoly>().getTime(), 8.0);
+    EXPECT_TRUE(trajectory->isTimeStrictlyIncreasing());
+
+    for (Eigen::Index i = 0; i < trajectory->size(); ++i)
+    {
+      EXPECT_TRUE((trajectory->getVelocity(i).array().abs() <= max_velocity.array() + 1e-6).all());
+      EXPECT_TRUE((trajectory->getAcceleration(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+    }
+  }
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);
@@ -43,6 +43,8 @@
 TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <Eigen/Core>
 #include <list>
+#include <memory>
+#include <vector>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 #include <tesseract_command_language/composite_instruction.h>
@@ -50,6 +52,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_POP
 
 namespace tesseract_planning
 {
+namespace totg
+{
+class Trajectory;
+}
+
 class TimeOptimalTrajectoryGeneration
 {
 public:
@@ -61,6 +68,19 @@ public:
                          double max_velocity_scaling_factor = 1.0,
                          double max_acceleration_scaling_factor = 1.0) const;
 
+  /**
+   * @brief Compute the time stamps and keep the time optimal trajectory so it can be sampled exactly
+   * @details The time optimal trajectory has an extra dummy joint appended, see TOTGTrajectorySampler
+   * @param parameterized Set to the time optimal trajectory, or nullptr if the trajectory is empty, has a single
+   * distinct waypoint or could not be parameterized
+   */
+  bool computeTimeStamps(TrajectoryContainer& trajectory,
+                         const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
+                         const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
+                         double max_velocity_scaling_factor,
+                         double max_acceleration_scaling_factor,
+                         std::shared_ptr<const totg::Trajectory>& parameterized) const;
+
 private:
   double path_tolerance_;
   double min_angle_change_;
@@ -84,7 +104,7 @@ public:
   virtual Eigen::VectorXd getConfig(double s) const = 0;
   virtual Eigen::VectorXd getTangent(double s) const = 0;
   virtual Eigen::VectorXd getCurvature(double s) const = 0;
-  virtual std::list<double> getSwitchingPoints() const = 0;
+  virtual std::vector<double> getSwitchingPoints() const = 0;
   virtual std::unique_ptr<PathSegment> clone() const = 0;
 
   double position_{ 0 };
@@ -96,6 +116,7 @@ protected:
 class Path
 {
 public:
+  Path(const std::vector<Eigen::VectorXd>& path, double max_deviation = 0.0);
   Path(const std::list<Eigen::VectorXd>& path, double max_deviation = 0.0);
   ~Path() = default;
   Path(const Path& path);
@@ -108,15 +129,19 @@ public:
   Eigen::VectorXd getTangent(double s) const;
   Eigen::VectorXd getCurvature(double s) const;
   double getNextSwitchingPoint(double s, bool& discontinuity) const;
-  std::list<std::pair<double, bool>> getSwitchingPoints() const;
+  const std::vector<std::pair<double, bool>>& getSwitchingPoints() const;
   const std::vector<double>& getMapping() const;
 
 private:
+  /** @brief Find the segment containing path position s using a binary search and make s relative to it */
   PathSegment* getPathSegment(double& s) const;
   double length_{ 0 };
   std::vector<double> mapping_;
-  std::list<std::pair<double, bool>> switching_points_;
-  std::list<std::unique_ptr<PathSegment>> path_segments_;
+  /** @brief The switching points sorted by path position */
+  std::vector<std::pair<double, bool>> switching_points_;
+  std::vector<std::unique_ptr<PathSegment>> path_segments_;
+  /** @brief The start position of each path segment, used for binary search */
+  std::vector<double> segment_positions_;
 };
 
 /** @brief Structure to store path data sampled at a point in time. */
@@ -200,9 +225,11 @@ private:
                                      TrajectoryStep& next_switching_point,
                                      double& before_acceleration,
                                      double& after_acceleration);
-  bool integrateForward(std::list<TrajectoryStep>& trajectory, double acceleration);
-  void
-  integrateBackward(std::list<TrajectoryStep>& start_trajectory, double path_pos, double path_vel, double acceleration);
+  bool integrateForward(std::vector<TrajectoryStep>& trajectory, double acceleration);
+  void integrateBackward(std::vector<TrajectoryStep>& start_trajectory,
+                         double path_pos,
+                         double path_vel,
+                         double acceleration);
   double getMinMaxPathAcceleration(double path_position, double path_velocity, bool max);
   double getMinMaxPhaseSlope(double path_position, double path_velocity, bool max);
   double getAccelerationMaxPathVelocity(double path_pos) const;
@@ -210,23 +237,98 @@ private:
   double getAccelerationMaxPathVelocityDeriv(double path_pos);
   double getVelocityMaxPathVelocityDeriv(double path_pos);
 
-  std::list<TrajectoryStep>::const_iterator getTrajectorySegment(double time) const;
-  std::list<TrajectoryStep>::const_iterator getTrajectorySegmentFromDist(double pos) const;
+  /** @brief Get the first trajectory step after the provided time using a binary search */
+  std::vector<TrajectoryStep>::const_iterator getTrajectorySegment(double time) const;
+  /** @brief Get the first trajectory step after the provided path position using a binary search */
+  std::vector<TrajectoryStep>::const_iterator getTrajectorySegmentFromDist(double pos) const;
 
   Path path_;
   Eigen::VectorXd max_velocity_;
   Eigen::VectorXd max_acceleration_;
   Eigen::Index joint_num_;
   bool valid_{ true };
-  std::list<TrajectoryStep> trajectory_;
-  std::list<TrajectoryStep> end_trajectory_;  // non-empty only if the trajectory generation failed.
+  std::vector<TrajectoryStep> trajectory_;
+  std::vector<TrajectoryStep> end_trajectory_;  // non-empty only if the trajectory generation failed.
 
-  const double time_step_;
+  /** @brief The buffer used by integrateBackward, stored in reverse order and reused between calls */
+  std::vector<TrajectoryStep> backward_trajectory_;
 
-  mutable double cached_time_;
-  mutable std::list<TrajectoryStep>::const_iterator cached_trajectory_segment_;
+  const double time_step_;
 };
 }  // namespace totg
+
+/**
+ * @brief Samples a trajectory computed by TimeOptimalTrajectoryGeneration exactly
+ *
+ * Unlike TrajectorySampler, which interpolates the waypoints, this evaluates the time optimal trajectory itself so the
+ * samples follow the blends between waypoints and respect the velocity and acceleration limits. Each sample does a
+ * binary search and allocates, so it is slower than TrajectorySampler. It holds no cursor and may be shared between
+ * threads.
+ */
+class TOTGTrajectorySampler
+{
+public:
+  using Ptr = std::shared_ptr<TOTGTrajectorySampler>;
+  using ConstPtr = std::shared_ptr<const TOTGTrajectorySampler>;
+
+  /**
+   * @brief Construct a sampler of a time optimal trajectory
+   * @param trajectory The valid time optimal trajectory
+   * @param dof The number of joints to sample, the joints after it are dropped. This removes the dummy joint appended
+   * by TimeOptimalTrajectoryGeneration::computeTimeStamps
+   */
+  TOTGTrajectorySampler(std::shared_ptr<const totg::Trajectory> trajectory, Eigen::Index dof);
+
+  /** @brief The time of the start of the trajectory */
+  double getStartTime() const;
+
+  /** @brief The time of the end of the trajectory */
+  double getEndTime() const;
+
+  /** @brief The duration of the trajectory */
+  double getDuration() const;
+
+  /** @brief The number of joints */
+  Eigen::Index dof() const;
+
+  /**
+   * @brief The number of samples needed to sample the trajectory from start to end with a fixed time step
+   * @param dt The time step
+   * @return The number of samples, the last sample is at or before the end of the trajectory
+   */
+  Eigen::Index getNumSamples(double dt) const;
+
+  /**
+   * @brief Sample the trajectory at a given time
+   * @param time The time from start, clamped to the trajectory
+   * @param position The position, must be of size dof()
+   * @param velocity The velocity, must be of size dof()
+   * @param acceleration The acceleration, must be of size dof()
+   */
+  void sample(double time,
+              Eigen::Ref<Eigen::VectorXd> position,
+              Eigen::Ref<Eigen::VectorXd> velocity,
+              Eigen::Ref<Eigen::VectorXd> acceleration) const;
+
+  /**
+   * @brief Sample the trajectory with a fixed time step into preallocated buffers
+   * @details Column i is sampled at start_time + i * dt, the number of samples is the number of columns of the buffers
+   * @param start_time The time of the first sample
+   * @param dt The time step
+   * @param positions The positions, must have dof() rows
+   * @param velocities The velocities, must have the same size as positions
+   * @param accelerations The accelerations, must have the same size as positions
+   */
+  void sampleUniform(double start_time,
+                     double dt,
+                     Eigen::Ref<Eigen::MatrixXd> positions,
+                     Eigen::Ref<Eigen::MatrixXd> velocities,
+                     Eigen::Ref<Eigen::MatrixXd> accelerations) const;
+
+private:
+  std::shared_ptr<const totg::Trajectory> trajectory_;
+  Eigen::Index dof_;
+};
 }  // namespace tesseract_planning
 
 #endif
@@ -41,7 +41,11 @@ TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
 #include <limits>
 #include <Eigen/Geometry>
 #include <algorithm>
+#include <cassert>
 #include <cmath>
+#include <iterator>
+#include <list>
+#include <stdexcept>
 #include <vector>
 #include <console_bridge/console.h>
 TESSERACT_COMMON_IGNORE_WARNINGS_POP
@@ -65,6 +69,23 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
                                                         double max_velocity_scaling_factor,
                                                         double max_acceleration_scaling_factor) const
 {
+  std::shared_ptr<const totg::Trajectory> parameterized;
+  return computeTimeStamps(trajectory,
+                           max_velocity,
+                           max_acceleration,
+                           max_velocity_scaling_factor,
+                           max_acceleration_scaling_factor,
+                           parameterized);
+}
+
+bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& trajectory,
+                                                        const Eigen::Ref<const Eigen::VectorXd>& max_velocity,
+                                                        const Eigen::Ref<const Eigen::VectorXd>& max_acceleration,
+                                                        double max_velocity_scaling_factor,
+                                                        double max_acceleration_scaling_factor,
+                                                        std::shared_ptr<const totg::Trajectory>& parameterized) const
+{
+  parameterized = nullptr;
   if (trajectory.empty())
     return true;
 
@@ -119,11 +140,15 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
 
   // Have to convert into Eigen data structs and remove repeated points
   //  (https://github.com/tobiaskunz/trajectories/issues/3)
-  std::list<Eigen::VectorXd> points;
+  // A dummy joint is appended to each point as a workaround to
+  //  https://github.com/ros-industrial-consortium/tesseract_planning/issues/27
+  std::vector<Eigen::VectorXd> points;
+  points.reserve(num_points);
   std::vector<std::size_t> mapping;
+  mapping.reserve(num_points);
   for (Eigen::Index p = 0; p < static_cast<Eigen::Index>(num_points); ++p)
   {
-    const Eigen::VectorXd& position = trajectory.getPosition(p);
+    const Eigen::Ref<const Eigen::VectorXd> position = trajectory.getPosition(p);
     bool diverse_point = (p == 0);
 
     if (p > 0)
@@ -137,7 +162,11 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
     }
 
     if (diverse_point)
-      points.push_back(position);
+    {
+      Eigen::VectorXd point(num_joints + 1);
+      point << position, static_cast<double>(points.size() + 1);
+      points.push_back(std::move(point));
+    }
 
     // Need to store the index mapping for assignData
     mapping.push_back(points.size() - 1);
@@ -150,23 +179,13 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
                             "waypoint.");
 
     // Set velocity, acceleration and time to zero for all points in the trajectory.
+    const Eigen::VectorXd zero = Eigen::VectorXd::Zero(num_joints);
     for (long i = 0; i < trajectory.size(); ++i)
-      trajectory.setData(i, Eigen::VectorXd::Zero(num_joints), Eigen::VectorXd::Zero(num_joints), 0);
+      trajectory.setData(i, zero, zero, 0);
 
     return true;
   }
 
-  // Append a dummy joint as a workaround to https://github.com/ros-industrial-consortium/tesseract_planning/issues/27
-  std::list<Eigen::VectorXd> new_points;
-  double dummy = 1.0;
-  for (auto& point : points)
-  {
-    Eigen::VectorXd new_point(point.size() + 1);
-    new_point << point, dummy;
-    new_points.push_back(new_point);
-    dummy += 1.0;
-  }
-
   Eigen::VectorXd max_velocity_dummy_appended(max_velocity.size() + 1);
   max_velocity_dummy_appended << (max_velocity * velocity_scaling_factor), std::numeric_limits<double>::max();
   Eigen::VectorXd max_acceleration_dummy_appended(max_acceleration.size() + 1);
@@ -174,15 +193,20 @@ bool TimeOptimalTrajectoryGeneration::computeTimeStamps(TrajectoryContainer& tra
       std::numeric_limits<double>::max();
 
   // Now actually call the algorithm
-  totg::Path path(new_points, path_tolerance_);
-  totg::Trajectory parameterized(path, max_velocity_dummy_appended, max_acceleration_dummy_appended, 0.001);
-  if (!parameterized.isValid())
+  totg::Path path(points, path_tolerance_);
+  auto result = std::make_shared<const totg::Trajectory>(
+      path, max_velocity_dummy_appended, max_acceleration_dummy_appended, 0.001);
+  if (!result->isValid())
   {
     CONSOLE_BRIDGE_logError("Unable to parameterize trajectory.");
     return false;
   }
 
-  return parameterized.assignData(trajectory, mapping);
+  if (!result->assignData(trajectory, mapping))
+    return false;
+
+  parameterized = std::move(result);
+  return true;
 }
 
 namespace totg
@@ -206,7 +230,7 @@ public:
 
   Eigen::VectorXd getCurvature(double /* s */) const override { return Eigen::VectorXd::Zero(start_.size()); }
 
-  std::list<double> getSwitchingPoints() const override { return {}; }
+  std::vector<double> getSwitchingPoints() const override { return {}; }
 
   std::unique_ptr<PathSegment> clone() const override { return std::make_unique<LinearPathSegment>(*this); }
 
@@ -291,9 +315,9 @@ public:
     return (-1.0 / radius) * (x * cos(angle) + y * sin(angle));
   }
 
-  std::list<double> getSwitchingPoints() const override
+  std::vector<double> getSwitchingPoints() const override
   {
-    std::list<double> switching_points;
+    std::vector<double> switching_points;
     const Eigen::Index dim = x.size();
     for (Eigen::Index i = 0; i < dim; ++i)
     {
@@ -308,7 +332,7 @@ public:
         switching_points.push_back(switching_point);
       }
     }
-    switching_points.sort();
+    std::sort(switching_points.begin(), switching_points.end());
     return switching_points;
   }
 
@@ -322,27 +346,25 @@ private:
 };
 
 Path::Path(const std::list<Eigen::VectorXd>& path, double max_deviation)
+  : Path(std::vector<Eigen::VectorXd>(path.begin(), path.end()), max_deviation)
+{
+}
+
+Path::Path(const std::vector<Eigen::VectorXd>& path, double max_deviation)
 {
   if (path.size() < 2)
     return;
-  auto path_iterator1 = path.begin();
-  auto path_iterator2 = path_iterator1;
-  ++path_iterator2;
-  std::list<Eigen::VectorXd>::const_iterator path_iterator3;
-  Eigen::VectorXd start_config = *path_iterator1;
+  Eigen::VectorXd start_config = path.front();
   mapping_.reserve(path.size());
   mapping_.push_back(0);
+  path_segments_.reserve(2 * path.size());
   double l{ 0 };
-  while (path_iterator2 != path.end())
+  for (std::size_t i = 1; i < path.size(); ++i)
   {
-    path_iterator3 = path_iterator2;
-    ++path_iterator3;
-    if (max_deviation > 0.0 && path_iterator3 != path.end())
+    if (max_deviation > 0.0 && (i + 1) < path.size())
     {
-      auto blend_segment = std::make_unique<CircularPathSegment>(0.5 * (*path_iterator1 + *path_iterator2),
-                                                                 *path_iterator2,
-                                                                 0.5 * (*path_iterator2 + *path_iterator3),
-                                                                 max_deviation);
+      auto blend_segment = std::make_unique<CircularPathSegment>(
+          0.5 * (path[i - 1] + path[i]), path[i], 0.5 * (path[i] + path[i + 1]), max_deviation);
       Eigen::VectorXd end_config = blend_segment->getConfig(0.0);
       if ((end_config - start_config).norm() > 0.000001)
       {
@@ -357,22 +379,22 @@ Path::Path(const std::list<Eigen::VectorXd>& path, double max_deviation)
     }
     else
     {
-      path_segments_.push_back(std::make_unique<LinearPathSegment>(start_config, *path_iterator2));
+      path_segments_.push_back(std::make_unique<LinearPathSegment>(start_config, path[i]));
       l += path_segments_.back()->getLength();
       mapping_.push_back(l);
-      start_config = *path_iterator2;
+      start_config = path[i];
     }
-    path_iterator1 = path_iterator2;
-    ++path_iterator2;
   }
   assert(mapping_.size() == path.size());
 
   // Create list of switching point candidates, calculate total path length and
   // absolute positions of path segments
+  segment_positions_.reserve(path_segments_.size());
   for (std::unique_ptr<PathSegment>& path_segment : path_segments_)
   {
     path_segment->position_ = length_;
-    std::list<double> local_switching_points = path_segment->getSwitchingPoints();
+    segment_positions_.push_back(length_);
+    std::vector<double> local_switching_points = path_segment->getSwitchingPoints();
     for (const auto& local_switching_point : local_switching_points)
     {
       switching_points_.emplace_back(length_ + local_switching_point, false);
@@ -385,8 +407,13 @@ Path::Path(const std::list<Eigen::VectorXd>& path, double max_deviation)
   switching_points_.pop_back();
 }
 
-Path::Path(const Path& path) : length_(path.length_), mapping_(path.mapping_), switching_points_(path.switching_points_)
+Path::Path(const Path& path)
+  : length_(path.length_)
+  , mapping_(path.mapping_)
+  , switching_points_(path.switching_points_)
+  , segment_positions_(path.segment_positions_)
 {
+  path_segments_.reserve(path.path_segments_.size());
   for (const std::unique_ptr<PathSegment>& path_segment : path.path_segments_)
     path_segments_.emplace_back(path_segment->clone());
 }
@@ -397,16 +424,11 @@ const std::vector<double>& Path::getMapping() const { return mapping_; }
 
 PathSegment* Path::getPathSegment(double& s) const
 {
-  auto it = path_segments_.begin();
-  auto next = it;
-  ++next;
-  while (next != path_segments_.end() && s >= (*next)->position_)
-  {
-    it = next;
-    ++next;
-  }
-  s -= (*it)->position_;
-  return (*it).get();
+  // Find the last segment starting at or before s, defaulting to the first segment
+  auto it = std::upper_bound(std::next(segment_positions_.begin()), segment_positions_.end(), s);
+  auto idx = static_cast<std::size_t>(std::distance(segment_positions_.begin(), it) - 1);
+  s -= segment_positions_[idx];
+  return path_segments_[idx].get();
 }
 
 Eigen::VectorXd Path::getConfig(double s) const
@@ -429,11 +451,10 @@ Eigen::VectorXd Path::getCurvature(double s) const
 
 double Path::getNextSwitchingPoint(double s, bool& discontinuity) const
 {
-  auto it = switching_points_.begin();
-  while (it != switching_points_.end() && it->first <= s)
-  {
-    ++it;
-  }
+  auto it = std::upper_bound(switching_points_.begin(),
+                             switching_points_.end(),
+                             s,
+                             [](double value, const std::pair<double, bool>& sp) { return value < sp.first; });
   if (it == switching_points_.end())
   {
     discontinuity = true;
@@ -443,7 +464,7 @@ double Path::getNextSwitchingPoint(double s, bool& discontinuity) const
   return it->first;
 }
 
-std::list<std::pair<double, bool>> Path::getSwitchingPoints() const { return switching_points_; }
+const std::vector<std::pair<double, bool>>& Path::getSwitchingPoints() const { return switching_points_; }
 
 Trajectory::Trajectory(const Path& path,
                        const Eigen::VectorXd& max_velocity,
@@ -454,7 +475,6 @@ Trajectory::Trajectory(const Path& path,
   , max_acceleration_(max_acceleration)
   , joint_num_(max_velocity.size())
   , time_step_(time_step)
-  , cached_time_(std::numeric_limits<double>::max())
 {
   trajectory_.emplace_back(0.0, 0.0);
   double after_acceleration = getMinMaxPathAcceleration(0.0, 0.0, true);
@@ -649,12 +669,12 @@ bool Trajectory::getNextVelocitySwitchingPoint(double path_pos,
 }
 
 // Returns true if end of path is reached
-bool Trajectory::integrateForward(std::list<TrajectoryStep>& trajectory, double acceleration)
+bool Trajectory::integrateForward(std::vector<TrajectoryStep>& trajectory, double acceleration)
 {
   double path_pos = trajectory.back().path_pos_;
   double path_vel = trajectory.back().path_vel_;
 
-  std::list<std::pair<double, bool>> switching_points = path_.getSwitchingPoints();
+  const std::vector<std::pair<double, bool>>& switching_points = path_.getSwitchingPoints();
   auto next_discontinuity = switching_points.begin();
 
   while (true)
@@ -744,7 +764,7 @@ bool Trajectory::integrateForward(std::list<TrajectoryStep>& trajectory, double
 
       if (getAccelerationMaxPathVelocity(after) < getVelocityMaxPathVelocity(after))
       {
-        if (after > next_discontinuity->first)
+        if (next_discontinuity != switching_points.end() && after > next_discontinuity->first)
         {
           return false;
         }
@@ -767,7 +787,7 @@ bool Trajectory::integrateForward(std::list<TrajectoryStep>& trajectory, double
   }
 }
 
-void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
+void Trajectory::integrateBackward(std::vector<TrajectoryStep>& start_trajectory,
                                    double path_pos,
                                    double path_vel,
                                    double acceleration)
@@ -776,7 +796,10 @@ void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
   --start2;
   auto start1 = start2;
   --start1;
-  std::list<TrajectoryStep> trajectory;
+
+  // The backward trajectory is stored in reverse order so steps can be appended
+  std::vector<TrajectoryStep>& trajectory = backward_trajectory_;
+  trajectory.clear();
   double slope{ 0 };
   assert(start1->path_pos_ < path_pos || tesseract_common::almostEqualRelativeAndAbs(start1->path_pos_, path_pos, EPS));
 
@@ -784,17 +807,17 @@ void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
   {
     if (start1->path_pos_ < path_pos || tesseract_common::almostEqualRelativeAndAbs(start1->path_pos_, path_pos, EPS))
     {
-      trajectory.push_front(TrajectoryStep(path_pos, path_vel));
+      trajectory.emplace_back(path_pos, path_vel);
       path_vel -= time_step_ * acceleration;
-      path_pos -= time_step_ * 0.5 * (path_vel + trajectory.front().path_vel_);
+      path_pos -= time_step_ * 0.5 * (path_vel + trajectory.back().path_vel_);
       acceleration = getMinMaxPathAcceleration(path_pos, path_vel, false);
-      slope = (trajectory.front().path_vel_ - path_vel) / (trajectory.front().path_pos_ - path_pos);
+      slope = (trajectory.back().path_vel_ - path_vel) / (trajectory.back().path_pos_ - path_pos);
 
       if (path_vel < 0.0)
       {
         valid_ = false;
         CONSOLE_BRIDGE_logError("Error while integrating backward: Negative path velocity");
-        end_trajectory_ = trajectory;
+        end_trajectory_.assign(trajectory.rbegin(), trajectory.rend());
         return;
       }
     }
@@ -820,7 +843,7 @@ void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
           (start1->path_vel_ - path_vel + slope * path_pos - start_slope * start1->path_pos_) / (slope - start_slope);
 
     double pos_max = std::max(start1->path_pos_, path_pos);
-    double pos_min = std::min(start2->path_pos_, trajectory.front().path_pos_);
+    double pos_min = std::min(start2->path_pos_, trajectory.back().path_pos_);
     bool check1 = (pos_max < intersection_path_pos) ||
                   tesseract_common::almostEqualRelativeAndAbs(pos_max, intersection_path_pos, EPS);
     bool check2 = (intersection_path_pos < pos_min) ||
@@ -832,14 +855,14 @@ void Trajectory::integrateBackward(std::list<TrajectoryStep>& start_trajectory,
           start1->path_vel_ + start_slope * (intersection_path_pos - start1->path_pos_);
       start_trajectory.erase(start2, start_trajectory.end());
       start_trajectory.emplace_back(intersection_path_pos, intersection_path_vel);
-      start_trajectory.splice(start_trajectory.end(), trajectory);
+      start_trajectory.insert(start_trajectory.end(), trajectory.rbegin(), trajectory.rend());
       return;
     }
   }
 
   valid_ = false;
   CONSOLE_BRIDGE_logError("Error while integrating backward: Did not hit start trajectory");
-  end_trajectory_ = trajectory;
+  end_trajectory_.assign(trajectory.rbegin(), trajectory.rend());
 }
 
 double Trajectory::getMinMaxPathAcceleration(double path_position, double path_velocity, bool max)
@@ -942,11 +965,11 @@ bool Trajectory::assignData(TrajectoryContainer& trajectory, const std::vector<s
   assert(trajectory.size() == mapping.size());
 
   // Set Start
+  // The dummy joint is dropped by passing the head of the velocity and acceleration without copying it
+  const Eigen::Index dof = trajectory.dof();
   PathData path_data = getPathData(0);
-  Eigen::VectorXd uv = getVelocity(path_data).head(trajectory.dof());
-  Eigen::VectorXd ua = getAcceleration(path_data).head(trajectory.dof());
   double time{ 0 };
-  trajectory.setData(0, uv, ua, time);
+  trajectory.setData(0, getVelocity(path_data).head(dof), getAcceleration(path_data).head(dof), time);
 
   // Set intermidiate points
   double prev_time{ 0 };
@@ -959,9 +982,7 @@ bool Trajectory::assignData(TrajectoryContainer& trajectory, const std::vector<s
       time = prev_time + 1e-8;
 
     path_data = getPathData(time);
-    uv = getVelocity(path_data).head(trajectory.dof());
-    ua = getAcceleration(path_data).head(trajectory.dof());
-    trajectory.setData(i, uv, ua, time);
+    trajectory.setData(i, getVelocity(path_data).head(dof), getAcceleration(path_data).head(dof), time);
 
     prev_time = time;
   }
@@ -971,15 +992,14 @@ bool Trajectory::assignData(TrajectoryContainer& trajectory, const std::vector<s
     time = prev_time + 1e-8;
 
   path_data = getPathData(time);
-  uv = getVelocity(path_data).head(trajectory.dof());
-  ua = getAcceleration(path_data).head(trajectory.dof());
-  trajectory.setData((trajectory.size() - 1), uv, ua, time);
+  trajectory.setData(
+      (trajectory.size() - 1), getVelocity(path_data).head(dof), getAcceleration(path_data).head(dof), time);
 
   assert(trajectory.isTimeStrictlyIncreasing());
   return true;
 }
 
-std::list<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectorySegment(double time) const
+std::vector<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectorySegment(double time) const
 {
   if (time >= trajectory_.back().time_)
   {
@@ -988,19 +1008,14 @@ std::list<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectoryS
     return last;
   }
 
-  if (time < cached_time_)
-  {
-    cached_trajectory_segment_ = trajectory_.begin();
-  }
-  while (time >= cached_trajectory_segment_->time_)
-  {
-    ++cached_trajectory_segment_;
-  }
-  cached_time_ = time;
-  return cached_trajectory_segment_;
+  // The first step always has a time of zero so the result always has a previous step
+  return std::upper_bound(std::next(trajectory_.begin()),
+                          trajectory_.end(),
+                          time,
+                          [](double value, const TrajectoryStep& step) { return value < step.time_; });
 }
 
-std::list<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectorySegmentFromDist(double pos) const
+std::vector<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectorySegmentFromDist(double pos) const
 {
   if (pos >= trajectory_.back().path_pos_)
   {
@@ -1012,13 +1027,10 @@ std::list<Trajectory::TrajectoryStep>::const_iterator Trajectory::getTrajectoryS
   if (pos < 0)
     return trajectory_.begin();
 
-  for (auto it = trajectory_.begin(); it != trajectory_.end(); ++it)
-  {
-    if (pos < it->path_pos_)
-      return it;
-  }
-
-  throw std::runtime_error("Failed to find trajectory segment, this should not happen");
+  return std::upper_bound(trajectory_.begin(),
+                          trajectory_.end(),
+                          pos,
+                          [](double value, const TrajectoryStep& step) { return value < step.path_pos_; });
 }
 
 PathData Trajectory::getPathData(double time) const
@@ -1084,4 +1096,58 @@ Eigen::VectorXd Trajectory::getAcceleration(const PathData& data) const
   return path_acc;
 }
 }  // namespace totg
+TOTGTrajectorySampler::TOTGTrajectorySampler(std::shared_ptr<const totg::Trajectory> trajectory, Eigen::Index dof)
+  : trajectory_(std::move(trajectory)), dof_(dof)
+{
+  if (trajectory_ == nullptr || !trajectory_->isValid())
+    throw std::runtime_error("TOTGTrajectorySampler: The trajectory must be valid!");
+
+  if (dof_ < 0 || dof_ > trajectory_->getPosition(trajectory_->getPathData(0)).rows())
+    throw std::runtime_error("TOTGTrajectorySampler: The dof must not exceed the number of joints of the trajectory!");
+}
+
+double TOTGTrajectorySampler::getStartTime() const { return 0; }
+
+double TOTGTrajectorySampler::getEndTime() const { return trajectory_->getDuration(); }
+
+double TOTGTrajectorySampler::getDuration() const { return trajectory_->getDuration(); }
+
+Eigen::Index TOTGTrajectorySampler::dof() const { return dof_; }
+
+Eigen::Index TOTGTrajectorySampler::getNumSamples(double dt) const
+{
+  if (dt <= 0)
+    throw std::runtime_error("TOTGTrajectorySampler: The time step must be greater than zero!");
+
+  // The tolerance keeps a sample at the end when the duration is a multiple of the time step
+  return static_cast<Eigen::Index>(std::floor((getDuration() / dt) + 1e-9)) + 1;
+}
+
+void TOTGTrajectorySampler::sample(double time,
+                                   Eigen::Ref<Eigen::VectorXd> position,
+                                   Eigen::Ref<Eigen::VectorXd> velocity,
+                                   Eigen::Ref<Eigen::VectorXd> acceleration) const
+{
+  assert(position.rows() == dof_ && velocity.rows() == dof_ && acceleration.rows() == dof_);
+
+  const totg::PathData path_data = trajectory_->getPathData(std::clamp(time, getStartTime(), getEndTime()));
+  position = trajectory_->getPosition(path_data).head(dof_);
+  velocity = trajectory_->getVelocity(path_data).head(dof_);
+  acceleration = trajectory_->getAcceleration(path_data).head(dof_);
+}
+
+void TOTGTrajectorySampler::sampleUniform(double start_time,
+                                          double dt,
+                                          Eigen::Ref<Eigen::MatrixXd> positions,
+                                          Eigen::Ref<Eigen::MatrixXd> velocities,
+                                          Eigen::Ref<Eigen::MatrixXd> accelerations) const
+{
+  assert(positions.rows() == dof_);
+  assert(velocities.rows() == positions.rows() && velocities.cols() == positions.cols());
+  assert(accelerations.rows() == positions.rows() && accelerations.cols() == positions.cols());
+
+  for (Eigen::Index i = 0; i < positions.cols(); ++i)
+    sample(start_time + (static_cast<double>(i) * dt), positions.col(i), velocities.col(i), accelerations.col(i));
+}
+
 }  // namespace tesseract_planning
@@ -0,0 +1,276 @@
+/**
+ * @file time_optimal_trajectory_generation_benchmark.cpp
+ * @brief Benchmark time optimal trajectory generation on long trajectories
+ *
+ * @author Levi Armstrong
+ * @date October 17, 2026
+ * @version TODO
+ * @bug No known bugs
+ *
+ * @copyright Copyright (c) 2026, Levi Armstrong
+ *
+ * @par License
+ * Software License Agreement (Apache License)
+ * @par
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ * http://www.apache.org/licenses/LICENSE-2.0
+ * @par
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <tesseract_common/macros.h>
+TESSERACT_COMMON_IGNORE_WARNINGS_PUSH
+#include <algorithm>
+#include <cmath>
+#include <list>
+#include <vector>
+TESSERACT_COMMON_IGNORE_WARNINGS_POP
+
+#include <benchmark/benchmark.h>
+#include <tesseract_time_parameterization/totg/time_optimal_trajectory_generation.h>
+#include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_time_parameterization/core/trajectory_sampler.h>
+#include <tesseract_command_language/state_waypoint.h>
+#include <tesseract_command_language/move_instruction.h>
+
+using namespace tesseract_planning;
+
+/** @brief Create a six joint path which moves along joint 1 while the remaining joints oscillate */
+static std::vector<Eigen::VectorXd> createPoints(long num_points)
+{
+  std::vector<Eigen::VectorXd> points;
+  points.reserve(static_cast<std::size_t>(num_points));
+  for (long i = 0; i < num_points; ++i)
+  {
+    Eigen::VectorXd point(6);
+    point(0) = 0.005 * static_cast<double>(i);
+    for (Eigen::Index j = 1; j < 6; ++j)
+      point(j) = 0.2 * std::sin((0.01 * static_cast<double>(i)) + static_cast<double>(j));
+
+    points.push_back(point);
+  }
+  return points;
+}
+
+static CompositeInstruction createProgram(long num_points)
+{
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+
+  CompositeInstruction program;
+  for (const auto& point : createPoints(num_points))
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, point) };
+    program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+  return program;
+}
+
+/** @brief Time parameterize the full program, which includes assigning the timing to every input point */
+static void BM_TOTGComputeTimeStamps(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(state.range(0));
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(6, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(6, 1.0);
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    CompositeInstruction copy = program;
+    InstructionsTrajectory trajectory(copy);
+    state.ResumeTiming();
+
+    benchmark::DoNotOptimize(solver.computeTimeStamps(trajectory, max_velocity, max_acceleration));
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/**
+ * @brief Time parameterize the full program on a dense copy as done by the task, which includes gathering the points,
+ * copying the program and assigning the results
+ */
+static void BM_TOTGComputeTimeStampsDense(benchmark::State& state)
+{
+  const CompositeInstruction program = createProgram(state.range(0));
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(6, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(6, 1.0);
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+
+  for (auto _ : state)
+  {
+    DenseTrajectory trajectory(program);
+    benchmark::DoNotOptimize(solver.computeTimeStamps(trajectory, max_velocity, max_acceleration));
+
+    CompositeInstruction copy = program;
+    trajectory.assign(copy);
+    benchmark::DoNotOptimize(copy);
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief Sample the parameterized trajectory at 1 kHz, as done when streaming to a controller */
+static void BM_TOTGSampleTrajectory(benchmark::State& state)
+{
+  std::vector<Eigen::VectorXd> points = createPoints(state.range(0));
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(6, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(6, 1.0);
+  totg::Trajectory trajectory(totg::Path(points, 0.001), max_velocity, max_acceleration, 0.001);
+  if (!trajectory.isValid())
+  {
+    state.SkipWithError("Failed to parameterize trajectory");
+    return;
+  }
+
+  const double duration = trajectory.getDuration();
+  const double dt = 0.001;
+  int64_t samples{ 0 };
+  for (auto _ : state)
+  {
+    for (double t = 0; t < duration; t += dt)
+    {
+      totg::PathData data = trajectory.getPathData(t);
+      benchmark::DoNotOptimize(trajectory.getPosition(data));
+      benchmark::DoNotOptimize(trajectory.getVelocity(data));
+      ++samples;
+    }
+  }
+  state.SetItemsProcessed(samples);
+}
+
+/** @brief Time parameterize a program and create a sampler, returns nullptr if the parameterization failed */
+static TrajectorySampler::Ptr createSampler(long num_points)
+{
+  const CompositeInstruction program = createProgram(num_points);
+  Eigen::VectorXd max_velocity = Eigen::VectorXd::Constant(6, 2.0);
+  Eigen::VectorXd max_acceleration = Eigen::VectorXd::Constant(6, 1.0);
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+
+  DenseTrajectory trajectory(program);
+  if (!solver.computeTimeStamps(trajectory, max_velocity, max_acceleration))
+    return nullptr;
+
+  return std::make_shared<TrajectorySampler>(trajectory);
+}
+
+/** @brief Stream the parameterized program at 1 kHz one sample at a time using the sampler cursor */
+static void BM_TrajectorySamplerSequential(benchmark::State& state)
+{
+  TrajectorySampler::Ptr sampler = createSampler(state.range(0));
+  if (sampler == nullptr)
+  {
+    state.SkipWithError("Failed to parameterize trajectory");
+    return;
+  }
+
+  const double dt = 0.001;
+  const Eigen::Index num_samples = sampler->getNumSamples(dt);
+  Eigen::VectorXd position(sampler->dof());
+  Eigen::VectorXd velocity(sampler->dof());
+  Eigen::VectorXd acceleration(sampler->dof());
+  for (auto _ : state)
+  {
+    sampler->reset();
+    for (Eigen::Index i = 0; i < num_samples; ++i)
+    {
+      sampler->sample(static_cast<double>(i) * dt, position, velocity, acceleration);
+      benchmark::DoNotOptimize(position.data());
+      benchmark::DoNotOptimize(velocity.data());
+      benchmark::DoNotOptimize(acceleration.data());
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_samples);
+}
+
+/** @brief Sample the parameterized program at 1 kHz into preallocated buffers */
+static void BM_TrajectorySamplerUniform(benchmark::State& state)
+{
+  TrajectorySampler::Ptr sampler = createSampler(state.range(0));
+  if (sampler == nullptr)
+  {
+    state.SkipWithError("Failed to parameterize trajectory");
+    return;
+  }
+
+  const double dt = 0.001;
+  const Eigen::Index num_samples = sampler->getNumSamples(dt);
+  Eigen::MatrixXd positions(sampler->dof(), num_samples);
+  Eigen::MatrixXd velocities(sampler->dof(), num_samples);
+  Eigen::MatrixXd accelerations(sampler->dof(), num_samples);
+  for (auto _ : state)
+  {
+    sampler->reset();
+    sampler->sampleUniform(0, dt, positions, velocities, accelerations);
+    benchmark::DoNotOptimize(positions.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * num_samples);
+}
+
+struct Step
+{
+  double path_pos{ 0 };
+  double time{ 0 };
+};
+
+/** @brief The previous trajectory storage, a list of steps searched linearly for every lookup by path position */
+static void BM_TOTGListSegmentLookup(benchmark::State& state)
+{
+  const auto num_steps = static_cast<std::size_t>(state.range(0));
+  std::list<Step> steps;
+  for (std::size_t i = 0; i < num_steps; ++i)
+    steps.push_back({ static_cast<double>(i), 0.001 * static_cast<double>(i) });
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < num_steps; ++i)
+    {
+      const double pos = static_cast<double>(i) + 0.5;
+      auto it = steps.begin();
+      while (it != steps.end() && !(pos < it->path_pos))
+        ++it;
+
+      benchmark::DoNotOptimize(it);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+/** @brief The current trajectory storage, a vector of steps searched using a binary search */
+static void BM_TOTGVectorSegmentLookup(benchmark::State& state)
+{
+  const auto num_steps = static_cast<std::size_t>(state.range(0));
+  std::vector<Step> steps;
+  steps.reserve(num_steps);
+  for (std::size_t i = 0; i < num_steps; ++i)
+    steps.push_back({ static_cast<double>(i), 0.001 * static_cast<double>(i) });
+
+  for (auto _ : state)
+  {
+    for (std::size_t i = 0; i < num_steps; ++i)
+    {
+      const double pos = static_cast<double>(i) + 0.5;
+      auto it = std::upper_bound(
+          steps.begin(), steps.end(), pos, [](double value, const Step& step) { return value < step.path_pos; });
+
+      benchmark::DoNotOptimize(it);
+    }
+  }
+  state.SetItemsProcessed(static_cast<int64_t>(state.iterations()) * state.range(0));
+}
+
+BENCHMARK(BM_TOTGComputeTimeStamps)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TOTGComputeTimeStampsDense)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TOTGSampleTrajectory)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectorySamplerSequential)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TrajectorySamplerUniform)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TOTGListSegmentLookup)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TOTGVectorSegmentLookup)->RangeMultiplier(10)->Range(1000, 100000)->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -43,8 +43,11 @@
 #include <tesseract_command_language/state_waypoint.h>
 #include <tesseract_command_language/move_instruction.h>
 #include <tesseract_time_parameterization/core/instructions_trajectory.h>
+#include <tesseract_time_parameterization/core/dense_trajectory.h>
+#include <tesseract_time_parameterization/core/trajectory_sampler.h>
 
 using tesseract_planning::CompositeInstruction;
+using tesseract_planning::DenseTrajectory;
 using tesseract_planning::InstructionsTrajectory;
 using tesseract_planning::MoveInstruction;
 using tesseract_planning::MoveInstructionPoly;
@@ -52,7 +55,9 @@ using tesseract_planning::MoveInstructionType;
 using tesseract_planning::StateWaypoint;
 using tesseract_planning::StateWaypointPoly;
 using tesseract_planning::TimeOptimalTrajectoryGeneration;
+using tesseract_planning::TOTGTrajectorySampler;
 using tesseract_planning::TrajectoryContainer;
+using tesseract_planning::TrajectorySampler;
 using tesseract_planning::totg::Path;
 using tesseract_planning::totg::PathData;
 using tesseract_planning::totg::Trajectory;
@@ -328,6 +333,50 @@ TEST(time_optimal_trajectory_generation, testCommandLanguageInterface)  // NOLIN
   EXPECT_TRUE(solver.computeTimeStamps(traj_wrapper, max_velocities, max_accelerations, 1.0, 1.0));
 }
 
+TEST(time_optimal_trajectory_generation, testRandomAccessSampling)  // NOLINT
+{
+  std::vector<Eigen::VectorXd> waypoints;
+  for (int i = 0; i < 50; ++i)
+  {
+    Eigen::VectorXd waypoint(3);
+    waypoint << 0.05 * i, 0.3 * std::sin(0.2 * i), 0.3 * std::cos(0.2 * i);
+    waypoints.push_back(waypoint);
+  }
+
+  Eigen::VectorXd max_velocities = Eigen::VectorXd::Constant(3, 1.0);
+  Eigen::VectorXd max_accelerations = Eigen::VectorXd::Constant(3, 1.0);
+
+  Trajectory trajectory(Path(waypoints, 0.01), max_velocities, max_accelerations, 0.001);
+  ASSERT_TRUE(trajectory.isValid());
+
+  // The list and vector constructors must produce the same path
+  std::list<Eigen::VectorXd> waypoints_list(waypoints.begin(), waypoints.end());
+  Trajectory trajectory_list(Path(waypoints_list, 0.01), max_velocities, max_accelerations, 0.001);
+  ASSERT_TRUE(trajectory_list.isValid());
+  EXPECT_DOUBLE_EQ(trajectory.getDuration(), trajectory_list.getDuration());
+
+  // Sampling in reverse order must match sampling in forward order
+  const double duration = trajectory.getDuration();
+  std::vector<Eigen::VectorXd> forward;
+  for (int i = 0; i <= 100; ++i)
+    forward.push_back(trajectory.getPosition(trajectory.getPathData(duration * i / 100.0)));
+
+  for (int i = 100; i >= 0; --i)
+  {
+    Eigen::VectorXd position = trajectory.getPosition(trajectory.getPathData(duration * i / 100.0));
+    EXPECT_TRUE(position.isApprox(forward[static_cast<std::size_t>(i)], 1e-12));
+  }
+
+  // Time lookup by path position must be increasing
+  double prev_time{ 0 };
+  for (double s : Path(waypoints, 0.01).getMapping())
+  {
+    double time = trajectory.getTime(s);
+    EXPECT_GE(time, prev_time);
+    prev_time = time;
+  }
+}
+
 // Initialize one-joint, straight-line trajectory
 CompositeInstruction createStraightTrajectory()
 {
@@ -374,6 +423,153 @@ TEST(time_optimal_trajectory_generation, testTrajectoryContainerInterface)  // N
   runTrajectoryContainerInterfaceTest(0.0001);
 }
 
+TEST(time_optimal_trajectory_generation, testDenseTrajectory)  // NOLINT
+{
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  Eigen::VectorXd max_acceleration(6);
+  max_acceleration << 1, 1, 1, 1, 1, 1;
+
+  CompositeInstruction expected_program = createStraightTrajectory();
+  InstructionsTrajectory expected_trajectory(expected_program);
+  EXPECT_TRUE(solver.computeTimeStamps(expected_trajectory, max_velocity, max_acceleration));
+
+  CompositeInstruction program = createStraightTrajectory();
+  DenseTrajectory trajectory(program);
+  EXPECT_TRUE(solver.computeTimeStamps(trajectory, max_velocity, max_acceleration));
+  trajectory.assign(program);
+
+  // Both containers give the same result
+  ASSERT_EQ(trajectory.size(), expected_trajectory.size());
+  InstructionsTrajectory assigned_trajectory(program);
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    EXPECT_TRUE(trajectory.getPosition(i).isApprox(expected_trajectory.getPosition(i), 1e-12));
+    EXPECT_TRUE(trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_TRUE(trajectory.getAcceleration(i).isApprox(expected_trajectory.getAcceleration(i), 1e-12));
+    EXPECT_NEAR(trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+    EXPECT_TRUE(assigned_trajectory.getVelocity(i).isApprox(expected_trajectory.getVelocity(i), 1e-12));
+    EXPECT_NEAR(assigned_trajectory.getTimeFromStart(i), expected_trajectory.getTimeFromStart(i), 1e-12);
+  }
+}
+
+TEST(time_optimal_trajectory_generation, testTrajectorySampler)  // NOLINT
+{
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+  CompositeInstruction program = createStraightTrajectory();
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  Eigen::VectorXd max_acceleration(6);
+  max_acceleration << 1, 1, 1, 1, 1, 1;
+  DenseTrajectory trajectory(program);
+  ASSERT_TRUE(solver.computeTimeStamps(trajectory, max_velocity, max_acceleration));
+
+  TrajectorySampler sampler(trajectory);
+  EXPECT_EQ(sampler.dof(), 6);
+  EXPECT_NEAR(sampler.getStartTime(), 0, 1e-12);
+  EXPECT_NEAR(sampler.getDuration(), trajectory.getTimeFromStart(trajectory.size() - 1), 1e-12);
+
+  // The samples at the waypoint times are the waypoints
+  Eigen::VectorXd position(6);
+  Eigen::VectorXd velocity(6);
+  Eigen::VectorXd acceleration(6);
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    sampler.sample(trajectory.getTimeFromStart(i), position, velocity, acceleration);
+    EXPECT_TRUE(position.isApprox(trajectory.getPosition(i), 1e-8));
+    EXPECT_TRUE(velocity.isApprox(trajectory.getVelocity(i), 1e-8));
+  }
+
+  // Sampling out of order gives the same result as sampling in order
+  const double dt = 0.001;
+  const Eigen::Index num_samples = sampler.getNumSamples(dt);
+  EXPECT_EQ(num_samples, static_cast<Eigen::Index>(std::floor(sampler.getDuration() / dt)) + 1);
+  Eigen::MatrixXd positions(6, num_samples);
+  Eigen::MatrixXd velocities(6, num_samples);
+  Eigen::MatrixXd accelerations(6, num_samples);
+  sampler.sampleUniform(0, dt, positions, velocities, accelerations);
+  for (Eigen::Index i = num_samples - 1; i >= 0; i -= 97)
+  {
+    sampler.sample(static_cast<double>(i) * dt, position, velocity, acceleration);
+    EXPECT_TRUE(position.isApprox(positions.col(i), 1e-12));
+    EXPECT_TRUE(velocity.isApprox(velocities.col(i), 1e-12));
+  }
+
+  // Times outside of the trajectory are clamped
+  sampler.sample(sampler.getEndTime() + 1.0, position, velocity, acceleration);
+  EXPECT_TRUE(position.isApprox(trajectory.getPosition(trajectory.size() - 1), 1e-8));
+  sampler.sample(-1.0, position, velocity, acceleration);
+  EXPECT_TRUE(position.isApprox(trajectory.getPosition(0), 1e-8));
+
+  EXPECT_ANY_THROW(sampler.getNumSamples(0));  // NOLINT
+}
+
+TEST(time_optimal_trajectory_generation, testTOTGTrajectorySampler)  // NOLINT
+{
+  TimeOptimalTrajectoryGeneration solver(0.001, 1e-3);
+  CompositeInstruction program = createStraightTrajectory();
+  Eigen::VectorXd max_velocity(6);
+  max_velocity << 2.088, 2.082, 3.27, 3.6, 3.3, 3.078;
+  Eigen::VectorXd max_acceleration(6);
+  max_acceleration << 1, 1, 1, 1, 1, 1;
+  DenseTrajectory trajectory(program);
+  std::shared_ptr<const Trajectory> parameterized;
+  ASSERT_TRUE(solver.computeTimeStamps(trajectory, max_velocity, max_acceleration, 1.0, 1.0, parameterized));
+  ASSERT_TRUE(parameterized != nullptr);
+
+  TOTGTrajectorySampler sampler(parameterized, 6);
+  EXPECT_EQ(sampler.dof(), 6);
+  EXPECT_NEAR(sampler.getStartTime(), 0, 1e-12);
+  EXPECT_NEAR(sampler.getDuration(), trajectory.getTimeFromStart(trajectory.size() - 1), 1e-12);
+
+  // The samples at the waypoint times are the waypoints
+  Eigen::VectorXd position(6);
+  Eigen::VectorXd velocity(6);
+  Eigen::VectorXd acceleration(6);
+  for (Eigen::Index i = 0; i < trajectory.size(); ++i)
+  {
+    sampler.sample(trajectory.getTimeFromStart(i), position, velocity, acceleration);
+    EXPECT_TRUE(position.isApprox(trajectory.getPosition(i), 1e-6));
+    EXPECT_TRUE(velocity.isApprox(trajectory.getVelocity(i), 1e-8));
+  }
+
+  // The samples are the time optimal trajectory without the dummy joint, so they respect the limits
+  const double dt = 0.001;
+  const Eigen::Index num_samples = sampler.getNumSamples(dt);
+  Eigen::MatrixXd positions(6, num_samples);
+  Eigen::MatrixXd velocities(6, num_samples);
+  Eigen::MatrixXd accelerations(6, num_samples);
+  sampler.sampleUniform(0, dt, positions, velocities, accelerations);
+  for (Eigen::Index i = 0; i < num_samples; ++i)
+  {
+    const PathData path_data = parameterized->getPathData(static_cast<double>(i) * dt);
+    EXPECT_TRUE(positions.col(i).isApprox(parameterized->getPosition(path_data).head(6), 1e-12));
+    EXPECT_TRUE((velocities.col(i).array().abs() <= max_velocity.array() + 1e-6).all());
+    EXPECT_TRUE((accelerations.col(i).array().abs() <= max_acceleration.array() + 1e-6).all());
+  }
+
+  // Times outside of the trajectory are clamped
+  sampler.sample(sampler.getEndTime() + 1.0, position, velocity, acceleration);
+  EXPECT_TRUE(position.isApprox(trajectory.getPosition(trajectory.size() - 1), 1e-6));
+
+  EXPECT_ANY_THROW(sampler.getNumSamples(0));                 // NOLINT
+  EXPECT_ANY_THROW(TOTGTrajectorySampler(parameterized, 8));  // NOLINT
+  EXPECT_ANY_THROW(TOTGTrajectorySampler(nullptr, 6));        // NOLINT
+
+  // A trajectory with a single distinct waypoint has no time optimal trajectory
+  std::vector<std::string> joint_names = { "joint_1", "joint_2", "joint_3", "joint_4", "joint_5", "joint_6" };
+  CompositeInstruction single_program;
+  for (int i = 0; i < 2; ++i)
+  {
+    StateWaypointPoly swp{ StateWaypoint(joint_names, Eigen::VectorXd::Zero(6)) };
+    single_program.appendMoveInstruction(MoveInstruction(swp, MoveInstructionType::FREESPACE));
+  }
+  InstructionsTrajectory single_trajectory(single_program);
+  EXPECT_TRUE(solver.computeTimeStamps(single_trajectory, max_velocity, max_acceleration, 1.0, 1.0, parameterized));
+  EXPECT_TRUE(parameterized == nullptr);
+}
+
 int main(int argc, char** argv)
 {
   testing::InitGoogleTest(&argc, argv);